@@ -45,11 +45,14 @@ const char* SC::AsyncRequest::TypeToString(Type type)
     case Type::SocketConnect: return "SocketConnect";
     case Type::SocketSend: return "SocketSend";
     case Type::SocketReceive: return "SocketReceive";
+    case Type::SocketSendTo: return "SocketSendTo";
+    case Type::SocketReceiveFrom: return "SocketReceiveFrom";
     case Type::SocketClose: return "SocketClose";
     case Type::FileRead: return "FileRead";
     case Type::FileWrite: return "FileWrite";
     case Type::FileClose: return "FileClose";
     case Type::FilePoll: return "FilePoll";
+    case Type::FileSystemOperation: return "FileSystemOperation";
     }
     Assert::unreachable();
 }
@@ -327,6 +330,86 @@ SC::Result SC::AsyncSocketReceive::validate(AsyncEventLoop&)
     return SC::Result(true);
 }
 
+SC::Result SC::AsyncSocketSendTo::start(AsyncEventLoop& eventLoop, const SocketDescriptor& descriptor,
+                                        SocketIPAddress address, Span<const char> data)
+{
+    SC_TRY(descriptor.get(handle, SC::Result::Error("Invalid handle")));
+    ipAddress    = address;
+    buffer       = data;
+    singleBuffer = true;
+    return eventLoop.start(*this);
+}
+
+SC::Result SC::AsyncSocketSendTo::start(AsyncEventLoop& eventLoop, const SocketDescriptor& descriptor,
+                                        SocketIPAddress address, Span<Span<const char>> data)
+{
+    SC_TRY(descriptor.get(handle, SC::Result::Error("Invalid handle")));
+    ipAddress    = address;
+    buffers      = data;
+    singleBuffer = false;
+    return eventLoop.start(*this);
+}
+
+SC::Result SC::AsyncSocketSendTo::validate(AsyncEventLoop&)
+{
+    SC_TRY_MSG(handle != SocketDescriptor::Invalid, "AsyncSocketSendTo - Invalid handle");
+    SC_TRY_MSG(ipAddress.isValid(), "AsyncSocketSendTo - Invalid ipaddress");
+    if (singleBuffer)
+    {
+        SC_TRY_MSG(buffer.sizeInBytes() > 0, "AsyncSocketSendTo - Zero sized write buffer");
+    }
+    else
+    {
+        SC_TRY_MSG(buffers.sizeInBytes() > 0, "AsyncSocketSendTo - Zero sized write buffers");
+    }
+#if not SC_PLATFORM_LINUX
+    SC_TRY_MSG(segmentSize == 0, "AsyncSocketSendTo - segmentSize (UDP GSO) is supported only on Linux");
+#endif
+    numDatagramsSent = 0;
+    totalBytesSent   = 0;
+    return SC::Result(true);
+}
+
+SC::Result SC::AsyncSocketReceiveFrom::start(AsyncEventLoop& eventLoop, const SocketDescriptor& descriptor,
+                                             Span<char> data)
+{
+    SC_TRY(descriptor.get(handle, SC::Result::Error("Invalid handle")));
+    buffer    = data;
+    datagrams = {};
+    return eventLoop.start(*this);
+}
+
+SC::Result SC::AsyncSocketReceiveFrom::start(AsyncEventLoop& eventLoop, const SocketDescriptor& descriptor,
+                                             Span<char> data, Span<Datagram> datagramSlots)
+{
+    SC_TRY(descriptor.get(handle, SC::Result::Error("Invalid handle")));
+    buffer    = data;
+    datagrams = datagramSlots;
+    return eventLoop.start(*this);
+}
+
+SC::Result SC::AsyncSocketReceiveFrom::validate(AsyncEventLoop&)
+{
+    SC_TRY_MSG(handle != SocketDescriptor::Invalid, "AsyncSocketReceiveFrom - Invalid handle");
+    SC_TRY_MSG(buffer.sizeInBytes() >= getDatagrams().sizeInElements(), "AsyncSocketReceiveFrom - Buffer too small");
+#if not SC_PLATFORM_LINUX
+    SC_TRY_MSG(not genericReceiveOffload, "AsyncSocketReceiveFrom - UDP GRO is supported only on Linux");
+#endif
+    return SC::Result(true);
+}
+
+SC::Span<SC::AsyncSocketReceiveFrom::Datagram> SC::AsyncSocketReceiveFrom::getDatagrams()
+{
+    return datagrams.empty() ? Span<Datagram>(singleDatagram) : datagrams;
+}
+
+SC::Span<char> SC::AsyncSocketReceiveFrom::getDatagramSlot(size_t index)
+{
+    const size_t numSlots = datagrams.empty() ? 1 : datagrams.sizeInElements();
+    const size_t slotSize = buffer.sizeInBytes() / numSlots;
+    return {buffer.data() + index * slotSize, slotSize};
+}
+
 SC::Result SC::AsyncSocketClose::start(AsyncEventLoop& eventLoop, const SocketDescriptor& descriptor)
 {
     SC_TRY(checkState());
@@ -413,6 +496,100 @@ SC::Result SC::AsyncFilePoll::validate(AsyncEventLoop&)
     SC_TRY_MSG(handle != FileDescriptor::Invalid, "AsyncFilePoll - Invalid file descriptor");
     return SC::Result(true);
 }
+
+SC::Result SC::AsyncFileSystemOperation::open(AsyncEventLoop& eventLoop, const native_char_t* filePath, OpenMode mode)
+{
+    SC_TRY(checkState());
+    operation = Operation::Open;
+    path      = filePath;
+    openMode  = mode;
+    return eventLoop.start(*this);
+}
+
+SC::Result SC::AsyncFileSystemOperation::sync(AsyncEventLoop& eventLoop, FileDescriptor::Handle fileDescriptor,
+                                              bool onlyData)
+{
+    SC_TRY(checkState());
+    operation = Operation::Sync;
+    handle    = fileDescriptor;
+    dataOnly  = onlyData;
+    return eventLoop.start(*this);
+}
+
+SC::Result SC::AsyncFileSystemOperation::allocate(AsyncEventLoop& eventLoop, FileDescriptor::Handle fileDescriptor,
+                                                  uint64_t fileOffset, uint64_t fileLength)
+{
+    SC_TRY(checkState());
+    operation = Operation::Allocate;
+    handle    = fileDescriptor;
+    offset    = fileOffset;
+    length    = fileLength;
+    return eventLoop.start(*this);
+}
+
+SC::Result SC::AsyncFileSystemOperation::stat(AsyncEventLoop& eventLoop, const native_char_t* filePath)
+{
+    SC_TRY(checkState());
+    operation = Operation::Stat;
+    path      = filePath;
+    return eventLoop.start(*this);
+}
+
+SC::Result SC::AsyncFileSystemOperation::removeFile(AsyncEventLoop& eventLoop, const native_char_t* filePath)
+{
+    SC_TRY(checkState());
+    operation = Operation::RemoveFile;
+    path      = filePath;
+    return eventLoop.start(*this);
+}
+
+SC::Result SC::AsyncFileSystemOperation::rename(AsyncEventLoop& eventLoop, const native_char_t* filePath,
+                                                const native_char_t* newFilePath)
+{
+    SC_TRY(checkState());
+    operation = Operation::Rename;
+    path      = filePath;
+    newPath   = newFilePath;
+    return eventLoop.start(*this);
+}
+
+SC::Result SC::AsyncFileSystemOperation::makeDirectory(AsyncEventLoop& eventLoop, const native_char_t* directoryPath)
+{
+    SC_TRY(checkState());
+    operation = Operation::MakeDirectory;
+    path      = directoryPath;
+    return eventLoop.start(*this);
+}
+
+SC::Result SC::AsyncFileSystemOperation::validate(AsyncEventLoop& eventLoop)
+{
+    switch (operation)
+    {
+    case Operation::None: return SC::Result::Error("AsyncFileSystemOperation - No operation has been started");
+    case Operation::Sync:
+    case Operation::Allocate:
+        SC_TRY_MSG(handle != FileDescriptor::Invalid, "AsyncFileSystemOperation - Invalid file descriptor");
+        break;
+    case Operation::Open:
+    case Operation::Stat:
+    case Operation::RemoveFile:
+    case Operation::MakeDirectory:
+    case Operation::Rename:
+        SC_TRY_MSG(path != nullptr and path[0] != 0, "AsyncFileSystemOperation - Invalid path");
+        if (operation == Operation::Rename)
+        {
+            SC_TRY_MSG(newPath != nullptr and newPath[0] != 0, "AsyncFileSystemOperation - Invalid new path");
+        }
+        break;
+    }
+
+    // Only use the async tasks for operations and backends that are not io_uring
+    if (not eventLoop.internal.kernelQueue.get().makesSenseToRunInThreadPool(*this))
+    {
+        disableThreadPool();
+    }
+    return SC::Result(true);
+}
 //-------------------------------------------------------------------------------------------------------
 // AsyncEventLoop
 //-------------------------------------------------------------------------------------------------------
@@ -605,11 +782,14 @@ void SC::AsyncEventLoop::enumerateRequests(Function<void(AsyncRequest&)> enumera
     internal.enumerateRequests(internal.activeSocketConnects, enumerationCallback);
     internal.enumerateRequests(internal.activeSocketSends, enumerationCallback);
     internal.enumerateRequests(internal.activeSocketReceives, enumerationCallback);
+    internal.enumerateRequests(internal.activeSocketSendTos, enumerationCallback);
+    internal.enumerateRequests(internal.activeSocketReceiveFroms, enumerationCallback);
     internal.enumerateRequests(internal.activeSocketCloses, enumerationCallback);
     internal.enumerateRequests(internal.activeFileReads, enumerationCallback);
     internal.enumerateRequests(internal.activeFileWrites, enumerationCallback);
     internal.enumerateRequests(internal.activeFileCloses, enumerationCallback);
     internal.enumerateRequests(internal.activeFilePolls, enumerationCallback);
+    internal.enumerateRequests(internal.activeFileSystemOperations, enumerationCallback);
     internal.enumerateRequests(internal.manualCompletions, enumerationCallback);
 }
 
@@ -787,8 +967,79 @@ void SC::AsyncEventLoop::Internal::clearSequence(AsyncSequence& sequence)
     }
 }
 
+void SC::AsyncEventLoop::Internal::linkSequence(AsyncEventLoop& eventLoop, AsyncRequest& head)
+{
+    // Requests already queued after head are staged immediately after it, so that the backend can submit all of them
+    // as a single chain of linked kernel submissions, started in order by the kernel itself.
+    AsyncSequence& sequence    = *head.sequence;
+    KernelQueue&   kernelQueue = eventLoop.internal.kernelQueue.get();
+    if ((head.flags & Flag_LinkedToPrevious) != 0 or not kernelQueue.canLinkRequest(head))
+    {
+        return;
+    }
+    AsyncRequest* last = nullptr;
+    for (AsyncRequest* it = sequence.submissions.front; it != nullptr; it = it->next)
+    {
+        if (not kernelQueue.canLinkRequest(*it))
+        {
+            break; // This one and following ones will be started after the chain will be completed
+        }
+        last = it;
+    }
+    if (last == nullptr)
+    {
+        return;
+    }
+    head.flags |= Flag_LinkedRequest;
+    sequence.numberOfLinked = 1;
+    while (last != nullptr)
+    {
+        AsyncRequest* previous = last->prev;
+        sequence.submissions.remove(*last);
+        last->flags |= Flag_LinkedRequest | Flag_LinkedToPrevious;
+        submissions.queueFront(*last);
+        numberOfSubmissions += 1;
+        sequence.numberOfLinked += 1;
+        last = previous;
+    }
+    if (sequence.submissions.isEmpty())
+    {
+        clearSequence(sequence);
+    }
+}
+
+void SC::AsyncEventLoop::Internal::releaseLinkedRequest(AsyncRequest& async)
+{
+    if ((async.flags & Flag_LinkedRequest) != 0)
+    {
+        async.flags &= ~(Flag_LinkedRequest | Flag_LinkedToPrevious);
+        AsyncSequence& sequence = *async.sequence;
+        sequence.numberOfLinked -= 1;
+        // Next requests of the sequence can be started only after all requests of the chain have been completed
+        sequence.runningAsync = sequence.numberOfLinked > 0;
+    }
+}
+
 SC::AsyncLoopTimeout* SC::AsyncEventLoop::Internal::findEarliestLoopTimeout() const { return activeLoopTimeouts.front; }
 
+const SC::Time::Absolute* SC::AsyncEventLoop::Internal::findEarliestExpirationTime() const
+{
+    const Time::Absolute* earliest = nullptr;
+    if (activeLoopTimeouts.front)
+    {
+        earliest = &activeLoopTimeouts.front->expirationTime;
+    }
+    if (activeDeadlines.front)
+    {
+        const Time::Absolute& deadline = activeDeadlines.front->expirationTime;
+        if (earliest == nullptr or earliest->isLaterThan(deadline))
+        {
+            earliest = &deadline;
+        }
+    }
+    return earliest;
+}
+
 void SC::AsyncEventLoop::Internal::invokeExpiredTimers(AsyncEventLoop& eventLoop, Time::Absolute currentTime)
 {
     AsyncLoopTimeout* async = activeLoopTimeouts.front;
@@ -824,6 +1075,101 @@ void SC::AsyncEventLoop::Internal::invokeExpiredTimers(AsyncEventLoop& eventLoop
     }
 }
 
+SC::detail::AsyncDeadline* SC::AsyncEventLoop::Internal::getDeadline(AsyncRequest& async, Time::Milliseconds& timeout)
+{
+    switch (async.type)
+    {
+    case AsyncRequest::Type::SocketConnect: {
+        AsyncSocketConnect& connect = static_cast<AsyncSocketConnect&>(async);
+        timeout                     = connect.timeout;
+        return &connect.deadline;
+    }
+    case AsyncRequest::Type::SocketSend: {
+        AsyncSocketSend& send = static_cast<AsyncSocketSend&>(async);
+        timeout               = send.timeout;
+        return &send.deadline;
+    }
+    case AsyncRequest::Type::SocketReceive: {
+        AsyncSocketReceive& receive = static_cast<AsyncSocketReceive&>(async);
+        timeout                     = receive.timeout;
+        return &receive.deadline;
+    }
+    case AsyncRequest::Type::FileRead: {
+        // Blocking reads and writes executed on a thread pool can't be interrupted
+        AsyncFileRead& read = static_cast<AsyncFileRead&>(async);
+        timeout             = read.timeout;
+        return (read.flags & Flag_AsyncTaskSequence) != 0 ? nullptr : &read.deadline;
+    }
+    case AsyncRequest::Type::FileWrite: {
+        AsyncFileWrite& write = static_cast<AsyncFileWrite&>(async);
+        timeout               = write.timeout;
+        return (write.flags & Flag_AsyncTaskSequence) != 0 ? nullptr : &write.deadline;
+    }
+    default: return nullptr;
+    }
+}
+
+void SC::AsyncEventLoop::Internal::addDeadline(AsyncRequest& async)
+{
+    Time::Milliseconds     timeout;
+    detail::AsyncDeadline* deadline = getDeadline(async, timeout);
+    if (deadline == nullptr or timeout.ms <= 0 or (async.flags & Flag_KernelDeadline) != 0)
+    {
+        return; // No timeout or already enforced by the kernel
+    }
+    deadline->request        = &async;
+    deadline->expirationTime = loopTime.offsetBy(timeout);
+
+    // Deadlines needs to be ordered. Searching from the back is O(1) when all requests use the same timeout, and
+    // isLaterThan ensures items with same expiration time to be sub-ordered by their scheduling order.
+    detail::AsyncDeadline* iterator = activeDeadlines.back;
+    while (iterator and iterator->expirationTime.isLaterThan(deadline->expirationTime))
+    {
+        iterator = iterator->prev;
+    }
+    if (iterator == nullptr)
+    {
+        activeDeadlines.queueFront(*deadline);
+    }
+    else if (iterator == activeDeadlines.back)
+    {
+        activeDeadlines.queueBack(*deadline);
+    }
+    else
+    {
+        deadline->prev       = iterator;
+        deadline->next       = iterator->next;
+        iterator->next->prev = deadline;
+        iterator->next       = deadline;
+    }
+}
+
+void SC::AsyncEventLoop::Internal::removeDeadline(AsyncRequest& async)
+{
+    Time::Milliseconds     timeout;
+    detail::AsyncDeadline* deadline = getDeadline(async, timeout);
+    if (deadline != nullptr and deadline->request != nullptr)
+    {
+        activeDeadlines.remove(*deadline);
+        deadline->request = nullptr;
+    }
+}
+
+void SC::AsyncEventLoop::Internal::invokeExpiredDeadlines(AsyncEventLoop& eventLoop)
+{
+    while (activeDeadlines.front and loopTime.isLaterThanOrEqualTo(activeDeadlines.front->expirationTime))
+    {
+        // Stopping the request removes its deadline, cancelling it as usual on next submission.
+        // Instead of the close callback, its callback is then invoked by executeCancellationCallbacks with an error.
+        AsyncRequest& async = *activeDeadlines.front->request;
+        async.flags |= Flag_TimedOut;
+        if (not stop(eventLoop, async, nullptr))
+        {
+            removeDeadline(async); // Should not happen, as only active requests have a deadline
+        }
+    }
+}
+
 template <typename T>
 void SC::AsyncEventLoop::Internal::stopRequests(AsyncEventLoop& eventLoop, IntrusiveDoubleLinkedList<T>& linkedList)
 {
@@ -915,11 +1261,14 @@ SC::Result SC::AsyncEventLoop::Internal::close(AsyncEventLoop& eventLoop)
     stopRequests(eventLoop, activeSocketConnects);
     stopRequests(eventLoop, activeSocketSends);
     stopRequests(eventLoop, activeSocketReceives);
+    stopRequests(eventLoop, activeSocketSendTos);
+    stopRequests(eventLoop, activeSocketReceiveFroms);
     stopRequests(eventLoop, activeSocketCloses);
     stopRequests(eventLoop, activeFileReads);
     stopRequests(eventLoop, activeFileWrites);
     stopRequests(eventLoop, activeFileCloses);
     stopRequests(eventLoop, activeFilePolls);
+    stopRequests(eventLoop, activeFileSystemOperations);
 
     stopRequests(eventLoop, manualCompletions);
 
@@ -1028,9 +1377,13 @@ SC::Result SC::AsyncEventLoop::Internal::runStep(AsyncEventLoop& eventLoop, Sync
 void SC::AsyncEventLoop::Internal::pushToCancellationQueue(AsyncRequest& async)
 {
     SC_ASSERT_RELEASE(async.isCancelling());
-    if (async.sequence and async.sequence->clearSequenceOnCancel)
+    if (async.sequence)
     {
-        clearSequence(*async.sequence);
+        releaseLinkedRequest(async);
+        if (async.sequence->clearSequenceOnCancel)
+        {
+            clearSequence(*async.sequence);
+        }
     }
     cancellations.queueBack(async);
 }
@@ -1038,18 +1391,32 @@ void SC::AsyncEventLoop::Internal::pushToCancellationQueue(AsyncRequest& async)
 SC::Result SC::AsyncEventLoop::Internal::submitRequests(AsyncEventLoop& eventLoop, AsyncKernelEvents& asyncKernelEvents)
 {
     KernelEvents kernelEvents(eventLoop.internal.kernelQueue.get(), asyncKernelEvents);
+    // Kernel events memory is not zeroed, as backends only read the numberOfEvents entries written by the kernel
     asyncKernelEvents.numberOfEvents = 0;
-    // TODO: Check if it's possible to avoid zeroing kernel events memory
-    memset(asyncKernelEvents.eventsMemory.data(), 0, asyncKernelEvents.eventsMemory.sizeInBytes());
     SC_LOG_MESSAGE("---------------\n");
 
     updateTime();
+    AsyncSequence* failedChain = nullptr; // Sequence whose linked chain has been broken by a failed request
     while (AsyncRequest* async = submissions.dequeueFront())
     {
         numberOfSubmissions -= 1;
-        auto res = stageSubmission(eventLoop, kernelEvents, *async);
+        Result res = Result(true);
+        if (async->sequence and failedChain == async->sequence and (async->flags & Flag_LinkedToPrevious) != 0)
+        {
+            res = Result::Error("Previous linked request failed");
+        }
+        else
+        {
+            if (async->sequence and async->sequence->linkInKernel and async->state == AsyncRequest::State::Setup)
+            {
+                linkSequence(eventLoop, *async);
+            }
+            res = stageSubmission(eventLoop, kernelEvents, *async);
+        }
         if (not res)
         {
+            const bool breaksChain = (async->flags & Flag_LinkedRequest) != 0 and async->sequence->clearSequenceOnError;
+            failedChain            = breaksChain ? async->sequence : nullptr;
             reportError(eventLoop, kernelEvents, *async, res, -1);
         }
     }
@@ -1069,12 +1436,15 @@ SC::Result SC::AsyncEventLoop::Internal::blockingPoll(AsyncEventLoop& eventLoop,
     SC_ASSERT_RELEASE(numActiveHandles >= 0);
     if (numActiveHandles > 0 or numberOfManualCompletions != 0 or hasPendingKernelCancellations)
     {
-        hasPendingKernelCancellations = false;
+        const bool waitKernelCancellations = hasPendingKernelCancellations;
+        hasPendingKernelCancellations      = false;
         // We may have some manualCompletions queued (for SocketClose for example) but no active handles
         SC_LOG_MESSAGE("Active Requests Before Poll = {}\n", getTotalNumberOfActiveHandle());
 
-        // If there are manual completions the loop can't block waiting for I/O, to dispatch them immediately
-        const bool canBlockForIO = numberOfManualCompletions == 0;
+        // If there are manual completions the loop can't block waiting for I/O, to dispatch them immediately.
+        // The same applies to cancellations not waiting for the kernel (like the ones of expired deadlines on Posix).
+        const bool canBlockForIO =
+            numberOfManualCompletions == 0 and (cancellations.isEmpty() or waitKernelCancellations);
         SC_TRY(kernelEvents.syncWithKernel(eventLoop, canBlockForIO ? syncMode : SyncMode::NoWait));
         SC_LOG_MESSAGE("Active Requests After Poll = {}\n", getTotalNumberOfActiveHandle());
     }
@@ -1116,6 +1486,7 @@ SC::Result SC::AsyncEventLoop::Internal::dispatchCompletions(AsyncEventLoop& eve
     runStepExecuteCompletions(eventLoop, kernelEvents);
     runStepExecuteManualCompletions(eventLoop, kernelEvents);
     runStepExecuteManualThreadPoolCompletions(eventLoop, kernelEvents);
+    invokeExpiredDeadlines(eventLoop); // After completions, to let requests completing in time win over deadlines
     executeCancellationCallbacks(eventLoop);
 
     SC_LOG_MESSAGE("Active Requests After Completion = {} ( + {} manual)\n", getTotalNumberOfActiveHandle(),
@@ -1123,6 +1494,26 @@ SC::Result SC::AsyncEventLoop::Internal::dispatchCompletions(AsyncEventLoop& eve
     return SC::Result(true);
 }
 
+struct SC::AsyncEventLoop::Internal::TimeoutAsyncPhase
+{
+    AsyncEventLoop& eventLoop;
+
+    template <typename T>
+    SC::Result operator()(T& async)
+    {
+        SC::Result         returnCode = SC::Result::Error("Timed out");
+        typename T::Result result(eventLoop, async, returnCode);
+        result.timedOut = true;
+
+        auto callback = async.callback; // copy callback to allow it releasing the request
+        if (callback.isValid())
+        {
+            callback(result);
+        }
+        return SC::Result(true);
+    }
+};
+
 void SC::AsyncEventLoop::Internal::executeCancellationCallbacks(AsyncEventLoop& eventLoop)
 {
     AsyncRequest* async = cancellations.front;
@@ -1130,9 +1521,15 @@ void SC::AsyncEventLoop::Internal::executeCancellationCallbacks(AsyncEventLoop&
     {
         AsyncRequest* next = async->next;
         SC_ASSERT_RELEASE(async->state == AsyncRequest::State::Cancelling);
+        const bool timedOut = (async->flags & Flag_TimedOut) != 0;
         async->markAsFree();
         cancellations.remove(*async);
-        if (async->closeCallback)
+        if (timedOut)
+        {
+            // Requests stopped by invokeExpiredDeadlines report the timeout to their own callback
+            (void)applyOnAsync(*async, TimeoutAsyncPhase{eventLoop});
+        }
+        else if (async->closeCallback)
         {
             Function<void(AsyncResult&)>& closeCallback = *async->closeCallback;
 
@@ -1186,7 +1583,7 @@ void SC::AsyncEventLoop::Internal::runStepExecuteCompletions(AsyncEventLoop& eve
         const int32_t eventIndex = static_cast<int32_t>(idx);
 
         AsyncRequest& async  = *request;
-        Result        result = Result(kernelEvents.validateEvent(idx, continueProcessing));
+        Result        result = Result(kernelEvents.validateEvent(eventLoop, idx, continueProcessing));
         if (not result)
         {
             reportError(eventLoop, kernelEvents, async, result, eventIndex);
@@ -1347,6 +1744,10 @@ struct SC::AsyncEventLoop::Internal::CompleteAsyncPhase
                 result.returnCode = Result(kernelEvents.completeAsync(result));
             }
         }
+        // Requests failed by an io_uring linked timeout are flagged by KernelEvents::validateEvent
+        result.timedOut = (async.flags & AsyncEventLoop::Internal::Flag_TimedOut) != 0;
+        async.flags &= ~AsyncEventLoop::Internal::Flag_TimedOut;
+
         auto callback = result.getAsync().callback; // copy callback to allow it releasing the request
         if (result.shouldCallCallback and callback.isValid())
         {
@@ -1382,6 +1783,7 @@ void SC::AsyncEventLoop::Internal::prepareTeardown(AsyncEventLoop& eventLoop, As
     case AsyncRequest::Type::ProcessExit:
 #if SC_PLATFORM_LINUX
         (void)static_cast<AsyncProcessExit&>(async).pidFd.get(teardown.fileHandle, Result::Error("missing pidfd"));
+        static_cast<AsyncProcessExit&>(async).pidFd.detach(); // Closed by teardownAsync, and request can be reused
 #endif
         teardown.processHandle = static_cast<AsyncProcessExit&>(async).handle;
         break;
@@ -1391,6 +1793,8 @@ void SC::AsyncEventLoop::Internal::prepareTeardown(AsyncEventLoop& eventLoop, As
     case AsyncRequest::Type::SocketConnect: teardown.socketHandle = static_cast<AsyncSocketConnect&>(async).handle; break;
     case AsyncRequest::Type::SocketSend:    teardown.socketHandle = static_cast<AsyncSocketSend&>(async).handle; break;
     case AsyncRequest::Type::SocketReceive: teardown.socketHandle = static_cast<AsyncSocketReceive&>(async).handle; break;
+    case AsyncRequest::Type::SocketSendTo:  teardown.socketHandle = static_cast<AsyncSocketSendTo&>(async).handle; break;
+    case AsyncRequest::Type::SocketReceiveFrom: teardown.socketHandle = static_cast<AsyncSocketReceiveFrom&>(async).handle; break;
     case AsyncRequest::Type::SocketClose:   teardown.socketHandle = static_cast<AsyncSocketClose&>(async).handle; break;
 
     // File
@@ -1398,6 +1802,7 @@ void SC::AsyncEventLoop::Internal::prepareTeardown(AsyncEventLoop& eventLoop, As
     case AsyncRequest::Type::FileWrite:     teardown.fileHandle = static_cast<AsyncFileWrite&>(async).handle; break;
     case AsyncRequest::Type::FileClose:     teardown.fileHandle = static_cast<AsyncFileClose&>(async).handle; break;
     case AsyncRequest::Type::FilePoll:      teardown.fileHandle = static_cast<AsyncFilePoll&>(async).handle; break;
+    case AsyncRequest::Type::FileSystemOperation: break;
     }
     // clang-format on
 }
@@ -1416,6 +1821,7 @@ SC::Result SC::AsyncEventLoop::Internal::activateAsync(AsyncEventLoop& eventLoop
 {
     SC_LOG_MESSAGE("{} {} ACTIVATE\n", async.debugName, AsyncRequest::TypeToString(async.type));
     SC_ASSERT_RELEASE(async.state == AsyncRequest::State::Submitting);
+    async.flags &= ~Flag_KernelDeadline; // Set again by backends linking a kernel timeout to this activation
     SC_TRY(Internal::applyOnAsync(async, ActivateAsyncPhase{eventLoop, kernelEvents}));
     addActiveHandle(async);
     return Result(true);
@@ -1451,6 +1857,12 @@ SC::Result SC::AsyncEventLoop::Internal::teardownAsync(AsyncTeardown& teardown)
     case AsyncRequest::Type::SocketReceive:
         SC_TRY(KernelEvents::teardownAsync(static_cast<AsyncSocketReceive*>(nullptr), teardown));
         break;
+    case AsyncRequest::Type::SocketSendTo:
+        SC_TRY(KernelEvents::teardownAsync(static_cast<AsyncSocketSendTo*>(nullptr), teardown));
+        break;
+    case AsyncRequest::Type::SocketReceiveFrom:
+        SC_TRY(KernelEvents::teardownAsync(static_cast<AsyncSocketReceiveFrom*>(nullptr), teardown));
+        break;
     case AsyncRequest::Type::SocketClose:
         SC_TRY(KernelEvents::teardownAsync(static_cast<AsyncSocketClose*>(nullptr), teardown));
         break;
@@ -1466,6 +1878,9 @@ SC::Result SC::AsyncEventLoop::Internal::teardownAsync(AsyncTeardown& teardown)
     case AsyncRequest::Type::FilePoll:
         SC_TRY(KernelEvents::teardownAsync(static_cast<AsyncFilePoll*>(nullptr), teardown));
         break;
+    case AsyncRequest::Type::FileSystemOperation:
+        SC_TRY(KernelEvents::teardownAsync(static_cast<AsyncFileSystemOperation*>(nullptr), teardown));
+        break;
     }
 
     if ((teardown.flags & Internal::Flag_ExcludeFromActiveCount) != 0)
@@ -1483,6 +1898,10 @@ void SC::AsyncEventLoop::Internal::reportError(AsyncEventLoop& eventLoop, Kernel
     {
         removeActiveHandle(async);
     }
+    else if (async.sequence)
+    {
+        releaseLinkedRequest(async);
+    }
     if (async.sequence and async.sequence->clearSequenceOnError)
     {
         clearSequence(*async.sequence);
@@ -1619,10 +2038,12 @@ void SC::AsyncEventLoop::Internal::removeActiveHandle(AsyncRequest& async)
 {
     SC_ASSERT_RELEASE(async.state == AsyncRequest::State::Active);
     async.state = AsyncRequest::State::Free;
+    removeDeadline(async);
 
     if (async.sequence)
     {
         async.sequence->runningAsync = false;
+        releaseLinkedRequest(async);
     }
 
     if ((async.flags & Internal::Flag_ManualCompletion) != 0)
@@ -1648,11 +2069,14 @@ void SC::AsyncEventLoop::Internal::removeActiveHandle(AsyncRequest& async)
         case AsyncRequest::Type::SocketConnect: activeSocketConnects.remove(*static_cast<AsyncSocketConnect*>(&async)); break;
         case AsyncRequest::Type::SocketSend:    activeSocketSends.remove(*static_cast<AsyncSocketSend*>(&async));       break;
         case AsyncRequest::Type::SocketReceive: activeSocketReceives.remove(*static_cast<AsyncSocketReceive*>(&async)); break;
+        case AsyncRequest::Type::SocketSendTo:  activeSocketSendTos.remove(*static_cast<AsyncSocketSendTo*>(&async));   break;
+        case AsyncRequest::Type::SocketReceiveFrom: activeSocketReceiveFroms.remove(*static_cast<AsyncSocketReceiveFrom*>(&async)); break;
         case AsyncRequest::Type::SocketClose:   activeSocketCloses.remove(*static_cast<AsyncSocketClose*>(&async));     break;
         case AsyncRequest::Type::FileRead:      activeFileReads.remove(*static_cast<AsyncFileRead*>(&async));           break;
         case AsyncRequest::Type::FileWrite:     activeFileWrites.remove(*static_cast<AsyncFileWrite*>(&async));         break;
         case AsyncRequest::Type::FileClose:     activeFileCloses.remove(*static_cast<AsyncFileClose*>(&async));         break;
         case AsyncRequest::Type::FilePoll:      activeFilePolls.remove(*static_cast<AsyncFilePoll*>(&async));           break;
+        case AsyncRequest::Type::FileSystemOperation: activeFileSystemOperations.remove(*static_cast<AsyncFileSystemOperation*>(&async)); break;
     }
     // clang-format on
 }
@@ -1669,6 +2093,7 @@ void SC::AsyncEventLoop::Internal::addActiveHandle(AsyncRequest& async)
     }
 
     numberOfActiveHandles += 1;
+    addDeadline(async);
 
     if (async.sequence)
     {
@@ -1724,11 +2149,14 @@ void SC::AsyncEventLoop::Internal::addActiveHandle(AsyncRequest& async)
     case AsyncRequest::Type::SocketConnect: activeSocketConnects.queueBack(*static_cast<AsyncSocketConnect*>(&async));  break;
     case AsyncRequest::Type::SocketSend:    activeSocketSends.queueBack(*static_cast<AsyncSocketSend*>(&async));        break;
     case AsyncRequest::Type::SocketReceive: activeSocketReceives.queueBack(*static_cast<AsyncSocketReceive*>(&async));  break;
+    case AsyncRequest::Type::SocketSendTo:  activeSocketSendTos.queueBack(*static_cast<AsyncSocketSendTo*>(&async));    break;
+    case AsyncRequest::Type::SocketReceiveFrom: activeSocketReceiveFroms.queueBack(*static_cast<AsyncSocketReceiveFrom*>(&async)); break;
     case AsyncRequest::Type::SocketClose:   activeSocketCloses.queueBack(*static_cast<AsyncSocketClose*>(&async));      break;
     case AsyncRequest::Type::FileRead:      activeFileReads.queueBack(*static_cast<AsyncFileRead*>(&async));            break;
     case AsyncRequest::Type::FileWrite:     activeFileWrites.queueBack(*static_cast<AsyncFileWrite*>(&async));          break;
     case AsyncRequest::Type::FileClose:     activeFileCloses.queueBack(*static_cast<AsyncFileClose*>(&async));          break;
     case AsyncRequest::Type::FilePoll: 	    activeFilePolls.queueBack(*static_cast<AsyncFilePoll*>(&async));            break;
+    case AsyncRequest::Type::FileSystemOperation: activeFileSystemOperations.queueBack(*static_cast<AsyncFileSystemOperation*>(&async)); break;
     }
     // clang-format on
 }
@@ -1752,11 +2180,16 @@ SC::Result SC::AsyncEventLoop::Internal::applyOnAsync(AsyncRequest& async, Lambd
     case AsyncRequest::Type::SocketConnect: SC_TRY(lambda(*static_cast<AsyncSocketConnect*>(&async))); break;
     case AsyncRequest::Type::SocketSend: SC_TRY(lambda(*static_cast<AsyncSocketSend*>(&async))); break;
     case AsyncRequest::Type::SocketReceive: SC_TRY(lambda(*static_cast<AsyncSocketReceive*>(&async))); break;
+    case AsyncRequest::Type::SocketSendTo: SC_TRY(lambda(*static_cast<AsyncSocketSendTo*>(&async))); break;
+    case AsyncRequest::Type::SocketReceiveFrom: SC_TRY(lambda(*static_cast<AsyncSocketReceiveFrom*>(&async))); break;
     case AsyncRequest::Type::SocketClose: SC_TRY(lambda(*static_cast<AsyncSocketClose*>(&async))); break;
     case AsyncRequest::Type::FileRead: SC_TRY(lambda(*static_cast<AsyncFileRead*>(&async))); break;
     case AsyncRequest::Type::FileWrite: SC_TRY(lambda(*static_cast<AsyncFileWrite*>(&async))); break;
     case AsyncRequest::Type::FileClose: SC_TRY(lambda(*static_cast<AsyncFileClose*>(&async))); break;
     case AsyncRequest::Type::FilePoll: SC_TRY(lambda(*static_cast<AsyncFilePoll*>(&async))); break;
+    case AsyncRequest::Type::FileSystemOperation:
+        SC_TRY(lambda(*static_cast<AsyncFileSystemOperation*>(&async)));
+        break;
     }
     return SC::Result(true);
 }
@@ -1790,10 +2223,13 @@ void SC::detail::AsyncCompletionVariant::destroy()
     case AsyncRequest::Type::SocketConnect: dtor(completionDataSocketConnect); break;
     case AsyncRequest::Type::SocketSend: dtor(completionDataSocketSend); break;
     case AsyncRequest::Type::SocketReceive: dtor(completionDataSocketReceive); break;
+    case AsyncRequest::Type::SocketSendTo: dtor(completionDataSocketSendTo); break;
+    case AsyncRequest::Type::SocketReceiveFrom: dtor(completionDataSocketReceiveFrom); break;
     case AsyncRequest::Type::SocketClose: dtor(completionDataSocketClose); break;
     case AsyncRequest::Type::FileRead: dtor(completionDataFileRead); break;
     case AsyncRequest::Type::FileWrite: dtor(completionDataFileWrite); break;
     case AsyncRequest::Type::FileClose: dtor(completionDataFileClose); break;
     case AsyncRequest::Type::FilePoll: dtor(completionDataFilePoll); break;
+    case AsyncRequest::Type::FileSystemOperation: dtor(completionDataFileSystemOperation); break;
     }
 }
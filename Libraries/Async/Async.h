@@ -51,12 +51,26 @@ struct EventObject;
 namespace SC
 {
 struct AsyncEventLoop;
+struct AsyncRequest;
 struct AsyncResult;
 struct AsyncSequence;
 struct AsyncTaskSequence;
 
 namespace detail
 {
+/// @brief Expiration time of a request started with a timeout, linked in the event loop list of deadlines
+struct AsyncDeadline
+{
+    AsyncDeadline* next = nullptr;
+    AsyncDeadline* prev = nullptr;
+
+    AsyncRequest*  request = nullptr;
+    Time::Absolute expirationTime;
+#if SC_PLATFORM_LINUX
+    AlignedStorage<16> kernelTimeout; // __kernel_timespec of the io_uring linked timeout
+#endif
+};
+
 struct AsyncWinOverlapped;
 struct AsyncWinOverlappedDefinition
 {
@@ -138,19 +152,23 @@ struct AsyncRequest
     /// @brief Type of async request
     enum class Type : uint8_t
     {
-        LoopTimeout,   ///< Request is an AsyncLoopTimeout object
-        LoopWakeUp,    ///< Request is an AsyncLoopWakeUp object
-        LoopWork,      ///< Request is an AsyncLoopWork object
-        ProcessExit,   ///< Request is an AsyncProcessExit object
-        SocketAccept,  ///< Request is an AsyncSocketAccept object
-        SocketConnect, ///< Request is an AsyncSocketConnect object
-        SocketSend,    ///< Request is an AsyncSocketSend object
-        SocketReceive, ///< Request is an AsyncSocketReceive object
-        SocketClose,   ///< Request is an AsyncSocketClose object
-        FileRead,      ///< Request is an AsyncFileRead object
-        FileWrite,     ///< Request is an AsyncFileWrite object
-        FileClose,     ///< Request is an AsyncFileClose object
-        FilePoll,      ///< Request is an AsyncFilePoll object
+        LoopTimeout,       ///< Request is an AsyncLoopTimeout object
+        LoopWakeUp,        ///< Request is an AsyncLoopWakeUp object
+        LoopWork,          ///< Request is an AsyncLoopWork object
+        ProcessExit,       ///< Request is an AsyncProcessExit object
+        SocketAccept,      ///< Request is an AsyncSocketAccept object
+        SocketConnect,     ///< Request is an AsyncSocketConnect object
+        SocketSend,        ///< Request is an AsyncSocketSend object
+        SocketReceive,     ///< Request is an AsyncSocketReceive object
+        SocketSendTo,      ///< Request is an AsyncSocketSendTo object
+        SocketReceiveFrom, ///< Request is an AsyncSocketReceiveFrom object
+        SocketClose,       ///< Request is an AsyncSocketClose object
+        FileRead,          ///< Request is an AsyncFileRead object
+        FileWrite,         ///< Request is an AsyncFileWrite object
+        FileClose,         ///< Request is an AsyncFileClose object
+        FilePoll,          ///< Request is an AsyncFilePoll object
+
+        FileSystemOperation, ///< Request is an AsyncFileSystemOperation object
     };
 
     /// @brief Constructs a free async request of given type
@@ -233,19 +251,32 @@ struct AsyncRequest
 /// @brief Execute AsyncRequests serially, by submitting the next one after the previous one is completed.
 /// Requests are being queued on a sequence using AsyncRequest::executeOn.
 /// AsyncTaskSequence can be used to force running asyncs on a thread (useful for buffered files)
+///
+/// Setting AsyncSequence::linkInKernel submits all requests queued in the same loop iteration as a single chain of
+/// linked io_uring submissions (`IOSQE_IO_LINK`, or `IOSQE_IO_HARDLINK` when AsyncSequence::clearSequenceOnError is
+/// `false`), so that the kernel starts each one as soon as the previous completes, without waking up the event loop
+/// between them (for example read-then-send or write-then-fsync).
+/// Callbacks are still invoked for every request of the chain. @n
+/// When a request of a chain fails, following ones fail too (with `IOSQE_IO_LINK`), as the kernel cancels them. @n
+/// Requests that are not completed by a single kernel submission (loop timeouts, wake-ups, works, process exits,
+/// zero-copy and multi-datagram sends, multi-datagram receives) are never linked and they run after the chain.
+/// All other backends ignore AsyncSequence::linkInKernel, emulating the same ordering in user-space.
 /// \snippet Tests/Libraries/Async/AsyncTest.cpp AsyncFileWriteSnippet
 struct AsyncSequence
 {
     AsyncSequence* next = nullptr;
     AsyncSequence* prev = nullptr;
 
-    bool clearSequenceOnCancel = true; ///< Do not queue next requests in the sequence when current one is cancelled
-    bool clearSequenceOnError  = true; ///< Do not queue next requests in the sequence when current one returns error
+    bool clearSequenceOnCancel = true;  ///< Do not queue next requests in the sequence when current one is cancelled
+    bool clearSequenceOnError  = true;  ///< Do not queue next requests in the sequence when current one returns error
+    bool linkInKernel          = false; ///< Submit queued requests as a chain of linked io_uring submissions
   private:
     friend struct AsyncEventLoop;
     bool runningAsync = false; // true if an async from this sequence is being run
     bool tracked      = false;
 
+    uint32_t numberOfLinked = 0; // Requests of the linked chain being run by the kernel that are not completed yet
+
     IntrusiveDoubleLinkedList<AsyncRequest> submissions;
 };
 
@@ -270,6 +301,9 @@ struct AsyncResult
     /// @brief Check if the returnCode of this result is valid
     [[nodiscard]] const SC::Result& isValid() const { return returnCode; }
 
+    /// @brief Check if the request failed because its timeout expired before completion
+    [[nodiscard]] bool isTimedOut() const { return timedOut; }
+
     AsyncEventLoop& eventLoop;
     AsyncRequest&   async;
 
@@ -277,6 +311,7 @@ struct AsyncResult
     friend struct AsyncEventLoop;
 
     bool  shouldCallCallback = true;
+    bool  timedOut           = false;
     bool* hasBeenReactivated = nullptr;
 
     SC::Result& returnCode;
@@ -484,6 +519,8 @@ struct AsyncSocketAccept : public detail::AsyncSocketAcceptBase
 /// SC::SocketFlags::NonBlocking and associated to the event loop with
 /// SC::AsyncEventLoop::associateExternallyCreatedSocket. @n
 /// Alternatively SC::AsyncEventLoop::createAsyncTCPSocket creates and associates the socket to the loop.
+/// @note Setting SC::AsyncSocketConnect::timeout fails the request with SC::AsyncResult::isTimedOut if the socket is
+/// not connected in time.
 ///
 /// \snippet Tests/Libraries/Async/AsyncTest.cpp AsyncSocketConnectSnippet
 struct AsyncSocketConnect : public AsyncRequest
@@ -502,10 +539,14 @@ struct AsyncSocketConnect : public AsyncRequest
     SocketDescriptor::Handle handle = SocketDescriptor::Invalid;
     SocketIPAddress          ipAddress;
 
+    Time::Milliseconds timeout; ///< Fail with SC::AsyncResult::isTimedOut if not connected in time (0 == no timeout)
+
   private:
     friend struct AsyncEventLoop;
     SC::Result validate(AsyncEventLoop&);
 
+    detail::AsyncDeadline deadline;
+
 #if SC_PLATFORM_WINDOWS
     void (*pConnectEx)() = nullptr;
     detail::WinOverlappedOpaque overlapped;
@@ -519,13 +560,25 @@ struct AsyncSocketConnect : public AsyncRequest
 /// SC::AsyncEventLoop::associateExternallyCreatedSocket or though AsyncSocketAccept. @n
 /// Alternatively SC::AsyncEventLoop::createAsyncTCPSocket creates and associates the socket to the loop.
 ///
+/// Setting SC::AsyncSocketSend::zeroCopy enables zero-copy sends on Linux (`MSG_ZEROCOPY` on epoll and
+/// `IORING_OP_SEND_ZC` on io_uring, that needs Linux 6.0), where the kernel keeps reading from the passed in buffers
+/// after they have been sent. In such case callback can be invoked twice: first with
+/// SC::AsyncSocketSend::CompletionData::bufferReusable == `false` when all data has been sent and then with
+/// SC::AsyncSocketSend::CompletionData::bufferReusable == `true` when buffers can be modified again.
+/// A single callback with `bufferReusable == true` is invoked when the kernel releases buffers immediately.
+/// @warning Stopping a zero-copy send doesn't stop the kernel from reading its buffers (or io_uring from posting the
+/// release notification for the request), so both must stay alive until the `bufferReusable == true` callback.
+/// @note Setting SC::AsyncSocketSend::timeout fails the request with SC::AsyncResult::isTimedOut if data has not
+/// been sent in time (for example because the remote endpoint is not reading it).
+///
 /// \snippet Tests/Libraries/Async/AsyncTest.cpp AsyncSocketSendSnippet
 struct AsyncSocketSend : public AsyncRequest
 {
     AsyncSocketSend() : AsyncRequest(Type::SocketSend) {}
     struct CompletionData : public AsyncCompletionData
     {
-        size_t numBytes = 0;
+        size_t numBytes       = 0;
+        bool   bufferReusable = true; ///< `false` if kernel is still reading from buffers (zero-copy sends)
     };
     using Result = AsyncResultOf<AsyncSocketSend, CompletionData>;
     using AsyncRequest::start;
@@ -544,13 +597,25 @@ struct AsyncSocketSend : public AsyncRequest
     Span<Span<const char>> buffers;             ///< Spans of bytes to send (singleBuffer == false)
     bool                   singleBuffer = true; ///< Controls if buffer or buffers will be used
 
+    bool zeroCopy = false; ///< Send without copying buffers to kernel (Linux only, ignored on other platforms)
+
+    Time::Milliseconds timeout; ///< Fail with SC::AsyncResult::isTimedOut if not sent in time (0 == no timeout)
+
   private:
     friend struct AsyncEventLoop;
     SC::Result validate(AsyncEventLoop&);
 
+    detail::AsyncDeadline deadline;
+
     size_t totalBytesWritten = 0;
 #if SC_PLATFORM_WINDOWS
     detail::WinOverlappedOpaque overlapped;
+#elif SC_PLATFORM_LINUX
+    bool     zeroCopyEnabled = false; // SO_ZEROCOPY has been successfully set on the socket
+    bool     zeroCopyWaiting = false; // All data has been sent, waiting for kernel to release buffers
+    uint32_t zeroCopyPending = 0;     // Number of zero-copy sends whose buffers have not yet been released
+
+    AlignedStorage<56> zeroCopyMessage; // msghdr for io_uring IORING_OP_SENDMSG_ZC
 #endif
 };
 
@@ -563,6 +628,8 @@ struct AsyncSocketSend : public AsyncRequest
 ///
 /// Additional notes:
 /// - SC::AsyncSocketReceive::CompletionData::disconnected will be set to true when client disconnects
+/// - Setting SC::AsyncSocketReceive::timeout fails the request with SC::AsyncResult::isTimedOut if no data arrives
+///   in time (useful to implement read or idle deadlines of network protocols)
 ///
 /// \snippet Tests/Libraries/Async/AsyncTest.cpp AsyncSocketReceiveSnippet
 struct AsyncSocketReceive : public AsyncRequest
@@ -597,14 +664,166 @@ struct AsyncSocketReceive : public AsyncRequest
     Span<char>               buffer; ///< The writeable span of memory where to data will be written
     SocketDescriptor::Handle handle = SocketDescriptor::Invalid; /// The Socket Descriptor handle to read data from.
 
+    Time::Milliseconds timeout; ///< Fail with SC::AsyncResult::isTimedOut if no data is received (0 == no timeout)
+
   private:
     friend struct AsyncEventLoop;
     SC::Result validate(AsyncEventLoop&);
+
+    detail::AsyncDeadline deadline;
 #if SC_PLATFORM_WINDOWS
     detail::WinOverlappedOpaque overlapped;
 #endif
 };
 
+/// @brief Starts a socket send to operation, sending one or more datagrams to a given remote endpoint.
+/// Callback will be called when all datagrams have been sent. @n
+/// @ref library_socket library can be used to create a Socket but the socket should be created with
+/// SC::SocketFlags::NonBlocking and associated to the event loop with
+/// SC::AsyncEventLoop::associateExternallyCreatedSocket. @n
+/// Alternatively SC::AsyncEventLoop::createAsyncUDPSocket creates and associates the socket to the loop.
+///
+/// Additional notes:
+/// - Passing a Span of buffers sends one datagram for each buffer, moving up to 64 datagrams per syscall
+///   where the OS allows it (`sendmmsg` on Linux)
+/// - SC::AsyncSocketSendTo::segmentSize enables UDP Generic Segmentation Offload (Linux only), letting the kernel
+///   split each buffer in datagrams of `segmentSize` bytes
+///
+/// \snippet Tests/Libraries/Async/AsyncTest.cpp AsyncSocketSendToSnippet
+struct AsyncSocketSendTo : public AsyncRequest
+{
+    AsyncSocketSendTo() : AsyncRequest(Type::SocketSendTo) {}
+    struct CompletionData : public AsyncCompletionData
+    {
+        size_t numBytes     = 0; ///< Total number of bytes sent
+        size_t numDatagrams = 0; ///< Number of buffers sent (each one as a single datagram or GSO batch)
+    };
+    using Result = AsyncResultOf<AsyncSocketSendTo, CompletionData>;
+    using AsyncRequest::start;
+
+    /// @brief Sets async request members and calls AsyncEventLoop::start
+    SC::Result start(AsyncEventLoop& eventLoop, const SocketDescriptor& descriptor, SocketIPAddress address,
+                     Span<const char> data);
+
+    /// @brief Sets async request members and calls AsyncEventLoop::start
+    SC::Result start(AsyncEventLoop& eventLoop, const SocketDescriptor& descriptor, SocketIPAddress address,
+                     Span<Span<const char>> data);
+
+    Function<void(Result&)> callback; ///< Called when all datagrams have been sent
+
+    SocketDescriptor::Handle handle = SocketDescriptor::Invalid; ///< The socket to send datagrams with
+    SocketIPAddress          ipAddress;                          ///< The remote endpoint receiving datagrams
+
+    Span<const char>       buffer;              ///< Datagram to send (singleBuffer == true)
+    Span<Span<const char>> buffers;             ///< Datagrams to send (singleBuffer == false)
+    bool                   singleBuffer = true; ///< Controls if buffer or buffers will be used
+
+    uint16_t segmentSize = 0; ///< If > 0 uses UDP GSO to split each buffer in datagrams of this size (Linux only)
+
+  private:
+    friend struct AsyncEventLoop;
+    SC::Result validate(AsyncEventLoop&);
+
+    size_t numDatagramsSent = 0;
+    size_t totalBytesSent   = 0;
+#if SC_PLATFORM_WINDOWS
+    detail::WinOverlappedOpaque overlapped;
+#elif SC_PLATFORM_LINUX
+    AlignedStorage<96> message; // msghdr, iovec and control data for io_uring
+#endif
+};
+
+/// @brief Starts a socket receive from operation, receiving one or more datagrams and their sender addresses.
+/// Callback will be called when at least one datagram has been received. @n
+/// @ref library_socket library can be used to create a Socket but the socket should be created with
+/// SC::SocketFlags::NonBlocking and associated to the event loop with
+/// SC::AsyncEventLoop::associateExternallyCreatedSocket. @n
+/// Alternatively SC::AsyncEventLoop::createAsyncUDPSocket creates and associates the socket to the loop.
+///
+/// Additional notes:
+/// - Passing a Span of SC::AsyncSocketReceiveFrom::Datagram splits the buffer in equally sized slots, receiving up
+///   to one datagram per slot with a single syscall where the OS allows it (`recvmmsg` on Linux).
+///   Only a single datagram is received per completion on other OS.
+/// - SC::AsyncSocketReceiveFrom::genericReceiveOffload enables UDP Generic Receive Offload (Linux only), where the
+///   kernel can coalesce multiple datagrams of SC::AsyncSocketReceiveFrom::Datagram::segmentSize in a single one
+///
+/// \snippet Tests/Libraries/Async/AsyncTest.cpp AsyncSocketReceiveFromSnippet
+struct AsyncSocketReceiveFrom : public AsyncRequest
+{
+    AsyncSocketReceiveFrom() : AsyncRequest(Type::SocketReceiveFrom) {}
+
+    /// @brief A received datagram with the address of its sender
+    struct Datagram
+    {
+        Span<char>      data;            ///< Received bytes (a slice of the slot reserved in the buffer)
+        SocketIPAddress ipAddress;       ///< Address of the sender
+        uint16_t        segmentSize = 0; ///< Size of coalesced datagrams when using GRO (0 if not coalesced)
+    };
+
+    struct CompletionData : public AsyncCompletionData
+    {
+        size_t numBytes     = 0; ///< Total number of bytes received
+        size_t numDatagrams = 0; ///< Number of datagrams received
+    };
+
+    struct Result : public AsyncResultOf<AsyncSocketReceiveFrom, CompletionData>
+    {
+        using AsyncResultOf<AsyncSocketReceiveFrom, CompletionData>::AsyncResultOf;
+
+        /// @brief Get the received datagram and the address of its sender (when started without datagrams Span)
+        /// @param outData The span of data actually read from socket
+        /// @param outAddress The address of the sender
+        /// @return Valid Result if the data was read without errors
+        SC::Result get(Span<char>& outData, SocketIPAddress& outAddress)
+        {
+            outData    = getAsync().singleDatagram.data;
+            outAddress = getAsync().singleDatagram.ipAddress;
+            return returnCode;
+        }
+
+        /// @brief Get all datagrams received in this completion
+        /// @param outDatagrams Span of datagrams received (a prefix of AsyncSocketReceiveFrom::datagrams)
+        /// @return Valid Result if the data was read without errors
+        SC::Result get(Span<Datagram>& outDatagrams)
+        {
+            SC_TRY(getAsync().getDatagrams().sliceStartLength(0, completionData.numDatagrams, outDatagrams));
+            return returnCode;
+        }
+    };
+    using AsyncRequest::start;
+
+    /// @brief Sets async request members and calls AsyncEventLoop::start
+    SC::Result start(AsyncEventLoop& eventLoop, const SocketDescriptor& descriptor, Span<char> data);
+
+    /// @brief Sets async request members and calls AsyncEventLoop::start
+    SC::Result start(AsyncEventLoop& eventLoop, const SocketDescriptor& descriptor, Span<char> data,
+                     Span<Datagram> datagramSlots);
+
+    Function<void(Result&)> callback; ///< Called after one or more datagrams have been received
+
+    SocketDescriptor::Handle handle = SocketDescriptor::Invalid; ///< The socket to receive datagrams from
+
+    Span<char>     buffer;    ///< Memory split in datagrams.sizeInElements() slots receiving datagrams
+    Span<Datagram> datagrams; ///< Datagrams to receive (if empty a single datagram is received in buffer)
+
+    bool genericReceiveOffload = false; ///< Enables UDP GRO (Linux only), set before starting the request
+
+  private:
+    friend struct AsyncEventLoop;
+    SC::Result validate(AsyncEventLoop&);
+
+    Span<Datagram> getDatagrams();
+    Span<char>     getDatagramSlot(size_t index);
+
+    Datagram singleDatagram;
+#if SC_PLATFORM_WINDOWS
+    detail::WinOverlappedOpaque overlapped;
+    int                         addressLength = 0;
+#elif SC_PLATFORM_LINUX
+    AlignedStorage<96> message; // msghdr, iovec and control data for io_uring
+#endif
+};
+
 /// @brief Starts a socket close operation.
 /// Callback will be called when the socket has been fully closed.
 ///
@@ -651,6 +870,9 @@ struct AsyncSocketClose : public AsyncRequest
 /// - When reactivating the AsyncRequest, remember to increment the offset (SC::AsyncFileRead::offset)
 /// - SC::AsyncFileRead::CompletionData::endOfFile signals end of file reached
 /// - `io_uring` backend will not use thread pool because that API allows proper async file read/writes
+/// - Setting SC::AsyncFileRead::timeout fails the request with SC::AsyncResult::isTimedOut if no data is read in time
+///   (for example from a pipe whose writer is idle). It's ignored when executing on a thread pool, as the blocking
+///   read can't be interrupted.
 ///
 /// \snippet Tests/Libraries/Async/AsyncTest.cpp AsyncFileReadSnippet
 struct AsyncFileRead : public AsyncRequest
@@ -680,6 +902,8 @@ struct AsyncFileRead : public AsyncRequest
     FileDescriptor::Handle  handle;   /// The file/pipe descriptor handle to read data from.
     /// Use SC::FileDescriptor or SC::PipeDescriptor to open it.
 
+    Time::Milliseconds timeout; ///< Fail with SC::AsyncResult::isTimedOut if no data is read in time (0 == no timeout)
+
     /// @brief Returns the last offset set with AsyncFileRead::setOffset
     uint64_t getOffset() const { return offset; }
 
@@ -696,6 +920,8 @@ struct AsyncFileRead : public AsyncRequest
     SC::Result validate(AsyncEventLoop&);
     bool       useOffset = false;
     uint64_t   offset    = 0; /// Offset from file start where to start reading. Not supported on pipes.
+
+    detail::AsyncDeadline deadline;
 #if SC_PLATFORM_WINDOWS
     uint64_t                    readCursor = 0;
     detail::WinOverlappedOpaque overlapped;
@@ -718,6 +944,9 @@ struct AsyncFileRead : public AsyncRequest
 /// - Open the file descriptor for non-blocking IO (SC::File::OpenOptions::blocking == `false`)
 /// - Call SC::AsyncEventLoop::associateExternallyCreatedFileDescriptor on the file descriptor
 ///
+/// @note Setting SC::AsyncFileWrite::timeout fails the request with SC::AsyncResult::isTimedOut if data has not been
+/// written in time (for example to a full pipe whose reader is idle). It's ignored when executing on a thread pool.
+///
 /// \snippet Tests/Libraries/Async/AsyncTest.cpp AsyncFileWriteSnippet
 struct AsyncFileWrite : public AsyncRequest
 {
@@ -756,6 +985,8 @@ struct AsyncFileWrite : public AsyncRequest
     Span<Span<const char>> buffers;             ///< The read-only spans of memory where to read the data from
     bool                   singleBuffer = true; ///< Controls if buffer or buffers will be used
 
+    Time::Milliseconds timeout; ///< Fail with SC::AsyncResult::isTimedOut if not written in time (0 == no timeout)
+
     /// @brief Returns the last offset set with AsyncFileWrite::setOffset
     uint64_t getOffset() const { return offset; }
 
@@ -775,6 +1006,8 @@ struct AsyncFileWrite : public AsyncRequest
     bool     useOffset   = false;
     uint64_t offset      = 0xffffffffffffffff; /// Offset to start writing from. Not supported on pipes.
 
+    detail::AsyncDeadline deadline;
+
     size_t totalBytesWritten = 0;
 #if SC_PLATFORM_WINDOWS
     detail::WinOverlappedOpaque overlapped;
@@ -841,6 +1074,102 @@ struct AsyncFilePoll : public AsyncRequest
 #endif
 };
 
+/// @brief Starts a file system operation (open, sync, allocate, stat, remove, rename or make directory).
+/// Callback will be called when the operation has been completed. @n
+///
+/// Operations map to native `io_uring` opcodes (`IORING_OP_OPENAT`, `IORING_OP_FSYNC`, `IORING_OP_FALLOCATE`,
+/// `IORING_OP_STATX`, `IORING_OP_UNLINKAT`, `IORING_OP_RENAMEAT` and `IORING_OP_MKDIRAT`).
+/// All other backends (`epoll`, `kqueue` and `IOCP`) have no async equivalent, so call AsyncRequest::executeOn to run
+/// the blocking syscall on a thread pool, otherwise it will be executed on the event loop thread.
+///
+/// @note Paths must be absolute, null-terminated in native encoding and valid until callback is called.
+///
+/// \snippet Tests/Libraries/Async/AsyncTest.cpp AsyncFileSystemOperationSnippet
+struct AsyncFileSystemOperation : public AsyncRequest
+{
+    AsyncFileSystemOperation() : AsyncRequest(Type::FileSystemOperation) {}
+
+    /// @brief Operation executed by the request
+    enum class Operation : uint8_t
+    {
+        None,          ///< No operation has been started yet
+        Open,          ///< Opens a file (`openat`)
+        Sync,          ///< Flushes file data and metadata (`fsync`) or only data (`fdatasync`) to storage
+        Allocate,      ///< Reserves storage for a range of bytes of a file (`fallocate`)
+        Stat,          ///< Obtains size and last modified time of a file or directory (`statx`)
+        RemoveFile,    ///< Removes a file (`unlinkat`)
+        Rename,        ///< Renames (or moves) a file or directory, replacing the destination (`renameat`)
+        MakeDirectory, ///< Creates a directory (`mkdirat`)
+    };
+
+    /// @brief Mode used to open a file (same semantics of SC::File::OpenMode)
+    enum class OpenMode : uint8_t
+    {
+        ReadOnly,            ///< Opens in read-only mode
+        WriteCreateTruncate, ///< Opens in write mode, creating or truncating it if another file exists
+        WriteAppend,         ///< Opens write mode, appending to existing file
+        ReadAndWrite         ///< Opens file for read / write mode
+    };
+
+    /// @brief Completion data for AsyncFileSystemOperation
+    struct CompletionData : public AsyncCompletionData
+    {
+        FileDescriptor::Handle handle = FileDescriptor::Invalid; ///< File opened by Operation::Open (owned by caller)
+
+        uint64_t       fileSize     = 0;     ///< Size of the file in bytes (Operation::Stat)
+        Time::Realtime modifiedTime = 0;     ///< Time when file was last modified (Operation::Stat)
+        bool           isDirectory  = false; ///< `true` if path is a directory (Operation::Stat)
+    };
+
+    /// @brief Callback result for AsyncFileSystemOperation
+    using Result = AsyncResultOf<AsyncFileSystemOperation, CompletionData>;
+
+    Function<void(Result&)> callback; ///< Called after the operation has been completed
+
+    /// @brief Opens the file at `path` with the given `mode` (result in CompletionData::handle)
+    SC::Result open(AsyncEventLoop& eventLoop, const native_char_t* path, OpenMode mode);
+
+    /// @brief Flushes file data to storage (and also metadata when `dataOnly` is `false`)
+    SC::Result sync(AsyncEventLoop& eventLoop, FileDescriptor::Handle fileDescriptor, bool dataOnly = false);
+
+    /// @brief Reserves storage for `length` bytes starting at `offset`, extending the file size if needed
+    SC::Result allocate(AsyncEventLoop& eventLoop, FileDescriptor::Handle fileDescriptor, uint64_t offset,
+                        uint64_t length);
+
+    /// @brief Obtains size and last modified time of the file or directory at `path`
+    SC::Result stat(AsyncEventLoop& eventLoop, const native_char_t* path);
+
+    /// @brief Removes the file at `path`
+    SC::Result removeFile(AsyncEventLoop& eventLoop, const native_char_t* path);
+
+    /// @brief Renames `path` to `newPath`, atomically replacing `newPath` if it exists
+    SC::Result rename(AsyncEventLoop& eventLoop, const native_char_t* path, const native_char_t* newPath);
+
+    /// @brief Creates a directory at `path` (parent directory must exist)
+    SC::Result makeDirectory(AsyncEventLoop& eventLoop, const native_char_t* path);
+
+    /// @brief Returns the last started operation
+    [[nodiscard]] Operation getOperation() const { return operation; }
+
+  private:
+    friend struct AsyncEventLoop;
+    SC::Result validate(AsyncEventLoop&);
+
+    Operation operation = Operation::None;
+    OpenMode  openMode  = OpenMode::ReadOnly;
+    bool      dataOnly  = false;
+
+    FileDescriptor::Handle handle  = FileDescriptor::Invalid;
+    const native_char_t*   path    = nullptr;
+    const native_char_t*   newPath = nullptr;
+
+    uint64_t offset = 0;
+    uint64_t length = 0;
+#if SC_PLATFORM_LINUX
+    AlignedStorage<256> statxBuffer; // struct statx written by io_uring
+#endif
+};
+
 struct AsyncLoopWork; // forward declared because it must be defined after AsyncTaskSequence
 
 namespace detail
@@ -861,18 +1190,22 @@ struct AsyncCompletionVariant
     union
     {
         AsyncCompletionData completionDataLoopWork; // Defined after AsyncCompletionVariant / AsyncTaskSequence
-        AsyncLoopTimeout::CompletionData   completionDataLoopTimeout;
-        AsyncLoopWakeUp::CompletionData    completionDataLoopWakeUp;
-        AsyncProcessExit::CompletionData   completionDataProcessExit;
-        AsyncSocketAccept::CompletionData  completionDataSocketAccept;
-        AsyncSocketConnect::CompletionData completionDataSocketConnect;
-        AsyncSocketSend::CompletionData    completionDataSocketSend;
-        AsyncSocketReceive::CompletionData completionDataSocketReceive;
-        AsyncSocketClose::CompletionData   completionDataSocketClose;
-        AsyncFileRead::CompletionData      completionDataFileRead;
-        AsyncFileWrite::CompletionData     completionDataFileWrite;
-        AsyncFileClose::CompletionData     completionDataFileClose;
-        AsyncFilePoll::CompletionData      completionDataFilePoll;
+        AsyncLoopTimeout::CompletionData       completionDataLoopTimeout;
+        AsyncLoopWakeUp::CompletionData        completionDataLoopWakeUp;
+        AsyncProcessExit::CompletionData       completionDataProcessExit;
+        AsyncSocketAccept::CompletionData      completionDataSocketAccept;
+        AsyncSocketConnect::CompletionData     completionDataSocketConnect;
+        AsyncSocketSend::CompletionData        completionDataSocketSend;
+        AsyncSocketReceive::CompletionData     completionDataSocketReceive;
+        AsyncSocketSendTo::CompletionData      completionDataSocketSendTo;
+        AsyncSocketReceiveFrom::CompletionData completionDataSocketReceiveFrom;
+        AsyncSocketClose::CompletionData       completionDataSocketClose;
+        AsyncFileRead::CompletionData          completionDataFileRead;
+        AsyncFileWrite::CompletionData         completionDataFileWrite;
+        AsyncFileClose::CompletionData         completionDataFileClose;
+        AsyncFilePoll::CompletionData          completionDataFilePoll;
+
+        AsyncFileSystemOperation::CompletionData completionDataFileSystemOperation;
     };
 
     auto& getCompletion(AsyncLoopWork&) { return completionDataLoopWork; }
@@ -883,11 +1216,14 @@ struct AsyncCompletionVariant
     auto& getCompletion(AsyncSocketConnect&) { return completionDataSocketConnect; }
     auto& getCompletion(AsyncSocketSend&) { return completionDataSocketSend; }
     auto& getCompletion(AsyncSocketReceive&) { return completionDataSocketReceive; }
+    auto& getCompletion(AsyncSocketSendTo&) { return completionDataSocketSendTo; }
+    auto& getCompletion(AsyncSocketReceiveFrom&) { return completionDataSocketReceiveFrom; }
     auto& getCompletion(AsyncSocketClose&) { return completionDataSocketClose; }
     auto& getCompletion(AsyncFileRead&) { return completionDataFileRead; }
     auto& getCompletion(AsyncFileWrite&) { return completionDataFileWrite; }
     auto& getCompletion(AsyncFileClose&) { return completionDataFileClose; }
     auto& getCompletion(AsyncFilePoll&) { return completionDataFilePoll; }
+    auto& getCompletion(AsyncFileSystemOperation&) { return completionDataFileSystemOperation; }
 
     template <typename T>
     auto& construct(T& t)
@@ -985,7 +1321,35 @@ struct AsyncEventLoop
         };
         ApiType apiType; ///< Criteria to choose Async IO API
 
-        Options() { apiType = ApiType::Automatic; }
+        /// @brief (Linux `io_uring` only) Sets `IORING_SETUP_SQPOLL`, where a kernel thread polls the submission
+        /// queue so that submitting requests doesn't need a syscall while the thread is awake.
+        /// @note Cannot be combined with Options::ioURingDeferTaskRun
+        bool ioURingSubmissionPolling;
+
+        /// @brief (Linux `io_uring` only) Sets `IORING_SETUP_SINGLE_ISSUER`, promising the kernel that only the
+        /// thread creating the loop will submit to it (not compatible with SC::AsyncEventLoopMonitor).
+        bool ioURingSingleIssuer;
+
+        /// @brief (Linux `io_uring` only) Sets `IORING_SETUP_DEFER_TASKRUN` (implies Options::ioURingSingleIssuer),
+        /// deferring completion work to the moment the loop asks for completions, improving batching.
+        bool ioURingDeferTaskRun;
+
+        /// @brief (Linux `io_uring` only) Number of submission queue entries (completion queue is twice as large)
+        uint32_t ioURingQueueDepth;
+
+        /// @brief (Linux `io_uring` only) Milliseconds of inactivity before the `SQPOLL` kernel thread goes to sleep
+        uint32_t ioURingSubmissionPollingIdleMs;
+
+        Options()
+        {
+            apiType = ApiType::Automatic;
+
+            ioURingQueueDepth              = 64;
+            ioURingSubmissionPolling       = false;
+            ioURingSubmissionPollingIdleMs = 1000;
+            ioURingSingleIssuer            = false;
+            ioURingDeferTaskRun            = false;
+        }
     };
 
     AsyncEventLoop();
@@ -1133,9 +1497,9 @@ struct AsyncEventLoop
   private:
     struct InternalDefinition
     {
-        static constexpr int Windows = 504;
-        static constexpr int Apple   = 496;
-        static constexpr int Linux   = 704;
+        static constexpr int Windows = 584;
+        static constexpr int Apple   = 576;
+        static constexpr int Linux   = 784;
         static constexpr int Default = Linux;
 
         static constexpr size_t Alignment = 8;
@@ -1153,6 +1517,7 @@ struct AsyncEventLoop
     friend struct AsyncRequest;
     friend struct AsyncFileWrite;
     friend struct AsyncFileRead;
+    friend struct AsyncFileSystemOperation;
     friend struct AsyncResult;
 };
 
@@ -13,6 +13,7 @@ struct SC::AsyncEventLoop::KernelQueue
     Result associateExternallyCreatedSocket(SocketDescriptor&) { return Result(true); }
     Result associateExternallyCreatedFileDescriptor(FileDescriptor&) { return Result(true); }
     Result makesSenseToRunInThreadPool(AsyncRequest&) { return Result(true); }
+    bool   canLinkRequest(AsyncRequest&) { return false; }
 };
 
 struct SC::AsyncEventLoop::KernelEvents
@@ -21,7 +22,7 @@ struct SC::AsyncEventLoop::KernelEvents
     uint32_t getNumEvents() const { return 0; }
 
     Result syncWithKernel(AsyncEventLoop&, Internal::SyncMode) { return Result(true); }
-    Result validateEvent(uint32_t, bool&) { return Result(true); }
+    Result validateEvent(AsyncEventLoop&, uint32_t, bool&) { return Result(true); }
 
     [[nodiscard]] AsyncRequest* getAsyncRequest(uint32_t) const { return nullptr; }
 
@@ -67,19 +67,26 @@ struct SC::AsyncEventLoop::Internal
     IntrusiveDoubleLinkedList<AsyncRequest> cancellations;
 
     // Active phase
-    IntrusiveDoubleLinkedList<AsyncLoopTimeout>   activeLoopTimeouts;
-    IntrusiveDoubleLinkedList<AsyncLoopWakeUp>    activeLoopWakeUps;
-    IntrusiveDoubleLinkedList<AsyncLoopWork>      activeLoopWork;
-    IntrusiveDoubleLinkedList<AsyncProcessExit>   activeProcessExits;
-    IntrusiveDoubleLinkedList<AsyncSocketAccept>  activeSocketAccepts;
-    IntrusiveDoubleLinkedList<AsyncSocketConnect> activeSocketConnects;
-    IntrusiveDoubleLinkedList<AsyncSocketSend>    activeSocketSends;
-    IntrusiveDoubleLinkedList<AsyncSocketReceive> activeSocketReceives;
-    IntrusiveDoubleLinkedList<AsyncSocketClose>   activeSocketCloses;
-    IntrusiveDoubleLinkedList<AsyncFileRead>      activeFileReads;
-    IntrusiveDoubleLinkedList<AsyncFileWrite>     activeFileWrites;
-    IntrusiveDoubleLinkedList<AsyncFileClose>     activeFileCloses;
-    IntrusiveDoubleLinkedList<AsyncFilePoll>      activeFilePolls;
+    IntrusiveDoubleLinkedList<AsyncLoopTimeout>       activeLoopTimeouts;
+    IntrusiveDoubleLinkedList<AsyncLoopWakeUp>        activeLoopWakeUps;
+    IntrusiveDoubleLinkedList<AsyncLoopWork>          activeLoopWork;
+    IntrusiveDoubleLinkedList<AsyncProcessExit>       activeProcessExits;
+    IntrusiveDoubleLinkedList<AsyncSocketAccept>      activeSocketAccepts;
+    IntrusiveDoubleLinkedList<AsyncSocketConnect>     activeSocketConnects;
+    IntrusiveDoubleLinkedList<AsyncSocketSend>        activeSocketSends;
+    IntrusiveDoubleLinkedList<AsyncSocketReceive>     activeSocketReceives;
+    IntrusiveDoubleLinkedList<AsyncSocketSendTo>      activeSocketSendTos;
+    IntrusiveDoubleLinkedList<AsyncSocketReceiveFrom> activeSocketReceiveFroms;
+    IntrusiveDoubleLinkedList<AsyncSocketClose>       activeSocketCloses;
+    IntrusiveDoubleLinkedList<AsyncFileRead>          activeFileReads;
+    IntrusiveDoubleLinkedList<AsyncFileWrite>         activeFileWrites;
+    IntrusiveDoubleLinkedList<AsyncFileClose>         activeFileCloses;
+    IntrusiveDoubleLinkedList<AsyncFilePoll>          activeFilePolls;
+
+    IntrusiveDoubleLinkedList<AsyncFileSystemOperation> activeFileSystemOperations;
+
+    // Deadlines of active requests started with a timeout, ordered by expiration time
+    IntrusiveDoubleLinkedList<detail::AsyncDeadline> activeDeadlines;
 
     // Manual completions
     IntrusiveDoubleLinkedList<AsyncRequest> manualCompletions;
@@ -97,6 +104,10 @@ struct SC::AsyncEventLoop::Internal
     static constexpr int16_t Flag_WatcherSet             = 1 << 3; // An event watcher has been set
     static constexpr int16_t Flag_AsyncTaskSequence      = 1 << 4; // AsyncRequest::sequence is an AsyncTaskSequence
     static constexpr int16_t Flag_AsyncTaskSequenceInUse = 1 << 5; // AsyncTaskSequence must still be waited
+    static constexpr int16_t Flag_LinkedRequest          = 1 << 6; // Part of a chain of kernel linked requests
+    static constexpr int16_t Flag_LinkedToPrevious       = 1 << 7; // Started by kernel after previous of its chain
+    static constexpr int16_t Flag_TimedOut               = 1 << 8; // Failed because its deadline has expired
+    static constexpr int16_t Flag_KernelDeadline         = 1 << 9; // Deadline is enforced by kernel (linked timeout)
 
     Result close(AsyncEventLoop& eventLoop);
 
@@ -109,7 +120,16 @@ struct SC::AsyncEventLoop::Internal
     // Timers
     [[nodiscard]] AsyncLoopTimeout* findEarliestLoopTimeout() const;
 
+    [[nodiscard]] const Time::Absolute* findEarliestExpirationTime() const;
+
     void invokeExpiredTimers(AsyncEventLoop& eventLoop, Time::Absolute currentTime);
+
+    // Deadlines
+    [[nodiscard]] static detail::AsyncDeadline* getDeadline(AsyncRequest& async, Time::Milliseconds& timeout);
+
+    void addDeadline(AsyncRequest& async);
+    void removeDeadline(AsyncRequest& async);
+    void invokeExpiredDeadlines(AsyncEventLoop& eventLoop);
     void updateTime();
 
     Result stop(AsyncEventLoop& eventLoop, AsyncRequest& async, Function<void(AsyncResult&)>* onClose);
@@ -122,6 +142,8 @@ struct SC::AsyncEventLoop::Internal
     void popNextInSequence(AsyncSequence& sequence);
     void resumeSequence(AsyncSequence& sequence);
     void clearSequence(AsyncSequence& sequence);
+    void linkSequence(AsyncEventLoop& eventLoop, AsyncRequest& head);
+    void releaseLinkedRequest(AsyncRequest& async);
 
     // Phases
     Result stageSubmission(AsyncEventLoop& eventLoop, KernelEvents& kernelEvents, AsyncRequest& async);
@@ -135,6 +157,7 @@ struct SC::AsyncEventLoop::Internal
     struct ActivateAsyncPhase;
     struct CancelAsyncPhase;
     struct CompleteAsyncPhase;
+    struct TimeoutAsyncPhase;
     Result completeAndReactivateOrTeardown(AsyncEventLoop& eventLoop, KernelEvents& kernelEvents, AsyncRequest& async,
                                            int32_t eventIndex, Result& returnCode);
 
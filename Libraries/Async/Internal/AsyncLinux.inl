@@ -23,6 +23,9 @@ struct SC::AsyncEventLoop::Internal::KernelQueue
     // On io_uring it doesn't make sense to run operations in a thread pool
     [[nodiscard]] bool makesSenseToRunInThreadPool(AsyncRequest&) { return isEpoll; }
 
+    // Only io_uring can link requests (IOSQE_IO_LINK), epoll sequences are run in user-space
+    [[nodiscard]] bool canLinkRequest(AsyncRequest& async) const;
+
     Result close();
     Result createEventLoop(AsyncEventLoop::Options options);
     Result createSharedWatchers(AsyncEventLoop&);
@@ -50,7 +53,7 @@ struct SC::AsyncEventLoop::Internal::KernelEvents
     [[nodiscard]] uint32_t getNumEvents() const;
 
     Result syncWithKernel(AsyncEventLoop&, Internal::SyncMode);
-    Result validateEvent(uint32_t&, bool&);
+    Result validateEvent(AsyncEventLoop&, uint32_t&, bool&);
 
     [[nodiscard]] AsyncRequest* getAsyncRequest(uint32_t);
 
@@ -85,11 +88,13 @@ bool SC::AsyncEventLoop::tryLoadingLiburing() { return globalLibURing.init(); }
 
 struct SC::AsyncEventLoop::Internal::KernelQueueIoURing
 {
-    static constexpr int QueueDepth = 64;
-
     bool ringInited = false;
     bool timerIsSet = false;
 
+    bool deferTaskRun = false; // Completions need io_uring_enter(IORING_ENTER_GETEVENTS) to be posted
+
+    unsigned numPeekedEvents = 0; // Completions being dispatched in place, still occupying ring slots
+
     io_uring ring;
 
     AsyncFilePoll  wakeUpPoll;
@@ -104,13 +109,14 @@ struct SC::AsyncEventLoop::Internal::KernelQueueIoURing
         SC_TRY(wakeUpEventFd.close());
         if (ringInited)
         {
-            ringInited = false;
+            ringInited      = false;
+            numPeekedEvents = 0;
             globalLibURing.io_uring_queue_exit(&ring);
         }
         return Result(true);
     }
 
-    Result createEventLoop()
+    Result createEventLoop(AsyncEventLoop::Options options)
     {
         if (not globalLibURing.init())
         {
@@ -121,12 +127,43 @@ struct SC::AsyncEventLoop::Internal::KernelQueueIoURing
         {
             return Result::Error("ring already inited");
         }
-        const auto uringFd = globalLibURing.io_uring_queue_init(QueueDepth, &ring, 0);
+        io_uring_params params;
+        memset(&params, 0, sizeof(params));
+        if (options.ioURingSubmissionPolling)
+        {
+            SC_TRY_MSG(not options.ioURingDeferTaskRun, "io_uring SQPOLL cannot be combined with DEFER_TASKRUN");
+            params.flags |= IORING_SETUP_SQPOLL;
+            params.sq_thread_idle = options.ioURingSubmissionPollingIdleMs;
+        }
+        if (options.ioURingSingleIssuer or options.ioURingDeferTaskRun)
+        {
+            params.flags |= IORING_SETUP_SINGLE_ISSUER;
+        }
+        if (options.ioURingDeferTaskRun)
+        {
+            // DEFER_TASKRUN needs io_uring_submit_and_get_events to reap completions when not waiting
+            SC_TRY_MSG(globalLibURing.io_uring_submit_and_get_events != nullptr,
+                       "io_uring DEFER_TASKRUN needs liburing >= 2.3");
+            params.flags |= IORING_SETUP_DEFER_TASKRUN;
+        }
+        const unsigned queueDepth = options.ioURingQueueDepth > 0 ? options.ioURingQueueDepth : 64;
+
+        int uringFd;
+        if (params.flags == 0)
+        {
+            uringFd = globalLibURing.io_uring_queue_init(queueDepth, &ring, 0);
+        }
+        else
+        {
+            SC_TRY_MSG(globalLibURing.io_uring_queue_init_params != nullptr, "io_uring_queue_init_params missing");
+            uringFd = globalLibURing.io_uring_queue_init_params(queueDepth, &ring, &params);
+        }
         if (uringFd < 0)
         {
             return Result::Error("io_uring_setup failed");
         }
-        ringInited = true;
+        ringInited   = true;
+        deferTaskRun = options.ioURingDeferTaskRun;
         return Result(true);
     }
 
@@ -176,6 +213,32 @@ struct SC::AsyncEventLoop::Internal::KernelQueueIoURing
 
     static Result associateExternallyCreatedSocket(SocketDescriptor&) { return Result(true); }
     static Result associateExternallyCreatedFileDescriptor(FileDescriptor&) { return Result(true); }
+
+    // Requests can be linked only if they're completed by exactly one submission (excluding poll based ones)
+    static bool canLinkRequest(AsyncRequest& async)
+    {
+        if ((async.flags & Internal::Flag_AsyncTaskSequence) != 0)
+        {
+            return false;
+        }
+        Time::Milliseconds timeout;
+        if (Internal::getDeadline(async, timeout) != nullptr and timeout.ms > 0)
+        {
+            return false; // Its IORING_OP_LINK_TIMEOUT would be the next submission of the chain
+        }
+        switch (async.type)
+        {
+        case AsyncRequest::Type::LoopTimeout:
+        case AsyncRequest::Type::LoopWakeUp:
+        case AsyncRequest::Type::LoopWork:
+        case AsyncRequest::Type::ProcessExit: return false;
+        case AsyncRequest::Type::SocketSend: return not static_cast<AsyncSocketSend&>(async).zeroCopy;
+        case AsyncRequest::Type::SocketSendTo: return static_cast<AsyncSocketSendTo&>(async).singleBuffer;
+        case AsyncRequest::Type::SocketReceiveFrom:
+            return static_cast<AsyncSocketReceiveFrom&>(async).datagrams.empty();
+        default: return true;
+        }
+    }
 };
 
 struct SC::AsyncEventLoop::Internal::KernelEventsIoURing
@@ -183,27 +246,27 @@ struct SC::AsyncEventLoop::Internal::KernelEventsIoURing
   private:
     KernelEvents& parentKernelEvents;
 
-    io_uring_cqe*  events;
-    io_uring_cqe** eventPointers;
+    io_uring_cqe** events; // Completions are read in place from the ring, until the next syncWithKernel
 
     int&      newEvents;
     const int totalNumEvents;
 
+    uint32_t      numSubmissions = 0;       // Number of submissions obtained with getNewSubmission
+    io_uring_sqe* lastSubmission = nullptr; // Last submission obtained with getNewSubmission
+    io_uring_sqe* linkTail       = nullptr; // Last submission of the chain of linked requests being staged
+    uint32_t      numFlushes     = 0;       // Number of times submissions have been flushed to the kernel
+
   public:
     KernelEventsIoURing(KernelEvents& kq, AsyncKernelEvents& kernelEvents)
         : parentKernelEvents(kq), newEvents(kernelEvents.numberOfEvents),
-          totalNumEvents(static_cast<int>(kernelEvents.eventsMemory.sizeInBytes() /
-                                          (sizeof(io_uring_cqe) + sizeof(io_uring_cqe*))))
+          totalNumEvents(static_cast<int>(kernelEvents.eventsMemory.sizeInBytes() / sizeof(io_uring_cqe*)))
     {
-        // First part of events memory is dedicated to eventPointers, second part to actual events
-        eventPointers = reinterpret_cast<decltype(eventPointers)>(kernelEvents.eventsMemory.data());
-        events        = reinterpret_cast<decltype(events)>(kernelEvents.eventsMemory.data() +
-                                                           totalNumEvents * sizeof(io_uring_cqe*));
+        events = reinterpret_cast<decltype(events)>(kernelEvents.eventsMemory.data());
     }
 
     [[nodiscard]] AsyncRequest* getAsyncRequest(uint32_t idx)
     {
-        io_uring_cqe& completion = events[idx];
+        io_uring_cqe& completion = *events[idx];
         return reinterpret_cast<AsyncRequest*>(globalLibURing.io_uring_cqe_get_data(&completion));
     }
 
@@ -230,75 +293,162 @@ struct SC::AsyncEventLoop::Internal::KernelEventsIoURing
                 return Result::Error("io_uring_get_sqe");
             }
         }
-        newSubmission = kernelSubmission;
+        newSubmission  = kernelSubmission;
+        lastSubmission = kernelSubmission;
+        numSubmissions += 1;
+        return Result(true);
+    }
+
+    // Links an IORING_OP_LINK_TIMEOUT to the submission of a request started with a timeout, so that the kernel
+    // cancels it on expiration without involving the event loop deadlines list
+    Result linkTimeout(AsyncEventLoop& eventLoop, io_uring_sqe* submission, AsyncRequest& async)
+    {
+        Time::Milliseconds     timeout;
+        detail::AsyncDeadline* deadline = Internal::getDeadline(async, timeout);
+        if (deadline == nullptr or timeout.ms <= 0)
+        {
+            return Result(true);
+        }
+        static_assert(sizeof(__kernel_timespec) <= sizeof(deadline->kernelTimeout), "kernelTimeout");
+        __kernel_timespec& kts = deadline->kernelTimeout.reinterpret_as<__kernel_timespec>();
+
+        kts.tv_sec  = timeout.ms / 1000;
+        kts.tv_nsec = (timeout.ms % 1000) * 1000 * 1000;
+
+        const uint32_t previousFlushes = numFlushes;
+        io_uring_sqe*  timeoutSubmission;
+        SC_TRY(getNewSubmission(eventLoop, timeoutSubmission));
+        // Intentionally not calling io_uring_sqe_set_data, as its completion is not needed (like for cancellations)
+        globalLibURing.io_uring_prep_link_timeout(timeoutSubmission, &kts, 0);
+        if (numFlushes == previousFlushes)
+        {
+            submission->flags |= IOSQE_IO_LINK;
+            async.flags |= Internal::Flag_KernelDeadline;
+        }
+        // Otherwise the request has already been submitted to make room in the full submission queue, so the
+        // orphaned link timeout fails harmlessly and the deadline is tracked by the event loop instead.
+        return Result(true);
+    }
+
+    template <typename T>
+    Result activateLinkedAsync(AsyncEventLoop& eventLoop, T& async)
+    {
+        const uint32_t previousSubmissions = numSubmissions;
+        SC_TRY(activateAsync(eventLoop, async));
+        // Link flag is set on previous submission of the chain only when this one has been successfully prepared, so
+        // that a failure to stage it just terminates the chain. Requests not queuing exactly one submission (manual
+        // completions) terminate it too.
+        const bool    hasOneSubmission = numSubmissions == previousSubmissions + 1;
+        io_uring_sqe* submission = hasOneSubmission and (async.flags & Internal::Flag_ManualCompletion) == 0
+                                       ? lastSubmission
+                                       : nullptr;
+        if (submission != nullptr and linkTail != nullptr and (async.flags & Internal::Flag_LinkedToPrevious) != 0)
+        {
+            linkTail->flags |= async.sequence->clearSequenceOnError ? IOSQE_IO_LINK : IOSQE_IO_HARDLINK;
+        }
+        linkTail = (async.flags & Internal::Flag_LinkedRequest) != 0 ? submission : nullptr;
         return Result(true);
     }
 
-    void copyReadyCompletions(AsyncEventLoop& eventLoop, const Time::Absolute* nextTimer)
+    // Returns false if no request has been completed and the timer has not expired
+    bool copyReadyCompletions(AsyncEventLoop& eventLoop, const Time::Absolute* nextTimer)
     {
         KernelQueueIoURing& kq = getKernelQueue(eventLoop);
-        // Read up to totalNumEvents completions, copy them into a local array and
-        // advance the ring buffer pointers to free ring slots.
-        newEvents = globalLibURing.io_uring_peek_batch_cqe(&kq.ring, &eventPointers[0], totalNumEvents);
+        // Read up to totalNumEvents completions, storing only pointers to them, as they're dispatched in place.
+        // Ring slots are freed in releaseCompletions, before reaping the next batch.
+        const int numPeeked = static_cast<int>(
+            globalLibURing.io_uring_peek_batch_cqe(&kq.ring, &events[0], static_cast<unsigned>(totalNumEvents)));
+        kq.numPeekedEvents = static_cast<unsigned>(numPeeked);
 
-        int writeIdx = 0;
-        int readIdx  = 0;
+        newEvents = 0;
 
-        while (readIdx < newEvents)
+        bool timerCompleted = false;
+        bool timerExpired   = false;
+        for (int readIdx = 0; readIdx < numPeeked; ++readIdx)
         {
-            const io_uring_cqe cqe = *eventPointers[readIdx];
-            if (cqe.user_data == reinterpret_cast<__u64>(&kq.timerIsSet))
+            io_uring_cqe* cqe = events[readIdx];
+            if (cqe->user_data == reinterpret_cast<__u64>(&kq.timerIsSet))
             {
                 kq.timerIsSet = false;
                 // Sanity check: expired timeouts are reported with ETIME errno
-                SC_ASSERT_RELEASE(cqe.res == -ETIME or cqe.res == -ECANCELED);
+                SC_ASSERT_RELEASE(cqe->res == -ETIME or cqe->res == -ECANCELED);
+                timerCompleted = true;
+                timerExpired   = cqe->res == -ETIME;
             }
-            else
+            else if (cqe->user_data != 0)
             {
-                events[writeIdx] = cqe;
-                writeIdx++;
+                events[newEvents++] = cqe;
             }
-            readIdx++;
+            // Completions of cancellations, link timeouts and timer updates / removals have nullptr user_data
         }
-        globalLibURing.io_uring_cq_advance(&kq.ring, newEvents);
 
         if (nextTimer)
         {
-            if (readIdx != writeIdx)
+            if (timerCompleted)
             {
                 // A custom timeout timer was set and it has expired
                 eventLoop.internal.runTimers = true;
             }
         }
+        return newEvents > 0 or timerExpired;
+    }
+
+    static Result waitForCompletions(KernelQueueIoURing& kq)
+    {
+        int res;
+        do
+        {
+            res = globalLibURing.io_uring_submit_and_wait(&kq.ring, 1);
+        } while (res == -EINTR);
+        return Result(res >= 0);
+    }
+
+    static void releaseCompletions(KernelQueueIoURing& kq)
+    {
+        if (kq.numPeekedEvents > 0)
+        {
+            globalLibURing.io_uring_cq_advance(&kq.ring, kq.numPeekedEvents);
+            kq.numPeekedEvents = 0;
+        }
     }
 
     Result syncWithKernel(AsyncEventLoop& eventLoop, Internal::SyncMode syncMode)
     {
-        AsyncLoopTimeout*     loopTimeout = nullptr;
-        const Time::Absolute* nextTimer   = nullptr;
+        const Time::Absolute* nextTimer = nullptr;
         if (syncMode == Internal::SyncMode::ForcedForwardProgress)
         {
-            loopTimeout = eventLoop.internal.findEarliestLoopTimeout();
-            if (loopTimeout)
-            {
-                nextTimer = &loopTimeout->expirationTime;
-            }
+            // Earliest between loop timeouts and deadlines of requests started with a timeout
+            nextTimer = eventLoop.internal.findEarliestExpirationTime();
         }
+        // Completions of previous step have been dispatched and their ring slots can be reused
+        KernelQueueIoURing& kq = getKernelQueue(eventLoop);
+        releaseCompletions(kq);
         SC_TRY(flushSubmissions(eventLoop, syncMode, nextTimer));
-        copyReadyCompletions(eventLoop, nextTimer);
+        while (not copyReadyCompletions(eventLoop, nextTimer) and syncMode == Internal::SyncMode::ForcedForwardProgress)
+        {
+            // Only internal completions (like the ones of timer updates) have been reaped, so keep waiting.
+            // Returning would make the caller spin, submitting a new timer update at each step.
+            releaseCompletions(kq);
+            SC_TRY_MSG(waitForCompletions(kq), "io_uring_submit_and_wait");
+        }
         return Result(true);
     }
 
     Result flushSubmissions(AsyncEventLoop& eventLoop, Internal::SyncMode syncMode, const Time::Absolute* nextTimer)
     {
         KernelQueueIoURing& kq = getKernelQueue(eventLoop);
+        // A chain can't span multiple submits (it happens only if it's longer than the submission queue)
+        linkTail = nullptr;
+        numFlushes += 1;
         while (true)
         {
             int res = -1;
             switch (syncMode)
             {
             case Internal::SyncMode::NoWait: {
-                res = globalLibURing.io_uring_submit(&kq.ring);
+                // With DEFER_TASKRUN completions are posted only when explicitly asked, in the same syscall
+                res = kq.deferTaskRun ? globalLibURing.io_uring_submit_and_get_events(&kq.ring)
+                                      : globalLibURing.io_uring_submit(&kq.ring);
                 break;
             }
             case Internal::SyncMode::ForcedForwardProgress: {
@@ -348,19 +498,23 @@ struct SC::AsyncEventLoop::Internal::KernelEventsIoURing
             }
             if (res < 0)
             {
-                if (errno == EINTR)
+                // liburing returns negated errno instead of setting it
+                const int error = -res;
+                if (error == EINTR)
                 {
                     continue;
                 }
-                if (errno == EAGAIN or errno == EBUSY)
+                if (error == EAGAIN or error == EBUSY)
                 {
                     // OMG the completion kernelEvents is full, so we can't submit
                     // anything until we free some of the completions slots :-|
                     copyReadyCompletions(eventLoop, nextTimer);
-                    if (newEvents > 0)
+                    if (kq.numPeekedEvents > 0)
                     {
-                        // We've freed some slots, let's try again
+                        // Dispatch them in place and free their ring slots, then try again
                         eventLoop.internal.runStepExecuteCompletions(eventLoop, parentKernelEvents);
+                        releaseCompletions(kq);
+                        newEvents = 0;
                         continue;
                     }
                     else
@@ -380,11 +534,29 @@ struct SC::AsyncEventLoop::Internal::KernelEventsIoURing
         return Result(true);
     }
 
-    Result validateEvent(uint32_t idx, bool& continueProcessing)
+    Result validateEvent(AsyncEventLoop&, uint32_t idx, bool& continueProcessing)
     {
-        io_uring_cqe& completion = events[idx];
+        io_uring_cqe& completion = *events[idx];
         // Cancellation completions have nullptr user_data
         continueProcessing = completion.user_data != 0;
+        if (continueProcessing and (completion.flags & IORING_CQE_F_NOTIF) != 0)
+        {
+            // Buffers of a zero-copy send have been released, and the request is completed only if it's waiting for
+            // this notification, as it could also be still reactivating (or it could have been stopped)
+            AsyncRequest& async = *getAsyncRequest(idx);
+            continueProcessing  = false;
+            if (async.type == AsyncRequest::Type::SocketSend)
+            {
+                AsyncSocketSend& send = static_cast<AsyncSocketSend&>(async);
+                if (send.zeroCopyPending > 0)
+                {
+                    send.zeroCopyPending -= 1;
+                    continueProcessing = send.state == AsyncRequest::State::Active and send.zeroCopyWaiting and
+                                         send.zeroCopyPending == 0;
+                }
+            }
+            return Result(true);
+        }
         if (continueProcessing and completion.res < 0)
         {
             continueProcessing = false; // Don't process cancellations
@@ -392,6 +564,24 @@ struct SC::AsyncEventLoop::Internal::KernelEventsIoURing
             {
                 return Result::Error("Error in processing event (io uring)");
             }
+            AsyncRequest& async = *getAsyncRequest(idx);
+            if (async.state == AsyncRequest::State::Active and (async.flags & Internal::Flag_LinkedToPrevious) != 0)
+            {
+                // Not stopped by user but cancelled by kernel, because a previous request of its chain has failed
+                return Result::Error("Linked request cancelled (io uring)");
+            }
+            if (async.state == AsyncRequest::State::Active and (async.flags & Internal::Flag_KernelDeadline) != 0)
+            {
+                // Not stopped by user but cancelled by kernel, because its IORING_OP_LINK_TIMEOUT has expired
+                async.flags |= Internal::Flag_TimedOut;
+                return Result::Error("Timed out");
+            }
+        }
+        if (continueProcessing)
+        {
+            // Request has been completed by kernel before processing the cancellation submitted when stopping it
+            const AsyncRequest::State state = getAsyncRequest(idx)->state;
+            continueProcessing = state != AsyncRequest::State::Cancelling and state != AsyncRequest::State::Free;
         }
         return Result(true);
     }
@@ -432,7 +622,7 @@ struct SC::AsyncEventLoop::Internal::KernelEventsIoURing
 
     Result completeAsync(AsyncSocketAccept::Result& res)
     {
-        return res.completionData.acceptedClient.assign(events[res.eventIndex].res);
+        return res.completionData.acceptedClient.assign(events[res.eventIndex]->res);
     }
 
     //-------------------------------------------------------------------------------------------------------
@@ -445,7 +635,7 @@ struct SC::AsyncEventLoop::Internal::KernelEventsIoURing
         struct sockaddr* sockAddr = &async.ipAddress.handle.reinterpret_as<struct sockaddr>();
         globalLibURing.io_uring_prep_connect(submission, async.handle, sockAddr, async.ipAddress.sizeOfHandle());
         globalLibURing.io_uring_sqe_set_data(submission, &async);
-        return Result(true);
+        return linkTimeout(eventLoop, submission, async);
     }
 
     Result completeAsync(AsyncSocketConnect::Result& res)
@@ -457,9 +647,15 @@ struct SC::AsyncEventLoop::Internal::KernelEventsIoURing
     //-------------------------------------------------------------------------------------------------------
     // Socket SEND
     //-------------------------------------------------------------------------------------------------------
+    Result setupAsync(AsyncEventLoop&, AsyncSocketSend& async) { return KernelEventsPosix::posixZeroCopySetup(async); }
+
     Result activateAsync(AsyncEventLoop& eventLoop, AsyncSocketSend& async)
     {
         io_uring_sqe* submission;
+        if (async.zeroCopyEnabled)
+        {
+            return activateZeroCopySend(eventLoop, async);
+        }
         SC_TRY(getNewSubmission(eventLoop, submission));
         if (async.singleBuffer)
         {
@@ -475,12 +671,25 @@ struct SC::AsyncEventLoop::Internal::KernelEventsIoURing
             globalLibURing.io_uring_prep_writev(submission, async.handle, vecs, nVecs, 0);
         }
         globalLibURing.io_uring_sqe_set_data(submission, &async);
-        return Result(true);
+        return linkTimeout(eventLoop, submission, async);
+    }
+
+    Result cancelAsync(AsyncEventLoop& eventLoop, AsyncSocketSend& async)
+    {
+        if (async.zeroCopyWaiting)
+        {
+            return Result(true); // Nothing has been submitted, as buffers release notification can't be cancelled
+        }
+        return cancelAsync<AsyncSocketSend>(eventLoop, async);
     }
 
     Result completeAsync(AsyncSocketSend::Result& result)
     {
-        result.completionData.numBytes = static_cast<size_t>(events[result.eventIndex].res);
+        if (result.getAsync().zeroCopyEnabled)
+        {
+            return completeZeroCopySend(result);
+        }
+        result.completionData.numBytes = static_cast<size_t>(events[result.eventIndex]->res);
 
         size_t totalBytes = 0;
         if (result.getAsync().singleBuffer)
@@ -498,6 +707,67 @@ struct SC::AsyncEventLoop::Internal::KernelEventsIoURing
         return Result(true);
     }
 
+    // IORING_OP_SEND_ZC posts a first completion (with IORING_CQE_F_MORE) when data has been sent and a second one
+    // (with IORING_CQE_F_NOTIF) when the kernel doesn't need buffers anymore. The request is reactivated after the
+    // first one, without submitting anything, to keep it active until the second one (handled by validateEvent).
+    Result activateZeroCopySend(AsyncEventLoop& eventLoop, AsyncSocketSend& async)
+    {
+        if (async.zeroCopyWaiting)
+        {
+            if (async.zeroCopyPending == 0)
+            {
+                // Notification has been already received while the request was being reactivated
+                async.flags |= Internal::Flag_ManualCompletion;
+            }
+            return Result(true);
+        }
+        io_uring_sqe* submission;
+        SC_TRY(getNewSubmission(eventLoop, submission));
+        if (async.singleBuffer)
+        {
+            globalLibURing.io_uring_prep_send_zc(submission, async.handle, async.buffer.data(),
+                                                 async.buffer.sizeInBytes(), MSG_WAITALL, 0);
+        }
+        else
+        {
+            static_assert(sizeof(msghdr) <= sizeof(async.zeroCopyMessage), "AsyncSocketSend::zeroCopyMessage");
+            static_assert(sizeof(iovec) == sizeof(Span<const char>), "assert");
+            msghdr& message    = async.zeroCopyMessage.reinterpret_as<msghdr>();
+            message            = {};
+            message.msg_iov    = reinterpret_cast<iovec*>(async.buffers.data());
+            message.msg_iovlen = async.buffers.sizeInElements();
+            globalLibURing.io_uring_prep_sendmsg_zc(submission, async.handle, &message, MSG_WAITALL);
+        }
+        globalLibURing.io_uring_sqe_set_data(submission, &async);
+        return linkTimeout(eventLoop, submission, async);
+    }
+
+    Result completeZeroCopySend(AsyncSocketSend::Result& result)
+    {
+        AsyncSocketSend& async = result.getAsync();
+        async.flags &= ~Internal::Flag_ManualCompletion;
+        if (not async.zeroCopyWaiting)
+        {
+            io_uring_cqe& completion = *events[result.eventIndex];
+            async.totalBytesWritten += static_cast<size_t>(completion.res);
+            result.completionData.numBytes = async.totalBytesWritten;
+            SC_TRY_MSG(async.totalBytesWritten == Internal::getSummedSizeOfBuffers(async), "send didn't send all data");
+            if ((completion.flags & IORING_CQE_F_MORE) != 0)
+            {
+                // Data has been sent but kernel is still reading from user buffers
+                async.zeroCopyPending                = 1;
+                async.zeroCopyWaiting                = true;
+                result.completionData.bufferReusable = false;
+                result.reactivateRequest(true);
+                return Result(true);
+            }
+        }
+        async.zeroCopyWaiting                = false;
+        result.completionData.numBytes       = async.totalBytesWritten;
+        result.completionData.bufferReusable = true;
+        return Result(true);
+    }
+
     //-------------------------------------------------------------------------------------------------------
     // Socket RECEIVE
     //-------------------------------------------------------------------------------------------------------
@@ -507,12 +777,12 @@ struct SC::AsyncEventLoop::Internal::KernelEventsIoURing
         SC_TRY(getNewSubmission(eventLoop, submission));
         globalLibURing.io_uring_prep_recv(submission, async.handle, async.buffer.data(), async.buffer.sizeInBytes(), 0);
         globalLibURing.io_uring_sqe_set_data(submission, &async);
-        return Result(true);
+        return linkTimeout(eventLoop, submission, async);
     }
 
     Result completeAsync(AsyncSocketReceive::Result& result)
     {
-        io_uring_cqe& completion       = events[result.eventIndex];
+        io_uring_cqe& completion       = *events[result.eventIndex];
         result.completionData.numBytes = static_cast<size_t>(completion.res);
         if (completion.res == 0)
         {
@@ -521,6 +791,107 @@ struct SC::AsyncEventLoop::Internal::KernelEventsIoURing
         return Result(true);
     }
 
+    //-------------------------------------------------------------------------------------------------------
+    // Socket SEND TO
+    //-------------------------------------------------------------------------------------------------------
+    Result activateAsync(AsyncEventLoop& eventLoop, AsyncSocketSendTo& async)
+    {
+        io_uring_sqe* submission;
+        if (async.singleBuffer)
+        {
+            SC_TRY(getNewSubmission(eventLoop, submission));
+            using Message = KernelEventsPosix::DatagramMessage;
+            static_assert(sizeof(Message) <= sizeof(async.message), "AsyncSocketSendTo::message");
+            Message& message = async.message.reinterpret_as<Message>();
+            KernelEventsPosix::prepareSendToMessage(async, async.buffer, message.header, message.vector,
+                                                    message.control);
+            globalLibURing.io_uring_prep_sendmsg(submission, async.handle, &message.header, 0);
+            globalLibURing.io_uring_sqe_set_data(submission, &async);
+            return Result(true);
+        }
+        // io_uring has no sendmmsg equivalent, so multiple datagrams are sent with sendmmsg as long as the socket
+        // is writable, polling for writability otherwise
+        SC_TRY(KernelEventsPosix::posixSendTo(async));
+        if (async.numDatagramsSent == async.buffers.sizeInElements())
+        {
+            async.flags |= Internal::Flag_ManualCompletion;
+            return Result(true);
+        }
+        SC_TRY(getNewSubmission(eventLoop, submission));
+        globalLibURing.io_uring_prep_poll_add(submission, async.handle, POLLOUT);
+        globalLibURing.io_uring_sqe_set_data(submission, &async);
+        return Result(true);
+    }
+
+    Result cancelAsync(AsyncEventLoop& eventLoop, AsyncSocketSendTo& async)
+    {
+        return async.singleBuffer ? cancelAsync<AsyncSocketSendTo>(eventLoop, async) : cancelPoll(eventLoop, async);
+    }
+
+    Result completeAsync(AsyncSocketSendTo::Result& result)
+    {
+        AsyncSocketSendTo& async = result.getAsync();
+        if (async.singleBuffer)
+        {
+            result.completionData.numBytes     = static_cast<size_t>(events[result.eventIndex]->res);
+            result.completionData.numDatagrams = 1;
+            return Result(true);
+        }
+        async.flags &= ~Internal::Flag_ManualCompletion;
+        return KernelEventsPosix::completeSendTo(result);
+    }
+
+    //-------------------------------------------------------------------------------------------------------
+    // Socket RECEIVE FROM
+    //-------------------------------------------------------------------------------------------------------
+    Result setupAsync(AsyncEventLoop&, AsyncSocketReceiveFrom& async)
+    {
+        return KernelEventsPosix::posixSetupReceiveFrom(async);
+    }
+
+    Result activateAsync(AsyncEventLoop& eventLoop, AsyncSocketReceiveFrom& async)
+    {
+        io_uring_sqe* submission;
+        SC_TRY(getNewSubmission(eventLoop, submission));
+        if (async.datagrams.empty())
+        {
+            using Message = KernelEventsPosix::DatagramMessage;
+            static_assert(sizeof(Message) <= sizeof(async.message), "AsyncSocketReceiveFrom::message");
+            Message& message = async.message.reinterpret_as<Message>();
+            KernelEventsPosix::prepareReceiveFromMessage(async, 0, message.header, message.vector, message.control);
+            globalLibURing.io_uring_prep_recvmsg(submission, async.handle, &message.header, 0);
+        }
+        else
+        {
+            // io_uring has no recvmmsg equivalent, so wait for readability and receive all slots with recvmmsg
+            globalLibURing.io_uring_prep_poll_add(submission, async.handle, POLLIN);
+        }
+        globalLibURing.io_uring_sqe_set_data(submission, &async);
+        return Result(true);
+    }
+
+    Result cancelAsync(AsyncEventLoop& eventLoop, AsyncSocketReceiveFrom& async)
+    {
+        return async.datagrams.empty() ? cancelAsync<AsyncSocketReceiveFrom>(eventLoop, async)
+                                       : cancelPoll(eventLoop, async);
+    }
+
+    Result completeAsync(AsyncSocketReceiveFrom::Result& result)
+    {
+        AsyncSocketReceiveFrom& async = result.getAsync();
+        if (async.datagrams.empty())
+        {
+            using Message                      = KernelEventsPosix::DatagramMessage;
+            const size_t numBytes              = static_cast<size_t>(events[result.eventIndex]->res);
+            result.completionData.numBytes     = numBytes;
+            result.completionData.numDatagrams = 1;
+
+            msghdr& header = async.message.reinterpret_as<Message>().header;
+            return KernelEventsPosix::completeReceiveFromMessage(async, 0, header, numBytes);
+        }
+        return KernelEventsPosix::completeAsync(result);
+    }
+
     //-------------------------------------------------------------------------------------------------------
     // Socket CLOSE
     //-------------------------------------------------------------------------------------------------------
@@ -535,7 +906,7 @@ struct SC::AsyncEventLoop::Internal::KernelEventsIoURing
 
     Result completeAsync(AsyncSocketClose::Result& result)
     {
-        io_uring_cqe& completion   = events[result.eventIndex];
+        io_uring_cqe& completion   = *events[result.eventIndex];
         result.completionData.code = completion.res;
         result.returnCode          = Result(true);
         return Result(true);
@@ -551,12 +922,12 @@ struct SC::AsyncEventLoop::Internal::KernelEventsIoURing
         globalLibURing.io_uring_prep_read(submission, async.handle, async.buffer.data(), async.buffer.sizeInBytes(),
                                           async.useOffset ? async.offset : -1);
         globalLibURing.io_uring_sqe_set_data(submission, &async);
-        return Result(true);
+        return linkTimeout(eventLoop, submission, async);
     }
 
     Result completeAsync(AsyncFileRead::Result& result)
     {
-        io_uring_cqe& completion       = events[result.eventIndex];
+        io_uring_cqe& completion       = *events[result.eventIndex];
         result.completionData.numBytes = static_cast<size_t>(completion.res);
         if (completion.res == 0)
         {
@@ -587,12 +958,12 @@ struct SC::AsyncEventLoop::Internal::KernelEventsIoURing
             globalLibURing.io_uring_prep_writev(submission, async.handle, vecs, nVecs, off);
         }
         globalLibURing.io_uring_sqe_set_data(submission, &async);
-        return Result(true);
+        return linkTimeout(eventLoop, submission, async);
     }
 
     Result completeAsync(AsyncFileWrite::Result& result)
     {
-        result.completionData.numBytes = static_cast<size_t>(events[result.eventIndex].res);
+        result.completionData.numBytes = static_cast<size_t>(events[result.eventIndex]->res);
         return Result(result.completionData.numBytes == Internal::getSummedSizeOfBuffers(result.getAsync()));
     }
 
@@ -610,12 +981,78 @@ struct SC::AsyncEventLoop::Internal::KernelEventsIoURing
 
     Result completeAsync(AsyncFileClose::Result& result)
     {
-        io_uring_cqe& completion   = events[result.eventIndex];
+        io_uring_cqe& completion   = *events[result.eventIndex];
         result.returnCode          = Result(true);
         result.completionData.code = completion.res;
         return Result(true);
     }
 
+    //-------------------------------------------------------------------------------------------------------
+    // File System OPERATION
+    //-------------------------------------------------------------------------------------------------------
+    Result activateAsync(AsyncEventLoop& eventLoop, AsyncFileSystemOperation& async)
+    {
+        using Operation = AsyncFileSystemOperation::Operation;
+        static_assert(sizeof(struct statx) <= sizeof(async.statxBuffer), "AsyncFileSystemOperation::statxBuffer");
+
+        io_uring_sqe* submission;
+        SC_TRY(getNewSubmission(eventLoop, submission));
+        switch (async.operation)
+        {
+        case Operation::None: return Result::Error("AsyncFileSystemOperation - No operation");
+        case Operation::Open: {
+            const int flags = KernelEventsPosix::getOpenFlags(async.openMode);
+            globalLibURing.io_uring_prep_openat(submission, AT_FDCWD, async.path, flags, KernelEventsPosix::FileAccess);
+            break;
+        }
+        case Operation::Sync: {
+            const unsigned flags = async.dataOnly ? IORING_FSYNC_DATASYNC : 0;
+            globalLibURing.io_uring_prep_fsync(submission, async.handle, flags);
+            break;
+        }
+        case Operation::Allocate:
+            globalLibURing.io_uring_prep_fallocate(submission, async.handle, 0, async.offset, async.length);
+            break;
+        case Operation::Stat: {
+            struct statx* statxBuffer = &async.statxBuffer.reinterpret_as<struct statx>();
+            globalLibURing.io_uring_prep_statx(submission, AT_FDCWD, async.path, 0, STATX_BASIC_STATS, statxBuffer);
+            break;
+        }
+        case Operation::RemoveFile:
+            globalLibURing.io_uring_prep_unlinkat(submission, AT_FDCWD, async.path, 0);
+            break;
+        case Operation::Rename:
+            globalLibURing.io_uring_prep_renameat(submission, AT_FDCWD, async.path, AT_FDCWD, async.newPath, 0);
+            break;
+        case Operation::MakeDirectory:
+            globalLibURing.io_uring_prep_mkdirat(submission, AT_FDCWD, async.path, KernelEventsPosix::DirectoryAccess);
+            break;
+        }
+        globalLibURing.io_uring_sqe_set_data(submission, &async);
+        return Result(true);
+    }
+
+    Result completeAsync(AsyncFileSystemOperation::Result& result)
+    {
+        // Failures (negative res) have already been reported by validateEvent
+        const io_uring_cqe&       completion = *events[result.eventIndex];
+        AsyncFileSystemOperation& async      = result.getAsync();
+        switch (async.operation)
+        {
+        case AsyncFileSystemOperation::Operation::Open: result.completionData.handle = completion.res; break;
+        case AsyncFileSystemOperation::Operation::Stat: {
+            const struct statx& fileStat        = async.statxBuffer.reinterpret_as<struct statx>();
+            result.completionData.fileSize      = fileStat.stx_size;
+            result.completionData.isDirectory   = S_ISDIR(fileStat.stx_mode);
+            result.completionData.modifiedTime  = Time::Realtime(fileStat.stx_mtime.tv_sec * 1000 +
+                                                                fileStat.stx_mtime.tv_nsec / 1000000);
+            break;
+        }
+        default: break;
+        }
+        return Result(true);
+    }
+
     //-------------------------------------------------------------------------------------------------------
     // File POLL
     //-------------------------------------------------------------------------------------------------------
@@ -631,7 +1068,9 @@ struct SC::AsyncEventLoop::Internal::KernelEventsIoURing
         return Result(true);
     }
 
-    Result cancelAsync(AsyncEventLoop& eventLoop, AsyncFilePoll& async)
+    Result cancelAsync(AsyncEventLoop& eventLoop, AsyncFilePoll& async) { return cancelPoll(eventLoop, async); }
+
+    Result cancelPoll(AsyncEventLoop& eventLoop, AsyncRequest& async)
     {
         io_uring_sqe* submission;
         SC_TRY(getNewSubmission(eventLoop, submission));
@@ -720,6 +1159,11 @@ SC::AsyncEventLoop::Internal::KernelQueuePosix& SC::AsyncEventLoop::Internal::Ke
     return storage.reinterpret_as<KernelQueuePosix>();
 }
 
+bool SC::AsyncEventLoop::Internal::KernelQueue::canLinkRequest(AsyncRequest& async) const
+{
+    return not isEpoll and KernelQueueIoURing::canLinkRequest(async);
+}
+
 SC::Result SC::AsyncEventLoop::Internal::KernelQueue::close()
 {
     return isEpoll ? getPosix().close() : getUring().close();
@@ -733,13 +1177,13 @@ SC::Result SC::AsyncEventLoop::Internal::KernelQueue::createEventLoop(AsyncEvent
         isEpoll = true;
         placementNew(storage.reinterpret_as<KernelQueuePosix>());
     }
-    else if (options.apiType == AsyncEventLoop::Options::ApiType::ForceUseEpoll and isEpoll)
+    else if (options.apiType == AsyncEventLoop::Options::ApiType::ForceUseIOURing and isEpoll)
     {
         storage.reinterpret_as<KernelQueuePosix>().~KernelQueuePosix();
         isEpoll = false;
         placementNew(storage.reinterpret_as<KernelQueueIoURing>());
     }
-    return isEpoll ? getPosix().createEventLoop() : getUring().createEventLoop();
+    return isEpoll ? getPosix().createEventLoop() : getUring().createEventLoop(options);
 }
 
 SC::Result SC::AsyncEventLoop::Internal::KernelQueue::createSharedWatchers(AsyncEventLoop& eventLoop)
@@ -800,10 +1244,11 @@ SC::Result SC::AsyncEventLoop::Internal::KernelEvents::syncWithKernel(AsyncEvent
     return isEpoll ? getPosix().syncWithKernel(eventLoop, syncMode) : getUring().syncWithKernel(eventLoop, syncMode);
 }
 
-SC::Result SC::AsyncEventLoop::Internal::KernelEvents::validateEvent(uint32_t& idx, bool& continueProcessing)
+SC::Result SC::AsyncEventLoop::Internal::KernelEvents::validateEvent(AsyncEventLoop& eventLoop, uint32_t& idx,
+                                                                     bool& continueProcessing)
 {
-    return isEpoll ? getPosix().validateEvent(idx, continueProcessing)
-                   : getUring().validateEvent(idx, continueProcessing);
+    return isEpoll ? getPosix().validateEvent(eventLoop, idx, continueProcessing)
+                   : getUring().validateEvent(eventLoop, idx, continueProcessing);
 }
 
 SC::AsyncRequest* SC::AsyncEventLoop::Internal::KernelEvents::getAsyncRequest(uint32_t idx)
@@ -813,7 +1258,7 @@ SC::AsyncRequest* SC::AsyncEventLoop::Internal::KernelEvents::getAsyncRequest(ui
 
 // clang-format off
 template <typename T>  SC::Result SC::AsyncEventLoop::Internal::KernelEvents::setupAsync(AsyncEventLoop& eventLoop, T& async)    { return isEpoll ? getPosix().setupAsync(eventLoop, async) : getUring().setupAsync(eventLoop, async); }
-template <typename T>  SC::Result SC::AsyncEventLoop::Internal::KernelEvents::activateAsync(AsyncEventLoop& eventLoop, T& async) { return isEpoll ? getPosix().activateAsync(eventLoop, async) : getUring().activateAsync(eventLoop, async); }
+template <typename T>  SC::Result SC::AsyncEventLoop::Internal::KernelEvents::activateAsync(AsyncEventLoop& eventLoop, T& async) { return isEpoll ? getPosix().activateAsync(eventLoop, async) : getUring().activateLinkedAsync(eventLoop, async); }
 template <typename T>  SC::Result SC::AsyncEventLoop::Internal::KernelEvents::cancelAsync(AsyncEventLoop& eventLoop, T& async)   { return isEpoll ? getPosix().cancelAsync(eventLoop, async) : getUring().cancelAsync(eventLoop, async); }
 template <typename T>  SC::Result SC::AsyncEventLoop::Internal::KernelEvents::completeAsync(T& async) { return isEpoll ? getPosix().completeAsync(async) : getUring().completeAsync(async); }
 
@@ -9,10 +9,12 @@ struct AsyncLinuxAPI
 
     void (*io_uring_queue_exit)(struct io_uring* ring)                                                     = nullptr;
     int (*io_uring_queue_init)(unsigned entries, struct io_uring* ring, unsigned flags)                    = nullptr;
+    int (*io_uring_queue_init_params)(unsigned entries, struct io_uring* ring, struct io_uring_params* p)  = nullptr;
     struct io_uring_sqe* (*io_uring_get_sqe)(struct io_uring* ring)                                        = nullptr;
     unsigned (*io_uring_peek_batch_cqe)(struct io_uring* ring, struct io_uring_cqe** cqes, unsigned count) = nullptr;
     int (*io_uring_submit)(struct io_uring* ring)                                                          = nullptr;
     int (*io_uring_submit_and_wait)(struct io_uring* ring, unsigned wait_nr)                               = nullptr;
+    int (*io_uring_submit_and_get_events)(struct io_uring* ring)                                           = nullptr;
 
     [[nodiscard]] bool init()
     {
@@ -29,10 +31,12 @@ struct AsyncLinuxAPI
         // clang-format off
         io_uring_queue_exit = reinterpret_cast<decltype(io_uring_queue_exit)>(::dlsym(liburingHandle, "io_uring_queue_exit"));
         io_uring_queue_init = reinterpret_cast<decltype(io_uring_queue_init)>(::dlsym(liburingHandle, "io_uring_queue_init"));
+        io_uring_queue_init_params = reinterpret_cast<decltype(io_uring_queue_init_params)>(::dlsym(liburingHandle, "io_uring_queue_init_params"));
         io_uring_get_sqe = reinterpret_cast<decltype(io_uring_get_sqe)>(::dlsym(liburingHandle, "io_uring_get_sqe"));
         io_uring_peek_batch_cqe = reinterpret_cast<decltype(io_uring_peek_batch_cqe)>(::dlsym(liburingHandle, "io_uring_peek_batch_cqe"));
         io_uring_submit = reinterpret_cast<decltype(io_uring_submit)>(::dlsym(liburingHandle, "io_uring_submit"));
         io_uring_submit_and_wait = reinterpret_cast<decltype(io_uring_submit_and_wait)>(::dlsym(liburingHandle, "io_uring_submit_and_wait"));
+        io_uring_submit_and_get_events = reinterpret_cast<decltype(io_uring_submit_and_get_events)>(::dlsym(liburingHandle, "io_uring_submit_and_get_events"));
         // clang-format on
         return true;
     }
@@ -83,11 +87,16 @@ struct AsyncLinuxLibURingLoader : public AsyncLinuxAPI
     void (*io_uring_prep_timeout)(struct io_uring_sqe* sqe, struct __kernel_timespec* ts, unsigned count, unsigned flags) = nullptr;
     void (*io_uring_prep_timeout_remove)(struct io_uring_sqe* sqe, __u64 user_data, unsigned flags) = nullptr;
     void (*io_uring_prep_timeout_update)(struct io_uring_sqe *sqe, struct __kernel_timespec *ts, __u64 user_data, unsigned flags) = nullptr;
+    void (*io_uring_prep_link_timeout)(struct io_uring_sqe* sqe, struct __kernel_timespec* ts, unsigned flags) = nullptr;
     void (*io_uring_prep_accept)(struct io_uring_sqe* sqe, int fd, struct sockaddr* addr, socklen_t* addrlen, int flags) = nullptr;
                                            
     void (*io_uring_prep_connect)(struct io_uring_sqe* sqe, int fd, const struct sockaddr* addr, socklen_t addrlen) = nullptr;
     void (*io_uring_prep_send)(struct io_uring_sqe* sqe, int sockfd, const void* buf, size_t len, int flags) = nullptr;
     void (*io_uring_prep_recv)(struct io_uring_sqe* sqe, int sockfd, void* buf, size_t len, int flags) = nullptr;
+    void (*io_uring_prep_sendmsg)(struct io_uring_sqe* sqe, int fd, const struct msghdr* msg, unsigned flags) = nullptr;
+    void (*io_uring_prep_send_zc)(struct io_uring_sqe* sqe, int sockfd, const void* buf, size_t len, int flags, unsigned zc_flags) = nullptr;
+    void (*io_uring_prep_sendmsg_zc)(struct io_uring_sqe* sqe, int fd, const struct msghdr* msg, unsigned flags) = nullptr;
+    void (*io_uring_prep_recvmsg)(struct io_uring_sqe* sqe, int fd, struct msghdr* msg, unsigned flags) = nullptr;
 
     void (*io_uring_prep_close)(struct io_uring_sqe* sqe, int fd) = nullptr;
 
@@ -97,6 +106,14 @@ struct AsyncLinuxLibURingLoader : public AsyncLinuxAPI
     void (*io_uring_prep_poll_add)(struct io_uring_sqe* sqe, int fd, unsigned poll_mask) = nullptr;
     void (*io_uring_prep_poll_remove)(struct io_uring_sqe* sqe, void* user_data) = nullptr;
     void (*io_uring_prep_cancel)(struct io_uring_sqe* sqe, void* user_data, int flags) = nullptr;
+
+    void (*io_uring_prep_openat)(struct io_uring_sqe* sqe, int dfd, const char* path, int flags, mode_t mode) = nullptr;
+    void (*io_uring_prep_fsync)(struct io_uring_sqe* sqe, int fd, unsigned fsync_flags) = nullptr;
+    void (*io_uring_prep_fallocate)(struct io_uring_sqe* sqe, int fd, int mode, __u64 offset, __u64 len) = nullptr;
+    void (*io_uring_prep_statx)(struct io_uring_sqe* sqe, int dfd, const char* path, int flags, unsigned mask, struct statx* statxbuf) = nullptr;
+    void (*io_uring_prep_unlinkat)(struct io_uring_sqe* sqe, int dfd, const char* path, int flags) = nullptr;
+    void (*io_uring_prep_renameat)(struct io_uring_sqe* sqe, int olddfd, const char* oldpath, int newdfd, const char* newpath, unsigned int flags) = nullptr;
+    void (*io_uring_prep_mkdirat)(struct io_uring_sqe* sqe, int dfd, const char* path, mode_t mode) = nullptr;
     // clang-format on
     AsyncLinuxLibURingLoader()
     {
@@ -106,16 +123,28 @@ struct AsyncLinuxLibURingLoader : public AsyncLinuxAPI
         this->io_uring_prep_timeout        = &::io_uring_prep_timeout;
         this->io_uring_prep_timeout_remove = &::io_uring_prep_timeout_remove;
         this->io_uring_prep_timeout_update = &::io_uring_prep_timeout_update;
+        this->io_uring_prep_link_timeout   = &::io_uring_prep_link_timeout;
         this->io_uring_prep_accept         = &::io_uring_prep_accept;
         this->io_uring_prep_connect        = &::io_uring_prep_connect;
         this->io_uring_prep_send           = &::io_uring_prep_send;
         this->io_uring_prep_recv           = &::io_uring_prep_recv;
+        this->io_uring_prep_sendmsg        = &::io_uring_prep_sendmsg;
+        this->io_uring_prep_send_zc        = &::io_uring_prep_send_zc;
+        this->io_uring_prep_sendmsg_zc     = &::io_uring_prep_sendmsg_zc;
+        this->io_uring_prep_recvmsg        = &::io_uring_prep_recvmsg;
         this->io_uring_prep_close          = &::io_uring_prep_close;
         this->io_uring_prep_read           = &::io_uring_prep_read;
         this->io_uring_prep_write          = &::io_uring_prep_write;
         this->io_uring_prep_poll_add       = &::io_uring_prep_poll_add;
         this->io_uring_prep_poll_remove    = &::io_uring_prep_poll_remove;
         this->io_uring_prep_cancel         = &::io_uring_prep_cancel;
+        this->io_uring_prep_openat         = &::io_uring_prep_openat;
+        this->io_uring_prep_fsync          = &::io_uring_prep_fsync;
+        this->io_uring_prep_fallocate      = &::io_uring_prep_fallocate;
+        this->io_uring_prep_statx          = &::io_uring_prep_statx;
+        this->io_uring_prep_unlinkat       = &::io_uring_prep_unlinkat;
+        this->io_uring_prep_renameat       = &::io_uring_prep_renameat;
+        this->io_uring_prep_mkdirat        = &::io_uring_prep_mkdirat;
     }
 };
 
@@ -242,6 +271,13 @@ struct AsyncLinuxLibURingLoader : public AsyncLinuxAPI
         sqe->timeout_flags = flags | IORING_TIMEOUT_UPDATE;
     }
 
+    static inline void io_uring_prep_link_timeout(struct io_uring_sqe* sqe, struct __kernel_timespec* ts,
+                                                  unsigned flags)
+    {
+        io_uring_prep_rw(IORING_OP_LINK_TIMEOUT, sqe, -1, ts, 1, 0);
+        sqe->timeout_flags = flags;
+    }
+
     static inline void io_uring_prep_accept(struct io_uring_sqe* sqe, int fd, struct sockaddr* addr, socklen_t* addrlen,
                                             int flags)
     {
@@ -267,6 +303,37 @@ struct AsyncLinuxLibURingLoader : public AsyncLinuxAPI
         sqe->msg_flags = (__u32)flags;
     }
 
+    static inline void io_uring_prep_sendmsg(struct io_uring_sqe* sqe, int fd, const struct msghdr* msg, unsigned flags)
+    {
+        io_uring_prep_rw(IORING_OP_SENDMSG, sqe, fd, msg, 1, 0);
+        sqe->msg_flags = flags;
+    }
+
+    // Opcodes are spelled as numbers, as they're missing from linux/io_uring.h of kernel headers older than 6.0
+    static constexpr int IORING_OP_SEND_ZC_VALUE    = 47; // IORING_OP_SEND_ZC
+    static constexpr int IORING_OP_SENDMSG_ZC_VALUE = 48; // IORING_OP_SENDMSG_ZC
+
+    static inline void io_uring_prep_send_zc(struct io_uring_sqe* sqe, int sockfd, const void* buf, size_t len,
+                                             int flags, unsigned zc_flags)
+    {
+        io_uring_prep_rw(IORING_OP_SEND_ZC_VALUE, sqe, sockfd, buf, (__u32)len, 0);
+        sqe->msg_flags = (__u32)flags;
+        sqe->ioprio    = (__u16)zc_flags;
+    }
+
+    static inline void io_uring_prep_sendmsg_zc(struct io_uring_sqe* sqe, int fd, const struct msghdr* msg,
+                                                unsigned flags)
+    {
+        io_uring_prep_rw(IORING_OP_SENDMSG_ZC_VALUE, sqe, fd, msg, 1, 0);
+        sqe->msg_flags = flags;
+    }
+
+    static inline void io_uring_prep_recvmsg(struct io_uring_sqe* sqe, int fd, struct msghdr* msg, unsigned flags)
+    {
+        io_uring_prep_rw(IORING_OP_RECVMSG, sqe, fd, msg, 1, 0);
+        sqe->msg_flags = flags;
+    }
+
     static inline void io_uring_prep_close(struct io_uring_sqe* sqe, int fd)
     {
         io_uring_prep_rw(IORING_OP_CLOSE, sqe, fd, NULL, 0, 0);
@@ -313,6 +380,67 @@ struct AsyncLinuxLibURingLoader : public AsyncLinuxAPI
         io_uring_prep_rw(IORING_OP_ASYNC_CANCEL, sqe, -1, user_data, 0, 0);
         sqe->cancel_flags = (__u32)flags;
     }
+
+    static inline void io_uring_prep_openat(struct io_uring_sqe* sqe, int dfd, const char* path, int flags,
+                                            mode_t mode)
+    {
+        io_uring_prep_rw(IORING_OP_OPENAT, sqe, dfd, path, mode, 0);
+        sqe->open_flags = (__u32)flags;
+    }
+
+    static inline void io_uring_prep_fsync(struct io_uring_sqe* sqe, int fd, unsigned fsync_flags)
+    {
+        io_uring_prep_rw(IORING_OP_FSYNC, sqe, fd, NULL, 0, 0);
+        sqe->fsync_flags = fsync_flags;
+    }
+
+    static inline void io_uring_prep_fallocate(struct io_uring_sqe* sqe, int fd, int mode, __u64 offset, __u64 len)
+    {
+        io_uring_prep_rw(IORING_OP_FALLOCATE, sqe, fd, NULL, (unsigned int)mode, offset);
+        sqe->addr = len;
+    }
+
+    static inline void io_uring_prep_statx(struct io_uring_sqe* sqe, int dfd, const char* path, int flags,
+                                           unsigned mask, struct statx* statxbuf)
+    {
+        io_uring_prep_rw(IORING_OP_STATX, sqe, dfd, path, mask, (__u64)(unsigned long)statxbuf);
+        sqe->statx_flags = (__u32)flags;
+    }
+
+    static inline void io_uring_prep_unlinkat(struct io_uring_sqe* sqe, int dfd, const char* path, int flags)
+    {
+        io_uring_prep_rw(IORING_OP_UNLINKAT, sqe, dfd, path, 0, 0);
+        sqe->unlink_flags = (__u32)flags;
+    }
+
+    static inline void io_uring_prep_renameat(struct io_uring_sqe* sqe, int olddfd, const char* oldpath, int newdfd,
+                                              const char* newpath, unsigned int flags)
+    {
+        io_uring_prep_rw(IORING_OP_RENAMEAT, sqe, olddfd, oldpath, (unsigned int)newdfd, (__u64)(unsigned long)newpath);
+        sqe->rename_flags = (__u32)flags;
+    }
+
+    static inline void io_uring_prep_mkdirat(struct io_uring_sqe* sqe, int dfd, const char* path, mode_t mode)
+    {
+        io_uring_prep_rw(IORING_OP_MKDIRAT, sqe, dfd, path, mode, 0);
+    }
 };
 
 #endif
+
+// Setup flags missing from older kernel headers (the kernel rejects them with EINVAL when unsupported)
+#ifndef IORING_SETUP_SQPOLL
+#define IORING_SETUP_SQPOLL (1U << 1)
+#endif
+#ifndef IORING_SETUP_SINGLE_ISSUER
+#define IORING_SETUP_SINGLE_ISSUER (1U << 12)
+#endif
+#ifndef IORING_SETUP_DEFER_TASKRUN
+#define IORING_SETUP_DEFER_TASKRUN (1U << 13)
+#endif
+#ifndef IORING_CQE_F_MORE
+#define IORING_CQE_F_MORE (1U << 1)
+#endif
+#ifndef IORING_CQE_F_NOTIF
+#define IORING_CQE_F_NOTIF (1U << 3)
+#endif
@@ -7,20 +7,43 @@
 
 #if SC_ASYNC_USE_EPOLL
 
-#include <errno.h>        // For error handling
-#include <fcntl.h>        // For fcntl function (used for setting non-blocking mode)
-#include <signal.h>       // For signal-related functions
-#include <sys/epoll.h>    // For epoll functions
-#include <sys/signalfd.h> // For signalfd functions
-#include <sys/socket.h>   // For socket-related functions
-#include <sys/stat.h>     // fstat
-#include <sys/uio.h>      // writev, pwritev
+#include <errno.h>          // For error handling
+#include <fcntl.h>          // For fcntl function (used for setting non-blocking mode)
+#include <linux/errqueue.h> // sock_extended_err / SO_EE_ORIGIN_ZEROCOPY
+#include <netinet/in.h>     // IPPROTO_UDP
+#include <netinet/udp.h>    // UDP_SEGMENT / UDP_GRO
+#include <signal.h>         // For signal-related functions
+#include <stdio.h>          // rename
+#include <sys/epoll.h>      // For epoll functions
+#include <sys/signalfd.h>   // For signalfd functions
+#include <sys/socket.h>     // For socket-related functions
+#include <sys/stat.h>       // fstat
+#include <sys/uio.h>        // writev, pwritev
+
+#ifndef UDP_SEGMENT
+#define UDP_SEGMENT 103
+#endif
+#ifndef UDP_GRO
+#define UDP_GRO 104
+#endif
+#ifndef SO_ZEROCOPY
+#define SO_ZEROCOPY 60
+#endif
+#ifndef MSG_ZEROCOPY
+#define MSG_ZEROCOPY 0x4000000
+#endif
+#ifndef SO_EE_ORIGIN_ZEROCOPY
+#define SO_EE_ORIGIN_ZEROCOPY 5
+#endif
 
 #else
 
 #include <errno.h>     // For error handling
+#include <fcntl.h>     // open / F_PREALLOCATE
 #include <netdb.h>     // socklen_t/getsockopt/recv
+#include <stdio.h>     // rename
 #include <sys/event.h> // kqueue
+#include <sys/socket.h> // sendmsg / recvmsg
 #include <sys/stat.h>  // fstat
 #include <sys/time.h>  // timespec
 #include <sys/uio.h>   // writev, pwritev
@@ -43,6 +66,9 @@ struct SC::AsyncEventLoop::Internal::KernelQueuePosix
 
     [[nodiscard]] static constexpr bool makesSenseToRunInThreadPool(AsyncRequest&) { return true; }
 
+    // epoll and kqueue have no way of linking requests, so sequences are run in user-space
+    [[nodiscard]] static constexpr bool canLinkRequest(AsyncRequest&) { return false; }
+
     const KernelQueuePosix& getPosix() const { return *this; }
 
     Result close()
@@ -372,13 +398,22 @@ struct SC::AsyncEventLoop::Internal::KernelEventsPosix
         return true;
     }
 
-    Result validateEvent(uint32_t idx, bool& continueProcessing)
+    Result validateEvent(AsyncEventLoop& eventLoop, uint32_t idx, bool& continueProcessing)
     {
         const epoll_event& event = events[idx];
         continueProcessing       = true;
 
         if ((event.events & EPOLLERR) != 0 || (event.events & EPOLLHUP) != 0)
         {
+            if ((event.events & EPOLLHUP) == 0)
+            {
+                bool isNotification = false;
+                SC_TRY(posixZeroCopyNotification(eventLoop, idx, isNotification, continueProcessing));
+                if (isNotification)
+                {
+                    return Result(true);
+                }
+            }
             continueProcessing = false;
             return Result::Error("Error in processing event (epoll EPOLLERR or EPOLLHUP)");
         }
@@ -425,7 +460,7 @@ struct SC::AsyncEventLoop::Internal::KernelEventsPosix
         return true;
     }
 
-    Result validateEvent(uint32_t idx, bool& continueProcessing)
+    Result validateEvent(AsyncEventLoop&, uint32_t idx, bool& continueProcessing)
     {
         const struct kevent& event = events[idx];
         continueProcessing         = (event.flags & EV_DELETE) == 0;
@@ -476,15 +511,11 @@ struct SC::AsyncEventLoop::Internal::KernelEventsPosix
 
     Result syncWithKernel(AsyncEventLoop& eventLoop, Internal::SyncMode syncMode)
     {
-        AsyncLoopTimeout*     loopTimeout = nullptr;
-        const Time::Absolute* nextTimer   = nullptr;
+        const Time::Absolute* nextTimer = nullptr;
         if (syncMode == Internal::SyncMode::ForcedForwardProgress)
         {
-            loopTimeout = eventLoop.internal.findEarliestLoopTimeout();
-            if (loopTimeout)
-            {
-                nextTimer = &loopTimeout->expirationTime;
-            }
+            // Earliest between loop timeouts and deadlines of requests started with a timeout
+            nextTimer = eventLoop.internal.findEarliestExpirationTime();
         }
         static constexpr Result errorResult = Result::Error("syncWithKernel() - Invalid Handle");
         FileDescriptor::Handle  loopFd;
@@ -519,7 +550,7 @@ struct SC::AsyncEventLoop::Internal::KernelEventsPosix
             return Result::Error("AsyncEventLoop::KernelQueuePosix::poll() - failed");
         }
         newEvents = static_cast<int>(res);
-        if (loopTimeout)
+        if (nextTimer)
         {
             eventLoop.internal.runTimers = true;
         }
@@ -683,6 +714,7 @@ struct SC::AsyncEventLoop::Internal::KernelEventsPosix
                         break;
                     }
                     fullyWrittenBytes += ioVecSize;
+                    indexOfVecToWrite++;
                 }
                 // Number of writes already written of io vector at indexOfVecToWrite
                 const size_t partiallyWrittenBytes = async.totalBytesWritten - fullyWrittenBytes;
@@ -789,14 +821,29 @@ struct SC::AsyncEventLoop::Internal::KernelEventsPosix
     // Socket SEND
     //-------------------------------------------------------------------------------------------------------
 
+#if SC_ASYNC_USE_EPOLL
+    Result setupAsync(AsyncEventLoop&, AsyncSocketSend& async) { return posixZeroCopySetup(async); }
+#endif
+
     static Result teardownAsync(AsyncSocketSend*, AsyncTeardown& teardown)
     {
-        return posixWriteCancel(*teardown.eventLoop, teardown.socketHandle, teardown.flags,
-                                teardown.eventLoop->internal.activeSocketSends.front);
+        SC_TRY(posixWriteCancel(*teardown.eventLoop, teardown.socketHandle, teardown.flags,
+                                teardown.eventLoop->internal.activeSocketSends.front));
+#if SC_ASYNC_USE_EPOLL
+        return posixZeroCopyWatchAgain(*teardown.eventLoop, teardown.socketHandle);
+#else
+        return Result(true);
+#endif
     }
 
     Result activateAsync(AsyncEventLoop& eventLoop, AsyncSocketSend& async)
     {
+#if SC_ASYNC_USE_EPOLL
+        if (async.zeroCopyEnabled)
+        {
+            return posixZeroCopyActivate(eventLoop, async);
+        }
+#endif
         return posixWriteActivate(eventLoop, async, -1, true);
     }
 
@@ -808,17 +855,301 @@ struct SC::AsyncEventLoop::Internal::KernelEventsPosix
     static Result completeAsync(AsyncSocketSend::Result& result)
     {
         AsyncSocketSend& async = result.getAsync();
-        SC_TRY(posixWriteCompleteAsync<AsyncSocketSend>(result, -1));
+#if SC_ASYNC_USE_EPOLL
+        if (async.zeroCopyEnabled)
+        {
+            SC_TRY(posixZeroCopyCompleteAsync(result));
+        }
+        else
+#endif
+        {
+            SC_TRY(posixWriteCompleteAsync<AsyncSocketSend>(result, -1));
+        }
         return posixWriteManualActivateWithSameHandle(result.eventLoop, async,
                                                       result.eventLoop.internal.activeSocketSends.front);
     }
 
+#if SC_ASYNC_USE_EPOLL
+    //-------------------------------------------------------------------------------------------------------
+    // Posix Zero Copy Send (setup is shared between epoll and io_uring)
+    //-------------------------------------------------------------------------------------------------------
+    static Result posixZeroCopySetup(AsyncSocketSend& async)
+    {
+        async.zeroCopyEnabled = false;
+        async.zeroCopyWaiting = false;
+        async.zeroCopyPending = 0;
+        if (async.zeroCopy)
+        {
+            // Silently fallback to regular sends on sockets not supporting it (for example AF_UNIX)
+            int enable            = 1;
+            async.zeroCopyEnabled = ::setsockopt(async.handle, SOL_SOCKET, SO_ZEROCOPY, &enable, sizeof(enable)) == 0;
+        }
+        return Result(true);
+    }
+
+    [[nodiscard]] static bool posixZeroCopyTryWrite(AsyncSocketSend& async)
+    {
+        const size_t     totalBytesToSend = Internal::getSummedSizeOfBuffers(async);
+        Span<const char> singleBuffer     = async.buffer;
+
+        Span<Span<const char>> buffers = async.singleBuffer ? Span<Span<const char>>(&singleBuffer, 1) : async.buffers;
+        while (async.totalBytesWritten < totalBytesToSend)
+        {
+            // Same partial write handling as posixTryWrite
+            static_assert(sizeof(iovec) == sizeof(Span<const char>), "assert");
+            iovec* ioVectors         = reinterpret_cast<iovec*>(buffers.data());
+            size_t fullyWrittenBytes = 0;
+            size_t indexOfVecToWrite = 0;
+            while (indexOfVecToWrite < buffers.sizeInElements())
+            {
+                const size_t ioVecSize = buffers[indexOfVecToWrite].sizeInBytes();
+                if (fullyWrittenBytes + ioVecSize > async.totalBytesWritten)
+                {
+                    break;
+                }
+                fullyWrittenBytes += ioVecSize;
+                indexOfVecToWrite++;
+            }
+            const size_t partiallyWrittenBytes = async.totalBytesWritten - fullyWrittenBytes;
+            const iovec  backup                = ioVectors[indexOfVecToWrite];
+            if (partiallyWrittenBytes > 0)
+            {
+                ioVectors[indexOfVecToWrite].iov_base =
+                    static_cast<char*>(ioVectors[indexOfVecToWrite].iov_base) + partiallyWrittenBytes;
+                ioVectors[indexOfVecToWrite].iov_len -= partiallyWrittenBytes;
+            }
+            msghdr message     = {};
+            message.msg_iov    = ioVectors + indexOfVecToWrite;
+            message.msg_iovlen = buffers.sizeInElements() - indexOfVecToWrite;
+
+            ssize_t numBytesSent = ::sendmsg(async.handle, &message, MSG_ZEROCOPY);
+            if (numBytesSent >= 0)
+            {
+                async.zeroCopyPending++; // Every successful MSG_ZEROCOPY send generates a notification
+            }
+            else if (errno == ENOBUFS)
+            {
+                numBytesSent = ::sendmsg(async.handle, &message, 0); // Socket optmem limit reached, just copy
+            }
+            if (partiallyWrittenBytes > 0)
+            {
+                ioVectors[indexOfVecToWrite] = backup;
+            }
+            if (numBytesSent < 0)
+            {
+                return false;
+            }
+            async.totalBytesWritten += static_cast<size_t>(numBytesSent);
+        }
+        return true;
+    }
+
+    static Result posixZeroCopyReceiveNotifications(AsyncSocketSend& async)
+    {
+        // Kernel signals that it's done reading from buffers of a range of sends through the socket error queue
+        while (async.zeroCopyPending > 0)
+        {
+            alignas(cmsghdr) char control[128];
+
+            msghdr message         = {};
+            message.msg_control    = control;
+            message.msg_controllen = sizeof(control);
+            if (::recvmsg(async.handle, &message, MSG_ERRQUEUE) < 0)
+            {
+                SC_TRY_MSG(errno == EAGAIN or errno == EWOULDBLOCK, "recvmsg MSG_ERRQUEUE failed");
+                break; // Error queue is empty
+            }
+            for (cmsghdr* cmsg = CMSG_FIRSTHDR(&message); cmsg != nullptr; cmsg = CMSG_NXTHDR(&message, cmsg))
+            {
+                const bool isIPV4 = cmsg->cmsg_level == SOL_IP and cmsg->cmsg_type == IP_RECVERR;
+                const bool isIPV6 = cmsg->cmsg_level == SOL_IPV6 and cmsg->cmsg_type == IPV6_RECVERR;
+                if (isIPV4 or isIPV6)
+                {
+                    const sock_extended_err* error = reinterpret_cast<const sock_extended_err*>(CMSG_DATA(cmsg));
+                    if (error->ee_errno == 0 and error->ee_origin == SO_EE_ORIGIN_ZEROCOPY)
+                    {
+                        // [ee_info, ee_data] is the inclusive range of completed sends
+                        const uint32_t numCompleted = error->ee_data - error->ee_info + 1;
+                        async.zeroCopyPending -= numCompleted < async.zeroCopyPending ? numCompleted //
+                                                                                      : async.zeroCopyPending;
+                    }
+                }
+            }
+        }
+        return Result(true);
+    }
+
+    // Finds the zero-copy send on the given socket with buffers not yet released by the kernel
+    static AsyncSocketSend* posixZeroCopyFindPending(AsyncEventLoop& eventLoop, SocketDescriptor::Handle handle)
+    {
+        AsyncSocketSend* current = eventLoop.internal.activeSocketSends.front;
+        while (current != nullptr and (current->handle != handle or current->zeroCopyPending == 0))
+        {
+            current = static_cast<AsyncSocketSend*>(current->next);
+        }
+        return current;
+    }
+
+    // Buffers release notifications are queued on the socket error queue, that signals EPOLLERR to the request
+    // registered for the socket (the zero-copy send itself or a receive on the same socket)
+    Result posixZeroCopyNotification(AsyncEventLoop& eventLoop, uint32_t idx, bool& isNotification,
+                                     bool& continueProcessing)
+    {
+        const epoll_event&       event   = events[idx];
+        AsyncRequest&            request = *getAsyncRequest(idx);
+        SocketDescriptor::Handle handle;
+        switch (request.type)
+        {
+        case AsyncRequest::Type::SocketSend: handle = static_cast<AsyncSocketSend&>(request).handle; break;
+        case AsyncRequest::Type::SocketReceive: handle = static_cast<AsyncSocketReceive&>(request).handle; break;
+        default: isNotification = false; return Result(true);
+        }
+        AsyncSocketSend* send = posixZeroCopyFindPending(eventLoop, handle);
+        isNotification        = send != nullptr;
+        if (send == nullptr)
+        {
+            return Result(true);
+        }
+        SC_TRY(posixZeroCopyReceiveNotifications(*send));
+        if (send == &request)
+        {
+            continueProcessing = send->zeroCopyWaiting ? send->zeroCopyPending == 0 : (event.events & EPOLLOUT) != 0;
+        }
+        else
+        {
+            continueProcessing = (event.events & (EPOLLIN | EPOLLOUT | EPOLLRDHUP)) != 0;
+            if (send->zeroCopyWaiting and send->zeroCopyPending == 0 and
+                (send->flags & Internal::Flag_ManualCompletion) == 0)
+            {
+                send->flags |= Internal::Flag_ManualCompletion;
+                eventLoop.internal.manualCompletions.queueBack(*send);
+            }
+        }
+        return Result(true);
+    }
+
+    // Registers the socket of a send waiting for buffers release (EPOLLERR is reported even with no events set)
+    static Result posixZeroCopyWatch(AsyncEventLoop& eventLoop, AsyncSocketSend& async)
+    {
+        FileDescriptor::Handle loopFd;
+        SC_TRY(eventLoop.internal.kernelQueue.get().getPosix().loopFd.get(loopFd, Result::Error("loop")));
+        struct epoll_event event = {0};
+        event.events             = 0;
+        event.data.ptr           = &async;
+        if (async.flags & Internal::Flag_WatcherSet)
+        {
+            SC_TRY_MSG(::epoll_ctl(loopFd, EPOLL_CTL_MOD, async.handle, &event) == 0, "epoll_ctl MOD failed");
+            return Result(true);
+        }
+        if (::epoll_ctl(loopFd, EPOLL_CTL_ADD, async.handle, &event) == 0)
+        {
+            async.flags |= Internal::Flag_WatcherSet;
+            return Result(true);
+        }
+        // Another request already registered the socket and it will receive EPOLLERR (see validateEvent)
+        SC_TRY_MSG(errno == EEXIST, "epoll_ctl ADD failed");
+        return Result(true);
+    }
+
+    // Registers again a send waiting for buffers release after the request registered for its socket has gone
+    static Result posixZeroCopyWatchAgain(AsyncEventLoop& eventLoop, SocketDescriptor::Handle handle)
+    {
+        AsyncSocketSend* send = posixZeroCopyFindPending(eventLoop, handle);
+        if (send != nullptr and send->zeroCopyWaiting and (send->flags & Internal::Flag_WatcherSet) == 0)
+        {
+            return posixZeroCopyWatch(eventLoop, *send);
+        }
+        return Result(true);
+    }
+
+    Result posixZeroCopyActivate(AsyncEventLoop& eventLoop, AsyncSocketSend& async)
+    {
+        if (async.zeroCopyWaiting)
+        {
+            if (async.zeroCopyPending == 0)
+            {
+                // Notifications have been already received through a receive on the same socket
+                async.flags |= Internal::Flag_ManualCompletion;
+                return Result(true);
+            }
+            return posixZeroCopyWatch(eventLoop, async);
+        }
+        if (not posixZeroCopyTryWrite(async))
+        {
+            SC_TRY_MSG(errno == EAGAIN or errno == EWOULDBLOCK, "sendmsg MSG_ZEROCOPY failed");
+            if ((async.flags & Internal::Flag_WatcherSet) == 0)
+            {
+                async.flags |= Internal::Flag_WatcherSet;
+                return setEventWatcher(eventLoop, async, async.handle, OUTPUT_EVENTS_MASK);
+            }
+            return Result(true);
+        }
+        async.flags |= Internal::Flag_ManualCompletion;
+        return Result(true);
+    }
+
+    static Result posixZeroCopyCompleteAsync(AsyncSocketSend::Result& result)
+    {
+        AsyncSocketSend& async = result.getAsync();
+        async.flags &= ~Internal::Flag_ManualCompletion;
+        if (not async.zeroCopyWaiting)
+        {
+            const bool allDataSent = posixZeroCopyTryWrite(async);
+            SC_TRY_MSG(allDataSent or errno == EAGAIN or errno == EWOULDBLOCK, "sendmsg MSG_ZEROCOPY failed");
+            // Always drain error queue, to avoid being woken up again by EPOLLERR while waiting for writability
+            SC_TRY(posixZeroCopyReceiveNotifications(async));
+            if (not allDataSent)
+            {
+                result.shouldCallCallback = false;
+                result.reactivateRequest(true);
+                return Result(true);
+            }
+            async.zeroCopyWaiting = true;
+            if (async.zeroCopyPending > 0)
+            {
+                // Data has been sent but kernel is still reading from user buffers
+                result.completionData.numBytes       = async.totalBytesWritten;
+                result.completionData.bufferReusable = false;
+                result.reactivateRequest(true);
+                return Result(true);
+            }
+        }
+        else
+        {
+            SC_TRY(posixZeroCopyReceiveNotifications(async));
+            if (async.zeroCopyPending > 0)
+            {
+                result.shouldCallCallback = false;
+                result.reactivateRequest(true);
+                return Result(true);
+            }
+        }
+        async.zeroCopyWaiting                = false;
+        result.completionData.numBytes       = async.totalBytesWritten;
+        result.completionData.bufferReusable = true;
+        return Result(true);
+    }
+#endif
+
     //-------------------------------------------------------------------------------------------------------
     // Socket RECEIVE
     //-------------------------------------------------------------------------------------------------------
     Result setupAsync(AsyncEventLoop& eventLoop, AsyncSocketReceive& async)
     {
 #if SC_ASYNC_USE_EPOLL
+        AsyncSocketSend* send = posixZeroCopyFindPending(eventLoop, async.handle);
+        if (send != nullptr and send->zeroCopyWaiting and (send->flags & Internal::Flag_WatcherSet) != 0)
+        {
+            // Take over the socket registered by a zero-copy send, that will get its notifications through this one
+            FileDescriptor::Handle loopFd;
+            SC_TRY(eventLoop.internal.kernelQueue.get().getPosix().loopFd.get(loopFd, Result::Error("loop")));
+            struct epoll_event event = {0};
+            event.events             = EPOLLIN | EPOLLRDHUP;
+            event.data.ptr           = &async;
+            SC_TRY_MSG(::epoll_ctl(loopFd, EPOLL_CTL_MOD, async.handle, &event) == 0, "epoll_ctl MOD failed");
+            send->flags &= ~Internal::Flag_WatcherSet;
+            return Result(true);
+        }
         return Result(setEventWatcher(eventLoop, async, async.handle, EPOLLIN | EPOLLRDHUP));
 #else
         return Result(setEventWatcher(eventLoop, async, async.handle, EVFILT_READ));
@@ -828,8 +1159,9 @@ struct SC::AsyncEventLoop::Internal::KernelEventsPosix
     static Result teardownAsync(AsyncSocketReceive*, AsyncTeardown& teardown)
     {
 #if SC_ASYNC_USE_EPOLL
-        return KernelQueuePosix::stopSingleWatcherImmediate(*teardown.eventLoop, teardown.socketHandle,
-                                                            EPOLLIN | EPOLLRDHUP);
+        SC_TRY(KernelQueuePosix::stopSingleWatcherImmediate(*teardown.eventLoop, teardown.socketHandle,
+                                                            EPOLLIN | EPOLLRDHUP));
+        return posixZeroCopyWatchAgain(*teardown.eventLoop, teardown.socketHandle);
 #else
         return KernelQueuePosix::stopSingleWatcherImmediate(*teardown.eventLoop, teardown.socketHandle, EVFILT_READ);
 #endif
@@ -848,6 +1180,316 @@ struct SC::AsyncEventLoop::Internal::KernelEventsPosix
         return Result(true);
     }
 
+    //-------------------------------------------------------------------------------------------------------
+    // Posix Datagrams (Shared between Socket SendTo / ReceiveFrom on epoll, kqueue and io_uring)
+    //-------------------------------------------------------------------------------------------------------
+    static constexpr size_t MaxDatagramsPerCall = 64;
+#if SC_ASYNC_USE_EPOLL
+    static constexpr size_t DatagramControlSize = CMSG_SPACE(sizeof(int)); // UDP_SEGMENT / UDP_GRO
+#else
+    static constexpr size_t DatagramControlSize = sizeof(cmsghdr);
+#endif
+
+    // Message stored inside the request to be used by io_uring SENDMSG / RECVMSG
+    struct DatagramMessage
+    {
+        msghdr header;
+        iovec  vector;
+        alignas(cmsghdr) char control[DatagramControlSize];
+    };
+
+    static void prepareSendToMessage(AsyncSocketSendTo& async, Span<const char> data, msghdr& header, iovec& vector,
+                                     char* control)
+    {
+        memset(&header, 0, sizeof(header));
+        vector.iov_base    = const_cast<char*>(data.data());
+        vector.iov_len     = data.sizeInBytes();
+        header.msg_name    = &async.ipAddress.handle.reinterpret_as<sockaddr>();
+        header.msg_namelen = async.ipAddress.sizeOfHandle();
+        header.msg_iov     = &vector;
+        header.msg_iovlen  = 1;
+#if SC_ASYNC_USE_EPOLL
+        if (async.segmentSize > 0)
+        {
+            header.msg_control    = control;
+            header.msg_controllen = CMSG_SPACE(sizeof(uint16_t));
+            cmsghdr* message      = CMSG_FIRSTHDR(&header);
+            message->cmsg_level   = IPPROTO_UDP;
+            message->cmsg_type    = UDP_SEGMENT;
+            message->cmsg_len     = CMSG_LEN(sizeof(uint16_t));
+            memcpy(CMSG_DATA(message), &async.segmentSize, sizeof(uint16_t));
+        }
+#else
+        (void)control;
+#endif
+    }
+
+    static void prepareReceiveFromMessage(AsyncSocketReceiveFrom& async, size_t index, msghdr& header, iovec& vector,
+                                          char* control)
+    {
+        AsyncSocketReceiveFrom::Datagram& datagram = async.getDatagrams()[index];
+
+        Span<char> slot = async.getDatagramSlot(index);
+        memset(&header, 0, sizeof(header));
+        vector.iov_base    = slot.data();
+        vector.iov_len     = slot.sizeInBytes();
+        header.msg_name    = &datagram.ipAddress.handle.reinterpret_as<sockaddr>();
+        header.msg_namelen = sizeof(datagram.ipAddress.handle);
+        header.msg_iov     = &vector;
+        header.msg_iovlen  = 1;
+        if (async.genericReceiveOffload)
+        {
+            header.msg_control    = control;
+            header.msg_controllen = DatagramControlSize;
+        }
+    }
+
+    static Result completeReceiveFromMessage(AsyncSocketReceiveFrom& async, size_t index, msghdr& header,
+                                             size_t numBytes)
+    {
+        SC_TRY_MSG((header.msg_flags & MSG_TRUNC) == 0, "AsyncSocketReceiveFrom - Datagram larger than its slot");
+        AsyncSocketReceiveFrom::Datagram& datagram = async.getDatagrams()[index];
+
+        SC_TRY(async.getDatagramSlot(index).sliceStartLength(0, numBytes, datagram.data));
+        datagram.segmentSize = 0;
+#if SC_ASYNC_USE_EPOLL
+        for (cmsghdr* message = CMSG_FIRSTHDR(&header); message != nullptr; message = CMSG_NXTHDR(&header, message))
+        {
+            if (message->cmsg_level == IPPROTO_UDP and message->cmsg_type == UDP_GRO)
+            {
+                int segmentSize;
+                memcpy(&segmentSize, CMSG_DATA(message), sizeof(segmentSize));
+                datagram.segmentSize = static_cast<uint16_t>(segmentSize);
+            }
+        }
+#endif
+        return datagram.ipAddress.updateAddressFamily();
+    }
+
+    // Sends datagrams not yet sent (sendmmsg on Linux), stopping without errors on EAGAIN / EWOULDBLOCK.
+    static Result posixSendTo(AsyncSocketSendTo& async)
+    {
+        const size_t numDatagrams = async.singleBuffer ? 1 : async.buffers.sizeInElements();
+        while (async.numDatagramsSent < numDatagrams)
+        {
+            const size_t numRemaining = numDatagrams - async.numDatagramsSent;
+            const size_t numToSend    = min(numRemaining, static_cast<size_t>(MaxDatagramsPerCall));
+
+            iovec vectors[MaxDatagramsPerCall];
+            alignas(cmsghdr) char controls[MaxDatagramsPerCall][DatagramControlSize];
+#if SC_ASYNC_USE_EPOLL
+            mmsghdr headers[MaxDatagramsPerCall];
+            for (size_t idx = 0; idx < numToSend; ++idx)
+            {
+                const size_t index = async.numDatagramsSent + idx;
+                prepareSendToMessage(async, async.singleBuffer ? async.buffer : async.buffers[index],
+                                     headers[idx].msg_hdr, vectors[idx], controls[idx]);
+                headers[idx].msg_len = 0;
+            }
+            int res;
+            do
+            {
+                res = ::sendmmsg(async.handle, headers, static_cast<unsigned int>(numToSend), 0);
+            } while (res == -1 and errno == EINTR);
+            if (res < 0)
+            {
+                return errno == EAGAIN or errno == EWOULDBLOCK ? Result(true) : Result::Error("sendmmsg failed");
+            }
+            for (int idx = 0; idx < res; ++idx)
+            {
+                async.totalBytesSent += headers[idx].msg_len;
+            }
+            async.numDatagramsSent += static_cast<size_t>(res);
+#else
+            for (size_t idx = 0; idx < numToSend; ++idx)
+            {
+                const size_t index = async.numDatagramsSent;
+
+                msghdr header;
+                prepareSendToMessage(async, async.singleBuffer ? async.buffer : async.buffers[index], header,
+                                     vectors[idx], controls[idx]);
+                ssize_t res;
+                do
+                {
+                    res = ::sendmsg(async.handle, &header, 0);
+                } while (res == -1 and errno == EINTR);
+                if (res < 0)
+                {
+                    return errno == EAGAIN or errno == EWOULDBLOCK ? Result(true) : Result::Error("sendmsg failed");
+                }
+                async.totalBytesSent += static_cast<size_t>(res);
+                async.numDatagramsSent += 1;
+            }
+#endif
+        }
+        return Result(true);
+    }
+
+    // Receives up to one datagram per slot (recvmmsg on Linux), returning zero datagrams on EAGAIN / EWOULDBLOCK.
+    static Result posixReceiveFrom(AsyncSocketReceiveFrom& async, AsyncSocketReceiveFrom::CompletionData& completion)
+    {
+        completion.numBytes     = 0;
+        completion.numDatagrams = 0;
+
+        const size_t numSlots = async.getDatagrams().sizeInElements();
+        while (completion.numDatagrams < numSlots)
+        {
+            const size_t numRemaining = numSlots - completion.numDatagrams;
+            const size_t numToReceive = min(numRemaining, static_cast<size_t>(MaxDatagramsPerCall));
+
+            iovec vectors[MaxDatagramsPerCall];
+            alignas(cmsghdr) char controls[MaxDatagramsPerCall][DatagramControlSize];
+#if SC_ASYNC_USE_EPOLL
+            mmsghdr headers[MaxDatagramsPerCall];
+            for (size_t idx = 0; idx < numToReceive; ++idx)
+            {
+                prepareReceiveFromMessage(async, completion.numDatagrams + idx, headers[idx].msg_hdr, vectors[idx],
+                                          controls[idx]);
+                headers[idx].msg_len = 0;
+            }
+            int res;
+            do
+            {
+                res = ::recvmmsg(async.handle, headers, static_cast<unsigned int>(numToReceive), MSG_DONTWAIT, nullptr);
+            } while (res == -1 and errno == EINTR);
+            if (res < 0)
+            {
+                return errno == EAGAIN or errno == EWOULDBLOCK ? Result(true) : Result::Error("recvmmsg failed");
+            }
+            for (int idx = 0; idx < res; ++idx)
+            {
+                SC_TRY(completeReceiveFromMessage(async, completion.numDatagrams, headers[idx].msg_hdr,
+                                                  headers[idx].msg_len));
+                completion.numBytes += headers[idx].msg_len;
+                completion.numDatagrams += 1;
+            }
+            if (static_cast<size_t>(res) < numToReceive)
+            {
+                break; // No more datagrams in the socket buffer
+            }
+#else
+            for (size_t idx = 0; idx < numToReceive; ++idx)
+            {
+                msghdr header;
+                prepareReceiveFromMessage(async, completion.numDatagrams, header, vectors[idx], controls[idx]);
+                ssize_t res;
+                do
+                {
+                    res = ::recvmsg(async.handle, &header, MSG_DONTWAIT);
+                } while (res == -1 and errno == EINTR);
+                if (res < 0)
+                {
+                    return errno == EAGAIN or errno == EWOULDBLOCK ? Result(true) : Result::Error("recvmsg failed");
+                }
+                SC_TRY(completeReceiveFromMessage(async, completion.numDatagrams, header, static_cast<size_t>(res)));
+                completion.numBytes += static_cast<size_t>(res);
+                completion.numDatagrams += 1;
+            }
+#endif
+        }
+        return Result(true);
+    }
+
+    static Result posixSetupReceiveFrom(AsyncSocketReceiveFrom& async)
+    {
+#if SC_ASYNC_USE_EPOLL
+        if (async.genericReceiveOffload)
+        {
+            const int enable = 1;
+            SC_TRY_MSG(::setsockopt(async.handle, IPPROTO_UDP, UDP_GRO, &enable, sizeof(enable)) == 0,
+                       "AsyncSocketReceiveFrom - setsockopt(UDP_GRO) failed");
+        }
+#else
+        (void)async;
+#endif
+        return Result(true);
+    }
+
+    //-------------------------------------------------------------------------------------------------------
+    // Socket SEND TO
+    //-------------------------------------------------------------------------------------------------------
+    static Result teardownAsync(AsyncSocketSendTo*, AsyncTeardown& teardown)
+    {
+        return posixWriteCancel(*teardown.eventLoop, teardown.socketHandle, teardown.flags,
+                                teardown.eventLoop->internal.activeSocketSendTos.front);
+    }
+
+    Result activateAsync(AsyncEventLoop& eventLoop, AsyncSocketSendTo& async)
+    {
+        SC_TRY(posixSendTo(async));
+        if (async.numDatagramsSent == (async.singleBuffer ? 1 : async.buffers.sizeInElements()))
+        {
+            // All datagrams have been sent synchronously so force a manual invocation of its completion
+            async.flags |= Internal::Flag_ManualCompletion;
+            return Result(true);
+        }
+        if ((async.flags & Internal::Flag_WatcherSet) == 0)
+        {
+            async.flags |= Internal::Flag_WatcherSet;
+            return Result(setEventWatcher(eventLoop, async, async.handle, OUTPUT_EVENTS_MASK));
+        }
+        return Result(true);
+    }
+
+    Result cancelAsync(AsyncEventLoop& eventLoop, AsyncSocketSendTo& async)
+    {
+        return posixWriteCancel(eventLoop, async.handle, async.flags, eventLoop.internal.activeSocketSendTos.front);
+    }
+
+    static Result completeAsync(AsyncSocketSendTo::Result& result)
+    {
+        AsyncSocketSendTo& async = result.getAsync();
+        async.flags &= ~Internal::Flag_ManualCompletion;
+        return completeSendTo(result);
+    }
+
+    static Result completeSendTo(AsyncSocketSendTo::Result& result)
+    {
+        AsyncSocketSendTo& async        = result.getAsync();
+        const size_t       numDatagrams = async.singleBuffer ? 1 : async.buffers.sizeInElements();
+        SC_TRY(posixSendTo(async));
+        if (async.numDatagramsSent < numDatagrams)
+        {
+            // Socket buffer is full: skip user callback and reactivate to wait for the socket to be writable again
+            result.shouldCallCallback = false;
+            result.reactivateRequest(true);
+            return Result(true);
+        }
+        result.completionData.numBytes     = async.totalBytesSent;
+        result.completionData.numDatagrams = async.numDatagramsSent;
+        // Allows re-sending the same buffers with Result::reactivateRequest
+        async.numDatagramsSent = 0;
+        async.totalBytesSent   = 0;
+        return Result(true);
+    }
+
+    //-------------------------------------------------------------------------------------------------------
+    // Socket RECEIVE FROM
+    //-------------------------------------------------------------------------------------------------------
+    Result setupAsync(AsyncEventLoop& eventLoop, AsyncSocketReceiveFrom& async)
+    {
+        SC_TRY(posixSetupReceiveFrom(async));
+        return Result(setEventWatcher(eventLoop, async, async.handle, INPUT_EVENTS_MASK));
+    }
+
+    static Result teardownAsync(AsyncSocketReceiveFrom*, AsyncTeardown& teardown)
+    {
+        return KernelQueuePosix::stopSingleWatcherImmediate(*teardown.eventLoop, teardown.socketHandle,
+                                                            INPUT_EVENTS_MASK);
+    }
+
+    static Result completeAsync(AsyncSocketReceiveFrom::Result& result)
+    {
+        SC_TRY(posixReceiveFrom(result.getAsync(), result.completionData));
+        if (result.completionData.numDatagrams == 0)
+        {
+            // Spurious wake up (or datagrams consumed by someone else), just keep waiting
+            result.shouldCallCallback = false;
+            result.reactivateRequest(true);
+        }
+        return Result(true);
+    }
+
     //-------------------------------------------------------------------------------------------------------
     // Socket CLOSE
     //-------------------------------------------------------------------------------------------------------
@@ -1008,6 +1650,120 @@ struct SC::AsyncEventLoop::Internal::KernelEventsPosix
         return executeOperation(result.getAsync(), result.completionData);
     }
 
+    //-------------------------------------------------------------------------------------------------------
+    // File System OPERATION
+    //-------------------------------------------------------------------------------------------------------
+    static constexpr mode_t FileAccess      = S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP | S_IROTH | S_IWOTH;
+    static constexpr mode_t DirectoryAccess = S_IRWXU | S_IRWXG | S_IROTH | S_IXOTH;
+
+    static int getOpenFlags(AsyncFileSystemOperation::OpenMode mode)
+    {
+        using OpenMode = AsyncFileSystemOperation::OpenMode;
+        switch (mode)
+        {
+        case OpenMode::ReadOnly: return O_RDONLY | O_CLOEXEC;
+        case OpenMode::WriteCreateTruncate: return O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC;
+        case OpenMode::WriteAppend: return O_WRONLY | O_APPEND | O_CLOEXEC;
+        case OpenMode::ReadAndWrite: return O_RDWR | O_CLOEXEC;
+        }
+        Assert::unreachable();
+    }
+
+    static Result allocateFile(int fileDescriptor, uint64_t offset, uint64_t length)
+    {
+#if SC_ASYNC_USE_EPOLL
+        int res;
+        do
+        {
+            res = ::fallocate(fileDescriptor, 0, static_cast<off_t>(offset), static_cast<off_t>(length));
+        } while (res == -1 and errno == EINTR);
+        SC_TRY_MSG(res == 0, "AsyncFileSystemOperation - fallocate failed");
+#else
+        struct stat fileStat;
+        SC_TRY_MSG(::fstat(fileDescriptor, &fileStat) == 0, "AsyncFileSystemOperation - fstat failed");
+        const off_t endOffset = static_cast<off_t>(offset + length);
+        if (endOffset > fileStat.st_size)
+        {
+            // Try a contiguous allocation first, falling back to a non-contiguous one
+            fstore_t store = {F_ALLOCATECONTIG | F_ALLOCATEALL, F_PEOFPOSMODE, 0, endOffset - fileStat.st_size, 0};
+            if (::fcntl(fileDescriptor, F_PREALLOCATE, &store) == -1)
+            {
+                store.fst_flags = F_ALLOCATEALL;
+                SC_TRY_MSG(::fcntl(fileDescriptor, F_PREALLOCATE, &store) != -1,
+                           "AsyncFileSystemOperation - F_PREALLOCATE failed");
+            }
+            // F_PREALLOCATE reserves storage without changing file size (unlike fallocate)
+            SC_TRY_MSG(::ftruncate(fileDescriptor, endOffset) == 0, "AsyncFileSystemOperation - ftruncate failed");
+        }
+#endif
+        return Result(true);
+    }
+
+    Result setupAsync(AsyncEventLoop&, AsyncFileSystemOperation& async)
+    {
+        async.flags |= Internal::Flag_ManualCompletion;
+        return Result(true);
+    }
+
+    static Result executeOperation(AsyncFileSystemOperation&                 async,
+                                   AsyncFileSystemOperation::CompletionData& completionData)
+    {
+        using Operation = AsyncFileSystemOperation::Operation;
+        switch (async.operation)
+        {
+        case Operation::None: return Result::Error("AsyncFileSystemOperation - No operation");
+        case Operation::Open: {
+            int fileDescriptor;
+            do
+            {
+                fileDescriptor = ::open(async.path, getOpenFlags(async.openMode), FileAccess);
+            } while (fileDescriptor == -1 and errno == EINTR);
+            SC_TRY_MSG(fileDescriptor != -1, "AsyncFileSystemOperation - open failed");
+            completionData.handle = fileDescriptor;
+            break;
+        }
+        case Operation::Sync: {
+#if SC_ASYNC_USE_EPOLL
+            const int res = async.dataOnly ? ::fdatasync(async.handle) : ::fsync(async.handle);
+#else
+            const int res = ::fsync(async.handle); // fdatasync is not exposed by all macOS SDKs
+#endif
+            SC_TRY_MSG(res == 0, "AsyncFileSystemOperation - fsync failed");
+            break;
+        }
+        case Operation::Allocate: SC_TRY(allocateFile(async.handle, async.offset, async.length)); break;
+        case Operation::Stat: {
+            struct stat fileStat;
+            SC_TRY_MSG(::stat(async.path, &fileStat) == 0, "AsyncFileSystemOperation - stat failed");
+#if SC_ASYNC_USE_EPOLL
+            const struct timespec& modifiedTime = fileStat.st_mtim;
+#else
+            const struct timespec& modifiedTime = fileStat.st_mtimespec;
+#endif
+            completionData.fileSize     = static_cast<uint64_t>(fileStat.st_size);
+            completionData.isDirectory  = S_ISDIR(fileStat.st_mode);
+            completionData.modifiedTime = Time::Realtime(static_cast<int64_t>(modifiedTime.tv_sec) * 1000 +
+                                                         static_cast<int64_t>(modifiedTime.tv_nsec) / 1000000);
+            break;
+        }
+        case Operation::RemoveFile:
+            SC_TRY_MSG(::unlink(async.path) == 0, "AsyncFileSystemOperation - unlink failed");
+            break;
+        case Operation::Rename:
+            SC_TRY_MSG(::rename(async.path, async.newPath) == 0, "AsyncFileSystemOperation - rename failed");
+            break;
+        case Operation::MakeDirectory:
+            SC_TRY_MSG(::mkdir(async.path, DirectoryAccess) == 0, "AsyncFileSystemOperation - mkdir failed");
+            break;
+        }
+        return Result(true);
+    }
+
+    Result completeAsync(AsyncFileSystemOperation::Result& result)
+    {
+        return executeOperation(result.getAsync(), result.completionData);
+    }
+
     //-------------------------------------------------------------------------------------------------------
     // Process EXIT
     //-------------------------------------------------------------------------------------------------------
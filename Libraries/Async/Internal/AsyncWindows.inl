@@ -40,6 +40,9 @@ struct SC::AsyncEventLoop::Internal::KernelQueue
 
     [[nodiscard]] static constexpr bool makesSenseToRunInThreadPool(AsyncRequest&) { return true; }
 
+    // IOCP has no way of linking requests, so sequences are run in user-space
+    [[nodiscard]] static constexpr bool canLinkRequest(AsyncRequest&) { return false; }
+
     Result associateExternallyCreatedSocket(SocketDescriptor& outDescriptor)
     {
         SC_TRY(removeAllAssociationsFor(outDescriptor));
@@ -205,15 +208,11 @@ struct SC::AsyncEventLoop::Internal::KernelEvents
 
     Result syncWithKernel(AsyncEventLoop& eventLoop, Internal::SyncMode syncMode)
     {
-        AsyncLoopTimeout*     loopTimeout = nullptr;
-        const Time::Absolute* nextTimer   = nullptr;
+        const Time::Absolute* nextTimer = nullptr;
         if (syncMode == Internal::SyncMode::ForcedForwardProgress)
         {
-            loopTimeout = eventLoop.internal.findEarliestLoopTimeout();
-            if (loopTimeout)
-            {
-                nextTimer = &loopTimeout->expirationTime;
-            }
+            // Earliest between loop timeouts and deadlines of requests started with a timeout
+            nextTimer = eventLoop.internal.findEarliestExpirationTime();
         }
         static constexpr Result errorResult = Result::Error("syncWithKernel() - Invalid Handle");
         FileDescriptor::Handle  loopFd;
@@ -248,14 +247,14 @@ struct SC::AsyncEventLoop::Internal::KernelEvents
                 return Result::Error("KernelEvents::poll() - GetQueuedCompletionStatusEx error");
             }
         }
-        if (loopTimeout)
+        if (nextTimer)
         {
             eventLoop.internal.runTimers = true;
         }
         return Result(true);
     }
 
-    [[nodiscard]] bool validateEvent(uint32_t idx, bool& continueProcessing)
+    [[nodiscard]] bool validateEvent(AsyncEventLoop&, uint32_t idx, bool& continueProcessing)
     {
         AsyncRequest* async = getAsyncRequest(idx);
         if (async != nullptr and async->state == AsyncRequest::State::Cancelling)
@@ -427,6 +426,18 @@ struct SC::AsyncEventLoop::Internal::KernelEvents
         return Result(true);
     }
 
+    static Result cancelAsync(AsyncEventLoop& eventLoop, AsyncSocketConnect& async)
+    {
+        BOOL res = ::CancelIoEx(reinterpret_cast<HANDLE>(async.handle), &async.overlapped.get().overlapped);
+        if (res == FALSE)
+        {
+            return Result::Error("AsyncSocketConnect: CancelEx failed");
+        }
+        // CancelIoEx queues a cancellation packet on the async queue
+        eventLoop.internal.hasPendingKernelCancellations = true;
+        return Result(true);
+    }
+
     static Result completeAsync(AsyncSocketConnect::Result& result)
     {
         AsyncSocketConnect& operation = result.getAsync();
@@ -488,6 +499,18 @@ struct SC::AsyncEventLoop::Internal::KernelEvents
         return Result(true);
     }
 
+    static Result cancelAsync(AsyncEventLoop& eventLoop, AsyncSocketSend& async)
+    {
+        BOOL res = ::CancelIoEx(reinterpret_cast<HANDLE>(async.handle), &async.overlapped.get().overlapped);
+        if (res == FALSE)
+        {
+            return Result::Error("AsyncSocketSend: CancelEx failed");
+        }
+        // CancelIoEx queues a cancellation packet on the async queue
+        eventLoop.internal.hasPendingKernelCancellations = true;
+        return Result(true);
+    }
+
     static Result completeAsync(AsyncSocketSend::Result& result)
     {
         return KernelQueue::checkWSAResult(result.getAsync().handle, result.getAsync().overlapped.get().overlapped,
@@ -537,6 +560,99 @@ struct SC::AsyncEventLoop::Internal::KernelEvents
         return res;
     }
 
+    //-------------------------------------------------------------------------------------------------------
+    // Socket SEND TO
+    //-------------------------------------------------------------------------------------------------------
+    static Result activateAsync(AsyncEventLoop&, AsyncSocketSendTo& async)
+    {
+        // One overlapped WSASendTo per datagram, as the same OVERLAPPED cannot be re-used for concurrent operations
+        const Span<const char> data = async.singleBuffer ? async.buffer : async.buffers[async.numDatagramsSent];
+
+        OVERLAPPED& overlapped = async.overlapped.get().overlapped;
+        WSABUF      buffer;
+        // this const_cast is caused by WSABUF being used for both send and receive
+        buffer.buf = const_cast<CHAR*>(data.data());
+        buffer.len = static_cast<ULONG>(data.sizeInBytes());
+        DWORD           transferred;
+        const sockaddr* address = &async.ipAddress.handle.reinterpret_as<const sockaddr>();
+        const int       length  = static_cast<int>(async.ipAddress.sizeOfHandle());
+        const int res = ::WSASendTo(async.handle, &buffer, 1, &transferred, 0, address, length, &overlapped, nullptr);
+        SC_TRY_MSG(res != SOCKET_ERROR or WSAGetLastError() == WSA_IO_PENDING, "WSASendTo failed");
+        return Result(true);
+    }
+
+    static Result completeAsync(AsyncSocketSendTo::Result& result)
+    {
+        AsyncSocketSendTo& async = result.getAsync();
+
+        size_t numBytes;
+        SC_TRY(KernelQueue::checkWSAResult(async.handle, async.overlapped.get().overlapped, &numBytes));
+        async.totalBytesSent += numBytes;
+        async.numDatagramsSent += 1;
+        if (not async.singleBuffer and async.numDatagramsSent < async.buffers.sizeInElements())
+        {
+            // Skip user callback and reactivate to send next datagram
+            result.shouldCallCallback = false;
+            result.reactivateRequest(true);
+            return Result(true);
+        }
+        result.completionData.numBytes     = async.totalBytesSent;
+        result.completionData.numDatagrams = async.numDatagramsSent;
+        // Allows re-sending the same buffers with Result::reactivateRequest
+        async.numDatagramsSent = 0;
+        async.totalBytesSent   = 0;
+        return Result(true);
+    }
+
+    //-------------------------------------------------------------------------------------------------------
+    // Socket RECEIVE FROM
+    //-------------------------------------------------------------------------------------------------------
+    static Result activateAsync(AsyncEventLoop&, AsyncSocketReceiveFrom& async)
+    {
+        // A single datagram is received per completion (in the first slot)
+        Span<char> slot = async.getDatagramSlot(0);
+
+        OVERLAPPED& overlapped = async.overlapped.get().overlapped;
+        WSABUF      buffer;
+        buffer.buf = slot.data();
+        buffer.len = static_cast<ULONG>(slot.sizeInBytes());
+        DWORD     transferred;
+        DWORD     flags   = 0;
+        sockaddr* address = &async.getDatagrams()[0].ipAddress.handle.reinterpret_as<sockaddr>();
+
+        async.addressLength = static_cast<int>(sizeof(async.getDatagrams()[0].ipAddress.handle));
+        const int res = ::WSARecvFrom(async.handle, &buffer, 1, &transferred, &flags, address, &async.addressLength,
+                                      &overlapped, nullptr);
+        SC_TRY_MSG(res != SOCKET_ERROR or WSAGetLastError() == WSA_IO_PENDING, "WSARecvFrom failed");
+        return Result(true);
+    }
+
+    static Result cancelAsync(AsyncEventLoop& eventLoop, AsyncSocketReceiveFrom& async)
+    {
+        BOOL res = ::CancelIoEx(reinterpret_cast<HANDLE>(async.handle), &async.overlapped.get().overlapped);
+        if (res == FALSE)
+        {
+            return Result::Error("AsyncSocketReceiveFrom: CancelEx failed");
+        }
+        // CancelIoEx queues a cancellation packet on the async queue
+        eventLoop.internal.hasPendingKernelCancellations = true;
+        return Result(true);
+    }
+
+    static Result completeAsync(AsyncSocketReceiveFrom::Result& result)
+    {
+        AsyncSocketReceiveFrom&           async    = result.getAsync();
+        AsyncSocketReceiveFrom::Datagram& datagram = async.getDatagrams()[0];
+
+        size_t numBytes;
+        SC_TRY(KernelQueue::checkWSAResult(async.handle, async.overlapped.get().overlapped, &numBytes));
+        SC_TRY(async.getDatagramSlot(0).sliceStartLength(0, numBytes, datagram.data));
+        datagram.segmentSize               = 0;
+        result.completionData.numBytes     = numBytes;
+        result.completionData.numDatagrams = 1;
+        return datagram.ipAddress.updateAddressFamily();
+    }
+
     //-------------------------------------------------------------------------------------------------------
     // Socket CLOSE
     //-------------------------------------------------------------------------------------------------------
@@ -662,6 +778,18 @@ struct SC::AsyncEventLoop::Internal::KernelEvents
         return Result(true);
     }
 
+    static Result cancelAsync(AsyncEventLoop& eventLoop, AsyncFileRead& async)
+    {
+        BOOL res = ::CancelIoEx(async.handle, &async.overlapped.get().overlapped);
+        if (res == FALSE and ::GetLastError() != ERROR_NOT_FOUND) // ERROR_NOT_FOUND: its packet is already queued
+        {
+            return Result::Error("AsyncFileRead: CancelEx failed");
+        }
+        // CancelIoEx queues a cancellation packet on the async queue
+        eventLoop.internal.hasPendingKernelCancellations = true;
+        return Result(true);
+    }
+
     static Result completeAsync(AsyncFileRead::Result& result)
     {
         return completeFileOperation(result, &result.completionData.endOfFile);
@@ -714,6 +842,18 @@ struct SC::AsyncEventLoop::Internal::KernelEvents
         }
     }
 
+    static Result cancelAsync(AsyncEventLoop& eventLoop, AsyncFileWrite& async)
+    {
+        BOOL res = ::CancelIoEx(async.handle, &async.overlapped.get().overlapped);
+        if (res == FALSE and ::GetLastError() != ERROR_NOT_FOUND) // ERROR_NOT_FOUND: its packet is already queued
+        {
+            return Result::Error("AsyncFileWrite: CancelEx failed");
+        }
+        // CancelIoEx queues a cancellation packet on the async queue
+        eventLoop.internal.hasPendingKernelCancellations = true;
+        return Result(true);
+    }
+
     static Result completeAsync(AsyncFileWrite::Result& result)
     {
         AsyncFileWrite& async = result.getAsync();
@@ -783,6 +923,118 @@ struct SC::AsyncEventLoop::Internal::KernelEvents
         return executeOperation(result.getAsync(), result.completionData);
     }
 
+    //-------------------------------------------------------------------------------------------------------
+    // File System OPERATION
+    //-------------------------------------------------------------------------------------------------------
+    Result setupAsync(AsyncEventLoop&, AsyncFileSystemOperation& async)
+    {
+        async.flags |= Internal::Flag_ManualCompletion;
+        return Result(true);
+    }
+
+    static Result openFile(AsyncFileSystemOperation& async, AsyncFileSystemOperation::CompletionData& completionData)
+    {
+        using OpenMode          = AsyncFileSystemOperation::OpenMode;
+        DWORD accessMode        = 0;
+        DWORD createDisposition = 0;
+        switch (async.openMode)
+        {
+        case OpenMode::ReadOnly:
+            accessMode        = FILE_GENERIC_READ;
+            createDisposition = OPEN_EXISTING;
+            break;
+        case OpenMode::WriteCreateTruncate:
+            accessMode        = FILE_GENERIC_WRITE;
+            createDisposition = CREATE_ALWAYS;
+            break;
+        case OpenMode::WriteAppend:
+            accessMode        = FILE_GENERIC_WRITE & ~FILE_WRITE_DATA; // FILE_APPEND_DATA only writes at the end
+            createDisposition = OPEN_EXISTING;
+            break;
+        case OpenMode::ReadAndWrite:
+            accessMode        = FILE_GENERIC_READ | FILE_GENERIC_WRITE;
+            createDisposition = OPEN_EXISTING;
+            break;
+        }
+        const DWORD  shareMode  = FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE;
+        const DWORD  attributes = FILE_ATTRIBUTE_NORMAL;
+        const HANDLE handle =
+            ::CreateFileW(async.path, accessMode, shareMode, nullptr, createDisposition, attributes, nullptr);
+        SC_TRY_MSG(handle != INVALID_HANDLE_VALUE, "AsyncFileSystemOperation - CreateFileW failed");
+        completionData.handle = handle;
+        return Result(true);
+    }
+
+    static Result allocateFile(HANDLE handle, uint64_t offset, uint64_t length)
+    {
+        LARGE_INTEGER fileSize;
+        SC_TRY_MSG(::GetFileSizeEx(handle, &fileSize) == TRUE, "AsyncFileSystemOperation - GetFileSizeEx failed");
+        const LONGLONG endOffset = static_cast<LONGLONG>(offset + length);
+        if (endOffset > fileSize.QuadPart)
+        {
+            FILE_ALLOCATION_INFO allocationInfo;
+            allocationInfo.AllocationSize.QuadPart = endOffset;
+            SC_TRY_MSG(::SetFileInformationByHandle(handle, FileAllocationInfo, &allocationInfo,
+                                                    sizeof(allocationInfo)) == TRUE,
+                       "AsyncFileSystemOperation - FileAllocationInfo failed");
+            FILE_END_OF_FILE_INFO endOfFileInfo;
+            endOfFileInfo.EndOfFile.QuadPart = endOffset;
+            SC_TRY_MSG(::SetFileInformationByHandle(handle, FileEndOfFileInfo, &endOfFileInfo,
+                                                    sizeof(endOfFileInfo)) == TRUE,
+                       "AsyncFileSystemOperation - FileEndOfFileInfo failed");
+        }
+        return Result(true);
+    }
+
+    static Result statFile(AsyncFileSystemOperation& async, AsyncFileSystemOperation::CompletionData& completionData)
+    {
+        WIN32_FILE_ATTRIBUTE_DATA data;
+        SC_TRY_MSG(::GetFileAttributesExW(async.path, GetFileExInfoStandard, &data) == TRUE,
+                   "AsyncFileSystemOperation - GetFileAttributesExW failed");
+        ULARGE_INTEGER fileTimeValue;
+        fileTimeValue.LowPart  = data.ftLastWriteTime.dwLowDateTime;
+        fileTimeValue.HighPart = data.ftLastWriteTime.dwHighDateTime;
+        fileTimeValue.QuadPart -= 116444736000000000ULL;
+
+        completionData.fileSize     = (static_cast<uint64_t>(data.nFileSizeHigh) << 32) | data.nFileSizeLow;
+        completionData.isDirectory  = (data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) != 0;
+        completionData.modifiedTime = Time::Realtime(static_cast<int64_t>(fileTimeValue.QuadPart / 10000ULL));
+        return Result(true);
+    }
+
+    static Result executeOperation(AsyncFileSystemOperation&                 async,
+                                   AsyncFileSystemOperation::CompletionData& completionData)
+    {
+        using Operation = AsyncFileSystemOperation::Operation;
+        switch (async.operation)
+        {
+        case Operation::None: return Result::Error("AsyncFileSystemOperation - No operation");
+        case Operation::Open: return openFile(async, completionData);
+        case Operation::Sync:
+            SC_TRY_MSG(::FlushFileBuffers(async.handle) == TRUE, "AsyncFileSystemOperation - FlushFileBuffers failed");
+            break;
+        case Operation::Allocate: return allocateFile(async.handle, async.offset, async.length);
+        case Operation::Stat: return statFile(async, completionData);
+        case Operation::RemoveFile:
+            SC_TRY_MSG(::DeleteFileW(async.path) == TRUE, "AsyncFileSystemOperation - DeleteFileW failed");
+            break;
+        case Operation::Rename:
+            SC_TRY_MSG(::MoveFileExW(async.path, async.newPath, MOVEFILE_REPLACE_EXISTING) == TRUE,
+                       "AsyncFileSystemOperation - MoveFileExW failed");
+            break;
+        case Operation::MakeDirectory:
+            SC_TRY_MSG(::CreateDirectoryW(async.path, nullptr) == TRUE,
+                       "AsyncFileSystemOperation - CreateDirectoryW failed");
+            break;
+        }
+        return Result(true);
+    }
+
+    Result completeAsync(AsyncFileSystemOperation::Result& result)
+    {
+        return executeOperation(result.getAsync(), result.completionData);
+    }
+
     //-------------------------------------------------------------------------------------------------------
     // Process EXIT
     //-------------------------------------------------------------------------------------------------------
@@ -143,6 +143,11 @@ struct SC::AsyncRequestWritableStream<AsyncWriteRequest>::Internal
         return detail::SocketDescriptorDefinition::releaseHandle(async.handle);
     }
 
+    static bool isBufferReusable(AsyncFileWrite::Result&) { return true; }
+
+    // Zero-copy socket sends complete before the kernel has finished reading from the buffer
+    static bool isBufferReusable(AsyncSocketSend::Result& result) { return result.completionData.bufferReusable; }
+
     template <typename DescriptorType>
     static Result init(AsyncRequestWritableStream& self, AsyncBuffersPool& buffersPool, Span<Request> requests,
                        AsyncEventLoop& eventLoop, const DescriptorType& descriptor)
@@ -192,6 +197,10 @@ SC::Result SC::AsyncRequestWritableStream<AsyncWriteRequest>::write(AsyncBufferV
     SC_TRY(getBuffersPool().getData(bufferID, request.buffer));
     request.callback = [this, bufferID](typename AsyncWriteRequest::Result& result)
     {
+        if (result.isValid() and not Internal::isBufferReusable(result))
+        {
+            return; // Keep the buffer referenced until request is invoked again, when buffer can be reused
+        }
         getBuffersPool().unrefBuffer(bufferID);
         auto callbackCopy = move(callback);
         callback          = {};
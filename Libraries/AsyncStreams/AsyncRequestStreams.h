@@ -74,6 +74,8 @@ struct ReadableSocketStream : public AsyncRequestReadableStream<AsyncSocketRecei
 };
 
 /// @brief Uses an SC::AsyncFileWrite to stream data to a socket
+/// @note Setting `request.zeroCopy = true` enables zero-copy sends (see SC::AsyncSocketSend), where buffers are kept
+/// referenced in the SC::AsyncBuffersPool until the kernel has finished reading from them.
 struct WritableSocketStream : public AsyncRequestWritableStream<AsyncSocketSend>
 {
     Result init(AsyncBuffersPool& buffersPool, Span<Request> requests, AsyncEventLoop& eventLoop,
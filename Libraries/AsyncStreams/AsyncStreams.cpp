@@ -3,26 +3,226 @@
 #include "AsyncStreams.h"
 #include "../Foundation/Assert.h"
 #include "../Foundation/Deferred.h"
+#include "../Foundation/Memory.h"
+
+#if SC_COMPILER_MSVC
+#include <intrin.h> // _BitScanForward64 / _BitScanReverse64
+#endif
 
 //-------------------------------------------------------------------------------------------------------
-// AsyncBufferView
+// AsyncBuffersPool
 //-------------------------------------------------------------------------------------------------------
+struct SC::AsyncBuffersPool::Slab
+{
+    size_t           numBuffers;
+    AsyncBufferView* views; // Followed by numBuffers * bufferSize bytes of data
+};
+
+struct SC::AsyncBuffersPool::Internal
+{
+    static constexpr size_t FirstSlabBuffers = 4; // Slab N holds FirstSlabBuffers << N buffers
+
+    static int floorLog2(uint64_t value)
+    {
+#if SC_COMPILER_MSVC
+        unsigned long index;
+        _BitScanReverse64(&index, value);
+        return static_cast<int>(index);
+#else
+        return 63 - __builtin_clzll(value);
+#endif
+    }
+
+    static int lowestBit(uint64_t value)
+    {
+#if SC_COMPILER_MSVC
+        unsigned long index;
+        _BitScanForward64(&index, value);
+        return static_cast<int>(index);
+#else
+        return __builtin_ctzll(value);
+#endif
+    }
+
+    // All buffers in size class N have sizes in the [2^N, 2^(N+1)) range (size class 0 holds also empty buffers)
+    static int sizeClassOf(size_t sizeInBytes) { return sizeInBytes == 0 ? 0 : floorLog2(sizeInBytes); }
+
+    static AsyncBufferView::ID::NumericType toNumeric(size_t index)
+    {
+        return static_cast<AsyncBufferView::ID::NumericType>(index);
+    }
+
+    static void pushFree(AsyncBuffersPool& pool, AsyncBufferView& buffer, size_t index)
+    {
+        const int sizeClass = sizeClassOf(buffer.data.sizeInBytes());
+
+        buffer.nextFree = (pool.freeListsMask & (1ULL << sizeClass)) ? pool.freeLists[sizeClass] : -1;
+        pool.freeLists[sizeClass] = toNumeric(index);
+        pool.freeListsMask |= 1ULL << sizeClass;
+    }
+
+    static AsyncBufferView* popFree(AsyncBuffersPool& pool, int sizeClass, AsyncBufferView::ID& bufferID)
+    {
+        bufferID.identifier = pool.freeLists[sizeClass];
+
+        AsyncBufferView* buffer   = pool.getBuffer(bufferID);
+        pool.freeLists[sizeClass] = buffer->nextFree;
+        if (buffer->nextFree < 0)
+        {
+            pool.freeListsMask &= ~(1ULL << sizeClass);
+        }
+        buffer->nextFree = -1;
+        return buffer;
+    }
+
+    static bool isIndexed(const AsyncBuffersPool& pool)
+    {
+        return pool.indexedBuffers.data() == pool.buffers.data() and
+               pool.indexedBuffers.sizeInElements() == pool.buffers.sizeInElements();
+    }
+
+    // Builds free lists of all unused buffers if user has changed AsyncBuffersPool::buffers
+    static void indexBuffers(AsyncBuffersPool& pool, bool force = false)
+    {
+        if (not force and isIndexed(pool))
+        {
+            return;
+        }
+        pool.indexedBuffers = pool.buffers;
+        pool.freeListsMask  = 0;
+
+        size_t numBuffers = pool.buffers.sizeInElements();
+        for (size_t slabIdx = 0; slabIdx < pool.numSlabs; ++slabIdx)
+        {
+            numBuffers += pool.slabs[slabIdx]->numBuffers;
+        }
+        // Push in reverse order so that lower indices are popped first
+        for (size_t idx = numBuffers; idx > 0; --idx)
+        {
+            AsyncBufferView* buffer = pool.getBuffer(AsyncBufferView::ID(toNumeric(idx - 1)));
+            if (buffer->refs == 0)
+            {
+                pushFree(pool, *buffer, idx - 1);
+            }
+        }
+        pool.stats.numBuffers = numBuffers;
+    }
+
+    // Searches a class that may contain buffers smaller than minimumSizeInBytes (not constant time)
+    static AsyncBufferView* popFreeFitting(AsyncBuffersPool& pool, int sizeClass, size_t minimumSizeInBytes,
+                                           AsyncBufferView::ID& bufferID)
+    {
+        AsyncBufferView* previous = nullptr;
+        for (auto index = pool.freeLists[sizeClass]; index >= 0;)
+        {
+            AsyncBufferView* buffer = pool.getBuffer(AsyncBufferView::ID(index));
+            if (buffer->data.sizeInBytes() >= minimumSizeInBytes)
+            {
+                if (previous == nullptr)
+                {
+                    return popFree(pool, sizeClass, bufferID);
+                }
+                previous->nextFree  = buffer->nextFree;
+                buffer->nextFree    = -1;
+                bufferID.identifier = index;
+                return buffer;
+            }
+            previous = buffer;
+            index    = buffer->nextFree;
+        }
+        return nullptr;
+    }
+
+    static Result allocateSlab(AsyncBuffersPool& pool, size_t minimumSizeInBytes)
+    {
+        SC_TRY_MSG(pool.numSlabs < pool.elasticMaxSlabs and pool.numSlabs < MaxSlabs,
+                   "AsyncBuffersPool::requestNewBuffer - Maximum number of elastic slabs reached");
+        size_t bufferSize = pool.elasticBufferSize;
+        while (bufferSize < minimumSizeInBytes)
+        {
+            bufferSize *= 2;
+        }
+        const size_t numBuffers = FirstSlabBuffers << pool.numSlabs;
+        const size_t totalSize  = sizeof(Slab) + numBuffers * (sizeof(AsyncBufferView) + bufferSize);
+
+        void* memory = Memory::allocate(totalSize, alignof(Slab));
+        SC_TRY_MSG(memory != nullptr, "AsyncBuffersPool::requestNewBuffer - Cannot allocate elastic slab");
+        Slab* slab       = reinterpret_cast<Slab*>(memory);
+        slab->numBuffers = numBuffers;
+        slab->views      = reinterpret_cast<AsyncBufferView*>(slab + 1);
+        char* data       = reinterpret_cast<char*>(slab->views + numBuffers);
+
+        const size_t firstIndex = pool.stats.numBuffers;
+
+        pool.slabs[pool.numSlabs++] = slab;
+        for (size_t idx = numBuffers; idx > 0; --idx)
+        {
+            AsyncBufferView* buffer = new (slab->views + idx - 1, PlacementNew()) AsyncBufferView();
+            buffer->data            = {data + (idx - 1) * bufferSize, bufferSize};
+            pushFree(pool, *buffer, firstIndex + idx - 1);
+        }
+        pool.stats.numSlabs = pool.numSlabs;
+        pool.stats.numBuffers += numBuffers;
+        pool.stats.slabsSizeInBytes += totalSize;
+        return Result(true);
+    }
+};
+
+SC::AsyncBuffersPool::~AsyncBuffersPool()
+{
+    for (size_t idx = 0; idx < numSlabs; ++idx)
+    {
+        Memory::release(slabs[idx]);
+    }
+}
+
+SC::Result SC::AsyncBuffersPool::releaseSlabs()
+{
+    for (size_t slabIdx = 0; slabIdx < numSlabs; ++slabIdx)
+    {
+        for (size_t idx = 0; idx < slabs[slabIdx]->numBuffers; ++idx)
+        {
+            SC_TRY_MSG(slabs[slabIdx]->views[idx].refs == 0, "AsyncBuffersPool::releaseSlabs - Buffers in use");
+        }
+    }
+    for (size_t idx = 0; idx < numSlabs; ++idx)
+    {
+        Memory::release(slabs[idx]);
+    }
+    numSlabs               = 0;
+    stats.numSlabs         = 0;
+    stats.slabsSizeInBytes = 0;
+    Internal::indexBuffers(*this, true); // Rebuild free lists without slab buffers
+    return Result(true);
+}
+
 void SC::AsyncBuffersPool::refBuffer(AsyncBufferView::ID bufferID)
 {
-    AsyncBufferView* buffer = buffers.get(bufferID.identifier);
+    AsyncBufferView* buffer = getBuffer(bufferID);
     SC_ASSERT_RELEASE(buffer);
     buffer->refs++;
 }
 
 void SC::AsyncBuffersPool::unrefBuffer(AsyncBufferView::ID bufferID)
 {
-    AsyncBufferView* buffer = buffers.get(bufferID.identifier);
+    AsyncBufferView* buffer = getBuffer(bufferID);
     SC_ASSERT_RELEASE(buffer);
     SC_ASSERT_RELEASE(buffer->refs != 0);
     buffer->refs--;
     if (buffer->refs == 0)
     {
         buffer->data = buffer->originalData;
+        stats.numInUse--;
+        if (Internal::isIndexed(*this))
+        {
+            Internal::pushFree(*this, *buffer, static_cast<size_t>(bufferID.identifier));
+        }
+        if (starving)
+        {
+            starving = false;
+            stats.waitTimeNs += static_cast<uint64_t>(
+                Time::HighResolutionCounter().snap().subtractExact(starvingSince).toNanoseconds().ns);
+        }
     }
 }
 
@@ -36,7 +236,7 @@ SC::Result SC::AsyncBuffersPool::getData(AsyncBufferView::ID bufferID, Span<cons
 
 SC::Result SC::AsyncBuffersPool::getData(AsyncBufferView::ID bufferID, Span<char>& data)
 {
-    AsyncBufferView* buffer = buffers.get(bufferID.identifier);
+    AsyncBufferView* buffer = getBuffer(bufferID);
     if (buffer == nullptr)
     {
         return Result::Error("AsyncBuffersPool::getData - Invalid bufferID");
@@ -47,28 +247,75 @@ SC::Result SC::AsyncBuffersPool::getData(AsyncBufferView::ID bufferID, Span<char
 
 SC::AsyncBufferView* SC::AsyncBuffersPool::getBuffer(AsyncBufferView::ID bufferID)
 {
-    return buffers.get(bufferID.identifier);
+    if (bufferID.identifier < 0)
+    {
+        return nullptr;
+    }
+    const size_t index = static_cast<size_t>(bufferID.identifier);
+    if (index < buffers.sizeInElements())
+    {
+        return buffers.begin() + index;
+    }
+    // Slab N starts at offset FirstSlabBuffers * (2^N - 1) after user provided buffers
+    const size_t offset  = index - buffers.sizeInElements();
+    const size_t slabIdx = static_cast<size_t>(Internal::floorLog2(offset / Internal::FirstSlabBuffers + 1));
+    if (slabIdx >= numSlabs)
+    {
+        return nullptr;
+    }
+    const size_t slabStart = Internal::FirstSlabBuffers * ((size_t(1) << slabIdx) - 1);
+    return slabs[slabIdx]->views + (offset - slabStart);
 }
 
 SC::Result SC::AsyncBuffersPool::requestNewBuffer(size_t minimumSizeInBytes, AsyncBufferView::ID& bufferID,
                                                   Span<char>& data)
 {
-    for (AsyncBufferView& buffer : buffers)
+    Internal::indexBuffers(*this);
+
+    // All buffers in size classes >= ceil(log2(minimumSizeInBytes)) are large enough
+    const int floorClass = Internal::sizeClassOf(minimumSizeInBytes);
+    const int ceilClass  = floorClass + ((minimumSizeInBytes & (minimumSizeInBytes - 1)) != 0 ? 1 : 0);
+
+    AsyncBufferView* buffer = nullptr;
+
+    const uint64_t fittingMask = ceilClass < NumSizeClasses ? freeListsMask & (~0ULL << ceilClass) : 0;
+    if (fittingMask != 0)
+    {
+        buffer = Internal::popFree(*this, Internal::lowestBit(fittingMask), bufferID);
+    }
+    else if (floorClass != ceilClass and (freeListsMask & (1ULL << floorClass)) != 0)
+    {
+        buffer = Internal::popFreeFitting(*this, floorClass, minimumSizeInBytes, bufferID);
+    }
+    if (buffer == nullptr and elasticBufferSize > 0 and Internal::allocateSlab(*this, minimumSizeInBytes))
     {
-        if (buffer.refs == 0 and buffer.data.sizeInBytes() >= minimumSizeInBytes)
+        return requestNewBuffer(minimumSizeInBytes, bufferID, data);
+    }
+    if (buffer == nullptr)
+    {
+        if (not starving)
         {
-            buffer.refs         = 1;
-            buffer.originalData = buffer.data;
-            bufferID = AsyncBufferView::ID(static_cast<AsyncBufferView::ID::NumericType>(&buffer - buffers.begin()));
-            return getData(bufferID, data);
+            starving = true;
+            starvingSince.snap();
         }
+        stats.numStarvations++;
+        return Result::Error("AsyncBuffersPool::requestNewBuffer failed");
+    }
+    buffer->refs         = 1;
+    buffer->originalData = buffer->data;
+    stats.numRequests++;
+    stats.numInUse++;
+    if (stats.numInUse > stats.highWaterMark)
+    {
+        stats.highWaterMark = stats.numInUse;
     }
-    return Result::Error("AsyncBuffersPool::requestNewBuffer failed");
+    data = buffer->data;
+    return Result(true);
 }
 
 void SC::AsyncBuffersPool::setNewBufferSize(AsyncBufferView::ID bufferID, size_t newSizeInBytes)
 {
-    AsyncBufferView* buffer = buffers.get(bufferID.identifier);
+    AsyncBufferView* buffer = getBuffer(bufferID);
     if (buffer and (newSizeInBytes < buffer->originalData.sizeInBytes()))
     {
         buffer->data = {buffer->data.data(), newSizeInBytes};
@@ -6,6 +6,7 @@
 #include "../Foundation/Result.h"
 #include "../Foundation/Span.h"
 #include "../Foundation/StrongID.h"
+#include "../Time/Time.h"
 #include "Internal/CircularQueue.h"
 #include "Internal/Event.h"
 
@@ -58,15 +59,48 @@ struct AsyncBufferView
     friend struct AsyncBuffersPool;
 
     int32_t refs = 0; // Counts AsyncReadable (single) or AsyncWritable (multiple) using it
+
+    ID::NumericType nextFree = -1; // Next buffer in the free list of same size class
 };
 
 /// @brief Holds a Span of AsyncBufferView (allocated by user) holding available memory for the streams
 /// @note User must fill the AsyncBuffersPool::buffers with a `Span` of AsyncBufferView
+///
+/// Free buffers are kept in intrusive free lists bucketed by power of two size class, so that
+/// AsyncBuffersPool::requestNewBuffer and AsyncBuffersPool::unrefBuffer run in constant time regardless of the number
+/// of buffers in the pool. @n
+/// When AsyncBuffersPool::elasticBufferSize is set, the pool grows by allocating additional slabs of buffers instead
+/// of failing AsyncBuffersPool::requestNewBuffer when all buffers are in use.
 struct AsyncBuffersPool
 {
     /// @brief Span of buffers to be filled in by the user
+    /// @note Buffers must not be modified while some of them are in use
     Span<AsyncBufferView> buffers;
 
+    /// @brief Size in bytes of buffers allocated in elastic mode (`0` disables elastic mode, that is the default)
+    size_t elasticBufferSize = 0;
+
+    /// @brief Maximum number of slabs allocated in elastic mode (each slab doubles number of buffers of previous one)
+    size_t elasticMaxSlabs = 8;
+
+    /// @brief Pool-wide usage statistics
+    struct Stats
+    {
+        size_t   numBuffers       = 0; ///< Number of buffers in the pool (including the ones allocated in slabs)
+        size_t   numInUse         = 0; ///< Number of buffers currently referenced
+        size_t   highWaterMark    = 0; ///< Maximum number of buffers referenced at the same time
+        size_t   numSlabs         = 0; ///< Number of slabs allocated in elastic mode
+        size_t   slabsSizeInBytes = 0; ///< Total memory allocated by slabs in elastic mode
+        uint64_t numRequests      = 0; ///< Number of successful AsyncBuffersPool::requestNewBuffer calls
+        uint64_t numStarvations   = 0; ///< Number of AsyncBuffersPool::requestNewBuffer failed for lack of buffers
+        uint64_t waitTimeNs       = 0; ///< Total nanoseconds between a starvation and the next buffer release
+    };
+
+    AsyncBuffersPool() = default;
+    ~AsyncBuffersPool();
+    AsyncBuffersPool(const AsyncBuffersPool&)            = delete;
+    AsyncBuffersPool& operator=(const AsyncBuffersPool&) = delete;
+
     /// @brief Increments a buffer reference count
     void refBuffer(AsyncBufferView::ID bufferID);
 
@@ -84,10 +118,37 @@ struct AsyncBuffersPool
     AsyncBufferView* getBuffer(AsyncBufferView::ID bufferID);
 
     /// @brief Requests a new available buffer that is at least minimumSizeInBytes, incrementing its refcount
+    /// @note The smallest size class holding a large enough buffer is used, and the most recently released buffer
+    /// in that class is returned first (as its memory is more likely to be still in CPU caches)
     Result requestNewBuffer(size_t minimumSizeInBytes, AsyncBufferView::ID& bufferID, Span<char>& data);
 
     /// @brief Sets the new size in bytes for the buffer
     void setNewBufferSize(AsyncBufferView::ID bufferID, size_t newSizeInBytes);
+
+    /// @brief Obtains pool-wide usage statistics
+    [[nodiscard]] const Stats& getStats() const { return stats; }
+
+    /// @brief Releases all slabs allocated in elastic mode (all of their buffers must be unused)
+    Result releaseSlabs();
+
+  private:
+    struct Internal;
+    struct Slab;
+
+    static constexpr int NumSizeClasses = 64;
+    static constexpr int MaxSlabs       = 32;
+
+    AsyncBufferView::ID::NumericType freeLists[NumSizeClasses];
+    uint64_t                         freeListsMask = 0; // Bit N set when freeLists[N] is not empty
+
+    Span<AsyncBufferView> indexedBuffers; // Value of buffers when free lists have been built
+
+    Slab*  slabs[MaxSlabs] = {nullptr};
+    size_t numSlabs        = 0;
+
+    Stats                       stats;
+    bool                        starving = false;
+    Time::HighResolutionCounter starvingSince;
 };
 
 /// @brief Async source abstraction emitting data events in caller provided byte buffers.
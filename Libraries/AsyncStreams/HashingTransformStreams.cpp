@@ -0,0 +1,128 @@
+// Copyright (c) Stefano Cristiano
+// SPDX-License-Identifier: MIT
+#include "HashingTransformStreams.h"
+
+//-------------------------------------------------------------------------------------------------------
+// AsyncHashingTransformStream
+//-------------------------------------------------------------------------------------------------------
+SC::AsyncHashingTransformStream::AsyncHashingTransformStream()
+{
+    using Self = AsyncHashingTransformStream;
+    AsyncWritableStream::asyncWrite.bind<Self, &Self::transform>(*this);
+    AsyncWritableStream::canEndWritable.bind<Self, &Self::canEndTransform>(*this);
+    asyncWork.work.bind<Self, &Self::work>(*this);
+    asyncWork.callback.bind<Self, &Self::afterWork>(*this);
+}
+
+SC::Result SC::AsyncHashingTransformStream::init(AsyncBuffersPool&                  buffersPool,
+                                                 Span<AsyncReadableStream::Request> readableRequests,
+                                                 Span<AsyncWritableStream::Request> writableRequests,
+                                                 Algorithm                          newAlgorithm)
+{
+    algorithm   = newAlgorithm;
+    digestReady = false;
+    ended       = false;
+    switch (algorithm)
+    {
+    case AlgorithmMD5: SC_TRY_MSG(hashing.setType(Hashing::TypeMD5), "Cannot init MD5"); break;
+    case AlgorithmSHA1: SC_TRY_MSG(hashing.setType(Hashing::TypeSHA1), "Cannot init SHA1"); break;
+    case AlgorithmSHA256: SC_TRY_MSG(hashing.setType(Hashing::TypeSHA256), "Cannot init SHA256"); break;
+    case AlgorithmCRC32C: SC_TRY_MSG(checksum.setType(Checksum::TypeCRC32C), "Cannot init CRC32C"); break;
+    case AlgorithmXXHash64: SC_TRY_MSG(checksum.setType(Checksum::TypeXXHash64), "Cannot init XXHash64"); break;
+    }
+    return AsyncDuplexStream::init(buffersPool, readableRequests, writableRequests);
+}
+
+bool SC::AsyncHashingTransformStream::getDigest(Hashing::Result& res) const
+{
+    if (digestReady)
+    {
+        res = digest;
+    }
+    return digestReady;
+}
+
+SC::Result SC::AsyncHashingTransformStream::transform(AsyncBufferView::ID                 bufferID,
+                                                      Function<void(AsyncBufferView::ID)> cb)
+{
+    // Writable side issues a new write only after finishedWriting, so there's at most one buffer in flight
+    SC_TRY(AsyncWritableStream::getBuffersPool().getData(bufferID, inputData));
+    inputBufferID = bufferID;
+    inputCallback = move(cb);
+    processing    = true;
+    if (eventLoop != nullptr)
+    {
+        return asyncWork.start(*eventLoop);
+    }
+    afterHash(work());
+    return Result(true);
+}
+
+SC::Result SC::AsyncHashingTransformStream::work()
+{
+    // Runs on a ThreadPool thread when an event loop has been set
+    const Span<const uint8_t> data = {reinterpret_cast<const uint8_t*>(inputData.data()), inputData.sizeInBytes()};
+    switch (algorithm)
+    {
+    case AlgorithmMD5:
+    case AlgorithmSHA1:
+    case AlgorithmSHA256: SC_TRY_MSG(hashing.add(data), "AsyncHashingTransformStream - Hashing::add failed"); break;
+    case AlgorithmCRC32C:
+    case AlgorithmXXHash64: SC_TRY_MSG(checksum.add(data), "AsyncHashingTransformStream - Checksum::add failed"); break;
+    }
+    return Result(true);
+}
+
+void SC::AsyncHashingTransformStream::afterWork(AsyncLoopWork::Result& result) { afterHash(result.isValid()); }
+
+void SC::AsyncHashingTransformStream::afterHash(Result result)
+{
+    if (not result)
+    {
+        AsyncWritableStream::emitError(result);
+        return;
+    }
+    // Data is forwarded as is, sharing the same buffer with downstream streams
+    if (not inputData.empty())
+    {
+        AsyncReadableStream::push(inputBufferID, inputData.sizeInBytes());
+    }
+    auto bufferID = inputBufferID;
+    auto callback = move(inputCallback);
+    inputCallback = {};
+    inputData     = {};
+    processing    = false;
+    AsyncWritableStream::finishedWriting(bufferID, move(callback), Result(true));
+}
+
+bool SC::AsyncHashingTransformStream::canEndTransform()
+{
+    if (processing)
+    {
+        return false; // Pushing last buffer downstream can resume (and try ending) this stream before finishedWriting
+    }
+    if (not ended)
+    {
+        ended    = true;
+        bool res = false;
+        switch (algorithm)
+        {
+        case AlgorithmMD5:
+        case AlgorithmSHA1:
+        case AlgorithmSHA256: res = hashing.getHash(digest); break;
+        case AlgorithmCRC32C:
+        case AlgorithmXXHash64: res = checksum.getHash(digest); break;
+        }
+        if (not res)
+        {
+            AsyncWritableStream::emitError(Result::Error("AsyncHashingTransformStream - Cannot compute digest"));
+        }
+        digestReady = res;
+        if (digestReady)
+        {
+            eventDigest.emit(digest);
+        }
+        AsyncReadableStream::pushEnd();
+    }
+    return true;
+}
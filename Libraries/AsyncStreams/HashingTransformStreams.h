@@ -0,0 +1,80 @@
+// Copyright (c) Stefano Cristiano
+// SPDX-License-Identifier: MIT
+#pragma once
+#include "../Async/Async.h"
+#include "../Hashing/Checksum.h"
+#include "../Hashing/Hashing.h"
+#include "AsyncStreams.h"
+namespace SC
+{
+//! @addtogroup group_async_streams
+//! @{
+
+/// @brief A pass-through transform computing a hash (or checksum) of all data flowing through it.
+/// @n
+/// Every written buffer is added to SC::Hashing (MD5, SHA1, SHA256) or SC::Checksum (CRC32C, XXH64) and then pushed
+/// downstream unmodified, without copying it, so that integrity can be verified while streaming, for example in a
+/// `ReadableFileStream -> AsyncHashingTransformStream -> WritableSocketStream` pipeline.
+/// The digest is emitted with SC::AsyncHashingTransformStream::eventDigest just before the readable side ends.
+/// @n
+/// When an event loop is set with AsyncHashingTransformStream::setEventLoop, hashing happens on the ThreadPool
+/// assigned to AsyncHashingTransformStream::asyncWork, keeping digest computation off the event loop thread.
+/// Otherwise data is hashed synchronously on the calling thread.
+///
+/// \snippet Tests/Libraries/AsyncStreams/HashingTransformStreamsTest.cpp AsyncHashingTransformStreamSnippet
+struct AsyncHashingTransformStream : public AsyncDuplexStream
+{
+    enum Algorithm
+    {
+        AlgorithmMD5,     ///< MD5 (computed with SC::Hashing)
+        AlgorithmSHA1,    ///< SHA1 (computed with SC::Hashing)
+        AlgorithmSHA256,  ///< SHA256 (computed with SC::Hashing)
+        AlgorithmCRC32C,  ///< CRC-32C (computed with SC::Checksum)
+        AlgorithmXXHash64 ///< XXH64 (computed with SC::Checksum)
+    };
+
+    AsyncHashingTransformStream();
+
+    Event<AsyncReadableStream::MaxListeners, Hashing::Result> eventDigest; ///< Emitted with digest of all data
+
+    AsyncLoopWork asyncWork; ///< Assign a ThreadPool to it (and set an event loop) to hash on a background thread
+
+    /// @brief Sets the event loop used to hash on the ThreadPool assigned to asyncWork
+    void setEventLoop(AsyncEventLoop& loop) { eventLoop = &loop; }
+
+    /// @brief Initializes the stream
+    /// @param buffersPool Pool shared with the other streams of the pipeline
+    /// @param readableRequests Queue for the readable (output) side of the stream
+    /// @param writableRequests Queue for the writable (input) side of the stream
+    /// @param algorithm Hash or checksum to compute
+    Result init(AsyncBuffersPool& buffersPool, Span<AsyncReadableStream::Request> readableRequests,
+                Span<AsyncWritableStream::Request> writableRequests, Algorithm algorithm);
+
+    /// @brief Obtains the digest after the stream has ended (the same emitted by eventDigest)
+    [[nodiscard]] bool getDigest(Hashing::Result& res) const;
+
+  private:
+    AsyncEventLoop* eventLoop = nullptr;
+
+    Algorithm algorithm = AlgorithmSHA256;
+    Hashing   hashing;
+    Checksum  checksum;
+
+    Hashing::Result digest;
+    bool            digestReady = false;
+    bool            ended       = false;
+    bool            processing  = false;
+
+    AsyncBufferView::ID                 inputBufferID;
+    Span<const char>                    inputData;
+    Function<void(AsyncBufferView::ID)> inputCallback;
+
+    Result transform(AsyncBufferView::ID bufferID, Function<void(AsyncBufferView::ID)> cb);
+    bool   canEndTransform();
+    Result work();
+    void   afterWork(AsyncLoopWork::Result& result);
+    void   afterHash(Result result);
+};
+
+//! @}
+} // namespace SC
@@ -0,0 +1,137 @@
+// Copyright (c) Stefano Cristiano
+// SPDX-License-Identifier: MIT
+#pragma once
+#include "../../Foundation/Result.h"
+#include "../../Foundation/Span.h"
+namespace SC
+{
+//! @addtogroup group_async_streams
+//! @{
+
+/// @brief Compresses or decompresses byte streams using the LZ4 frame format.
+/// @n
+/// The codec is implemented in-tree, without any external dependency, and it interoperates with the `lz4` command
+/// line tool and any other library supporting the LZ4 frame format. @n
+/// Compression is an order of magnitude faster than zlib (at the cost of a lower compression ratio) and decompression
+/// runs at multiple GB/s, making it suitable for hot-path network payloads or large snapshot files. @n
+/// Data can be added until needed with SC::LZ4Stream::process call.
+/// SC::LZ4Stream::finalize will compute any end-of-stream data if needed.
+/// @note Compressor produces independent 64 KB blocks with a content checksum. Decompressor accepts all block sizes
+/// (up to 4 MB), linked or independent blocks, block and content checksums, skippable and concatenated frames.
+struct LZ4Stream
+{
+    enum Algorithm
+    {
+        Compress,  ///< Compress into LZ4 frame format
+        Decompress ///< Decompress from LZ4 frame format
+    };
+
+    /// @brief Initializes an LZ4Stream struct
+    LZ4Stream() = default;
+
+    /// @brief Destroys an LZ4Stream struct, releasing its internal buffers
+    ~LZ4Stream();
+
+    LZ4Stream(const LZ4Stream&)            = delete;
+    LZ4Stream(LZ4Stream&&)                 = delete;
+    LZ4Stream& operator=(const LZ4Stream&) = delete;
+    LZ4Stream& operator=(LZ4Stream&&)      = delete;
+
+    /// @brief Inits the compressor / decompressor, allocating its internal buffers
+    /// @param wantedAlgorithm Compress or Decompress
+    /// @return Valid Result if the algorithm has been inited successfully
+    [[nodiscard]] Result init(Algorithm wantedAlgorithm);
+
+    /// @brief Add data to be processed. Can be called multiple times before LZ4Stream::finalize.
+    /// @param input Span containing data to be processed, that will be modified pointing to data not (yet)
+    /// processed due to insufficient output space.
+    /// @param output Writable memory receiving processed data. It will then point to unused memory.
+    /// @return Valid Result if data has been processed successfully
+    [[nodiscard]] Result process(Span<const char>& input, Span<char>& output);
+
+    /// @brief Finalize stream by flushing last block, end mark and checksums (if compressing)
+    /// @param output Writable memory receiving processed data. It will then point to unused memory.
+    /// @param streamEnded Will be set to `true` if the stream has ended.
+    /// @return Valid Result if no error has happened during finalization
+    [[nodiscard]] Result finalize(Span<char>& output, bool& streamEnded);
+
+    /// @brief Compresses a single LZ4 block (without any frame format header)
+    /// @param input Data to be compressed
+    /// @param output Receives compressed data, must be at least LZ4Stream::getBlockBound(input.sizeInBytes()) bytes
+    /// @return Number of bytes written to output or 0 if output is too small
+    static size_t compressBlock(Span<const char> input, Span<char> output);
+
+    /// @brief Decompresses a single LZ4 block (without any frame format header)
+    /// @param input Data to be decompressed
+    /// @param output Receives decompressed data
+    /// @param prefixSize How many bytes immediately before output.data() can be referenced by matches (linked blocks)
+    /// @param outputSize Number of bytes written to output
+    /// @return Valid Result if input is a valid LZ4 block that fits in output
+    [[nodiscard]] static Result decompressBlock(Span<const char> input, Span<char> output, size_t prefixSize,
+                                               size_t& outputSize);
+
+    /// @brief Returns the maximum size of compressing inputSize bytes in a single LZ4 block
+    static constexpr size_t getBlockBound(size_t inputSize) { return inputSize + inputSize / 255 + 16; }
+
+  private:
+    struct Internal;
+    struct Hash32
+    {
+        uint32_t state[4]   = {0};
+        uint32_t totalSize  = 0;
+        uint32_t bufferSize = 0;
+        bool     large      = false;
+        char     buffer[16] = {0};
+    };
+
+    enum class State
+    {
+        Constructed,
+        Header,         // Compressor: writing header / Decompressor: reading magic number
+        FrameDescriptor,
+        SkippableFrame,
+        BlockHeader,
+        BlockData,
+        BlockChecksum,
+        BlockOutput,
+        ContentChecksum,
+        Ended,
+    };
+    State     state     = State::Constructed;
+    Algorithm algorithm = Algorithm::Compress;
+
+    Hash32 contentHash;
+
+    char*  memory     = nullptr; // Internal buffers (hash table, blocks and history)
+    size_t memorySize = 0;
+
+    // Small staging area for headers and checksums
+    char   header[20] = {0};
+    size_t headerSize = 0; // Bytes needed in header (decompression) or available (compression)
+    size_t headerUsed = 0; // Bytes already read (decompression) or written (compression)
+
+    // Frame properties
+    bool   blockIndependent   = true;
+    bool   hasBlockChecksum   = false;
+    bool   hasContentChecksum = false;
+    size_t blockMaxSize       = 0;
+
+    // Current block
+    bool   blockUncompressed = false;
+    size_t blockSize         = 0; // Compressed size (decompression) or accumulated input (compression)
+    size_t blockUsed         = 0;
+    size_t skipSize          = 0;
+
+    // Pending decompressed (or compressed) output
+    char*  pendingData = nullptr;
+    size_t pendingSize = 0;
+    size_t historySize = 0; // Decompressed bytes kept as history for linked blocks
+
+    Result allocate(size_t numBytes);
+    Result compress(Span<const char>& input, Span<char>& output);
+    Result compressFinalize(Span<char>& output, bool& streamEnded);
+    Result decompress(Span<const char>& input, Span<char>& output, bool& streamEnded);
+};
+
+//! @}
+} // namespace SC
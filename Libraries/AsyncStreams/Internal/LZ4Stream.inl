@@ -0,0 +1,945 @@
+// Copyright (c) Stefano Cristiano
+// SPDX-License-Identifier: MIT
+#pragma once
+
+#include "../../Foundation/Assert.h"
+#include "../../Foundation/Memory.h"
+#include "LZ4Stream.h"
+
+#include <string.h> // memcpy
+
+// LZ4 frame format: https://github.com/lz4/lz4/blob/dev/doc/lz4_Frame_format.md
+// LZ4 block format: https://github.com/lz4/lz4/blob/dev/doc/lz4_Block_format.md
+// All multi-byte values in both formats are little endian, as all platforms supported by this library.
+struct SC::LZ4Stream::Internal
+{
+    static constexpr uint32_t FrameMagic       = 0x184D2204;
+    static constexpr uint32_t SkippableMagic   = 0x184D2A50; // Lower 4 bits can have any value
+    static constexpr uint32_t UncompressedFlag = 0x80000000;
+
+    static constexpr size_t CompressBlockSize = 64 * 1024; // Block size produced by the compressor
+    static constexpr size_t MaxOffset         = 65535;     // Maximum distance of a match
+    static constexpr size_t HistorySize       = 64 * 1024; // History kept for linked blocks
+    static constexpr size_t MinMatch          = 4;
+    static constexpr size_t LastLiterals      = 5;  // Last bytes of a block are always literals
+    static constexpr size_t MatchFindLimit    = 12; // A match can't start in the last 12 bytes of a block
+    static constexpr int    HashLog           = 12;
+    static constexpr int    SkipTrigger       = 6; // Skip faster over incompressible data
+
+    static constexpr size_t getCompressorMemory() { return CompressBlockSize + 4 + getBlockBound(CompressBlockSize); }
+
+    //---------------------------------------------------------------------------------------------------
+    // Memory access
+    //---------------------------------------------------------------------------------------------------
+    static uint32_t read32(const uint8_t* ptr)
+    {
+        uint32_t value;
+        memcpy(&value, ptr, sizeof(value));
+        return value;
+    }
+
+    static uint64_t read64(const uint8_t* ptr)
+    {
+        uint64_t value;
+        memcpy(&value, ptr, sizeof(value));
+        return value;
+    }
+
+    static void write32(char* ptr, uint32_t value) { memcpy(ptr, &value, sizeof(value)); }
+
+    static void copy8(uint8_t* dst, const uint8_t* src) { memcpy(dst, src, 8); }
+
+    // Copies in 16 bytes chunks, writing (and reading) up to 15 bytes past the given size
+    static void wildCopy(uint8_t* dst, const uint8_t* src, size_t size)
+    {
+        uint8_t* const dstEnd = dst + size;
+        do
+        {
+            copy8(dst, src);
+            copy8(dst + 8, src + 8);
+            dst += 16;
+            src += 16;
+        } while (dst < dstEnd);
+    }
+
+    //---------------------------------------------------------------------------------------------------
+    // XXH32 (used for header, block and content checksums)
+    //---------------------------------------------------------------------------------------------------
+    static constexpr uint32_t Prime1 = 2654435761U;
+    static constexpr uint32_t Prime2 = 2246822519U;
+    static constexpr uint32_t Prime3 = 3266489917U;
+    static constexpr uint32_t Prime4 = 668265263U;
+    static constexpr uint32_t Prime5 = 374761393U;
+
+    static uint32_t rotl(uint32_t value, int bits) { return (value << bits) | (value >> (32 - bits)); }
+
+    static uint32_t round(uint32_t acc, uint32_t input) { return rotl(acc + input * Prime2, 13) * Prime1; }
+
+    static void hashReset(Hash32& hash)
+    {
+        hash            = Hash32();
+        hash.state[0]   = Prime1 + Prime2;
+        hash.state[1]   = Prime2;
+        hash.state[2]   = 0;
+        hash.state[3]   = 0 - Prime1;
+        hash.totalSize  = 0;
+        hash.bufferSize = 0;
+        hash.large      = false;
+    }
+
+    static void hashStripes(Hash32& hash, const uint8_t*& ptr, const uint8_t* end)
+    {
+        uint32_t v1 = hash.state[0], v2 = hash.state[1], v3 = hash.state[2], v4 = hash.state[3];
+        while (end - ptr >= 16)
+        {
+            v1 = round(v1, read32(ptr));
+            v2 = round(v2, read32(ptr + 4));
+            v3 = round(v3, read32(ptr + 8));
+            v4 = round(v4, read32(ptr + 12));
+            ptr += 16;
+        }
+        hash.state[0] = v1, hash.state[1] = v2, hash.state[2] = v3, hash.state[3] = v4;
+    }
+
+    static void hashUpdate(Hash32& hash, const void* data, size_t size)
+    {
+        const uint8_t* ptr = static_cast<const uint8_t*>(data);
+        const uint8_t* end = ptr + size;
+
+        hash.totalSize += static_cast<uint32_t>(size);
+        hash.large = hash.large or size >= 16 or hash.totalSize >= 16;
+        if (hash.bufferSize + size < 16)
+        {
+            memcpy(hash.buffer + hash.bufferSize, ptr, size);
+            hash.bufferSize += static_cast<uint32_t>(size);
+            return;
+        }
+        if (hash.bufferSize > 0)
+        {
+            const size_t toCopy = 16 - hash.bufferSize;
+            memcpy(hash.buffer + hash.bufferSize, ptr, toCopy);
+            ptr += toCopy;
+            const uint8_t* bufferPtr = reinterpret_cast<const uint8_t*>(hash.buffer);
+            hashStripes(hash, bufferPtr, bufferPtr + 16);
+            hash.bufferSize = 0;
+        }
+        hashStripes(hash, ptr, end);
+        memcpy(hash.buffer, ptr, static_cast<size_t>(end - ptr));
+        hash.bufferSize = static_cast<uint32_t>(end - ptr);
+    }
+
+    static uint32_t hashDigest(const Hash32& hash)
+    {
+        uint32_t value;
+        if (hash.large)
+        {
+            value = rotl(hash.state[0], 1) + rotl(hash.state[1], 7) + rotl(hash.state[2], 12) + rotl(hash.state[3], 18);
+        }
+        else
+        {
+            value = hash.state[2] + Prime5;
+        }
+        value += hash.totalSize;
+
+        const uint8_t* ptr = reinterpret_cast<const uint8_t*>(hash.buffer);
+        const uint8_t* end = ptr + hash.bufferSize;
+        while (end - ptr >= 4)
+        {
+            value = rotl(value + read32(ptr) * Prime3, 17) * Prime4;
+            ptr += 4;
+        }
+        while (ptr < end)
+        {
+            value = rotl(value + (*ptr) * Prime5, 11) * Prime1;
+            ptr++;
+        }
+        value ^= value >> 15;
+        value *= Prime2;
+        value ^= value >> 13;
+        value *= Prime3;
+        value ^= value >> 16;
+        return value;
+    }
+
+    static uint32_t hash(const void* data, size_t size)
+    {
+        Hash32 hashState;
+        hashReset(hashState);
+        hashUpdate(hashState, data, size);
+        return hashDigest(hashState);
+    }
+
+    //---------------------------------------------------------------------------------------------------
+    // Block compression
+    //---------------------------------------------------------------------------------------------------
+    // Hashing 5 bytes finds noticeably more matches than 4 bytes on text-like data (it's always safe to read 8 bytes
+    // as positions being hashed are at least MatchFindLimit bytes before the end of the block)
+    static uint32_t hashPosition(const uint8_t* ptr)
+    {
+        return static_cast<uint32_t>(((read64(ptr) << 24) * 889523592379ULL) >> (64 - HashLog));
+    }
+
+    static size_t countMatch(const uint8_t* ip, const uint8_t* match, const uint8_t* limit)
+    {
+        const uint8_t* start = ip;
+        while (limit - ip >= 8)
+        {
+            if (read64(ip) != read64(match))
+            {
+                break;
+            }
+            ip += 8;
+            match += 8;
+        }
+        while (ip < limit and *ip == *match)
+        {
+            ip++;
+            match++;
+        }
+        return static_cast<size_t>(ip - start);
+    }
+
+    static uint8_t* writeLength(uint8_t* op, size_t length)
+    {
+        for (; length >= 255; length -= 255)
+        {
+            *op++ = 255;
+        }
+        *op++ = static_cast<uint8_t>(length);
+        return op;
+    }
+
+    static size_t compressBlock(const uint8_t* src, size_t srcSize, uint8_t* dst, size_t dstCapacity)
+    {
+        uint32_t table[1 << HashLog];
+        memset(table, 0, sizeof(table));
+
+        const uint8_t* ip     = src;
+        const uint8_t* anchor = src;
+        const uint8_t* iend   = src + srcSize;
+
+        uint8_t* op   = dst;
+        uint8_t* oend = dst + dstCapacity;
+
+        if (srcSize >= MatchFindLimit + 1)
+        {
+            const uint8_t* matchFindLimit = iend - MatchFindLimit;
+            const uint8_t* matchLimit     = iend - LastLiterals;
+
+            table[hashPosition(ip)] = 0;
+            ip++;
+            uint32_t forwardHash = hashPosition(ip);
+            while (true)
+            {
+                // Find a match, skipping faster and faster when nothing has been found for a while
+                const uint8_t* match;
+                {
+                    const uint8_t* forwardIp = ip;
+                    unsigned       step      = 1;
+                    unsigned       attempts  = 1u << SkipTrigger;
+                    do
+                    {
+                        const uint32_t currentHash = forwardHash;
+                        ip                         = forwardIp;
+                        forwardIp += step;
+                        step = attempts++ >> SkipTrigger;
+                        if (forwardIp > matchFindLimit)
+                        {
+                            goto lastLiterals;
+                        }
+                        match              = src + table[currentHash];
+                        forwardHash        = hashPosition(forwardIp);
+                        table[currentHash] = static_cast<uint32_t>(ip - src);
+                    } while (static_cast<size_t>(ip - match) > MaxOffset or read32(match) != read32(ip));
+                }
+                // Extend match backwards
+                while (ip > anchor and match > src and ip[-1] == match[-1])
+                {
+                    ip--;
+                    match--;
+                }
+                // Encode literals
+                uint8_t*     token         = op++;
+                const size_t literalLength = static_cast<size_t>(ip - anchor);
+                if (static_cast<size_t>(oend - op) < literalLength + literalLength / 255 + 2 + 1 + LastLiterals)
+                {
+                    return 0;
+                }
+                if (literalLength >= 15)
+                {
+                    *token = 15 << 4;
+                    op     = writeLength(op, literalLength - 15);
+                }
+                else
+                {
+                    *token = static_cast<uint8_t>(literalLength << 4);
+                }
+                memcpy(op, anchor, literalLength);
+                op += literalLength;
+
+                while (true)
+                {
+                    // Encode offset and match length
+                    const size_t offset = static_cast<size_t>(ip - match);
+                    *op++               = static_cast<uint8_t>(offset);
+                    *op++               = static_cast<uint8_t>(offset >> 8);
+
+                    const size_t matchLength = countMatch(ip + MinMatch, match + MinMatch, matchLimit);
+                    ip += MinMatch + matchLength;
+                    if (static_cast<size_t>(oend - op) < matchLength / 255 + 1 + LastLiterals)
+                    {
+                        return 0;
+                    }
+                    if (matchLength >= 15)
+                    {
+                        *token += 15;
+                        op = writeLength(op, matchLength - 15);
+                    }
+                    else
+                    {
+                        *token += static_cast<uint8_t>(matchLength);
+                    }
+                    anchor = ip;
+                    if (ip > matchFindLimit)
+                    {
+                        goto lastLiterals;
+                    }
+                    table[hashPosition(ip - 2)] = static_cast<uint32_t>(ip - 2 - src);
+
+                    // Check if next position immediately starts another match
+                    const uint32_t currentHash = hashPosition(ip);
+                    match                      = src + table[currentHash];
+                    table[currentHash]         = static_cast<uint32_t>(ip - src);
+                    if (static_cast<size_t>(ip - match) <= MaxOffset and read32(match) == read32(ip))
+                    {
+                        token  = op++;
+                        *token = 0;
+                        continue;
+                    }
+                    break;
+                }
+                forwardHash = hashPosition(++ip);
+            }
+        }
+    lastLiterals:
+        const size_t lastRun = static_cast<size_t>(iend - anchor);
+        if (static_cast<size_t>(oend - op) < lastRun + 1 + (lastRun + 255 - 15) / 255)
+        {
+            return 0;
+        }
+        if (lastRun >= 15)
+        {
+            *op++ = 15 << 4;
+            op    = writeLength(op, lastRun - 15);
+        }
+        else
+        {
+            *op++ = static_cast<uint8_t>(lastRun << 4);
+        }
+        memcpy(op, anchor, lastRun);
+        op += lastRun;
+        return static_cast<size_t>(op - dst);
+    }
+
+    //---------------------------------------------------------------------------------------------------
+    // Block decompression
+    //---------------------------------------------------------------------------------------------------
+    static bool readLength(const uint8_t*& ip, const uint8_t* iend, size_t& length)
+    {
+        uint8_t value;
+        do
+        {
+            if (ip == iend)
+            {
+                return false;
+            }
+            value = *ip++;
+            length += value;
+        } while (value == 255);
+        return true;
+    }
+
+    static Result decompressBlock(const uint8_t* src, size_t srcSize, uint8_t* dst, size_t dstCapacity,
+                                  size_t prefixSize, size_t& dstSize)
+    {
+        const uint8_t* ip   = src;
+        const uint8_t* iend = src + srcSize;
+
+        uint8_t*       op       = dst;
+        uint8_t* const oend     = dst + dstCapacity;
+        const uint8_t* lowLimit = dst - prefixSize;
+        while (true)
+        {
+            SC_TRY_MSG(ip < iend, "LZ4Stream - truncated block");
+            const unsigned token = *ip++;
+
+            // Shortcut for the most common sequence (up to 14 literals followed by a match of up to 18 bytes) when
+            // far enough from both block ends, copying fixed size chunks that can exceed the actual lengths
+            size_t literalLength = token >> 4;
+            if (literalLength != 15 and iend - ip >= 16 + 2 and oend - op >= 14 + 24)
+            {
+                copy8(op, ip);
+                copy8(op + 8, ip + 8);
+                op += literalLength;
+                ip += literalLength;
+
+                const size_t offset      = static_cast<size_t>(ip[0]) | (static_cast<size_t>(ip[1]) << 8);
+                const size_t matchLength = token & 15;
+                if (matchLength != 15 and offset >= 8 and offset <= static_cast<size_t>(op - lowLimit))
+                {
+                    const uint8_t* match = op - offset;
+                    copy8(op, match);
+                    copy8(op + 8, match + 8);
+                    copy8(op + 16, match + 16);
+                    op += matchLength + MinMatch;
+                    ip += 2;
+                    continue;
+                }
+            }
+            else
+            {
+                // Literals
+                if (literalLength == 15)
+                {
+                    SC_TRY_MSG(readLength(ip, iend, literalLength), "LZ4Stream - truncated literal length");
+                }
+                SC_TRY_MSG(literalLength <= static_cast<size_t>(iend - ip), "LZ4Stream - literals exceed block size");
+                SC_TRY_MSG(literalLength <= static_cast<size_t>(oend - op), "LZ4Stream - literals exceed output size");
+                if (static_cast<size_t>(iend - ip) >= literalLength + 16 and
+                    static_cast<size_t>(oend - op) >= literalLength + 16)
+                {
+                    wildCopy(op, ip, literalLength);
+                }
+                else
+                {
+                    memcpy(op, ip, literalLength);
+                }
+                op += literalLength;
+                ip += literalLength;
+                if (ip == iend)
+                {
+                    break; // Last sequence is made only of literals
+                }
+            }
+
+            // Match
+            SC_TRY_MSG(iend - ip >= 2, "LZ4Stream - truncated match offset");
+            const size_t offset = static_cast<size_t>(ip[0]) | (static_cast<size_t>(ip[1]) << 8);
+            ip += 2;
+            SC_TRY_MSG(offset != 0 and offset <= static_cast<size_t>(op - lowLimit), "LZ4Stream - invalid offset");
+
+            size_t matchLength = token & 15;
+            if (matchLength == 15)
+            {
+                SC_TRY_MSG(readLength(ip, iend, matchLength), "LZ4Stream - truncated match length");
+            }
+            matchLength += MinMatch;
+            SC_TRY_MSG(matchLength <= static_cast<size_t>(oend - op), "LZ4Stream - match exceeds output size");
+
+            const uint8_t* match = op - offset;
+            if (offset >= 8 and static_cast<size_t>(oend - op) >= matchLength + 16)
+            {
+                wildCopy(op, match, matchLength); // Non overlapping 8 bytes chunks
+                op += matchLength;
+            }
+            else
+            {
+                for (size_t idx = 0; idx < matchLength; ++idx)
+                {
+                    op[idx] = match[idx];
+                }
+                op += matchLength;
+            }
+        }
+        dstSize = static_cast<size_t>(op - dst);
+        return Result(true);
+    }
+
+    //---------------------------------------------------------------------------------------------------
+    // Frame helpers
+    //---------------------------------------------------------------------------------------------------
+    static uint32_t readLE32(const char* ptr)
+    {
+        const uint8_t* data = reinterpret_cast<const uint8_t*>(ptr);
+        return static_cast<uint32_t>(data[0]) | (static_cast<uint32_t>(data[1]) << 8) |
+               (static_cast<uint32_t>(data[2]) << 16) | (static_cast<uint32_t>(data[3]) << 24);
+    }
+
+    static size_t copyTo(Span<char>& output, const char* data, size_t size)
+    {
+        const size_t toCopy = size < output.sizeInBytes() ? size : output.sizeInBytes();
+        memcpy(output.data(), data, toCopy);
+        output = {output.data() + toCopy, output.sizeInBytes() - toCopy};
+        return toCopy;
+    }
+
+    static void advance(Span<const char>& input, size_t size)
+    {
+        input = {input.data() + size, input.sizeInBytes() - size};
+    }
+
+    // Accumulates input in the header staging area until headerSize bytes are available
+    static bool gather(LZ4Stream& stream, Span<const char>& input)
+    {
+        size_t toCopy = stream.headerSize - stream.headerUsed;
+        if (toCopy > input.sizeInBytes())
+        {
+            toCopy = input.sizeInBytes();
+        }
+        memcpy(stream.header + stream.headerUsed, input.data(), toCopy);
+        stream.headerUsed += toCopy;
+        advance(input, toCopy);
+        return stream.headerUsed == stream.headerSize;
+    }
+
+    static void expect(LZ4Stream& stream, State state, size_t numBytes)
+    {
+        stream.state      = state;
+        stream.headerSize = numBytes;
+        stream.headerUsed = 0;
+    }
+
+    // Writes pending header and block data to output, returning true when everything has been written
+    static bool drain(LZ4Stream& stream, Span<char>& output)
+    {
+        stream.headerUsed += copyTo(output, stream.header + stream.headerUsed, stream.headerSize - stream.headerUsed);
+        if (stream.headerUsed < stream.headerSize)
+        {
+            return false;
+        }
+        const size_t copied = copyTo(output, stream.pendingData, stream.pendingSize);
+        stream.pendingData += copied;
+        stream.pendingSize -= copied;
+        return stream.pendingSize == 0;
+    }
+
+    // Compresses a block with its header directly in output (if large enough) or in the staging area
+    static void compressFrameBlock(LZ4Stream& stream, const char* data, size_t size, Span<char>& output)
+    {
+        const size_t bound  = 4 + getBlockBound(size);
+        const bool   direct = output.sizeInBytes() >= bound;
+        char*        block  = direct ? output.data() : stream.memory + CompressBlockSize;
+
+        const uint8_t* src  = reinterpret_cast<const uint8_t*>(data);
+        uint8_t*       dst  = reinterpret_cast<uint8_t*>(block + 4);
+        size_t         used = compressBlock(src, size, dst, bound - 4);
+        if (used == 0 or used >= size)
+        {
+            // Incompressible data is stored as is
+            write32(block, static_cast<uint32_t>(size) | UncompressedFlag);
+            memcpy(block + 4, data, size);
+            used = size;
+        }
+        else
+        {
+            write32(block, static_cast<uint32_t>(used));
+        }
+        if (direct)
+        {
+            output = {output.data() + 4 + used, output.sizeInBytes() - 4 - used};
+        }
+        else
+        {
+            stream.pendingData = block;
+            stream.pendingSize = 4 + used;
+        }
+    }
+
+    static Result parseFrameDescriptor(LZ4Stream& stream)
+    {
+        const uint8_t flags = static_cast<uint8_t>(stream.header[0]);
+        const uint8_t bd    = static_cast<uint8_t>(stream.header[1]);
+        SC_TRY_MSG((flags >> 6) == 1, "LZ4Stream - unsupported frame version");
+        SC_TRY_MSG((flags & 0x02) == 0 and (bd & 0x8F) == 0, "LZ4Stream - reserved bits are set");
+        SC_TRY_MSG((flags & 0x01) == 0, "LZ4Stream - dictionaries are not supported");
+        const size_t descriptorSize = 2 + ((flags & 0x08) ? 8 : 0) + 1;
+        if (stream.headerSize < descriptorSize)
+        {
+            stream.headerSize = descriptorSize; // Content size is present, gather more bytes
+            return Result(true);
+        }
+        const uint32_t headerChecksum = (hash(stream.header, descriptorSize - 1) >> 8) & 0xFF;
+        SC_TRY_MSG(headerChecksum == static_cast<uint8_t>(stream.header[descriptorSize - 1]),
+                   "LZ4Stream - invalid frame descriptor checksum");
+
+        stream.blockIndependent   = (flags & 0x20) != 0;
+        stream.hasBlockChecksum   = (flags & 0x10) != 0;
+        stream.hasContentChecksum = (flags & 0x04) != 0;
+        switch ((bd >> 4) & 0x7)
+        {
+        case 4: stream.blockMaxSize = 64 * 1024; break;
+        case 5: stream.blockMaxSize = 256 * 1024; break;
+        case 6: stream.blockMaxSize = 1024 * 1024; break;
+        case 7: stream.blockMaxSize = 4 * 1024 * 1024; break;
+        default: return Result::Error("LZ4Stream - invalid block maximum size");
+        }
+        // Compressed block staging + history + decompressed block (+ 8 bytes to allow fast match copies)
+        SC_TRY(stream.allocate(stream.blockMaxSize + HistorySize + stream.blockMaxSize + 8));
+        stream.historySize = 0;
+        hashReset(stream.contentHash);
+        expect(stream, State::BlockHeader, 4);
+        return Result(true);
+    }
+};
+
+SC::LZ4Stream::~LZ4Stream()
+{
+    if (memory)
+    {
+        Memory::release(memory);
+    }
+}
+
+SC::Result SC::LZ4Stream::allocate(size_t numBytes)
+{
+    if (numBytes > memorySize)
+    {
+        if (memory)
+        {
+            Memory::release(memory);
+        }
+        memorySize = 0;
+        memory     = static_cast<char*>(Memory::allocate(numBytes, 16));
+        SC_TRY_MSG(memory != nullptr, "LZ4Stream - cannot allocate memory");
+        memorySize = numBytes;
+    }
+    return Result(true);
+}
+
+SC::Result SC::LZ4Stream::init(Algorithm wantedAlgorithm)
+{
+    SC_TRY_MSG(state == State::Constructed, "Init can be called only in State::Constructed");
+    algorithm = wantedAlgorithm;
+    Internal::hashReset(contentHash);
+    if (algorithm == Compress)
+    {
+        SC_TRY(allocate(Internal::getCompressorMemory()));
+        // Magic number, FLG (version 01, independent blocks, content checksum), BD (64 KB blocks), header checksum
+        Internal::write32(header, Internal::FrameMagic);
+        header[4] = 0x64;
+        header[5] = 0x40;
+        header[6] = static_cast<char>((Internal::hash(header + 4, 2) >> 8) & 0xFF);
+        Internal::expect(*this, State::Header, 7);
+        headerUsed = 0;
+    }
+    else
+    {
+        Internal::expect(*this, State::Header, 4);
+    }
+    return Result(true);
+}
+
+SC::Result SC::LZ4Stream::process(Span<const char>& input, Span<char>& output)
+{
+    SC_TRY_MSG(not output.empty(), "LZ4Stream::process empty output is not allowed");
+    switch (algorithm)
+    {
+    case Compress: return compress(input, output);
+    case Decompress: {
+        bool streamEnded = false;
+        return decompress(input, output, streamEnded);
+    }
+    }
+    Assert::unreachable();
+}
+
+SC::Result SC::LZ4Stream::finalize(Span<char>& output, bool& streamEnded)
+{
+    switch (algorithm)
+    {
+    case Compress: return compressFinalize(output, streamEnded);
+    case Decompress: {
+        Span<const char> input;
+        return decompress(input, output, streamEnded);
+    }
+    }
+    Assert::unreachable();
+}
+
+size_t SC::LZ4Stream::compressBlock(Span<const char> input, Span<char> output)
+{
+    const uint8_t* src = reinterpret_cast<const uint8_t*>(input.data());
+    uint8_t*       dst = reinterpret_cast<uint8_t*>(output.data());
+    return Internal::compressBlock(src, input.sizeInBytes(), dst, output.sizeInBytes());
+}
+
+SC::Result SC::LZ4Stream::decompressBlock(Span<const char> input, Span<char> output, size_t prefixSize,
+                                          size_t& outputSize)
+{
+    const uint8_t* src = reinterpret_cast<const uint8_t*>(input.data());
+    uint8_t*       dst = reinterpret_cast<uint8_t*>(output.data());
+    return Internal::decompressBlock(src, input.sizeInBytes(), dst, output.sizeInBytes(), prefixSize, outputSize);
+}
+
+SC::Result SC::LZ4Stream::compress(Span<const char>& input, Span<char>& output)
+{
+    SC_TRY_MSG(state == State::Header or state == State::BlockData, "LZ4Stream - compress called in wrong state");
+    state = State::BlockData;
+    while (Internal::drain(*this, output))
+    {
+        if (blockSize == Internal::CompressBlockSize)
+        {
+            Internal::compressFrameBlock(*this, memory, blockSize, output);
+            blockSize = 0;
+        }
+        else if (input.empty())
+        {
+            break;
+        }
+        else if (blockSize == 0 and input.sizeInBytes() >= Internal::CompressBlockSize)
+        {
+            // Compress directly from input, avoiding a copy
+            Internal::hashUpdate(contentHash, input.data(), Internal::CompressBlockSize);
+            Internal::compressFrameBlock(*this, input.data(), Internal::CompressBlockSize, output);
+            Internal::advance(input, Internal::CompressBlockSize);
+        }
+        else
+        {
+            size_t toCopy = Internal::CompressBlockSize - blockSize;
+            if (toCopy > input.sizeInBytes())
+            {
+                toCopy = input.sizeInBytes();
+            }
+            memcpy(memory + blockSize, input.data(), toCopy);
+            Internal::hashUpdate(contentHash, input.data(), toCopy);
+            blockSize += toCopy;
+            Internal::advance(input, toCopy);
+        }
+    }
+    return Result(true);
+}
+
+SC::Result SC::LZ4Stream::compressFinalize(Span<char>& output, bool& streamEnded)
+{
+    Span<const char> input;
+    if (state != State::Ended)
+    {
+        SC_TRY(compress(input, output));
+        if (blockSize > 0 and Internal::drain(*this, output))
+        {
+            Internal::compressFrameBlock(*this, memory, blockSize, output);
+            blockSize = 0;
+        }
+        if (blockSize == 0 and Internal::drain(*this, output))
+        {
+            // End mark followed by content checksum
+            Internal::write32(header, 0);
+            Internal::write32(header + 4, Internal::hashDigest(contentHash));
+            Internal::expect(*this, State::Ended, 8);
+        }
+    }
+    streamEnded = state == State::Ended and Internal::drain(*this, output);
+    return Result(true);
+}
+
+SC::Result SC::LZ4Stream::decompress(Span<const char>& input, Span<char>& output, bool& streamEnded)
+{
+    while (true)
+    {
+        switch (state)
+        {
+        case State::Constructed: return Result::Error("LZ4Stream - not initialized");
+        case State::Header: {
+            if (not Internal::gather(*this, input))
+            {
+                return Result(true);
+            }
+            const uint32_t magic = Internal::readLE32(header);
+            if (magic == Internal::FrameMagic)
+            {
+                Internal::expect(*this, State::FrameDescriptor, 3);
+            }
+            else if ((magic & 0xFFFFFFF0) == Internal::SkippableMagic)
+            {
+                Internal::expect(*this, State::SkippableFrame, 4);
+                skipSize = 0;
+            }
+            else
+            {
+                return Result::Error("LZ4Stream - invalid magic number");
+            }
+        }
+        break;
+        case State::FrameDescriptor: {
+            if (not Internal::gather(*this, input))
+            {
+                return Result(true);
+            }
+            SC_TRY(Internal::parseFrameDescriptor(*this));
+        }
+        break;
+        case State::SkippableFrame: {
+            if (headerUsed < headerSize)
+            {
+                if (not Internal::gather(*this, input))
+                {
+                    return Result(true);
+                }
+                skipSize = Internal::readLE32(header);
+            }
+            const size_t toSkip = skipSize < input.sizeInBytes() ? skipSize : input.sizeInBytes();
+            Internal::advance(input, toSkip);
+            skipSize -= toSkip;
+            if (skipSize > 0)
+            {
+                return Result(true);
+            }
+            Internal::expect(*this, State::Header, 4);
+        }
+        break;
+        case State::BlockHeader: {
+            if (not Internal::gather(*this, input))
+            {
+                return Result(true);
+            }
+            const uint32_t value = Internal::readLE32(header);
+            if (value == 0)
+            {
+                if (hasContentChecksum)
+                {
+                    Internal::expect(*this, State::ContentChecksum, 4);
+                }
+                else
+                {
+                    Internal::expect(*this, State::Ended, 0);
+                }
+                break;
+            }
+            blockUncompressed = (value & Internal::UncompressedFlag) != 0;
+            blockSize         = value & ~Internal::UncompressedFlag;
+            blockUsed         = 0;
+            SC_TRY_MSG(blockSize <= blockMaxSize, "LZ4Stream - block exceeds maximum size");
+            state = State::BlockData;
+        }
+        break;
+        case State::BlockData: {
+            // Use block directly from input when it's entirely available, or accumulate it in staging memory
+            const char* block = nullptr;
+            if (blockUsed == 0 and input.sizeInBytes() >= blockSize)
+            {
+                block = input.data();
+                Internal::advance(input, blockSize);
+            }
+            else
+            {
+                size_t toCopy = blockSize - blockUsed;
+                if (toCopy > input.sizeInBytes())
+                {
+                    toCopy = input.sizeInBytes();
+                }
+                memcpy(memory + blockUsed, input.data(), toCopy);
+                blockUsed += toCopy;
+                Internal::advance(input, toCopy);
+                if (blockUsed < blockSize)
+                {
+                    return Result(true);
+                }
+                block = memory;
+            }
+            if (hasBlockChecksum)
+            {
+                Internal::write32(header + 4, Internal::hash(block, blockSize));
+            }
+
+            // Independent blocks can be decompressed directly to output when there is enough space for them
+            char*        decoded     = memory + blockMaxSize + Internal::HistorySize;
+            const bool   direct      = blockIndependent and output.sizeInBytes() >= blockMaxSize + 8;
+            char*        destination = direct ? output.data() : decoded;
+            size_t       decodedSize = blockSize;
+            const size_t prefixSize  = blockIndependent ? 0 : historySize;
+            if (blockUncompressed)
+            {
+                memcpy(destination, block, blockSize);
+            }
+            else
+            {
+                const Span<const char> source = {block, blockSize};
+                SC_TRY(decompressBlock(source, {destination, blockMaxSize + 8}, prefixSize, decodedSize));
+                SC_TRY_MSG(decodedSize <= blockMaxSize, "LZ4Stream - block exceeds maximum size");
+            }
+            if (hasContentChecksum)
+            {
+                Internal::hashUpdate(contentHash, destination, decodedSize);
+            }
+            if (direct)
+            {
+                output = {output.data() + decodedSize, output.sizeInBytes() - decodedSize};
+            }
+            else
+            {
+                pendingData = decoded;
+                pendingSize = decodedSize;
+            }
+            blockSize = decodedSize; // Needed to update history once block has been written to output
+            if (hasBlockChecksum)
+            {
+                Internal::expect(*this, State::BlockChecksum, 4);
+            }
+            else
+            {
+                state = State::BlockOutput;
+            }
+        }
+        break;
+        case State::BlockChecksum: {
+            if (not Internal::gather(*this, input))
+            {
+                return Result(true);
+            }
+            SC_TRY_MSG(Internal::readLE32(header) == Internal::readLE32(header + 4),
+                       "LZ4Stream - invalid block checksum");
+            state = State::BlockOutput;
+        }
+        break;
+        case State::BlockOutput: {
+            const size_t copied = Internal::copyTo(output, pendingData, pendingSize);
+            pendingData += copied;
+            pendingSize -= copied;
+            if (pendingSize > 0)
+            {
+                return Result(true);
+            }
+            if (not blockIndependent)
+            {
+                // Keep last 64 KB of decompressed data as history for next block, just before decoded area
+                char* decoded = memory + blockMaxSize + Internal::HistorySize;
+                if (blockSize >= Internal::HistorySize)
+                {
+                    memcpy(decoded - Internal::HistorySize, decoded + blockSize - Internal::HistorySize,
+                           Internal::HistorySize);
+                    historySize = Internal::HistorySize;
+                }
+                else
+                {
+                    const size_t keep = historySize + blockSize > Internal::HistorySize
+                                            ? Internal::HistorySize - blockSize
+                                            : historySize;
+                    memmove(decoded - keep - blockSize, decoded - keep, keep + blockSize);
+                    historySize = keep + blockSize;
+                }
+            }
+            Internal::expect(*this, State::BlockHeader, 4);
+        }
+        break;
+        case State::ContentChecksum: {
+            if (not Internal::gather(*this, input))
+            {
+                return Result(true);
+            }
+            SC_TRY_MSG(Internal::readLE32(header) == Internal::hashDigest(contentHash),
+                       "LZ4Stream - invalid content checksum");
+            Internal::expect(*this, State::Ended, 0);
+        }
+        break;
+        case State::Ended: {
+            if (input.empty())
+            {
+                streamEnded = true;
+                return Result(true);
+            }
+            Internal::expect(*this, State::Header, 4); // Concatenated frame
+        }
+        break;
+        }
+    }
+}
@@ -103,6 +103,33 @@ struct SC::ZLibAPI
         return pInflateInit2(&strm, windowBits, Version, static_cast<int>(sizeof(Stream)));
     }
 
+    // Optional functions, needed to split a single stream in independent blocks (see supportsBlocks)
+    Error deflateReset(Stream& strm) { return pDeflateReset(&strm); }
+    Error deflateSetDictionary(Stream& strm, const unsigned char* dictionary, unsigned int length)
+    {
+        return pDeflateSetDictionary(&strm, dictionary, length);
+    }
+
+    unsigned long crc32(unsigned long crc, const unsigned char* buf, unsigned int len) { return pCrc32(crc, buf, len); }
+    unsigned long adler32(unsigned long adler, const unsigned char* buf, unsigned int len)
+    {
+        return pAdler32(adler, buf, len);
+    }
+    unsigned long crc32Combine(unsigned long crc1, unsigned long crc2, long len2)
+    {
+        return pCrc32Combine(crc1, crc2, len2);
+    }
+    unsigned long adler32Combine(unsigned long adler1, unsigned long adler2, long len2)
+    {
+        return pAdler32Combine(adler1, adler2, len2);
+    }
+
+    /// @brief Returns true if all functions needed to compress independent blocks have been loaded
+    bool supportsBlocks() const
+    {
+        return pDeflateReset and pDeflateSetDictionary and pCrc32 and pAdler32 and pCrc32Combine and pAdler32Combine;
+    }
+
   private:
 #if SC_PLATFORM_WINDOWS
 #define SC_ZLIB_API_CC __stdcall
@@ -117,6 +144,14 @@ struct SC::ZLibAPI
     Error(SC_ZLIB_API_CC* pDeflateInit2)(void* strm, Compression level, Method method, int windowBits, int memLevel,
                                          Strategy strategy, const char* version, int stream_size)          = nullptr;
     Error(SC_ZLIB_API_CC* pInflateInit2)(void* strm, int windowBits, const char* version, int stream_size) = nullptr;
+
+    Error(SC_ZLIB_API_CC* pDeflateReset)(void* strm)                                                      = nullptr;
+    Error(SC_ZLIB_API_CC* pDeflateSetDictionary)(void* strm, const unsigned char* dict, unsigned int len) = nullptr;
+
+    unsigned long(SC_ZLIB_API_CC* pCrc32)(unsigned long crc, const unsigned char* buf, unsigned int len)     = nullptr;
+    unsigned long(SC_ZLIB_API_CC* pAdler32)(unsigned long adler, const unsigned char* buf, unsigned int len) = nullptr;
+    unsigned long(SC_ZLIB_API_CC* pCrc32Combine)(unsigned long crc1, unsigned long crc2, long len2)          = nullptr;
+    unsigned long(SC_ZLIB_API_CC* pAdler32Combine)(unsigned long adler1, unsigned long adler2, long len2)    = nullptr;
 #undef SC_ZLIB_API_CC
     // Handle for dynamic library
     void* library = nullptr;
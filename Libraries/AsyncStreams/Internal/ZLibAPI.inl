@@ -112,6 +112,13 @@ SC::Result SC::ZLibAPI::load(const char* libPath)
     SC_TRY(Internal::loadSymbol(*this, pInflateEnd, "inflateEnd"));
     SC_TRY(Internal::loadSymbol(*this, pDeflateInit2, "deflateInit2_"));
     SC_TRY(Internal::loadSymbol(*this, pInflateInit2, "inflateInit2_"));
+    // Optional symbols (some zlib compatible libraries may not export them)
+    (void)Internal::loadSymbol(*this, pDeflateReset, "deflateReset");
+    (void)Internal::loadSymbol(*this, pDeflateSetDictionary, "deflateSetDictionary");
+    (void)Internal::loadSymbol(*this, pCrc32, "crc32");
+    (void)Internal::loadSymbol(*this, pAdler32, "adler32");
+    (void)Internal::loadSymbol(*this, pCrc32Combine, "crc32_combine");
+    (void)Internal::loadSymbol(*this, pAdler32Combine, "adler32_combine");
     return Result(true);
 }
 
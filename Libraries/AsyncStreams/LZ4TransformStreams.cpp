@@ -0,0 +1,71 @@
+// Copyright (c) Stefano Cristiano
+// SPDX-License-Identifier: MIT
+#include "LZ4TransformStreams.h"
+
+#include "Internal/LZ4Stream.inl"
+//-------------------------------------------------------------------------------------------------------
+// AsyncLZ4TransformStream
+//-------------------------------------------------------------------------------------------------------
+SC::AsyncLZ4TransformStream::AsyncLZ4TransformStream()
+{
+    AsyncTransformStream::onProcess.bind<AsyncLZ4TransformStream, &AsyncLZ4TransformStream::processExecute>(*this);
+    AsyncTransformStream::onFinalize.bind<AsyncLZ4TransformStream, &AsyncLZ4TransformStream::processFinalize>(*this);
+    asyncWork.work.bind<AsyncLZ4TransformStream, &AsyncLZ4TransformStream::work>(*this);
+    asyncWork.callback.bind<AsyncLZ4TransformStream, &AsyncLZ4TransformStream::afterWork>(*this);
+}
+
+SC::Result SC::AsyncLZ4TransformStream::processExecute(Span<const char> input, Span<char> output)
+{
+    savedInput  = input;
+    savedOutput = output;
+    finalizing  = false;
+    if (eventLoop != nullptr)
+    {
+        return asyncWork.start(*eventLoop);
+    }
+    SC_TRY(work());
+    AsyncTransformStream::afterProcess(savedInput, savedOutput);
+    return Result(true);
+}
+
+SC::Result SC::AsyncLZ4TransformStream::processFinalize(Span<char> output)
+{
+    savedInput  = {};
+    savedOutput = output;
+    finalizing  = true;
+    if (eventLoop != nullptr)
+    {
+        return asyncWork.start(*eventLoop);
+    }
+    SC_TRY(work());
+    AsyncTransformStream::afterFinalize(savedOutput, streamEnded);
+    return Result(true);
+}
+
+SC::Result SC::AsyncLZ4TransformStream::work()
+{
+    if (finalizing)
+    {
+        return stream.finalize(savedOutput, streamEnded);
+    }
+    else
+    {
+        return stream.process(savedInput, savedOutput);
+    }
+}
+
+void SC::AsyncLZ4TransformStream::afterWork(AsyncLoopWork::Result& result)
+{
+    if (not result.isValid())
+    {
+        AsyncReadableStream::emitError(result.isValid());
+    }
+    else if (finalizing)
+    {
+        AsyncTransformStream::afterFinalize(savedOutput, streamEnded);
+    }
+    else
+    {
+        AsyncTransformStream::afterProcess(savedInput, savedOutput);
+    }
+}
@@ -0,0 +1,39 @@
+// Copyright (c) Stefano Cristiano
+// SPDX-License-Identifier: MIT
+#pragma once
+#include "../Async/Async.h"
+#include "AsyncStreams.h"
+#include "Internal/LZ4Stream.h"
+namespace SC
+{
+/// @brief Compresses or decompresses a stream using the LZ4 frame format (see SC::LZ4Stream).
+/// @n
+/// When an event loop is set with AsyncLZ4TransformStream::setEventLoop, processing happens on the ThreadPool
+/// assigned to AsyncLZ4TransformStream::asyncWork. Otherwise data is processed synchronously on the calling thread,
+/// as LZ4 is usually fast enough to not justify the cost of a thread hop.
+///
+/// \snippet Tests/Libraries/AsyncStreams/LZ4StreamTest.cpp AsyncLZ4TransformStreamSnippet
+struct AsyncLZ4TransformStream : public AsyncTransformStream
+{
+    AsyncLZ4TransformStream();
+
+    LZ4Stream     stream;
+    AsyncLoopWork asyncWork;
+
+    void setEventLoop(AsyncEventLoop& loop) { eventLoop = &loop; }
+
+  private:
+    AsyncEventLoop* eventLoop = nullptr;
+
+    Result processExecute(Span<const char> input, Span<char> output);
+    Result processFinalize(Span<char> output);
+    void   afterWork(AsyncLoopWork::Result& result);
+    Result work();
+
+    bool finalizing  = false;
+    bool streamEnded = false;
+
+    Span<const char> savedInput;
+    Span<char>       savedOutput;
+};
+} // namespace SC
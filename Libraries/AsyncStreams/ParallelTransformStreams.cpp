@@ -0,0 +1,212 @@
+// Copyright (c) Stefano Cristiano
+// SPDX-License-Identifier: MIT
+#include "ParallelTransformStreams.h"
+
+//-------------------------------------------------------------------------------------------------------
+// AsyncParallelTransformStream
+//-------------------------------------------------------------------------------------------------------
+SC::AsyncParallelTransformStream::Job::Job()
+{
+    asyncWork.work.bind<Job, &Job::work>(*this);
+    asyncWork.callback.bind<Job, &Job::afterWork>(*this);
+}
+
+SC::Result SC::AsyncParallelTransformStream::Job::work()
+{
+    // Runs on a ThreadPool thread, touching only memory owned by this job
+    result = parent->onProcess(input, output);
+    return Result(true);
+}
+
+void SC::AsyncParallelTransformStream::Job::afterWork(AsyncLoopWork::Result& res)
+{
+    if (not res.isValid())
+    {
+        result = Result::Error("AsyncParallelTransformStream - job failed");
+    }
+    parent->afterJob(*this);
+}
+
+SC::AsyncParallelTransformStream::AsyncParallelTransformStream()
+{
+    using Self = AsyncParallelTransformStream;
+    AsyncWritableStream::asyncWrite.bind<Self, &Self::transform>(*this);
+    AsyncWritableStream::canEndWritable.bind<Self, &Self::canEndTransform>(*this);
+    AsyncReadableStream::asyncRead.bind<Self, &Self::readTransformed>(*this);
+}
+
+SC::Result SC::AsyncParallelTransformStream::init(AsyncBuffersPool&                  buffersPool,
+                                                  Span<AsyncReadableStream::Request> readableRequests,
+                                                  Span<AsyncWritableStream::Request> writableRequests,
+                                                  AsyncEventLoop& loop, ThreadPool& threadPool, Span<Job> jobsSpan)
+{
+    SC_TRY_MSG(jobs.empty(), "AsyncParallelTransformStream::init - already inited");
+    SC_TRY_MSG(not jobsSpan.empty(), "AsyncParallelTransformStream::init - needs at least one job");
+    SC_TRY_MSG(onProcess.isValid(), "AsyncParallelTransformStream::init - onProcess must be set");
+    SC_TRY(AsyncDuplexStream::init(buffersPool, readableRequests, writableRequests));
+    for (Job& job : jobsSpan)
+    {
+        SC_TRY_MSG(job.parent == nullptr, "AsyncParallelTransformStream::init - job is already in use");
+        job.parent = this;
+        job.state  = Job::State::Free;
+        SC_TRY(job.asyncWork.setThreadPool(threadPool));
+    }
+    jobs      = jobsSpan;
+    eventLoop = &loop;
+    return Result(true);
+}
+
+SC::Result SC::AsyncParallelTransformStream::transform(AsyncBufferView::ID                 bufferID,
+                                                       Function<void(AsyncBufferView::ID)> cb)
+{
+    // The write will be acknowledged (with finishedWriting) only when it has been submitted to some job
+    SC_TRY_MSG(not hasPendingInput, "AsyncParallelTransformStream::transform - Logical Error");
+    hasPendingInput = true;
+    pendingBufferID = bufferID;
+    pendingCallback = move(cb);
+    return submitPendingInput();
+}
+
+SC::Result SC::AsyncParallelTransformStream::submitPendingInput()
+{
+    Job& job = jobFor(nextSubmitSequence);
+    if (job.state != Job::State::Free)
+    {
+        return Result(true); // Retried when the job output will be pushed downstream
+    }
+    AsyncBuffersPool& pool = AsyncWritableStream::getBuffersPool();
+    SC_TRY(pool.getData(pendingBufferID, job.input));
+
+    const size_t outputSize = minimumOutputSize > 0 ? minimumOutputSize : job.input.sizeInBytes();
+    if (not pool.requestNewBuffer(outputSize, job.outputBufferID, job.output))
+    {
+        // With jobs in flight this is retried by afterJob, otherwise by readTransformed when the readable side will be
+        // resumed (after some buffer is released downstream). Pushing is not allowed while paused, so pausing is
+        // delayed until all processed jobs have been pushed.
+        if (not outputPaused and nextPushSequence == nextSubmitSequence)
+        {
+            outputPaused = true;
+            AsyncReadableStream::pause();
+        }
+        return Result(true);
+    }
+    job.inputBufferID = pendingBufferID;
+    job.result        = Result(true);
+    job.state         = Job::State::Processing;
+    pool.refBuffer(job.inputBufferID); // Released in afterJob
+    nextSubmitSequence++;
+    Result res = job.asyncWork.start(*eventLoop);
+    if (not res)
+    {
+        job.state = Job::State::Free;
+        pool.unrefBuffer(job.inputBufferID);
+        pool.unrefBuffer(job.outputBufferID);
+        return res;
+    }
+
+    auto bufferID   = pendingBufferID;
+    auto callback   = move(pendingCallback);
+    hasPendingInput = false;
+    pendingCallback = {};
+    AsyncWritableStream::finishedWriting(bufferID, move(callback), Result(true));
+    return Result(true);
+}
+
+void SC::AsyncParallelTransformStream::pushProcessed()
+{
+    if (pushing or outputPaused or finished)
+    {
+        return; // Avoid re-entrancy when push synchronously triggers resume of this stream
+    }
+    pushing = true;
+    AsyncBuffersPool& pool = AsyncReadableStream::getBuffersPool();
+    while (nextPushSequence < nextSubmitSequence)
+    {
+        Job& job = jobFor(nextPushSequence);
+        if (job.state != Job::State::Processed)
+        {
+            break; // Following jobs (even if already processed) must wait for this one, to preserve order
+        }
+        job.state = Job::State::Free;
+        nextPushSequence++;
+        if (not job.output.empty())
+        {
+            numPushes++;
+            AsyncReadableStream::push(job.outputBufferID, job.output.sizeInBytes());
+        }
+        pool.unrefBuffer(job.outputBufferID);
+    }
+    if (endRequested and not hasPendingInput and nextPushSequence == nextSubmitSequence)
+    {
+        finished = true;
+        AsyncReadableStream::pushEnd();
+    }
+    pushing = false;
+}
+
+void SC::AsyncParallelTransformStream::afterJob(Job& job)
+{
+    AsyncWritableStream::getBuffersPool().unrefBuffer(job.inputBufferID);
+    if (not job.result)
+    {
+        job.state = Job::State::Free;
+        AsyncReadableStream::getBuffersPool().unrefBuffer(job.outputBufferID);
+        AsyncReadableStream::emitError(job.result);
+        return;
+    }
+    // onProcess is not allowed to grow output outside of the buffer obtained from the pool
+    Span<char> outputData;
+    if (not AsyncReadableStream::getBuffersPool().getData(job.outputBufferID, outputData) or
+        job.output.data() != outputData.data() or job.output.sizeInBytes() > outputData.sizeInBytes())
+    {
+        job.state = Job::State::Free;
+        AsyncReadableStream::getBuffersPool().unrefBuffer(job.outputBufferID);
+        AsyncReadableStream::emitError(Result::Error("AsyncParallelTransformStream - Invalid onProcess output"));
+        return;
+    }
+    job.state = Job::State::Processed;
+    resumeAll();
+}
+
+void SC::AsyncParallelTransformStream::resumeAll()
+{
+    pushProcessed();
+    // Pushing buffers downstream frees their jobs, so pending input can make progress
+    if (hasPendingInput)
+    {
+        Result res = submitPendingInput();
+        if (not res)
+        {
+            AsyncWritableStream::emitError(res);
+        }
+        pushProcessed(); // Could finish the stream if pending input was the last one
+    }
+    if (finished)
+    {
+        AsyncWritableStream::resumeWriting(); // Transitions the writable side from Ending to Ended state
+    }
+}
+
+SC::Result SC::AsyncParallelTransformStream::readTransformed()
+{
+    // Called when readable side is resumed (for example when new output buffers are available)
+    outputPaused = false;
+    if (jobs.empty())
+    {
+        return Result(true);
+    }
+    const uint64_t pushesBefore = numPushes;
+    resumeAll();
+    if (numPushes != pushesBefore and not outputPaused and not finished)
+    {
+        AsyncReadableStream::reactivate(true); // Ends the synchronous read loop, as nothing more can be pushed
+    }
+    return Result(true);
+}
+
+bool SC::AsyncParallelTransformStream::canEndTransform()
+{
+    endRequested = true;
+    pushProcessed();
+    return finished;
+}
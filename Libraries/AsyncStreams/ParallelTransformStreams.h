@@ -0,0 +1,105 @@
+// Copyright (c) Stefano Cristiano
+// SPDX-License-Identifier: MIT
+#pragma once
+#include "../Async/Async.h"
+#include "AsyncStreams.h"
+namespace SC
+{
+//! @addtogroup group_async_streams
+//! @{
+
+/// @brief A transform stream processing multiple buffers concurrently on a ThreadPool, preserving their order.
+/// @n
+/// Every buffer written to the stream is dispatched to a free SC::AsyncParallelTransformStream::Job that runs
+/// SC::AsyncParallelTransformStream::onProcess on a ThreadPool thread, so that CPU heavy stages of an SC::AsyncPipeline
+/// (compression of independent blocks, hashing of independent chunks, encryption with counter modes etc.) can overlap.
+/// @n
+/// Each buffer gets a sequence number and job `N` is only re-used for sequence `N + jobs.size()` after its output has
+/// been pushed downstream, so the jobs act as a reorder window keeping output in the same order of the input. @n
+/// Back-pressure is preserved: writes are not acknowledged while all jobs are busy (or while no output buffer can be
+/// obtained), pausing upstream streams exactly as a serial transform stream would do.
+/// @note SC::AsyncBuffersPool must hold more than twice the number of jobs buffers, as each job holds both its input
+/// and output buffer while running.
+///
+/// \snippet Tests/Libraries/AsyncStreams/ParallelTransformStreamsTest.cpp AsyncParallelTransformStreamSnippet
+struct AsyncParallelTransformStream : public AsyncDuplexStream
+{
+    /// @brief A single buffer transformation, running on a ThreadPool thread
+    struct Job
+    {
+        Job();
+
+      private:
+        friend struct AsyncParallelTransformStream;
+        enum class State
+        {
+            Free,       // Can be used for the next written buffer
+            Processing, // Running on a ThreadPool thread
+            Processed,  // Waiting for all previous buffers to be pushed downstream
+        };
+        State               state = State::Free;
+        AsyncBufferView::ID inputBufferID;
+        AsyncBufferView::ID outputBufferID;
+        Span<const char>    input;
+        Span<char>          output;
+        Result              result = Result(true);
+        AsyncLoopWork       asyncWork;
+
+        AsyncParallelTransformStream* parent = nullptr;
+
+        Result work();
+        void   afterWork(AsyncLoopWork::Result& result);
+    };
+
+    AsyncParallelTransformStream();
+
+    /// @brief Transforms an entire input buffer into the output buffer, setting output to the written bytes.
+    /// @warning Invoked concurrently on multiple ThreadPool threads, so it must not modify any shared state
+    Function<Result(Span<const char> input, Span<char>& output)> onProcess;
+
+    /// @brief Minimum size of output buffers (if zero, output buffers will be at least as large as input buffers)
+    size_t minimumOutputSize = 0;
+
+    /// @brief Initializes the stream
+    /// @param buffersPool Pool used to allocate output buffers
+    /// @param readableRequests Queue for the readable (output) side of the stream
+    /// @param writableRequests Queue for the writable (input) side of the stream
+    /// @param eventLoop Event loop where job completions will be delivered
+    /// @param threadPool Thread pool running the jobs
+    /// @param jobs Jobs that can be concurrently running (should be >= number of threadPool threads)
+    Result init(AsyncBuffersPool& buffersPool, Span<AsyncReadableStream::Request> readableRequests,
+                Span<AsyncWritableStream::Request> writableRequests, AsyncEventLoop& eventLoop,
+                ThreadPool& threadPool, Span<Job> jobs);
+
+  private:
+    AsyncEventLoop* eventLoop = nullptr;
+    Span<Job>       jobs;
+
+    uint64_t nextSubmitSequence = 0; // Sequence number of the next written buffer
+    uint64_t nextPushSequence   = 0; // Sequence number of the next buffer to push downstream
+    uint64_t numPushes          = 0;
+
+    bool outputPaused = false;
+    bool pushing      = false;
+    bool endRequested = false;
+    bool finished     = false;
+
+    // Written buffer waiting for a free job (or for an output buffer)
+    bool                                hasPendingInput = false;
+    AsyncBufferView::ID                 pendingBufferID;
+    Function<void(AsyncBufferView::ID)> pendingCallback;
+
+    Job& jobFor(uint64_t sequence) { return jobs[static_cast<size_t>(sequence % jobs.sizeInElements())]; }
+
+    Result transform(AsyncBufferView::ID bufferID, Function<void(AsyncBufferView::ID)> cb);
+    Result readTransformed();
+    bool   canEndTransform();
+
+    Result submitPendingInput();
+    void   pushProcessed();
+    void   afterJob(Job& job);
+    void   resumeAll();
+};
+
+//! @}
+} // namespace SC
@@ -145,3 +145,427 @@ void SC::AsyncZLibTransformStream::afterWork(AsyncLoopWork::Result&)
         AsyncTransformStream::afterProcess(savedInput, savedOutput);
     }
 }
+
+//-------------------------------------------------------------------------------------------------------
+// ParallelZLibTransformStream
+//-------------------------------------------------------------------------------------------------------
+SC::ParallelZLibTransformStream::Job::Job()
+{
+    asyncWork.work.bind<Job, &Job::work>(*this);
+    asyncWork.callback.bind<Job, &Job::afterWork>(*this);
+}
+
+SC::ParallelZLibTransformStream::Job::~Job()
+{
+    if (streamInit)
+    {
+        (void)zlib.deflateEnd(stream.reinterpret_as<ZLibAPI::Stream>());
+    }
+}
+
+SC::Result SC::ParallelZLibTransformStream::Job::work()
+{
+    // Runs on a ThreadPool thread, touching only memory owned by this job
+    ZLibAPI::Stream& strm = stream.reinterpret_as<ZLibAPI::Stream>();
+    SC_TRY_MSG(zlib.deflateReset(strm) == ZLibAPI::OK, "deflateReset failed");
+    if (dictionaryLength > 0)
+    {
+        const auto dict = reinterpret_cast<const unsigned char*>(dictionary.data());
+        const auto res  = zlib.deflateSetDictionary(strm, dict, static_cast<unsigned int>(dictionaryLength));
+        SC_TRY_MSG(res == ZLibAPI::OK, "deflateSetDictionary failed");
+    }
+    const auto* inputData = reinterpret_cast<const unsigned char*>(input.data());
+    const auto  inputSize = static_cast<unsigned int>(inputLength);
+
+    // Header goes in front of the first block, trailer is appended to the last one by the event loop thread
+    size_t headerSize = 0;
+    switch (parent->algorithm)
+    {
+    case ZLibStream::CompressGZip:
+        checksum = static_cast<uint32_t>(zlib.crc32(0, inputData, inputSize));
+        if (isFirst)
+        {
+            // Magic, DEFLATE method, no flags, no modification time, no extra flags, unknown OS
+            const unsigned char gzipHeader[10] = {0x1f, 0x8b, 0x08, 0, 0, 0, 0, 0, 0, 0xff};
+            memcpy(output.data(), gzipHeader, sizeof(gzipHeader));
+            headerSize = sizeof(gzipHeader);
+        }
+        break;
+    case ZLibStream::CompressZLib:
+        checksum = static_cast<uint32_t>(zlib.adler32(1, inputData, inputSize));
+        if (isFirst)
+        {
+            // DEFLATE with 32K window, default compression level (matches deflateInit2 + DEFAULT_COMPRESSION)
+            const unsigned char zlibHeader[2] = {0x78, 0x9c};
+            memcpy(output.data(), zlibHeader, sizeof(zlibHeader));
+            headerSize = sizeof(zlibHeader);
+        }
+        break;
+    default: break;
+    }
+
+    // Non-last blocks end with a SYNC_FLUSH (byte aligned, without the "final block" bit) so that they can just
+    // be concatenated one after the other, and only the last one gets FINISH.
+    const size_t outputAvailable = output.sizeInBytes() - headerSize - HeaderTrailerSize;
+
+    strm.next_in   = inputData;
+    strm.avail_in  = inputSize;
+    strm.next_out  = reinterpret_cast<unsigned char*>(output.data() + headerSize);
+    strm.avail_out = static_cast<unsigned int>(outputAvailable);
+
+    const auto res = zlib.deflate(strm, isLast ? ZLibAPI::FINISH : ZLibAPI::SYNC_FLUSH);
+    SC_TRY_MSG(res == (isLast ? ZLibAPI::STREAM_END : ZLibAPI::OK), "deflate failed");
+    SC_TRY_MSG(strm.avail_in == 0 and strm.avail_out != 0, "deflate output bound exceeded");
+    outputLength = headerSize + outputAvailable - strm.avail_out;
+    return Result(true);
+}
+
+void SC::ParallelZLibTransformStream::Job::afterWork(AsyncLoopWork::Result& result)
+{
+    parent->afterJob(*this, result.isValid());
+}
+
+SC::ParallelZLibTransformStream::ParallelZLibTransformStream()
+{
+    using Self = ParallelZLibTransformStream;
+    AsyncWritableStream::asyncWrite.bind<Self, &Self::transform>(*this);
+    AsyncWritableStream::canEndWritable.bind<Self, &Self::canEndTransform>(*this);
+    AsyncReadableStream::asyncRead.bind<Self, &Self::readTransformed>(*this);
+}
+
+SC::Result SC::ParallelZLibTransformStream::init(AsyncBuffersPool&                  buffersPool,
+                                                 Span<AsyncReadableStream::Request> readableRequests,
+                                                 Span<AsyncWritableStream::Request> writableRequests,
+                                                 AsyncEventLoop& loop, ThreadPool& threadPool, Span<Job> jobsSpan,
+                                                 Span<char> memory, ZLibStream::Algorithm wantedAlgorithm)
+{
+    SC_TRY_MSG(jobs.empty(), "ParallelZLibTransformStream::init - already inited");
+    SC_TRY_MSG(not jobsSpan.empty(), "ParallelZLibTransformStream::init - needs at least one job");
+    SC_TRY_MSG(blockSize >= DictionarySize, "ParallelZLibTransformStream::init - blockSize is too small");
+    SC_TRY_MSG(blockSize <= 64 * 1024 * 1024, "ParallelZLibTransformStream::init - blockSize is too big");
+    SC_TRY_MSG(memory.sizeInBytes() >= getMemorySizeFor(jobsSpan.sizeInElements(), blockSize),
+               "ParallelZLibTransformStream::init - insufficient memory");
+
+    int windowBits = -ZLibAPI::MaxBits; // All algorithms produce raw DEFLATE blocks, header is written manually
+    switch (wantedAlgorithm)
+    {
+    case ZLibStream::CompressGZip:
+    case ZLibStream::CompressZLib:
+    case ZLibStream::CompressDeflate: break;
+    default: return Result::Error("ParallelZLibTransformStream::init - only compression is supported");
+    }
+    SC_TRY(zlib.load());
+    SC_TRY_MSG(zlib.supportsBlocks(), "ParallelZLibTransformStream::init - zlib library is missing functions");
+    SC_TRY(AsyncDuplexStream::init(buffersPool, readableRequests, writableRequests));
+
+    SC_TRY(memory.sliceStartLength(0, DictionarySize, window));
+    size_t offset = DictionarySize;
+    for (Job& job : jobsSpan)
+    {
+        SC_TRY_MSG(not job.streamInit, "ParallelZLibTransformStream::init - job is already in use");
+        SC_TRY(memory.sliceStartLength(offset, DictionarySize, job.dictionary));
+        offset += DictionarySize;
+        SC_TRY(memory.sliceStartLength(offset, blockSize, job.input));
+        offset += blockSize;
+        SC_TRY(memory.sliceStartLength(offset, getOutputBound(blockSize), job.output));
+        offset += getOutputBound(blockSize);
+
+        ZLibAPI::Stream& strm = job.stream.reinterpret_as<ZLibAPI::Stream>();
+
+        strm.zalloc = nullptr;
+        strm.zfree  = nullptr;
+        strm.opaque = nullptr;
+
+        const auto res = zlib.deflateInit2(strm, ZLibAPI::DEFAULT_COMPRESSION, ZLibAPI::DEFLATED, windowBits, 8,
+                                           ZLibAPI::DEFAULT_STRATEGY);
+        SC_TRY_MSG(res == ZLibAPI::OK, "ParallelZLibTransformStream::init - deflateInit2 failed");
+        job.streamInit = true;
+        job.parent     = this;
+        job.state      = Job::State::Free;
+        SC_TRY(job.asyncWork.setThreadPool(threadPool));
+    }
+    jobs      = jobsSpan;
+    eventLoop = &loop;
+    algorithm = wantedAlgorithm;
+    checksum  = algorithm == ZLibStream::CompressZLib ? 1 : 0;
+    return Result(true);
+}
+
+SC::Result SC::ParallelZLibTransformStream::transform(AsyncBufferView::ID                 bufferID,
+                                                      Function<void(AsyncBufferView::ID)> cb)
+{
+    // The write will be acknowledged (with finishedWriting) only when all of its data has been copied to some job
+    SC_TRY_MSG(not hasPendingInput, "ParallelZLibTransformStream::transform - Logical Error");
+    hasPendingInput = true;
+    pendingOffset   = 0;
+    pendingBufferID = bufferID;
+    pendingCallback = move(cb);
+    return consumePendingInput();
+}
+
+SC::Result SC::ParallelZLibTransformStream::consumePendingInput()
+{
+    Span<const char> sourceData;
+    SC_TRY(AsyncWritableStream::getBuffersPool().getData(pendingBufferID, sourceData));
+    while (pendingOffset < sourceData.sizeInBytes())
+    {
+        Job& job = jobFor(nextSubmitSequence);
+        if (job.state == Job::State::Free)
+        {
+            job.state       = Job::State::Filling;
+            job.inputLength = 0;
+        }
+        else if (job.state != Job::State::Filling)
+        {
+            return Result(true); // All jobs are busy, resumed when next block will be pushed downstream
+        }
+        size_t toCopy = sourceData.sizeInBytes() - pendingOffset;
+        if (toCopy > blockSize - job.inputLength)
+        {
+            toCopy = blockSize - job.inputLength;
+        }
+        memcpy(job.input.data() + job.inputLength, sourceData.data() + pendingOffset, toCopy);
+        job.inputLength += toCopy;
+        pendingOffset += toCopy;
+        if (job.inputLength == blockSize)
+        {
+            SC_TRY(submit(job, false));
+        }
+    }
+    auto bufferID   = pendingBufferID;
+    auto callback   = move(pendingCallback);
+    hasPendingInput = false;
+    pendingCallback = {};
+    AsyncWritableStream::finishedWriting(bufferID, move(callback), Result(true));
+    return Result(true);
+}
+
+SC::Result SC::ParallelZLibTransformStream::submit(Job& job, bool isLast)
+{
+    // Previous block tail becomes the dictionary of this block, and this block tail the dictionary of next one.
+    // Copying it is needed because previous block memory could be reused before this job has been executed.
+    job.dictionaryLength = nextSubmitSequence == 0 ? 0 : DictionarySize;
+    memcpy(job.dictionary.data(), window.data(), job.dictionaryLength);
+    if (not isLast)
+    {
+        memcpy(window.data(), job.input.data() + job.inputLength - DictionarySize, DictionarySize);
+    }
+    job.isFirst      = nextSubmitSequence == 0;
+    job.isLast       = isLast;
+    job.outputLength = 0;
+    job.outputPushed = 0;
+    job.state        = Job::State::Compressing;
+    nextSubmitSequence++;
+    return job.asyncWork.start(*eventLoop);
+}
+
+bool SC::ParallelZLibTransformStream::trySubmitLast()
+{
+    if (not lastSubmitted)
+    {
+        // Last block is always submitted, even if empty, to terminate the DEFLATE stream
+        Job& job = jobFor(nextSubmitSequence);
+        if (job.state == Job::State::Free)
+        {
+            job.inputLength = 0;
+        }
+        else if (job.state != Job::State::Filling)
+        {
+            return false; // Retry when next block will be pushed downstream
+        }
+        lastSubmitted = true;
+        Result res    = submit(job, true);
+        if (not res)
+        {
+            AsyncWritableStream::emitError(res);
+            return false;
+        }
+    }
+    return true;
+}
+
+void SC::ParallelZLibTransformStream::pushCompressed()
+{
+    if (pushing or outputPaused or finished)
+    {
+        return; // Avoid re-entrancy when push synchronously triggers resume of this stream
+    }
+    pushing = true;
+    while (true)
+    {
+        Job& job = jobFor(nextPushSequence);
+        if (job.state == Job::State::Compressed)
+        {
+            // Checksums can be combined only here, in order, where all previous blocks are known
+            job.state = Job::State::Pushing;
+            if (algorithm == ZLibStream::CompressGZip)
+            {
+                const auto length = static_cast<long>(job.inputLength);
+                checksum = static_cast<uint32_t>(zlib.crc32Combine(checksum, job.checksum, length));
+            }
+            else if (algorithm == ZLibStream::CompressZLib)
+            {
+                const auto length = static_cast<long>(job.inputLength);
+                checksum = static_cast<uint32_t>(zlib.adler32Combine(checksum, job.checksum, length));
+            }
+            totalInput += job.inputLength;
+            if (job.isLast)
+            {
+                writeTrailer(job);
+            }
+        }
+        else if (job.state != Job::State::Pushing)
+        {
+            break;
+        }
+        while (job.outputPushed < job.outputLength)
+        {
+            if (not reserveOutputBuffer())
+            {
+                pushing = false;
+                return; // Resumed by readTransformed
+            }
+            size_t toCopy = job.outputLength - job.outputPushed;
+            if (toCopy > outputData.sizeInBytes())
+            {
+                toCopy = outputData.sizeInBytes();
+            }
+            memcpy(outputData.data(), job.output.data() + job.outputPushed, toCopy);
+            job.outputPushed += toCopy;
+            numPushes++;
+            hasOutputBuffer = false;
+            AsyncReadableStream::push(outputBufferID, toCopy);
+            AsyncReadableStream::getBuffersPool().unrefBuffer(outputBufferID);
+        }
+        job.state = Job::State::Free;
+        nextPushSequence++;
+        if (job.isLast)
+        {
+            finished = true;
+            if (hasOutputBuffer)
+            {
+                hasOutputBuffer = false;
+                AsyncReadableStream::getBuffersPool().unrefBuffer(outputBufferID);
+            }
+            AsyncReadableStream::pushEnd();
+            break;
+        }
+    }
+    if (not finished)
+    {
+        (void)reserveOutputBuffer();
+    }
+    pushing = false;
+}
+
+bool SC::ParallelZLibTransformStream::reserveOutputBuffer()
+{
+    // Holding one output buffer at all times ensures that compressed blocks can always be pushed downstream, even
+    // when all other buffers of the pool are being held by pending writes to this stream, that would otherwise
+    // deadlock as they're waiting for a free job (that will not be freed until its output has been pushed).
+    // When this is not possible, the readable side is paused until a buffer is released by some write in-flight.
+    if (not hasOutputBuffer)
+    {
+        AsyncBuffersPool& pool = AsyncReadableStream::getBuffersPool();
+        if (not pool.requestNewBuffer(0, outputBufferID, outputData))
+        {
+            if (not outputPaused)
+            {
+                outputPaused = true;
+                AsyncReadableStream::pause();
+            }
+            return false;
+        }
+        hasOutputBuffer = true;
+    }
+    return true;
+}
+
+void SC::ParallelZLibTransformStream::writeTrailer(Job& job)
+{
+    unsigned char* trailer = reinterpret_cast<unsigned char*>(job.output.data() + job.outputLength);
+    if (algorithm == ZLibStream::CompressGZip)
+    {
+        const uint32_t size = static_cast<uint32_t>(totalInput); // ISIZE is modulo 2^32
+        for (int idx = 0; idx < 4; ++idx)
+        {
+            trailer[idx]     = static_cast<unsigned char>(checksum >> (8 * idx)); // little endian
+            trailer[4 + idx] = static_cast<unsigned char>(size >> (8 * idx));
+        }
+        job.outputLength += 8;
+    }
+    else if (algorithm == ZLibStream::CompressZLib)
+    {
+        for (int idx = 0; idx < 4; ++idx)
+        {
+            trailer[idx] = static_cast<unsigned char>(checksum >> (8 * (3 - idx))); // big endian
+        }
+        job.outputLength += 4;
+    }
+}
+
+void SC::ParallelZLibTransformStream::afterJob(Job& job, Result result)
+{
+    if (not result)
+    {
+        job.state = Job::State::Errored;
+        AsyncReadableStream::emitError(result);
+        return;
+    }
+    job.state = Job::State::Compressed;
+    resumeAll();
+}
+
+void SC::ParallelZLibTransformStream::resumeAll()
+{
+    pushCompressed();
+    // Pushing blocks downstream frees their jobs, so pending input (or end of stream) can make progress
+    if (hasPendingInput)
+    {
+        Result res = consumePendingInput();
+        if (not res)
+        {
+            AsyncWritableStream::emitError(res);
+        }
+    }
+    else if (endRequested and not lastSubmitted)
+    {
+        (void)trySubmitLast();
+    }
+    if (finished)
+    {
+        AsyncWritableStream::resumeWriting(); // Transitions the writable side from Ending to Ended state
+    }
+}
+
+SC::Result SC::ParallelZLibTransformStream::readTransformed()
+{
+    // Called when readable side is resumed (for example when new output buffers are available)
+    outputPaused = false;
+    if (jobs.empty())
+    {
+        return Result(true);
+    }
+    const uint64_t pushesBefore = numPushes;
+    if (not finished and not reserveOutputBuffer())
+    {
+        return Result(true);
+    }
+    resumeAll();
+    if (numPushes != pushesBefore and not outputPaused and not finished)
+    {
+        AsyncReadableStream::reactivate(true); // Ends the synchronous read loop, as nothing more can be pushed
+    }
+    return Result(true);
+}
+
+bool SC::ParallelZLibTransformStream::canEndTransform()
+{
+    endRequested = true;
+    if (not hasPendingInput)
+    {
+        (void)trySubmitLast();
+    }
+    pushCompressed();
+    return finished;
+}
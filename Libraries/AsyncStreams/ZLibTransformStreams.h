@@ -42,4 +42,137 @@ struct AsyncZLibTransformStream : public AsyncTransformStream
     Span<char>       savedOutput;
 };
 
+/// @brief Compresses a stream with ZLIB, GZIP or DEFLATE, using multiple ThreadPool threads at the same time.
+/// @n
+/// Input is split in independent blocks of ParallelZLibTransformStream::blockSize bytes that are compressed
+/// concurrently (using the last 32 KB of the previous block as dictionary, to keep compression ratio close to the
+/// single threaded one), and the resulting output is re-assembled in order as a single standard compliant stream.
+/// Concurrency is bounded by the number of ParallelZLibTransformStream::Job passed to
+/// ParallelZLibTransformStream::init, that also bounds how much input is buffered when output can't be written fast
+/// enough (writes will not be acknowledged until a job becomes free again).
+/// @note Memory for all jobs must be supplied by the caller (see ParallelZLibTransformStream::getMemorySizeFor).
+struct ParallelZLibTransformStream : public AsyncDuplexStream
+{
+    static constexpr size_t DictionarySize = 32 * 1024; ///< Maximum distance that can be referenced by DEFLATE
+
+    /// @brief A single block compression job, running on a ThreadPool thread
+    struct Job
+    {
+        Job();
+        ~Job();
+        Job(const Job&)            = delete;
+        Job(Job&&)                 = delete;
+        Job& operator=(const Job&) = delete;
+        Job& operator=(Job&&)      = delete;
+
+      private:
+        friend struct ParallelZLibTransformStream;
+        enum class State
+        {
+            Free,        // Can be used to accumulate the next block
+            Filling,     // Accumulating input for the next block
+            Compressing, // Running on a ThreadPool thread
+            Compressed,  // Waiting for all previous blocks to be pushed downstream
+            Pushing,     // Being pushed downstream (waiting for output buffers)
+            Errored,     // Compression has failed
+        };
+        State         state      = State::Free;
+        bool          streamInit = false;
+        bool          isFirst    = false;
+        bool          isLast     = false;
+        uint32_t      checksum   = 0;
+        Span<char>    dictionary;
+        Span<char>    input;
+        Span<char>    output;
+        size_t        dictionaryLength = 0;
+        size_t        inputLength      = 0;
+        size_t        outputLength     = 0;
+        size_t        outputPushed     = 0;
+        AsyncLoopWork asyncWork;
+
+        ParallelZLibTransformStream* parent = nullptr;
+
+        AlignedStorage<112> stream;
+
+        Result work();
+        void   afterWork(AsyncLoopWork::Result& result);
+    };
+
+    ParallelZLibTransformStream();
+
+    size_t blockSize = 128 * 1024; ///< Size of each independently compressed block (must be >= DictionarySize)
+
+    /// @brief Returns size of the memory to be passed to ParallelZLibTransformStream::init
+    static constexpr size_t getMemorySizeFor(size_t numJobs, size_t blockSize)
+    {
+        return DictionarySize + numJobs * (DictionarySize + blockSize + getOutputBound(blockSize));
+    }
+
+    /// @brief Initializes the stream
+    /// @param buffersPool Pool used to allocate output buffers
+    /// @param readableRequests Queue for the readable (output) side of the stream
+    /// @param writableRequests Queue for the writable (input) side of the stream
+    /// @param eventLoop Event loop where job completions will be delivered
+    /// @param threadPool Thread pool running the compression jobs
+    /// @param jobs Jobs that can be concurrently compressing (should be >= number of threadPool threads)
+    /// @param memory Memory used by all jobs, with at least ParallelZLibTransformStream::getMemorySizeFor bytes
+    /// @param algorithm One of ZLibStream::CompressGZip, ZLibStream::CompressZLib or ZLibStream::CompressDeflate
+    Result init(AsyncBuffersPool& buffersPool, Span<AsyncReadableStream::Request> readableRequests,
+                Span<AsyncWritableStream::Request> writableRequests, AsyncEventLoop& eventLoop,
+                ThreadPool& threadPool, Span<Job> jobs, Span<char> memory,
+                ZLibStream::Algorithm algorithm = ZLibStream::CompressGZip);
+
+  private:
+    static constexpr size_t HeaderTrailerSize = 16; // GZIP header (10) or ZLIB header (2), trailers are 8 or 4 bytes
+
+    static constexpr size_t getOutputBound(size_t inputSize)
+    {
+        // Same as deflateBound, plus some room for the SYNC_FLUSH empty stored block and header / trailer
+        return inputSize + (inputSize >> 12) + (inputSize >> 14) + (inputSize >> 25) + 32 + HeaderTrailerSize;
+    }
+
+    AsyncEventLoop*       eventLoop = nullptr;
+    Span<Job>             jobs;
+    Span<char>            window;
+    ZLibStream::Algorithm algorithm = ZLibStream::CompressGZip;
+
+    uint64_t nextSubmitSequence = 0; // Sequence number of the block being filled
+    uint64_t nextPushSequence   = 0; // Sequence number of the next block to push downstream
+    uint64_t totalInput         = 0; // Total number of input bytes pushed downstream (for the trailer)
+    uint32_t checksum           = 0; // Combined checksum of all blocks pushed downstream (for the trailer)
+    uint64_t numPushes          = 0;
+
+    // Output buffer reserved for next push
+    bool                hasOutputBuffer = false;
+    AsyncBufferView::ID outputBufferID;
+    Span<char>          outputData;
+
+    bool outputPaused  = false;
+    bool pushing       = false;
+    bool endRequested  = false;
+    bool lastSubmitted = false;
+    bool finished      = false;
+
+    // Input buffer not yet fully copied to a job
+    bool                                hasPendingInput = false;
+    size_t                              pendingOffset   = 0;
+    AsyncBufferView::ID                 pendingBufferID;
+    Function<void(AsyncBufferView::ID)> pendingCallback;
+
+    Job& jobFor(uint64_t sequence) { return jobs[static_cast<size_t>(sequence % jobs.sizeInElements())]; }
+
+    Result transform(AsyncBufferView::ID bufferID, Function<void(AsyncBufferView::ID)> cb);
+    Result readTransformed();
+    bool   canEndTransform();
+
+    Result consumePendingInput();
+    Result submit(Job& job, bool isLast);
+    bool   trySubmitLast();
+    void   pushCompressed();
+    bool   reserveOutputBuffer();
+    void   writeTrailer(Job& job);
+    void   afterJob(Job& job, Result result);
+    void   resumeAll();
+};
+
 } // namespace SC
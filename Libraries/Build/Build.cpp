@@ -9,6 +9,7 @@ namespace SC
 namespace Build
 {
 struct FilePathsResolver;
+struct ExecutorNative;
 /// @brief Writes all project files for a given Definition with some Parameters using the provided FilePathsResolver
 struct ProjectWriter
 {
@@ -25,16 +26,21 @@ struct ProjectWriter
     [[nodiscard]] bool write(StringView filename);
 
   private:
+    friend struct ExecutorNative;
     struct WriterXCode;
     struct WriterVisualStudio;
     struct WriterMakefile;
+    struct WriterNinja;
 };
 } // namespace Build
 } // namespace SC
 #include "Internal/BuildWriterMakefile.inl"
+#include "Internal/BuildWriterNinja.inl"
 #include "Internal/BuildWriterVisualStudio.inl"
 #include "Internal/BuildWriterXCode.inl"
 
+#include "Internal/BuildExecutorNative.inl" // Uses WriterNinja
+
 #include "../Containers/Vector.h"
 
 struct SC::Build::CompileFlags::Internal
@@ -273,6 +279,15 @@ bool SC::Build::Project::addSpecificFileFlags(SourceFiles selection)
     return filesWithSpecificFlags.push_back(selection);
 }
 
+bool SC::Build::Project::enableUnityBuild(uint32_t batchSize)
+{
+    if (batchSize == 0)
+        return false;
+    unityBuild.enabled   = true;
+    unityBuild.batchSize = batchSize;
+    return true;
+}
+
 bool SC::Build::Project::removeFiles(StringView subdirectory, StringView filter)
 {
     if (subdirectory.containsCodePoint('*') or subdirectory.containsCodePoint('?'))
@@ -629,6 +644,13 @@ bool SC::Build::ProjectWriter::write(StringView defaultProjectName)
         }
         break;
     }
+    case Generator::Ninja: {
+        WriterNinja           writer(definition, filePathsResolver, directories, parameters);
+        WriterNinja::Renderer renderer;
+        SC_TRY(writer.writeNinja(fs, workspace, renderer, buffer));
+        break;
+    }
+    case Generator::Native: break; // Definition is compiled directly by Action::execute, without project files
     }
     return Result(true);
 }
@@ -636,9 +658,9 @@ bool SC::Build::ProjectWriter::write(StringView defaultProjectName)
 struct SC::Build::Action::Internal
 {
     static Result configure(ConfigureFunction configure, StringView projectFileName, const Action& action);
-    static Result coverage(StringView projectFileName, const Action& action);
-    static Result executeInternal(StringView projectFileName, const Action& action, Span<StringView> environment = {},
-                                  String* outputExecutable = nullptr);
+    static Result coverage(ConfigureFunction configure, StringView projectFileName, const Action& action);
+    static Result executeInternal(ConfigureFunction configure, StringView projectFileName, const Action& action,
+                                  Span<StringView> environment = {}, String* outputExecutable = nullptr);
 
     static Result toVisualStudioArchitecture(Architecture::Type architectureType, StringView& architecture)
     {
@@ -682,6 +704,55 @@ struct SC::Build::Action::Internal
         }
         return Result(true);
     }
+
+    /// @brief Gets target OS, architecture and compiler (from CXX variable) used by Ninja and Native generators
+    static Result toVariant(const Action& action, Span<StringView> environment, StringView& targetOS,
+                            StringView& architecture, StringView& compiler)
+    {
+        architecture = HostInstructionSet == InstructionSet::ARM64 ? StringView("arm64") : "x86_64";
+        switch (action.parameters.architecture)
+        {
+        case Architecture::Intel64: architecture = "x86_64"; break;
+        case Architecture::Arm64: architecture = "arm64"; break;
+        case Architecture::Any: break;
+        case Architecture::Intel32: // Unsupported
+        case Architecture::Wasm:    // Unsupported
+            return Result::Error("Unsupported architecture for ninja / native");
+        }
+        // Compiler is resolved when generating, so pick the build.ninja written for the compiler set in CXX
+        compiler = action.parameters.platform == Platform::Apple ? StringView("clang") : "gcc";
+        StringView name, value;
+        for (size_t idx = 0; idx + 1 < environment.sizeInElements(); idx += 2)
+        {
+            if (environment[idx] == "CXX")
+            {
+                value = environment[idx + 1];
+            }
+        }
+        ProcessEnvironment processEnvironment;
+        size_t             index;
+        if (value.isEmpty() and processEnvironment.contains("CXX", &index))
+        {
+            SC_TRY(processEnvironment.get(index, name, value));
+        }
+        if (not value.isEmpty())
+        {
+            compiler = value.containsString("clang") ? StringView("clang") : "gcc";
+        }
+        targetOS = action.parameters.platform == Platform::Apple ? "macOS" : "linux";
+        return Result(true);
+    }
+
+    /// @brief Gets the directory of the build.ninja (or of Native build) for platform, architecture and compiler
+    static Result toVariantDirectory(const Action& action, Span<StringView> environment, String& directory)
+    {
+        StringView targetOS, architecture, compiler;
+        SC_TRY(toVariant(action, environment, targetOS, architecture, compiler));
+        SC_TRY(Path::join(directory, {action.parameters.directories.projectsDirectory.view(),
+                                      Generator::toString(action.parameters.generator)}));
+        return Result(StringBuilder(directory, StringBuilder::DoNotClear)
+                          .append("/{}-{}-{}", targetOS, architecture, compiler));
+    }
 };
 
 SC::Result SC::Build::Action::execute(const Action& action, ConfigureFunction configure, StringView projectName)
@@ -690,8 +761,8 @@ SC::Result SC::Build::Action::execute(const Action& action, ConfigureFunction co
     {
     case Print:
     case Run:
-    case Compile: return Internal::executeInternal(projectName, action);
-    case Coverage: return Internal::coverage(projectName, action);
+    case Compile: return Internal::executeInternal(configure, projectName, action);
+    case Coverage: return Internal::coverage(configure, projectName, action);
     case Configure: return Internal::configure(configure, projectName, action);
     }
     return Result::Error("Action::execute - unsupported action");
@@ -706,7 +777,8 @@ SC::Result SC::Build::Action::Internal::configure(ConfigureFunction configure, S
     return Result(true);
 }
 
-SC::Result SC::Build::Action::Internal::coverage(StringView projectFileName, const Action& action)
+SC::Result SC::Build::Action::Internal::coverage(ConfigureFunction configure, StringView projectFileName,
+                                                 const Action& action)
 {
     Action newAction = action;
     String executablePath;
@@ -714,11 +786,11 @@ SC::Result SC::Build::Action::Internal::coverage(StringView projectFileName, con
     // Build the configuration with coverage information
     newAction.action         = Action::Compile;
     StringView environment[] = {"CC", "clang", "CXX", "clang++"};
-    SC_TRY(executeInternal(projectFileName, newAction, environment));
+    SC_TRY(executeInternal(configure, projectFileName, newAction, environment));
 
     // Get coverage configuration executable path
     newAction.action = Action::Print;
-    SC_TRY(executeInternal(projectFileName, newAction, environment, &executablePath));
+    SC_TRY(executeInternal(configure, projectFileName, newAction, environment, &executablePath));
     String coverageDirectory;
     SC_TRY(Path::join(coverageDirectory, {action.parameters.directories.projectsDirectory.view(), "..", "_Coverage"}));
 
@@ -879,8 +951,9 @@ SC::Result SC::Build::Action::Internal::coverage(StringView projectFileName, con
     return Result(true);
 }
 
-SC::Result SC::Build::Action::Internal::executeInternal(StringView projectFileName, const Action& action,
-                                                        Span<StringView> environment, String* outputExecutable)
+SC::Result SC::Build::Action::Internal::executeInternal(ConfigureFunction configure, StringView projectFileName,
+                                                        const Action& action, Span<StringView> environment,
+                                                        String* outputExecutable)
 {
     const StringView configuration  = action.configuration.isEmpty() ? "Debug" : action.configuration;
     const StringView selectedTarget = action.target.isEmpty() ? projectFileName : action.target;
@@ -1102,6 +1175,119 @@ SC::Result SC::Build::Action::Internal::executeInternal(StringView projectFileNa
         }
     }
     break;
+    case Generator::Ninja: {
+        String ninjaDirectory;
+        SC_TRY(toVariantDirectory(action, environment, ninjaDirectory));
+        SmallString<64> targetName;
+        SC_TRY(StringBuilder(targetName).format("{}_{}", selectedTarget, configuration));
+        if (environment.sizeInElements() % 2 == 0)
+        {
+            for (size_t idx = 0; idx < environment.sizeInElements(); idx += 2)
+            {
+                SC_TRY(process.setEnvironment(environment[idx], environment[idx + 1]));
+            }
+        }
+        switch (action.action)
+        {
+        case Action::Compile:
+        case Action::Run: {
+            StringView arguments[] = {"ninja", "-C", ninjaDirectory.view(), targetName.view()};
+            SC_TRY(process.exec(arguments));
+            SC_TRY_MSG(process.getExitStatus() == 0, "Compile returned error");
+        }
+        break;
+        case Action::Print: break;
+        default: return Result::Error("Unexpected Build::Action (supported \"compile\", \"run\")");
+        }
+        if (action.action == Action::Compile)
+        {
+            break;
+        }
+        // The <target>_<configuration> phony target has the executable as its only input
+        String     output = StringEncoding::Utf8;
+        Process    queryProcess;
+        StringView queryArguments[] = {"ninja", "-C", ninjaDirectory.view(), "-t", "query", targetName.view()};
+        SC_TRY(queryProcess.exec(queryArguments, output));
+        SC_TRY_MSG(queryProcess.getExitStatus() == 0, "Cannot query ninja target");
+        StringViewTokenizer tokenizer(output.view());
+        StringView          relativePath;
+        bool                foundInput = false;
+        while (tokenizer.tokenizeNextLine())
+        {
+            const StringView line = tokenizer.component.trimWhiteSpaces();
+            if (foundInput)
+            {
+                relativePath = line;
+                break;
+            }
+            foundInput = line == "input: phony";
+        }
+        SC_TRY_MSG(not relativePath.isEmpty(), "Cannot find executable path from ninja target");
+        String             executablePath, joinedPath;
+        Vector<StringView> components;
+        SC_TRY(Path::join(joinedPath, {ninjaDirectory.view(), relativePath}));
+        SC_TRY(Path::normalize(joinedPath.view(), components, &executablePath, Path::AsNative));
+        if (action.action == Action::Run)
+        {
+            Process testProcess;
+            SC_TRY(testProcess.exec({executablePath.view()}));
+            SC_TRY_MSG(testProcess.getExitStatus() == 0, "Run exited with non zero status");
+        }
+        else if (outputExecutable)
+        {
+            return Result(outputExecutable->assign(executablePath.view()));
+        }
+    }
+    break;
+    case Generator::Native: {
+        switch (action.action)
+        {
+        case Action::Compile:
+        case Action::Run:
+        case Action::Print: break;
+        default: return Result::Error("Unexpected Build::Action (supported \"compile\", \"run\")");
+        }
+        StringView targetOS, architecture, compiler;
+        SC_TRY(toVariant(action, environment, targetOS, architecture, compiler));
+        String variantDirectory, cacheDirectory;
+        SC_TRY(toVariantDirectory(action, environment, variantDirectory));
+        {
+            // Cache lives outside of _Intermediates and _Outputs, to survive cleaning them
+            String             joinedPath;
+            Vector<StringView> components;
+            SC_TRY(Path::join(joinedPath, {action.parameters.directories.projectsDirectory.view(), "..", "_Cache"}));
+            SC_TRY(Path::normalize(joinedPath.view(), components, &cacheDirectory, Path::AsNative));
+        }
+        Definition definition;
+        SC_TRY(configure(definition, action.parameters));
+        for (const Workspace& workspace : definition.workspaces)
+        {
+            SC_TRY(workspace.validate());
+        }
+        SC_TRY_MSG(not definition.workspaces.isEmpty(), "Definition has no workspaces");
+        size_t index;
+        SC_TRY_MSG(definition.workspaces[0].projects.find([&](const Project& it) { return it.name == selectedTarget; },
+                                                          &index),
+                   "Cannot find project to compile");
+        FilePathsResolver filePathsResolver;
+        SC_TRY(filePathsResolver.resolve(definition));
+        ExecutorNative executor(definition, filePathsResolver, action.parameters, environment);
+        SC_TRY(executor.setVariant(targetOS, architecture, compiler));
+        String executablePath;
+        SC_TRY(executor.build(definition.workspaces[0].projects[index], configuration, variantDirectory.view(),
+                              cacheDirectory.view(), action.action != Action::Print, executablePath));
+        if (action.action == Action::Run)
+        {
+            Process testProcess;
+            SC_TRY(testProcess.exec({executablePath.view()}));
+            SC_TRY_MSG(testProcess.getExitStatus() == 0, "Run exited with non zero status");
+        }
+        else if (action.action == Action::Print and outputExecutable)
+        {
+            return Result(outputExecutable->assign(executablePath.view()));
+        }
+    }
+    break;
     }
     return Result(true);
 }
@@ -94,7 +94,7 @@ struct Architecture
     }
 };
 
-/// @brief Build system generator (Xcode / Visual Studio)
+/// @brief Build system generator (Xcode / Visual Studio / Make / Ninja / Native)
 struct Generator
 {
     enum Type
@@ -103,6 +103,8 @@ struct Generator
         VisualStudio2022, ///< Generate projects for Visual Studio 2022
         VisualStudio2019, ///< Generate projects for Visual Studio 2019
         Make,             ///< Generate posix makefiles
+        Ninja,            ///< Generate ninja build files (with compile_commands.json)
+        Native,           ///< Compile directly invoking compiler processes, caching object files (no project files)
     };
 
     /// @brief Get StringView from Generator::Type
@@ -114,6 +116,8 @@ struct Generator
         case VisualStudio2022: return "VisualStudio2022";
         case VisualStudio2019: return "VisualStudio2019";
         case Make: return "Make";
+        case Ninja: return "Ninja";
+        case Native: return "Native";
         }
         Assert::unreachable();
     }
@@ -322,6 +326,14 @@ struct TargetType
     };
 };
 
+/// @brief Unity (jumbo) build settings, compiling batches of C++ source files as a single translation unit
+/// @note Files with per-file compile flags (Project::addSpecificFileFlags) are never batched
+struct UnityBuild
+{
+    bool     enabled   = false; ///< Compile C++ sources through generated unity files including them
+    uint32_t batchSize = 8;     ///< Maximum number of C++ sources included by each unity file
+};
+
 /// @brief Groups multiple Configuration and source files with their compile and link flags
 struct Project
 {
@@ -340,6 +352,8 @@ struct Project
 
     Vector<SourceFiles> filesWithSpecificFlags; ///< List of files with specific flags different from project/config
 
+    UnityBuild unityBuild; ///< Unity build settings (disabled by default)
+
     Vector<Configuration> configurations; ///< Build configurations created inside the project
 
     /// @brief Set root directory for this project (all relative paths will be relative to this one)
@@ -368,6 +382,9 @@ struct Project
     /// @brief Add a set of flags that apply to some files only
     [[nodiscard]] bool addSpecificFileFlags(SourceFiles selection);
 
+    /// @brief Enables unity build, batching C++ sources (without specific flags) in groups of `batchSize` files
+    [[nodiscard]] bool enableUnityBuild(uint32_t batchSize = 8);
+
     /// @brief Adds paths to include paths list
     [[nodiscard]] bool addIncludePaths(Span<const StringView> includePaths);
 
@@ -0,0 +1,585 @@
+// Copyright (c) Stefano Cristiano
+// SPDX-License-Identifier: MIT
+#include "../../Async/Async.h"
+#include "../../FileSystem/FileSystem.h"
+#include "../../FileSystem/Path.h"
+#include "../../Hashing/Checksum.h"
+#include "../../Process/Process.h"
+#include "../../Strings/StringBuilder.h"
+#include "../Build.h"
+#include "BuildWriter.h"
+
+/// @brief Compiles a project configuration invoking compiler and linker directly, without any other build system.
+/// Compile and link flags are the same written by WriterNinja for a given Variant.
+/// Object files are restored from a content-addressed cache when possible, otherwise they're compiled by parallel
+/// compiler processes whose exit is monitored by AsyncProcessExit (like ProcessLimiter in SC-format).
+///
+/// Each object file is cached in two steps, as included headers are known only after compiling:
+/// - A "source key" hashes compiler, flags, source path and source content, naming a manifest with included headers
+/// - An "object key" hashes the source key with path and content of all headers in the manifest, naming the object
+struct SC::Build::ExecutorNative
+{
+    using WriterNinja = ProjectWriter::WriterNinja;
+    using Variant     = WriterNinja::Variant;
+    using RenderItem  = WriterInternal::RenderItem;
+    using Renderer    = WriterInternal::Renderer;
+
+    static constexpr size_t MaxProcesses = 32; // Never launch more than 32 compiler processes
+
+    /// @brief A single source file to be compiled to an object file
+    struct Unit
+    {
+        String source;     // Source file (relative to variant directory)
+        String objectFile; // Object file (relative to variant directory)
+
+        Vector<String> arguments; // Compiler command line
+
+        String sourceKey; // Hash of compiler, flags, source path and source content
+        String objectKey; // Hash of source key and of all included headers
+
+        bool needsCompile = false;
+    };
+
+    const FilePathsResolver& filePathsResolver;
+    Span<StringView>         environment;
+
+    Variant variant;
+
+    WriterNinja writer;
+    FileSystem  fs; // Initialized to the variant directory, that is also the working directory of all processes
+
+    String cacheDirectory;
+
+    VectorMap<String, uint64_t> headersHashes; // Content hash of each header, computed at most once per build
+
+    Vector<Unit>     units;
+    AsyncEventLoop   eventLoop;
+    AsyncProcessExit processExits[MaxProcesses];
+    bool             processBusy[MaxProcesses] = {false};
+    Result           compileResult             = Result(true);
+
+    ExecutorNative(const Definition& definition, const FilePathsResolver& filePathsResolver,
+                   const Parameters& parameters, Span<StringView> environment)
+        : filePathsResolver(filePathsResolver), environment(environment),
+          writer(definition, filePathsResolver, parameters.directories, parameters)
+    {}
+
+    /// @brief Sets target OS (linux / macOS), architecture (x86_64 / arm64) and compiler (gcc / clang) to build for
+    [[nodiscard]] Result setVariant(StringView targetOS, StringView targetArchitecture, StringView compiler)
+    {
+        variant.targetOS           = targetOS;
+        variant.targetArchitecture = targetArchitecture;
+        variant.compiler           = compiler;
+        variant.buildSystem        = "native";
+        if (targetOS == "macOS")
+        {
+            SC_TRY_MSG(WriterNinja::isClang(variant), "Only clang is supported on macOS");
+            variant.targetFlags = WriterNinja::getAppleTargetFlags(targetArchitecture);
+        }
+        else
+        {
+            const StringView hostArchitecture =
+                HostInstructionSet == InstructionSet::ARM64 ? StringView("arm64") : "x86_64";
+            SC_TRY_MSG(targetArchitecture == hostArchitecture, "Cross-compiling with native on linux is unsupported");
+        }
+        return Result(true);
+    }
+
+    /// @brief Compiles and links a project configuration, or just computes its executable path.
+    /// @param project The project to build
+    /// @param configName Name of the configuration to build
+    /// @param variantDirectory Absolute path of the directory used as `$(PROJECT_DIR)` and as working directory
+    /// @param objectsCacheDirectory Absolute path of the directory where objects and headers manifests are cached
+    /// @param compile If `false` only computes executable path without compiling anything
+    /// @param[out] executable Absolute path of the linked executable
+    [[nodiscard]] Result build(const Project& project, StringView configName, StringView variantDirectory,
+                               StringView objectsCacheDirectory, bool compile, String& executable)
+    {
+        SC_TRY(writer.variantDirectory.assign(variantDirectory));
+        SC_TRY(cacheDirectory.assign(objectsCacheDirectory));
+        SC_TRY(fs.init("."));
+        SC_TRY(fs.makeDirectoryRecursive(variantDirectory));
+        SC_TRY(fs.makeDirectoryRecursive(objectsCacheDirectory));
+        SC_TRY(fs.init(variantDirectory));
+
+        const Configuration* configuration = project.getConfiguration(configName);
+        SC_TRY_MSG(configuration != nullptr, "Cannot find configuration to build");
+        SC_TRY_MSG(configuration->architecture != Architecture::Intel64 or variant.targetArchitecture == "x86_64",
+                   "Configuration is restricted to a different architecture");
+        SC_TRY_MSG(configuration->architecture != Architecture::Arm64 or variant.targetArchitecture == "arm64",
+                   "Configuration is restricted to a different architecture");
+
+        CompileFlags        compileFlags;
+        const CompileFlags* compileSources[] = {&configuration->compile, &project.files.compile};
+        SC_TRY(CompileFlags::merge(compileSources, compileFlags));
+        SC_TRY_MSG(not compileFlags.enableCoverage or WriterNinja::isClang(variant),
+                   "Coverage is supported only when using clang");
+
+        Directories variantDirectories = writer.directories;
+        SC_TRY(variantDirectories.projectsDirectory.assign(variantDirectory));
+        String projectDirFormat;
+        SC_TRY(StringBuilder(projectDirFormat).format("{}/{{}}", variantDirectory));
+        RelativeDirectories relativeDirectories;
+        SC_TRY(relativeDirectories.computeRelativeDirectories(variantDirectories, Path::AsPosix, project,
+                                                              projectDirFormat.view()));
+
+        String intermediateDirectory, outputDirectory;
+        SC_TRY(writer.appendDirectory(intermediateDirectory, configuration->intermediatesPath.view(),
+                                      relativeDirectories.relativeProjectsToIntermediates.view(), project, configName,
+                                      relativeDirectories, variant));
+        SC_TRY(writer.appendDirectory(outputDirectory, configuration->outputPath.view(),
+                                      relativeDirectories.relativeProjectsToOutputs.view(), project, configName,
+                                      relativeDirectories, variant));
+
+        String relativeExecutable;
+        SC_TRY(StringBuilder(relativeExecutable).format("{}/{}", outputDirectory, project.targetName));
+        {
+            String             joinedPath;
+            Vector<StringView> components;
+            SC_TRY(Path::join(joinedPath, {variantDirectory, relativeExecutable.view()}));
+            SC_TRY(Path::normalize(joinedPath.view(), components, &executable, Path::AsNative));
+        }
+        if (not compile)
+        {
+            return Result(true);
+        }
+        SC_TRY(fs.makeDirectoryRecursive(intermediateDirectory.view()));
+        SC_TRY(fs.makeDirectoryRecursive(outputDirectory.view()));
+
+        Renderer renderer;
+        SC_TRY(WriterInternal::renderProject(variantDirectory, project, filePathsResolver, renderer.renderItems));
+        SC_TRY(prepareUnits(project, *configuration, compileFlags, relativeDirectories, renderer,
+                            intermediateDirectory.view()));
+        SC_TRY(compileUnits());
+        for (Unit& unit : units)
+        {
+            if (unit.needsCompile)
+            {
+                SC_TRY(storeUnit(unit));
+            }
+        }
+        String ldflags;
+        SC_TRY(WriterNinja::appendLinkFlags(ldflags, project.link, compileFlags, variant));
+        return link(project, ldflags.view(), intermediateDirectory.view(), relativeExecutable.view());
+    }
+
+  private:
+    [[nodiscard]] Result prepareUnits(const Project& project, const Configuration& configuration,
+                                      const CompileFlags& compileFlags, const RelativeDirectories& relativeDirectories,
+                                      const Renderer& renderer, StringView intermediateDirectory)
+    {
+        const StringView configName = configuration.name.view();
+        using Flags = WriterNinja::Flags;
+        Flags projectFlags;
+        SC_TRY(writer.appendCompileFlags(projectFlags, project, configName, compileFlags, relativeDirectories,
+                                         variant));
+        Vector<Flags> groupsFlags;
+        for (const SourceFiles& files : project.filesWithSpecificFlags)
+        {
+            CompileFlags        groupCompileFlags;
+            const CompileFlags* groupSources[] = {&files.compile, &configuration.compile, &project.files.compile};
+            SC_TRY(CompileFlags::merge(groupSources, groupCompileFlags));
+            Flags groupFlags;
+            SC_TRY(writer.appendCompileFlags(groupFlags, project, configName, groupCompileFlags, relativeDirectories,
+                                             variant));
+            SC_TRY(groupsFlags.push_back(move(groupFlags)));
+        }
+
+        units.clear();
+        for (const RenderItem& item : renderer.renderItems)
+        {
+            const StringView extension = RenderItem::getExtension(item.type);
+            if (extension.isEmpty() or item.compiledInUnityFile)
+                continue;
+            const bool   isCpp = item.type == RenderItem::CppFile or item.type == RenderItem::ObjCppFile;
+            const Flags* flags = &projectFlags;
+            size_t       index;
+            if (item.compileFlags != nullptr and
+                project.filesWithSpecificFlags.find([&](const SourceFiles& it)
+                                                    { return &it.compile == item.compileFlags; }, &index))
+            {
+                flags = &groupsFlags[index];
+            }
+            Unit unit;
+            SC_TRY(unit.source.assign(item.path.view()));
+            SC_TRY(StringBuilder(unit.objectFile)
+                       .format("{}/{}.o", intermediateDirectory, Path::basename(item.name.view(), extension)));
+            StringView compiler;
+            if (WriterNinja::isClang(variant))
+            {
+                compiler = isCpp ? StringView("clang++") : "clang";
+            }
+            else
+            {
+                compiler = isCpp ? StringView("g++") : "gcc";
+            }
+            SC_TRY(unit.arguments.push_back(compiler));
+            SC_TRY(appendArguments(unit.arguments, isCpp ? flags->cxxflags.view() : flags->cflags.view()));
+            SC_TRY(computeSourceKey(unit));
+
+            String depfile;
+            SC_TRY(StringBuilder(depfile).format("{}.d", unit.objectFile));
+            SC_TRY(unit.arguments.append({"-MD", "-MF", depfile.view(), "-pthread", "-c", unit.source.view(), "-o",
+                                          unit.objectFile.view()}));
+            SC_TRY(prepareUnit(unit));
+            SC_TRY(units.push_back(move(unit)));
+        }
+        return Result(true);
+    }
+
+    /// @brief Checks if object file is up to date, restores it from cache or marks it as needing compilation
+    [[nodiscard]] Result prepareUnit(Unit& unit)
+    {
+        String keyFile, manifestFile, manifest, objectKey;
+        SC_TRY(StringBuilder(keyFile).format("{}.key", unit.objectFile));
+        SC_TRY(StringBuilder(manifestFile).format("{}/{}.headers", cacheDirectory, unit.sourceKey));
+
+        unit.needsCompile = true;
+        if (not fs.existsAndIsFile(manifestFile.view()))
+        {
+            return fs.removeFileIfExists(keyFile.view());
+        }
+        SC_TRY(fs.read(manifestFile.view(), manifest, StringEncoding::Utf8));
+        bool headersFound;
+        SC_TRY(computeObjectKey(unit.sourceKey.view(), manifest.view(), unit.objectKey, headersFound));
+        if (not headersFound)
+        {
+            return fs.removeFileIfExists(keyFile.view()); // Some header has been removed
+        }
+        if (fs.existsAndIsFile(unit.objectFile.view()) and fs.existsAndIsFile(keyFile.view()))
+        {
+            String currentKey;
+            SC_TRY(fs.read(keyFile.view(), currentKey, StringEncoding::Ascii));
+            if (currentKey == unit.objectKey)
+            {
+                unit.needsCompile = false; // Object file is up to date
+                return Result(true);
+            }
+        }
+        String cachedObject;
+        SC_TRY(StringBuilder(cachedObject).format("{}/{}.o", cacheDirectory, unit.objectKey));
+        if (fs.existsAndIsFile(cachedObject.view()))
+        {
+            const FileSystem::CopyFlags overwrite = FileSystem::CopyFlags().setOverwrite(true);
+            SC_TRY(fs.copyFile(cachedObject.view(), unit.objectFile.view(), overwrite));
+            SC_TRY(fs.writeString(keyFile.view(), unit.objectKey.view()));
+            unit.needsCompile = false;
+            return Result(true);
+        }
+        return fs.removeFileIfExists(keyFile.view());
+    }
+
+    /// @brief Stores a freshly compiled object file and the list of headers it includes in the cache
+    [[nodiscard]] Result storeUnit(Unit& unit)
+    {
+        String depfile, dependencies, manifest;
+        SC_TRY(StringBuilder(depfile).format("{}.d", unit.objectFile));
+        SC_TRY(fs.read(depfile.view(), dependencies, StringEncoding::Utf8));
+        SC_TRY(parseDepfile(dependencies.view(), manifest));
+
+        bool headersFound;
+        SC_TRY(computeObjectKey(unit.sourceKey.view(), manifest.view(), unit.objectKey, headersFound));
+        SC_TRY_MSG(headersFound, "Cannot read headers listed in depfile");
+
+        String manifestFile, cachedObject, keyFile;
+        SC_TRY(StringBuilder(manifestFile).format("{}/{}.headers", cacheDirectory, unit.sourceKey));
+        SC_TRY(StringBuilder(cachedObject).format("{}/{}.o", cacheDirectory, unit.objectKey));
+        SC_TRY(StringBuilder(keyFile).format("{}.key", unit.objectFile));
+        SC_TRY(fs.removeFileIfExists(manifestFile.view()));
+        SC_TRY(fs.writeString(manifestFile.view(), manifest.view()));
+        SC_TRY(fs.copyFile(unit.objectFile.view(), cachedObject.view(), FileSystem::CopyFlags().setOverwrite(true)));
+        SC_TRY(fs.removeFileIfExists(keyFile.view()));
+        return fs.writeString(keyFile.view(), unit.objectKey.view());
+    }
+
+    /// @brief Launches all compiler processes needed, keeping at most one process per core running at the same time
+    [[nodiscard]] Result compileUnits()
+    {
+        size_t maxProcesses = Process::getNumberOfProcessors();
+        if (maxProcesses > MaxProcesses)
+        {
+            maxProcesses = MaxProcesses;
+        }
+        compileResult = Result(true);
+        SC_TRY(eventLoop.create());
+        for (size_t unitIndex = 0; unitIndex < units.size() and compileResult; ++unitIndex)
+        {
+            if (not units[unitIndex].needsCompile)
+                continue;
+            size_t slot = maxProcesses;
+            while (compileResult and slot == maxProcesses)
+            {
+                for (slot = 0; slot < maxProcesses; ++slot)
+                {
+                    if (not processBusy[slot])
+                        break;
+                }
+                if (slot == maxProcesses)
+                {
+                    compileResult = eventLoop.runOnce(); // Wait for a compiler process to exit
+                }
+            }
+            if (compileResult)
+            {
+                compileResult = launchUnit(unitIndex, slot);
+            }
+        }
+        SC_TRY(eventLoop.run()); // Wait for all compiler processes still running
+        SC_TRY(eventLoop.close());
+        return compileResult;
+    }
+
+    [[nodiscard]] Result launchUnit(size_t unitIndex, size_t slot)
+    {
+        Vector<StringView> arguments;
+        for (const String& argument : units[unitIndex].arguments)
+        {
+            SC_TRY(arguments.push_back(argument.view()));
+        }
+        Process process;
+        SC_TRY(setupProcess(process));
+        SC_TRY(process.launch(arguments.toSpanConst()));
+        // Launch does not wait for the child process to finish so we can monitor it with the event loop
+        processExits[slot].callback = [this](AsyncProcessExit::Result& result)
+        {
+            ProcessDescriptor::ExitStatus exitStatus;
+            Result                        res = result.get(exitStatus);
+            if (res and exitStatus.status != 0)
+            {
+                res = Result::Error("Compile returned error");
+            }
+            if (not res and compileResult)
+            {
+                compileResult = res; // Keep the first error, still waiting for all other processes to exit
+            }
+            processBusy[&result.getAsync() - processExits] = false;
+        };
+        ProcessDescriptor::Handle processHandle = 0;
+        SC_TRY(process.handle.get(processHandle, Result::Error("Invalid Handle")));
+        SC_TRY(processExits[slot].start(eventLoop, processHandle));
+        process.handle.detach(); // we can't close it
+        processBusy[slot] = true;
+        return Result(true);
+    }
+
+    [[nodiscard]] Result link(const Project& project, StringView ldflags, StringView intermediateDirectory,
+                              StringView relativeExecutable)
+    {
+        Vector<String> arguments;
+        SC_TRY(arguments.push_back(WriterNinja::isClang(variant) ? StringView("clang++") : "g++"));
+        SC_TRY(appendArguments(arguments, ldflags));
+
+        // Link only if executable is missing or if any object file or link flag has changed since last link
+        Checksum checksum;
+        SC_TRY(checksum.setType(Checksum::TypeXXHash64));
+        SC_TRY(addToChecksum(checksum, relativeExecutable));
+        for (const String& argument : arguments)
+        {
+            SC_TRY(addToChecksum(checksum, argument.view()));
+        }
+        String responseFileContent;
+        for (const Unit& unit : units)
+        {
+            SC_TRY(addToChecksum(checksum, unit.objectKey.view()));
+            SC_TRY(StringBuilder(responseFileContent).append("\"{}\"\n", unit.objectFile));
+        }
+        String linkKey, keyFile, responseFile, responseFileArgument;
+        SC_TRY(appendChecksum(checksum, linkKey));
+        SC_TRY(StringBuilder(keyFile).format("{}/{}.key", intermediateDirectory, project.targetName));
+        if (fs.existsAndIsFile(relativeExecutable) and fs.existsAndIsFile(keyFile.view()))
+        {
+            String currentKey;
+            SC_TRY(fs.read(keyFile.view(), currentKey, StringEncoding::Ascii));
+            if (currentKey == linkKey)
+            {
+                return Result(true);
+            }
+        }
+        SC_TRY(fs.removeFileIfExists(keyFile.view()));
+        SC_TRY(StringBuilder(responseFile).format("{}/{}.rsp", intermediateDirectory, project.targetName));
+        SC_TRY(fs.removeFileIfExists(responseFile.view()));
+        SC_TRY(fs.writeString(responseFile.view(), responseFileContent.view()));
+        SC_TRY(StringBuilder(responseFileArgument).format("@{}", responseFile));
+
+        Vector<StringView> linkArguments;
+        SC_TRY(linkArguments.append({arguments[0].view(), "-o", relativeExecutable, responseFileArgument.view()}));
+        for (size_t idx = 1; idx < arguments.size(); ++idx)
+        {
+            SC_TRY(linkArguments.push_back(arguments[idx].view()));
+        }
+        Process process;
+        SC_TRY(setupProcess(process));
+        SC_TRY(process.exec(linkArguments.toSpanConst()));
+        SC_TRY_MSG(process.getExitStatus() == 0, "Link returned error");
+        return fs.writeString(keyFile.view(), linkKey.view());
+    }
+
+    [[nodiscard]] Result setupProcess(Process& process)
+    {
+        SC_TRY(process.setWorkingDirectory(writer.variantDirectory.view()));
+        if (environment.sizeInElements() % 2 == 0)
+        {
+            for (size_t idx = 0; idx < environment.sizeInElements(); idx += 2)
+            {
+                SC_TRY(process.setEnvironment(environment[idx], environment[idx + 1]));
+            }
+        }
+        return Result(true);
+    }
+
+    [[nodiscard]] Result computeSourceKey(Unit& unit)
+    {
+        Checksum checksum;
+        SC_TRY(checksum.setType(Checksum::TypeXXHash64));
+        for (const String& argument : unit.arguments)
+        {
+            SC_TRY(addToChecksum(checksum, argument.view()));
+        }
+        SC_TRY(addToChecksum(checksum, unit.source.view()));
+        Buffer content;
+        SC_TRY(fs.read(unit.source.view(), content));
+        SC_TRY(checksum.add({reinterpret_cast<const uint8_t*>(content.data()), content.size()}));
+        return appendChecksum(checksum, unit.sourceKey);
+    }
+
+    /// @brief Computes object key from source key and content of all headers listed (one per line) in the manifest
+    [[nodiscard]] Result computeObjectKey(StringView sourceKey, StringView manifest, String& objectKey, bool& found)
+    {
+        found = false;
+        Checksum checksum;
+        SC_TRY(checksum.setType(Checksum::TypeXXHash64));
+        SC_TRY(addToChecksum(checksum, sourceKey));
+        StringViewTokenizer tokenizer(manifest);
+        while (tokenizer.tokenizeNextLine())
+        {
+            const StringView header = tokenizer.component;
+            if (header.isEmpty())
+                continue;
+            uint64_t* headerHash = headersHashes.get(header);
+            if (headerHash == nullptr)
+            {
+                if (not fs.existsAndIsFile(header))
+                {
+                    return Result(true);
+                }
+                Buffer content;
+                SC_TRY(fs.read(header, content));
+                String headerPath;
+                SC_TRY(headerPath.assign(header));
+                const uint64_t hash = Checksum::xxHash64({reinterpret_cast<const uint8_t*>(content.data()),
+                                                          content.size()});
+                SC_TRY(headersHashes.insertIfNotExists({move(headerPath), hash}));
+                headerHash = headersHashes.get(header);
+            }
+            SC_TRY(addToChecksum(checksum, header));
+            SC_TRY(checksum.add({reinterpret_cast<const uint8_t*>(headerHash), sizeof(uint64_t)}));
+        }
+        found = true;
+        return appendChecksum(checksum, objectKey);
+    }
+
+    /// @brief Extracts all prerequisites but the first (the source file) of a Makefile rule written by `-MD`
+    [[nodiscard]] static Result parseDepfile(StringView depfile, String& headers)
+    {
+        const char*  text = depfile.bytesWithoutTerminator();
+        const size_t size = depfile.sizeInBytes();
+
+        size_t idx = 0;
+        for (; idx < size; ++idx)
+        {
+            if (text[idx] == ':' and (idx + 1 == size or text[idx + 1] == ' ' or text[idx + 1] == '\n'))
+                break; // End of the rule target (a ':' followed by something else could be part of a path)
+        }
+        Vector<char>  path;
+        StringBuilder builder(headers, StringBuilder::Clear);
+        bool          isSource = true;
+        for (idx = idx + 1; idx <= size; ++idx)
+        {
+            const char c = idx < size ? text[idx] : '\n';
+            if (c == '\\' and idx + 1 < size and (text[idx + 1] == ' ' or text[idx + 1] == '#'))
+            {
+                SC_TRY(path.push_back(text[++idx])); // Escaped space or hash
+            }
+            else if (c == '\\' and idx + 1 < size and (text[idx + 1] == '\n' or text[idx + 1] == '\r'))
+            {
+                continue; // Line continuation
+            }
+            else if (c == '$' and idx + 1 < size and text[idx + 1] == '$')
+            {
+                SC_TRY(path.push_back(text[++idx])); // Escaped dollar
+            }
+            else if (c == ' ' or c == '\t' or c == '\n' or c == '\r')
+            {
+                if (not path.isEmpty())
+                {
+                    if (not isSource)
+                    {
+                        SC_TRY(builder.append("{}\n", StringView(path.toSpanConst(), false, StringEncoding::Utf8)));
+                    }
+                    isSource = false;
+                    path.clear();
+                }
+            }
+            else
+            {
+                SC_TRY(path.push_back(c));
+            }
+        }
+        return Result(true);
+    }
+
+    /// @brief Splits a command line in arguments, handling double quotes and escapes produced by WriterNinja
+    [[nodiscard]] static Result appendArguments(Vector<String>& arguments, StringView commandLine)
+    {
+        const char*  text = commandLine.bytesWithoutTerminator();
+        const size_t size = commandLine.sizeInBytes();
+
+        Vector<char> argument;
+        bool         inQuotes    = false;
+        bool         hasArgument = false;
+        for (size_t idx = 0; idx <= size; ++idx)
+        {
+            const char c = idx < size ? text[idx] : ' ';
+            if (c == '\\' and idx + 1 < size and (text[idx + 1] == '"' or text[idx + 1] == '\\'))
+            {
+                SC_TRY(argument.push_back(text[++idx]));
+                hasArgument = true;
+            }
+            else if (c == '"')
+            {
+                inQuotes    = not inQuotes;
+                hasArgument = true;
+            }
+            else if (c == ' ' and not inQuotes)
+            {
+                if (hasArgument)
+                {
+                    SC_TRY(arguments.push_back(StringView(argument.toSpanConst(), false, StringEncoding::Utf8)));
+                    argument.clear();
+                    hasArgument = false;
+                }
+            }
+            else
+            {
+                SC_TRY(argument.push_back(c));
+                hasArgument = true;
+            }
+        }
+        return Result(true);
+    }
+
+    [[nodiscard]] static Result addToChecksum(Checksum& checksum, StringView text)
+    {
+        SC_TRY(checksum.add(text.toBytesSpan()));
+        const uint8_t separator = 0; // Avoids ambiguities between concatenations of different strings
+        return Result(checksum.add({&separator, 1}));
+    }
+
+    [[nodiscard]] static Result appendChecksum(const Checksum& checksum, String& key)
+    {
+        Hashing::Result hash;
+        SC_TRY(checksum.getHash(hash));
+        return Result(StringBuilder(key, StringBuilder::Clear)
+                          .appendHex(hash.toBytesSpan(), StringBuilder::AppendHexCase::LowerCase));
+    }
+};
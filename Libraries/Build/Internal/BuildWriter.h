@@ -4,6 +4,8 @@
 #include "../../Algorithms/AlgorithmBubbleSort.h"
 #include "../../Containers/VectorMap.h"
 #include "../../Containers/VectorSet.h"
+#include "../../FileSystem/FileSystem.h"
+#include "../../Strings/StringBuilder.h"
 #include "../Build.h"
 
 namespace SC
@@ -81,6 +83,8 @@ struct SC::Build::WriterInternal
         Vector<String>      platformFilters;
         const CompileFlags* compileFlags = nullptr;
 
+        bool compiledInUnityFile = false; // Source is compiled as part of a generated unity file
+
         [[nodiscard]] static StringView getExtension(RenderItem::Type type)
         {
             switch (type)
@@ -116,6 +120,24 @@ struct SC::Build::WriterInternal
         Vector<RenderItem> renderItems;
     };
 
+    /// @brief Warnings enabled on GCC and Clang by both Makefile and Ninja generators (C and C++)
+    [[nodiscard]] static StringView getPosixWarningCPPFlags()
+    {
+        // TODO: On GCC we need to enable also the following fixing the warnings
+        // -W error=conversion
+        // -W shadow
+        // -W sign-compare
+        // -W error=sign-conversion
+        // -W missing-field-initializers
+        return "-Werror -Werror=return-type -Wunreachable-code -Wmissing-braces -Wparentheses -Wswitch "
+               "-Wunused-function -Wunused-label -Wunused-parameter -Wunused-variable -Wunused-value -Wempty-body "
+               "-Wuninitialized -Wunknown-pragmas -Wenum-conversion -Werror=float-conversion "
+               "-Werror=implicit-fallthrough";
+    }
+
+    /// @brief Warnings enabled on GCC and Clang by both Makefile and Ninja generators (C++ only)
+    [[nodiscard]] static StringView getPosixWarningCXXFlags() { return "-Wnon-virtual-dtor -Woverloaded-virtual"; }
+
     [[nodiscard]] static bool appendPrefixIfRelativePosix(StringView relativeVariable, StringBuilder& builder,
                                                           StringView text, StringView prefix)
     {
@@ -261,6 +283,71 @@ struct SC::Build::WriterInternal
                 it.compileFlags = nullptr; // This is the shared compile flags
             }
         }
+        if (project.unityBuild.enabled)
+        {
+            SC_TRY(renderUnityFiles(projectDirectory, project, outputFiles));
+        }
+        return Result(true);
+    }
+
+    /// @brief Generates unity files including batches of C++ sources using shared compile flags.
+    /// Batched sources are kept in outputFiles (so that they're still listed by IDE projects) but they're marked with
+    /// RenderItem::compiledInUnityFile, so that writers compile the generated unity files in their place.
+    [[nodiscard]] static Result renderUnityFiles(StringView projectDirectory, const Project& project,
+                                                 Vector<RenderItem>& outputFiles)
+    {
+        SC_TRY_MSG(project.unityBuild.batchSize > 0, "UnityBuild::batchSize must be greater than zero");
+        Vector<size_t> batch;
+        for (size_t idx = 0; idx < outputFiles.size(); ++idx)
+        {
+            const RenderItem& item = outputFiles[idx];
+            if (item.type == RenderItem::CppFile and item.compileFlags == nullptr)
+            {
+                SC_TRY(batch.push_back(idx));
+            }
+        }
+        FileSystem fs;
+        SC_TRY(fs.init(projectDirectory));
+        SC_TRY(fs.makeDirectoryIfNotExists("Unity"));
+
+        Vector<RenderItem> unityFiles;
+        String             content;
+        String             existingContent;
+        for (size_t first = 0; first < batch.size(); first += project.unityBuild.batchSize)
+        {
+            const size_t numFiles = min(batch.size() - first, static_cast<size_t>(project.unityBuild.batchSize));
+            if (numFiles < 2)
+                continue; // A single file doesn't benefit from being wrapped in a unity file
+
+            StringBuilder builder(content, StringBuilder::Clear);
+            SC_TRY(builder.append("// Unity build file generated by SC::Build (do not edit)\n"));
+            for (size_t idx = first; idx < first + numFiles; ++idx)
+            {
+                RenderItem& item = outputFiles[batch[idx]];
+                // Unity files live in projectDirectory/Unity and item.path is relative to projectDirectory
+                SC_TRY(builder.append("#include \"../{}\"\n", item.path.view()));
+                item.compiledInUnityFile = true;
+            }
+            RenderItem unityFile;
+            unityFile.type = RenderItem::CppFile;
+            unityFile.name = StringEncoding::Utf8; // To unify hashes
+            const size_t batchIndex = first / project.unityBuild.batchSize;
+            SC_TRY(StringBuilder(unityFile.name).append("{}_Unity_{}.cpp", project.name, batchIndex));
+            SC_TRY(StringBuilder(unityFile.path).format("Unity/{}", unityFile.name));
+            SC_TRY(unityFile.referencePath.assign(unityFile.path.view()));
+
+            // Rewriting unchanged unity files would update their modification time, triggering a full rebuild
+            if (not fs.read(unityFile.path.view(), existingContent, StringEncoding::Utf8) or
+                existingContent.view() != content.view())
+            {
+                SC_TRY(fs.writeString(unityFile.path.view(), content.view()));
+            }
+            SC_TRY(unityFiles.push_back(move(unityFile)));
+        }
+        for (RenderItem& unityFile : unityFiles)
+        {
+            SC_TRY(outputFiles.push_back(move(unityFile)));
+        }
         return Result(true);
     }
 };
@@ -316,7 +316,7 @@ $({0}_TARGET_DIR)/$({0}_TARGET_NAME): $({0}_OBJECT_FILES) | $({0}_TARGET_DIR)
         for (const RenderItem& item : renderer.renderItems)
         {
             const StringView extension = RenderItem::getExtension(item.type);
-            if (extension.isEmpty())
+            if (extension.isEmpty() or item.compiledInUnityFile)
                 continue;
             StringBuilder(escapedPath, StringBuilder::Clear).appendReplaceAll(item.path.view(), " ", "\\ ");
             StringView itemName = Path::basename(item.name.view(), extension);
@@ -435,7 +435,7 @@ $({0}_INTERMEDIATE_DIR)/{4}.o: $(CURDIR_ESCAPED)/{2} | $({0}_INTERMEDIATE_DIR)
         for (const RenderItem& item : renderer.renderItems)
         {
             const StringView extension = RenderItem::getExtension(item.type);
-            if (extension.isEmpty())
+            if (extension.isEmpty() or item.compiledInUnityFile)
                 continue;
             builder.append("\n$({0}_INTERMEDIATE_DIR)/", makeTarget);
             builder.appendReplaceAll(Path::basename(item.name.view(), extension), " ", "\\ ");
@@ -460,20 +460,8 @@ $({0}_INTERMEDIATE_DIR)/{4}.o: $(CURDIR_ESCAPED)/{2} | $({0}_INTERMEDIATE_DIR)
     void appendWarnings(StringBuilder& builder, StringView makeTarget, const CompileFlags& compile)
     {
         SC_COMPILER_WARNING_PUSH_UNUSED_RESULT;
-        // TODO: On GCC we need to enable also the following fixing the warnings
-        // -W error=conversion
-        // -W shadow
-        // -W sign-compare
-        // -W error=sign-conversion
-        // -W missing-field-initializers
-
-        builder.append("\n{0}_WARNING_CXXFLAGS :=-Wnon-virtual-dtor -Woverloaded-virtual", makeTarget);
-
-        builder.append("\n{0}_WARNING_CPPFLAGS :=-Werror -Werror=return-type -Wunreachable-code "
-                       "-Wmissing-braces -Wparentheses -Wswitch -Wunused-function -Wunused-label "
-                       "-Wunused-parameter -Wunused-variable -Wunused-value -Wempty-body -Wuninitialized "
-                       "-Wunknown-pragmas -Wenum-conversion -Werror=float-conversion -Werror=implicit-fallthrough",
-                       makeTarget);
+        builder.append("\n{0}_WARNING_CXXFLAGS :={1}", makeTarget, WriterInternal::getPosixWarningCXXFlags());
+        builder.append("\n{0}_WARNING_CPPFLAGS :={1}", makeTarget, WriterInternal::getPosixWarningCPPFlags());
         for (const Warning& warning : compile.warnings)
         {
             // TODO: Differentiate between Clang and GCC warnings
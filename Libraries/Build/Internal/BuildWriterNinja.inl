@@ -0,0 +1,548 @@
+// Copyright (c) Stefano Cristiano
+// SPDX-License-Identifier: MIT
+#include "../../FileSystem/FileSystem.h"
+#include "../../FileSystem/Path.h"
+#include "../../Strings/StringBuilder.h"
+#include "../Build.h"
+#include "BuildWriter.h"
+
+struct SC::Build::ProjectWriter::WriterNinja
+{
+    const Definition&        definition;
+    const FilePathsResolver& filePathsResolver;
+    const Directories&       directories;
+    const Parameters&        parameters;
+
+    String variantDirectory; // Absolute path of the directory holding build.ninja for current Variant
+
+    WriterNinja(const Definition& definition, const FilePathsResolver& filePathsResolver,
+                const Directories& directories, const Parameters& parameters)
+        : definition(definition), filePathsResolver(filePathsResolver), directories(directories),
+          parameters(parameters)
+    {}
+    using RenderItem  = WriterInternal::RenderItem;
+    using RenderGroup = WriterInternal::RenderGroup;
+    using Renderer    = WriterInternal::Renderer;
+
+    /// @brief Target and toolchain of a single build.ninja.
+    /// Ninja has no conditionals, so everything that Makefile detects at build time is resolved here instead.
+    struct Variant
+    {
+        StringView targetOS;           // linux / macOS
+        StringView targetArchitecture; // x86_64 / arm64
+        StringView compiler;           // gcc / clang
+        StringView targetFlags;        // -target flags when cross-compiling with clang on macOS
+        StringView buildSystem;        // Value of $(BUILD_SYSTEM) (ninja / native)
+    };
+
+    /// @brief Flags for a given combination of project, configuration and (optional) per-file flags
+    struct Flags
+    {
+        String cflags;
+        String cxxflags;
+    };
+
+    [[nodiscard]] static bool isClang(const Variant& variant) { return variant.compiler == "clang"; }
+
+    /// @brief Gets clang flags to target macOS on the given architecture (arm64 / x86_64)
+    [[nodiscard]] static StringView getAppleTargetFlags(StringView architecture)
+    {
+        return architecture == "arm64" ? StringView("-target arm64-apple-macos11") : "-target x86_64-apple-macos11";
+    }
+
+    /// @brief Gets variant subdirectory name (for example `linux-x86_64-gcc`) shared with Build::Action
+    [[nodiscard]] static bool getVariantName(const Variant& variant, String& name)
+    {
+        return StringBuilder(name, StringBuilder::Clear)
+            .format("{}-{}-{}", variant.targetOS, variant.targetArchitecture, variant.compiler);
+    }
+
+    /// @brief Writes build.ninja (and compile_commands.json) for all variants of current platform / architecture
+    [[nodiscard]] Result writeNinja(FileSystem& fs, const Workspace& workspace, Renderer& renderer, String& buffer)
+    {
+        const bool       hostIsArm64      = SC::HostInstructionSet == SC::InstructionSet::ARM64;
+        const StringView hostArchitecture = hostIsArm64 ? StringView("arm64") : "x86_64";
+
+        StringView architectures[2];
+        size_t     numArchitectures = 0;
+        switch (parameters.architecture)
+        {
+        case Architecture::Intel64: architectures[numArchitectures++] = "x86_64"; break;
+        case Architecture::Arm64: architectures[numArchitectures++] = "arm64"; break;
+        case Architecture::Any:
+            if (parameters.platform == Platform::Apple)
+            {
+                architectures[numArchitectures++] = "arm64";
+                architectures[numArchitectures++] = "x86_64";
+            }
+            else
+            {
+                architectures[numArchitectures++] = hostArchitecture;
+            }
+            break;
+        case Architecture::Intel32: // Unsupported
+        case Architecture::Wasm:    // Unsupported
+            return Result::Error("Unsupported architecture for ninja");
+        }
+
+        for (size_t idx = 0; idx < numArchitectures; ++idx)
+        {
+            Variant variant;
+            variant.targetArchitecture = architectures[idx];
+            variant.buildSystem        = "ninja";
+            if (parameters.platform == Platform::Apple)
+            {
+                variant.targetOS    = "macOS";
+                variant.compiler    = "clang";
+                variant.targetFlags = getAppleTargetFlags(variant.targetArchitecture);
+                SC_TRY(writeVariant(fs, workspace, renderer, buffer, variant));
+            }
+            else
+            {
+                if (variant.targetArchitecture != hostArchitecture)
+                {
+                    return Result::Error("Cross-compiling with ninja on linux is unsupported");
+                }
+                variant.targetOS = "linux";
+                variant.compiler = "gcc";
+                SC_TRY(writeVariant(fs, workspace, renderer, buffer, variant));
+                variant.compiler = "clang";
+                SC_TRY(writeVariant(fs, workspace, renderer, buffer, variant));
+            }
+        }
+        return Result(true);
+    }
+
+    [[nodiscard]] Result writeVariant(FileSystem& fs, const Workspace& workspace, Renderer& renderer, String& buffer,
+                                      const Variant& variant)
+    {
+        String variantName;
+        SC_TRY(getVariantName(variant, variantName));
+        Directories variantDirectories = directories;
+        String&     variantPath        = variantDirectories.projectsDirectory;
+        SC_TRY(Path::join(variantPath, {directories.projectsDirectory.view(), variantName.view()}));
+        SC_TRY(fs.makeDirectoryRecursive(variantDirectories.projectsDirectory.view()));
+        SC_TRY(variantDirectory.assign(variantDirectories.projectsDirectory.view()));
+
+        StringBuilder builder(buffer, StringBuilder::Clear);
+        SC_TRY(writeRules(builder, variant));
+
+        String projectDirFormat;
+        SC_TRY(StringBuilder(projectDirFormat).format("{}/{{}}", variantDirectories.projectsDirectory));
+        for (const Project& project : workspace.projects)
+        {
+            RelativeDirectories relativeDirectories;
+            SC_TRY(relativeDirectories.computeRelativeDirectories(variantDirectories, Path::AsPosix, project,
+                                                                  projectDirFormat.view()));
+            renderer.renderItems.clear();
+            SC_TRY(WriterInternal::renderProject(variantDirectories.projectsDirectory.view(), project,
+                                                 filePathsResolver, renderer.renderItems));
+            SC_TRY(writeProject(fs, builder, project, renderer, relativeDirectories, variantDirectories, variant));
+        }
+        String ninjaFile;
+        SC_TRY(Path::join(ninjaFile, {variantDirectories.projectsDirectory.view(), "build.ninja"}));
+        SC_TRY(fs.removeFileIfExists(ninjaFile.view()));
+        SC_TRY(fs.writeString(ninjaFile.view(), buffer.view()));
+        return Result(true);
+    }
+
+    [[nodiscard]] static Result writeRules(StringBuilder& builder, const Variant& variant)
+    {
+        SC_TRY(builder.append("# Generated by SC::Build, do not edit\n"
+                              "ninja_required_version = 1.3\n\n"));
+        if (isClang(variant))
+        {
+            SC_TRY(builder.append("cc = clang\ncxx = clang++\n"));
+        }
+        else
+        {
+            SC_TRY(builder.append("cc = gcc\ncxx = g++\n"));
+        }
+        // Header dependencies are collected from compiler generated depfiles into .ninja_deps (deps = gcc), so that
+        // a no-op build doesn't need to parse any .d file. Linking uses a response file to avoid command line limits.
+        return Result(builder.append(R"delimiter(
+rule cxx
+  command = $cxx $cxxflags -MMD -MF $out.d -pthread -c $in -o $out
+  description = Compiling $in
+  depfile = $out.d
+  deps = gcc
+
+rule cc
+  command = $cc $cflags -MMD -MF $out.d -pthread -c $in -o $out
+  description = Compiling $in
+  depfile = $out.d
+  deps = gcc
+
+rule link
+  command = $cxx -o $out @$out.rsp $ldflags
+  description = Linking $target
+  rspfile = $out.rsp
+  rspfile_content = $in
+)delimiter"));
+    }
+
+    [[nodiscard]] Result writeProject(FileSystem& fs, StringBuilder& builder, const Project& project,
+                                      const Renderer& renderer, const RelativeDirectories& relativeDirectories,
+                                      const Directories& variantDirectories, const Variant& variant)
+    {
+        const StringView targetName = project.targetName.view();
+
+        bool isDefaultConfiguration = true;
+        for (const Configuration& configuration : project.configurations)
+        {
+            if (configuration.architecture == Architecture::Intel64 and variant.targetArchitecture != "x86_64")
+                continue;
+            if (configuration.architecture == Architecture::Arm64 and variant.targetArchitecture != "arm64")
+                continue;
+
+            CompileFlags        compileFlags;
+            const CompileFlags* compileSources[] = {&configuration.compile, &project.files.compile};
+            SC_TRY(CompileFlags::merge(compileSources, compileFlags));
+            const StringView configName = configuration.name.view();
+            if (compileFlags.enableCoverage and not isClang(variant))
+            {
+                SC_TRY(builder.append("\n# {} {} skipped (coverage is supported only when using clang)\n", targetName,
+                                      configName));
+                continue;
+            }
+
+            SC_TRY(builder.append("\n# {} {}\n", targetName, configName));
+
+            String intermediateDirectory, outputDirectory;
+            SC_TRY(appendDirectory(intermediateDirectory, configuration.intermediatesPath.view(),
+                                   relativeDirectories.relativeProjectsToIntermediates.view(), project, configName,
+                                   relativeDirectories, variant));
+            SC_TRY(appendDirectory(outputDirectory, configuration.outputPath.view(),
+                                   relativeDirectories.relativeProjectsToOutputs.view(), project, configName,
+                                   relativeDirectories, variant));
+
+            // Flags for all files and then for each group of files with specific flags
+            Flags projectFlags;
+            SC_TRY(appendCompileFlags(projectFlags, project, configName, compileFlags, relativeDirectories, variant));
+            SC_TRY(builder.append("{0}_{1}_cflags = ", targetName, configName));
+            SC_TRY(appendEscaped(builder, projectFlags.cflags.view(), false));
+            SC_TRY(builder.append("\n{0}_{1}_cxxflags = ", targetName, configName));
+            SC_TRY(appendEscaped(builder, projectFlags.cxxflags.view(), false));
+            SC_TRY(builder.append("\n"));
+
+            Vector<Flags> groupsFlags;
+            for (size_t idx = 0; idx < project.filesWithSpecificFlags.size(); ++idx)
+            {
+                CompileFlags        groupCompileFlags;
+                const CompileFlags* groupSources[] = {&project.filesWithSpecificFlags[idx].compile,
+                                                      &configuration.compile, &project.files.compile};
+                SC_TRY(CompileFlags::merge(groupSources, groupCompileFlags));
+                Flags groupFlags;
+                SC_TRY(appendCompileFlags(groupFlags, project, configName, groupCompileFlags, relativeDirectories,
+                                          variant));
+                SC_TRY(builder.append("{0}_{1}_GROUP_{2}_cflags = ", targetName, configName, idx));
+                SC_TRY(appendEscaped(builder, groupFlags.cflags.view(), false));
+                SC_TRY(builder.append("\n{0}_{1}_GROUP_{2}_cxxflags = ", targetName, configName, idx));
+                SC_TRY(appendEscaped(builder, groupFlags.cxxflags.view(), false));
+                SC_TRY(builder.append("\n"));
+                SC_TRY(groupsFlags.push_back(move(groupFlags)));
+            }
+
+            String compileCommands;
+            SC_TRY(compileCommands.assign("["));
+
+            String objectFiles;
+            String objectFile;
+            for (const RenderItem& item : renderer.renderItems)
+            {
+                const StringView extension = RenderItem::getExtension(item.type);
+                if (extension.isEmpty() or item.compiledInUnityFile)
+                    continue;
+                const bool isCpp = item.type == RenderItem::CppFile or item.type == RenderItem::ObjCppFile;
+                SC_TRY(StringBuilder(objectFile, StringBuilder::Clear)
+                           .format("{}/{}.o", intermediateDirectory, Path::basename(item.name.view(), extension)));
+
+                SmallString<32> group;
+                const Flags*    flags = &projectFlags;
+                if (item.compileFlags != nullptr)
+                {
+                    size_t index;
+                    if (project.filesWithSpecificFlags.find([&](const SourceFiles& it)
+                                                            { return &it.compile == item.compileFlags; }, &index))
+                    {
+                        SC_TRY(StringBuilder(group).format("_GROUP_{}", index));
+                        flags = &groupsFlags[index];
+                    }
+                }
+                SC_TRY(builder.append("build "));
+                SC_TRY(appendEscaped(builder, objectFile.view(), true));
+                SC_TRY(builder.append(isCpp ? StringView(": cxx ") : ": cc "));
+                SC_TRY(appendEscaped(builder, item.path.view(), true));
+                const StringView flagsName = isCpp ? StringView("cxxflags") : "cflags";
+                SC_TRY(builder.append("\n  {0} = ${1}_{2}{3}_{0}\n", flagsName, targetName, configName, group.view()));
+
+                StringBuilder objectFilesBuilder(objectFiles, StringBuilder::DoNotClear);
+                SC_TRY(objectFilesBuilder.append(" $\n    "));
+                SC_TRY(appendEscaped(objectFilesBuilder, objectFile.view(), true));
+
+                SC_TRY(appendCompileCommand(compileCommands, item.path, objectFile,
+                                            isCpp ? flags->cxxflags.view() : flags->cflags.view(), isCpp, variant));
+            }
+
+            String ldflags;
+            SC_TRY(appendLinkFlags(ldflags, project.link, compileFlags, variant));
+
+            String executable;
+            SC_TRY(StringBuilder(executable).format("{}/{}", outputDirectory, targetName));
+            SC_TRY(builder.append("build "));
+            SC_TRY(appendEscaped(builder, executable.view(), true));
+            SC_TRY(builder.append(": link{}\n  ldflags = ", objectFiles));
+            SC_TRY(appendEscaped(builder, ldflags.view(), false));
+            SC_TRY(builder.append("\n  target = {}\n", targetName));
+            SC_TRY(builder.append("build {}_{}: phony ", targetName, configName));
+            SC_TRY(appendEscaped(builder, executable.view(), true));
+            SC_TRY(builder.append("\n"));
+            if (isDefaultConfiguration)
+            {
+                SC_TRY(builder.append("default {}_{}\n", targetName, configName));
+                isDefaultConfiguration = false;
+            }
+
+            // Emit compile_commands.json in the intermediates directory, at the same location used by Makefile
+            SC_TRY(StringBuilder(compileCommands, StringBuilder::DoNotClear).append("\n]\n"));
+            String compileCommandsDirectory, compileCommandsPath;
+            {
+                Vector<StringView> components;
+                SC_TRY(Path::join(compileCommandsPath,
+                                  {variantDirectories.projectsDirectory.view(), intermediateDirectory.view()}));
+                SC_TRY(Path::normalize(compileCommandsPath.view(), components, &compileCommandsDirectory,
+                                       Path::AsNative));
+            }
+            SC_TRY(fs.makeDirectoryRecursive(compileCommandsDirectory.view()));
+            SC_TRY(Path::join(compileCommandsPath, {compileCommandsDirectory.view(), "compile_commands.json"}));
+            SC_TRY(fs.removeFileIfExists(compileCommandsPath.view()));
+            SC_TRY(fs.writeString(compileCommandsPath.view(), compileCommands.view()));
+        }
+        return Result(true);
+    }
+
+    [[nodiscard]] Result appendCompileCommand(String& json, const String& sourceFile, const String& objectFile,
+                                              StringView flags, bool isCpp, const Variant& variant)
+    {
+        const bool    isFirst = json.view() == "[";
+        StringBuilder builder(json, StringBuilder::DoNotClear);
+        SC_TRY(builder.append(isFirst ? StringView("\n  {\n    \"directory\": \"") : ",\n  {\n    \"directory\": \""));
+        SC_TRY(appendJsonEscaped(builder, variantDirectory.view()));
+        SC_TRY(builder.append("\",\n    \"file\": \""));
+        SC_TRY(appendJsonEscaped(builder, sourceFile.view()));
+        SC_TRY(builder.append("\",\n    \"output\": \""));
+        SC_TRY(appendJsonEscaped(builder, objectFile.view()));
+        SC_TRY(builder.append("\",\n    \"command\": \""));
+        if (isClang(variant))
+        {
+            SC_TRY(builder.append(isCpp ? StringView("clang++ ") : "clang "));
+        }
+        else
+        {
+            SC_TRY(builder.append(isCpp ? StringView("g++ ") : "gcc "));
+        }
+        SC_TRY(appendJsonEscaped(builder, flags));
+        SC_TRY(builder.append(" -pthread -c \\\""));
+        SC_TRY(appendJsonEscaped(builder, sourceFile.view()));
+        SC_TRY(builder.append("\\\" -o \\\""));
+        SC_TRY(appendJsonEscaped(builder, objectFile.view()));
+        return Result(builder.append("\\\"\"\n  }"));
+    }
+
+    [[nodiscard]] static bool appendJsonEscaped(StringBuilder& builder, StringView text)
+    {
+        const StringBuilder::ReplacePair replacements[] = {
+            {"\\", "\\\\"}, //
+            {"\"", "\\\""}, //
+        };
+        return builder.appendReplaceMultiple(text, {replacements, sizeof(replacements) / sizeof(replacements[0])});
+    }
+
+    /// @brief Escapes text for a ninja file. Paths additionally need spaces and colons escaped.
+    [[nodiscard]] static bool appendEscaped(StringBuilder& builder, StringView text, bool isPath)
+    {
+        const StringBuilder::ReplacePair replacements[] = {
+            {"$", "$$"}, //
+            {" ", "$ "}, //
+            {":", "$:"}, //
+        };
+        return builder.appendReplaceMultiple(text, {replacements, isPath ? size_t(3) : size_t(1)});
+    }
+
+    [[nodiscard]] Result appendDirectory(String& directory, StringView path, StringView relativePrefix,
+                                         const Project& project, StringView configName,
+                                         const RelativeDirectories& relativeDirectories, const Variant& variant)
+    {
+        StringBuilder builder(directory, StringBuilder::Clear);
+        if (not Path::isAbsolute(path, Path::AsNative))
+        {
+            SC_TRY(builder.append(relativePrefix));
+            SC_TRY(builder.append(Path::Posix::SeparatorStringView()));
+        }
+        return Result(appendVariable(builder, path, project, configName, relativeDirectories, variant));
+    }
+
+    [[nodiscard]] Result appendCompileFlags(Flags& flags, const Project& project, StringView configName,
+                                            const CompileFlags& compileFlags,
+                                            const RelativeDirectories& relativeDirectories, const Variant& variant)
+    {
+        const bool       clang           = isClang(variant);
+        const bool       needsNoSanitize = clang and compileFlags.enableASAN;
+        const StringView noSanitize      = "-fno-sanitize=enum,return,float-divide-by-zero,function,vptr";
+
+        // Flags for both .c and .cpp files (in the same order used by Makefile)
+        String        cppflags;
+        StringBuilder builder(cppflags);
+        SC_TRY(builder.append(variant.targetFlags));
+        if (clang and compileFlags.enableCoverage)
+        {
+            SC_TRY(builder.append(" -fprofile-instr-generate -fcoverage-mapping"));
+        }
+        if (needsNoSanitize)
+        {
+            SC_TRY(builder.append(" {}", noSanitize));
+        }
+        SC_TRY(builder.append(" -fvisibility=hidden"));
+        SC_TRY(builder.append(" {}", WriterInternal::getPosixWarningCPPFlags()));
+        for (const Warning& warning : compileFlags.warnings)
+        {
+            // Compiler is known when generating, so warnings specific to the other compiler can be dropped
+            const bool otherCompiler = warning.type == (clang ? Warning::GCCWarning : Warning::ClangWarning);
+            if (warning.state == Warning::Disabled and warning.type != Warning::MSVCWarning and not otherCompiler)
+            {
+                SC_TRY(builder.append(" -Wno-{0}", warning.name));
+            }
+        }
+        switch (compileFlags.optimizationLevel)
+        {
+        case Optimization::Debug: SC_TRY(builder.append(" -D_DEBUG=1 -g -ggdb -O0 -fstrict-aliasing")); break;
+        case Optimization::Release: SC_TRY(builder.append(" -DNDEBUG=1 -O3 -fstrict-aliasing")); break;
+        }
+        if (compileFlags.enableASAN)
+        {
+            SC_TRY(builder.append(" -fsanitize=address,undefined"));
+        }
+        for (const String& it : compileFlags.defines)
+        {
+            SC_TRY(builder.append(" \"-D"));
+            SC_TRY(appendVariable(builder, it.view(), project, configName, relativeDirectories, variant));
+            SC_TRY(builder.append("\""));
+        }
+        for (const String& it : compileFlags.includePaths)
+        {
+            if (Path::isAbsolute(it.view(), Path::AsNative))
+            {
+                SC_TRY(builder.append(" \"-I{}\"", it.view()));
+            }
+            else
+            {
+                SC_TRY(builder.append(" \"-I{}/{}\"", relativeDirectories.relativeProjectsToProjectRoot, it.view()));
+            }
+        }
+        SC_TRY(flags.cflags.assign(cppflags.view().trimWhiteSpaces()));
+
+        // Flags for .cpp files only
+        StringBuilder cxxBuilder(flags.cxxflags, StringBuilder::Clear);
+        SC_TRY(cxxBuilder.append(flags.cflags.view()));
+        // TODO: De-hardcode -std=c++14
+        SC_TRY(cxxBuilder.append(" -std=c++14"));
+        if (not compileFlags.enableRTTI)
+        {
+            SC_TRY(cxxBuilder.append(" -fno-rtti"));
+        }
+        if (not compileFlags.enableExceptions)
+        {
+            SC_TRY(cxxBuilder.append(" -fno-exceptions"));
+        }
+        if (clang)
+        {
+            if (not compileFlags.enableStdCpp)
+            {
+                SC_TRY(cxxBuilder.append(" -nostdinc++"));
+            }
+            if (needsNoSanitize)
+            {
+                // It's important that these flags come AFTER -fsanitize=address,undefined (see Makefile writer)
+                SC_TRY(cxxBuilder.append(" {}", noSanitize));
+            }
+        }
+        else
+        {
+            SC_TRY(cxxBuilder.append(" -DSC_COMPILER_ENABLE_STD_CPP=1")); // Only GCC 13+ supports nostdlib++
+        }
+        SC_TRY(cxxBuilder.append(" -fvisibility-inlines-hidden {}", WriterInternal::getPosixWarningCXXFlags()));
+        return Result(true);
+    }
+
+    [[nodiscard]] static Result appendLinkFlags(String& ldflags, const LinkFlags& link,
+                                                const CompileFlags& compileFlags, const Variant& variant)
+    {
+        String        flags;
+        StringBuilder builder(flags);
+        SC_TRY(builder.append(variant.targetFlags));
+        if (compileFlags.enableASAN)
+        {
+            SC_TRY(builder.append(" -fsanitize=address,undefined"));
+        }
+        if (isClang(variant))
+        {
+            if (compileFlags.enableCoverage)
+            {
+                SC_TRY(builder.append(" -fprofile-instr-generate -fcoverage-mapping"));
+            }
+            if (compileFlags.enableASAN)
+            {
+                SC_TRY(builder.append(" -fno-sanitize=enum,return,float-divide-by-zero,function,vptr"));
+            }
+            // We still need to figure out how to make nostdlib++ work on Clang / Linux
+            if (not compileFlags.enableStdCpp and variant.targetOS != "linux")
+            {
+                SC_TRY(builder.append(" -nostdlib++"));
+            }
+        }
+        for (const String& it : link.libraries)
+        {
+            SC_TRY(builder.append(" -l{}", it.view()));
+        }
+        if (variant.targetOS == "linux")
+        {
+            // -rdynamic is needed to resolve Plugin symbols in the executable
+            SC_TRY(builder.append(" -rdynamic"));
+        }
+        else
+        {
+            for (const String& it : link.frameworks)
+            {
+                SC_TRY(builder.append(" -framework {}", it.view()));
+            }
+            for (const String& it : link.frameworksMacOS)
+            {
+                SC_TRY(builder.append(" -framework {}", it.view()));
+            }
+        }
+        return Result(ldflags.assign(flags.view().trimWhiteSpaces()));
+    }
+
+    [[nodiscard]] bool appendVariable(StringBuilder& builder, StringView text, const Project& project,
+                                      StringView configName, const RelativeDirectories& relativeDirectories,
+                                      const Variant& variant) const
+    {
+        const StringView projectRoot      = relativeDirectories.projectRootRelativeToProjects.view();
+        const StringView projectDirectory = variantDirectory.view();
+
+        const StringBuilder::ReplacePair replacements[] = {
+            {"$(PROJECT_DIR)", projectDirectory},                    //
+            {"$(PROJECT_ROOT)", projectRoot},                        //
+            {"$(CONFIGURATION)", configName},                        //
+            {"$(PROJECT_NAME)", project.targetName.view()},          //
+            {"$(TARGET_OS)", variant.targetOS},                      //
+            {"$(TARGET_OS_VERSION)", ""},                            //
+            {"$(TARGET_ARCHITECTURES)", variant.targetArchitecture}, //
+            {"$(BUILD_SYSTEM)", variant.buildSystem},                //
+            {"$(COMPILER)", variant.compiler},                       //
+            {"$(COMPILER_VERSION)", ""},                             //
+            {"\"", "\\\""},                                          // Escape double quotes
+        };
+        return builder.appendReplaceMultiple(text, {replacements, sizeof(replacements) / sizeof(replacements[0])});
+    }
+};
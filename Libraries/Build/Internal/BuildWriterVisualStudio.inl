@@ -366,7 +366,14 @@ struct SC::Build::ProjectWriter::WriterVisualStudio
         {
             if (it.type == WriterInternal::RenderItem::CppFile or it.type == WriterInternal::RenderItem::CFile)
             {
-                if (it.compileFlags == nullptr)
+                if (it.compiledInUnityFile)
+                {
+                    // Still listed in the project but compiled by the unity file including it
+                    builder.append("    <ClCompile Include=\"{}\">\n", it.path);
+                    builder.append("      <ExcludedFromBuild>true</ExcludedFromBuild>\n");
+                    builder.append("    </ClCompile>\n");
+                }
+                else if (it.compileFlags == nullptr)
                 {
                     builder.append("    <ClCompile Include=\"{}\" />\n", it.path);
                 }
@@ -215,6 +215,8 @@ struct SC::Build::ProjectWriter::WriterXCode
             case RenderItem::ObjCppFile: type = "Sources"; break;
             default: continue;
             }
+            if (file.compiledInUnityFile)
+                continue; // Only its file reference is written, as it's compiled by a unity file
 
             String platformFilters;
             if (not file.platformFilters.isEmpty())
@@ -562,6 +564,8 @@ struct SC::Build::ProjectWriter::WriterXCode
             files = ()delimiter");
         for (const RenderItem& file : xcodeFiles)
         {
+            if (file.compiledInUnityFile)
+                continue;
             if (file.type == RenderItem::CppFile or file.type == RenderItem::CFile or
                 file.type == RenderItem::ObjCppFile or file.type == RenderItem::ObjCFile)
                 builder.append("\n                       {} /* {} in Sources */,", file.buildHash, file.name);
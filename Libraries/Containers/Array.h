@@ -104,10 +104,10 @@ struct Array : public Segment<detail::ArrayVTable<T, N>>
         T* itEnd = Parent::end();
         T* it    = Algorithms::removeIf(itBeg, itEnd, forward<Lambda>(criteria));
 
-        const size_t numBytes = static_cast<size_t>(itEnd - it) * sizeof(T);
-        const size_t offBytes = static_cast<size_t>(it - itBeg) * sizeof(T);
-        detail::VectorVTable<T>::destruct(Parent::getData(), offBytes, numBytes);
-        Parent::header.sizeBytes -= static_cast<decltype(Parent::header.sizeBytes)>(numBytes);
+        const size_t numElements = static_cast<size_t>(itEnd - it);
+        const size_t offset      = static_cast<size_t>(it - itBeg);
+        detail::VectorVTable<T>::destruct({Parent::data() + offset, numElements});
+        Parent::header.sizeBytes -= static_cast<decltype(Parent::header.sizeBytes)>(numElements * sizeof(T));
         return it != itEnd;
     }
 
@@ -38,6 +38,23 @@ void SC::IntrusiveDoubleLinkedList<T>::queueBack(T& item)
     queueBackUnchecked(item, item);
 }
 
+template <typename T>
+void SC::IntrusiveDoubleLinkedList<T>::queueFront(T& item)
+{
+    SC_ASSERT_DEBUG(item.next == nullptr and item.prev == nullptr);
+    if (front)
+    {
+        front->prev = &item;
+        item.next   = front;
+    }
+    else
+    {
+        SC_ASSERT_DEBUG(back == nullptr);
+        back = &item;
+    }
+    front = &item;
+}
+
 template <typename T>
 void SC::IntrusiveDoubleLinkedList<T>::queueBackUnchecked(T& item, T& newBack)
 {
@@ -34,6 +34,9 @@ struct IntrusiveDoubleLinkedList
     /// @brief Appends item to the back of this linked list
     void queueBack(T& item);
 
+    /// @brief Inserts item at the front of this linked list
+    void queueFront(T& item);
+
     /// @brief Removes item from this linked list
     void remove(T& item);
 
@@ -0,0 +1,218 @@
+// Copyright (c) Stefano Cristiano
+// SPDX-License-Identifier: MIT
+#pragma once
+#include "../Foundation/Assert.h"
+#include "../Foundation/Span.h"
+#include "../Foundation/VirtualMemory.h"
+
+namespace SC
+{
+template <typename T>
+struct VirtualVector;
+} // namespace SC
+
+//! @addtogroup group_containers
+//! @{
+
+/// @brief A contiguous sequence of elements, backed by a VirtualMemory reservation that never relocates
+/// @tparam T Type of single vector element
+///
+/// SC::VirtualVector reserves address space for up to SC::VirtualVector::maxCapacity elements in
+/// SC::VirtualVector::create, committing pages only when they're needed by a growth. @n
+/// Differently from SC::Vector, growing never copies or moves existing elements, so pointers to them stay valid for
+/// the entire lifetime of the container and appending has no latency spikes caused by re-allocations. @n
+/// SC::VirtualVector::shrink_to_fit gives back to the OS all pages past current size. @n
+/// This makes it practical to build very large (multi-GB) append-only logs or indexes on 64-bit systems, where
+/// reserving address space is essentially free.
+/// @note Growing past SC::VirtualVector::maxCapacity fails, as address space is not extended after creation.
+///
+/// \snippet Tests/Libraries/Containers/VirtualVectorTest.cpp VirtualVectorSnippet
+template <typename T>
+struct SC::VirtualVector
+{
+    VirtualVector() = default;
+    ~VirtualVector() { SC_ASSERT_RELEASE(release()); }
+
+    VirtualVector(const VirtualVector&)            = delete;
+    VirtualVector& operator=(const VirtualVector&) = delete;
+
+    VirtualVector(VirtualVector&& other) { *this = move(other); }
+    VirtualVector& operator=(VirtualVector&& other)
+    {
+        SC_ASSERT_RELEASE(release());
+        virtualMemory       = other.virtualMemory;
+        numElements         = other.numElements;
+        other.virtualMemory = VirtualMemory();
+        other.numElements   = 0;
+        return *this;
+    }
+
+    /// @brief Reserves address space for up to maxNumElements, without committing any memory
+    /// @param maxNumElements Maximum number of elements that this vector will ever hold
+    /// @return `true` if address space has been reserved (`false` if already created)
+    [[nodiscard]] bool create(size_t maxNumElements)
+    {
+        if (maxNumElements > static_cast<size_t>(~static_cast<size_t>(0)) / sizeof(T))
+        {
+            return false;
+        }
+        return virtualMemory.reserve(maxNumElements * sizeof(T));
+    }
+
+    /// @brief Destroys all elements and gives back the entire reserved address space to the OS
+    [[nodiscard]] bool release()
+    {
+        clear();
+        return virtualMemory.release();
+    }
+
+    /// @brief Appends a single element to the end of the vector
+    [[nodiscard]] bool push_back(const T& value)
+    {
+        if (not reserve(numElements + 1))
+        {
+            return false;
+        }
+        placementNew(data()[numElements++], value);
+        return true;
+    }
+
+    /// @brief Moves a single element to the end of the vector
+    [[nodiscard]] bool push_back(T&& value)
+    {
+        if (not reserve(numElements + 1))
+        {
+            return false;
+        }
+        placementNew(data()[numElements++], move(value));
+        return true;
+    }
+
+    /// @brief Appends a Span of items (by copy) to the end of the vector
+    [[nodiscard]] bool append(Span<const T> span)
+    {
+        if (not reserve(numElements + span.sizeInElements()))
+        {
+            return false;
+        }
+        for (const T& item : span)
+        {
+            placementNew(data()[numElements++], item);
+        }
+        return true;
+    }
+
+    /// @brief Removes the last element of the vector
+    /// @param removedValue Last item will be moved in the value if != `nullptr`
+    /// @return `true` if element was successfully removed (`false` if vector is empty)
+    [[nodiscard]] bool pop_back(T* removedValue = nullptr)
+    {
+        if (numElements == 0)
+        {
+            return false;
+        }
+        numElements--;
+        if (removedValue)
+        {
+            *removedValue = move(data()[numElements]);
+        }
+        data()[numElements].~T();
+        return true;
+    }
+
+    /// @brief Changes size, destroying exceeding elements or copy constructing new ones from value
+    [[nodiscard]] bool resize(size_t newSize, const T& value = T())
+    {
+        while (numElements > newSize)
+        {
+            data()[--numElements].~T();
+        }
+        if (not reserve(newSize))
+        {
+            return false;
+        }
+        while (numElements < newSize)
+        {
+            placementNew(data()[numElements++], value);
+        }
+        return true;
+    }
+
+    /// @brief Commits memory for at least newCapacity elements, without changing size.
+    /// @note Commits are grown geometrically, to amortize the cost of the underlying system calls.
+    [[nodiscard]] bool reserve(size_t newCapacity)
+    {
+        if (newCapacity <= capacity())
+        {
+            return true;
+        }
+        if (newCapacity > maxCapacity())
+        {
+            return false;
+        }
+        const size_t neededBytes = newCapacity * sizeof(T);
+        size_t       commitBytes = virtualMemory.committedBytes * 2;
+        if (commitBytes < neededBytes)
+        {
+            commitBytes = neededBytes;
+        }
+        if (commitBytes > virtualMemory.reservedBytes)
+        {
+            commitBytes = virtualMemory.reservedBytes;
+        }
+        return virtualMemory.commit(commitBytes);
+    }
+
+    /// @brief Gives back to the OS all committed pages that are not needed to hold current size
+    [[nodiscard]] bool shrink_to_fit() { return virtualMemory.shrink(numElements * sizeof(T)); }
+
+    /// @brief Destroys all elements, without giving back memory (use VirtualVector::shrink_to_fit for that)
+    void clear()
+    {
+        while (numElements > 0)
+        {
+            data()[--numElements].~T();
+        }
+    }
+
+    // clang-format off
+    [[nodiscard]] T*       data()        { return static_cast<T*>(virtualMemory.memory); }
+    [[nodiscard]] const T* data()  const { return static_cast<const T*>(virtualMemory.memory); }
+    [[nodiscard]] T*       begin()       { return data(); }
+    [[nodiscard]] const T* begin() const { return data(); }
+    [[nodiscard]] T*       end()         { return data() + numElements; }
+    [[nodiscard]] const T* end()   const { return data() + numElements; }
+
+    [[nodiscard]] T&       back()        { SC_ASSERT_RELEASE(not isEmpty()); return data()[numElements - 1]; }
+    [[nodiscard]] T&       front()       { SC_ASSERT_RELEASE(not isEmpty()); return data()[0]; }
+    [[nodiscard]] const T& back()  const { SC_ASSERT_RELEASE(not isEmpty()); return data()[numElements - 1]; }
+    [[nodiscard]] const T& front() const { SC_ASSERT_RELEASE(not isEmpty()); return data()[0]; }
+
+    [[nodiscard]] T&       operator[](size_t idx)       { SC_ASSERT_DEBUG(idx < numElements); return data()[idx]; }
+    [[nodiscard]] const T& operator[](size_t idx) const { SC_ASSERT_DEBUG(idx < numElements); return data()[idx]; }
+    // clang-format on
+
+    /// @brief Obtains a Span of internal contents
+    [[nodiscard]] Span<T> toSpan() { return {data(), numElements}; }
+
+    /// @brief Obtains a Span of internal contents
+    [[nodiscard]] Span<const T> toSpanConst() const { return {data(), numElements}; }
+
+    /// @brief Check if is empty (`size()` == 0)
+    [[nodiscard]] bool isEmpty() const { return numElements == 0; }
+
+    /// @brief Returns current size
+    [[nodiscard]] size_t size() const { return numElements; }
+
+    /// @brief Returns number of elements that can be held without committing more memory
+    [[nodiscard]] size_t capacity() const { return virtualMemory.committedBytes / sizeof(T); }
+
+    /// @brief Returns the maximum number of elements that can ever be held (set by VirtualVector::create)
+    [[nodiscard]] size_t maxCapacity() const { return virtualMemory.reservedBytes / sizeof(T); }
+
+  private:
+    VirtualMemory virtualMemory;
+    size_t        numElements = 0;
+};
+
+//! @}
@@ -143,6 +143,10 @@ struct SC::FileDescriptor : public SC::UniqueHandle<SC::detail::FileDescriptorDe
     /// @return Valid result if seek succeeds
     [[nodiscard]] Result sizeInBytes(size_t& sizeInBytes) const;
 
+    /// @brief Flushes all written data (and metadata) to the underlying storage device (`fsync` / `FlushFileBuffers`)
+    /// @return Valid result if data has been flushed to the device successfully
+    [[nodiscard]] Result sync();
+
   private:
     friend struct File;
     struct Internal;
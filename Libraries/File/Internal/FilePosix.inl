@@ -179,6 +179,12 @@ SC::Result SC::FileDescriptor::currentPosition(size_t& position) const
     return Result::Error("lseek failed");
 }
 
+SC::Result SC::FileDescriptor::sync()
+{
+    SC_TRY_MSG(::fsync(handle) == 0, "fsync failed");
+    return Result(true);
+}
+
 SC::Result SC::FileDescriptor::sizeInBytes(size_t& sizeInBytes) const
 {
     struct stat fileStat;
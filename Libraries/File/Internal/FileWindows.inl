@@ -86,6 +86,12 @@ SC::Result SC::FileDescriptor::currentPosition(size_t& position) const
     return Result::Error("SetFilePointerEx failed");
 }
 
+SC::Result SC::FileDescriptor::sync()
+{
+    SC_TRY_MSG(::FlushFileBuffers(handle) == TRUE, "FlushFileBuffers failed");
+    return Result(true);
+}
+
 SC::Result SC::FileDescriptor::sizeInBytes(size_t& sizeInBytes) const
 {
     LARGE_INTEGER li;
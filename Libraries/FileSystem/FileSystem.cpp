@@ -376,6 +376,17 @@ bool SC::FileSystem::existsAndIsDirectory(StringView directory)
     return Internal::moveDirectory(encodedPath1.getNullTerminatedNative(), encodedPath2.getNullTerminatedNative());
 }
 
+SC::Result SC::FileSystem::rename(StringView sourceFile, StringView destinationFile)
+{
+    StringView encodedPath1;
+    StringView encodedPath2;
+    SC_TRY(convert(sourceFile, fileFormatBuffer1, &encodedPath1));
+    SC_TRY(convert(destinationFile, fileFormatBuffer2, &encodedPath2));
+    SC_TRY_FORMAT_NATIVE(sourceFile, Internal::renameFile(encodedPath1.getNullTerminatedNative(),
+                                                          encodedPath2.getNullTerminatedNative()));
+    return Result(true);
+}
+
 SC::Result SC::FileSystem::getFileStat(StringView file, FileStat& fileTime)
 {
     StringView encodedPath;
@@ -261,6 +261,12 @@ struct SC::FileSystem
     /// @return `true` if the move succeeded
     [[nodiscard]] bool moveDirectory(StringView sourceDirectory, StringView destinationDirectory);
 
+    /// @brief Renames a file, atomically replacing destination if it already exists
+    /// @param sourceFile The file that will be renamed
+    /// @param destinationFile The new path of the file (must be on the same volume of sourceFile)
+    /// @return Valid Result if the file has been renamed successfully
+    [[nodiscard]] Result rename(StringView sourceFile, StringView destinationFile);
+
     /// @brief Writes a block of memory to a file
     /// @param file Path to the file that is meant to be written
     /// @param data Block of memory to write
@@ -27,6 +27,8 @@ struct SC::FileSystem::Internal
 
     [[nodiscard]] static bool moveDirectory(const char* source, const char* destination) { return false; }
 
+    [[nodiscard]] static bool renameFile(const char* source, const char* destination) { return false; }
+
     [[nodiscard]] static bool removeFile(const char* path) { return false; }
 
     [[nodiscard]] static bool formatError(int errorNumber, String& buffer) { return false; }
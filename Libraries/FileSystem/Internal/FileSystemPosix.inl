@@ -108,6 +108,11 @@ struct SC::FileSystem::Internal
         return true;
     }
 
+    [[nodiscard]] static bool renameFile(const char* sourcePath, const char* destinationPath)
+    {
+        return ::rename(sourcePath, destinationPath) == 0;
+    }
+
     [[nodiscard]] static bool removeEmptyDirectory(const char* path) { return rmdir(path) == 0; }
 
     [[nodiscard]] static bool removeFile(const char* path) { return remove(path) == 0; }
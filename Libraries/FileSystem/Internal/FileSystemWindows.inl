@@ -109,6 +109,11 @@ struct SC::FileSystem::Internal
         return ::MoveFileExW(sourcePath, destinationPath, MOVEFILE_REPLACE_EXISTING | MOVEFILE_COPY_ALLOWED) == TRUE;
     }
 
+    [[nodiscard]] static bool renameFile(const wchar_t* sourcePath, const wchar_t* destinationPath)
+    {
+        return ::MoveFileExW(sourcePath, destinationPath, MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) == TRUE;
+    }
+
     [[nodiscard]] static bool removeEmptyDirectory(const wchar_t* dir)
     {
         SC_TRY_LIBC(_wrmdir(dir));
@@ -37,6 +37,21 @@ SC::Result SC::FileSystemWatcher::FolderWatcher::stopWatching()
     return parent->internal.get().stopWatching(*this);
 }
 
+void SC::FileSystemWatcher::FolderWatcher::notify(const Notification& notification) const
+{
+    if (notifyBatchCallback.isValid())
+    {
+        ChangeSet changeSet;
+        changeSet.basePath      = notification.basePath;
+        changeSet.notifications = {&notification, 1};
+        notifyBatchCallback(changeSet);
+    }
+    else
+    {
+        notifyCallback(notification);
+    }
+}
+
 void SC::FileSystemWatcher::FolderWatcher::setDebugName(const char* debugName)
 {
     (void)debugName;
@@ -45,6 +60,15 @@ void SC::FileSystemWatcher::FolderWatcher::setDebugName(const char* debugName)
 #endif
 }
 
+SC::FileSystemWatcher::LinuxBackend SC::FileSystemWatcher::FolderWatcher::getLinuxBackend() const
+{
+#if SC_PLATFORM_LINUX
+    return Internal::getLinuxBackend(*this);
+#else
+    return LinuxBackend::Inotify;
+#endif
+}
+
 template <>
 void SC::FileSystemWatcher::InternalOpaque::construct(Handle& buffer)
 {
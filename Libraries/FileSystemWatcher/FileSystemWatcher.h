@@ -41,6 +41,13 @@ struct String;
 ///
 /// Example using SC::FileSystemWatcher::ThreadRunner:
 /// \snippet Tests/Libraries/FileSystemWatcher/FileSystemWatcherTest.cpp fileSystemWatcherThreadRunnerSnippet
+///
+/// Setting SC::FileSystemWatcher::FolderWatcher::notifyBatchCallback delivers coalesced notifications instead:
+/// \snippet Tests/Libraries/FileSystemWatcher/FileSystemWatcherTest.cpp fileSystemWatcherBatchSnippet
+///
+/// On Linux setting SC::FileSystemWatcher::linuxBackend to SC::FileSystemWatcher::LinuxBackend::Fanotify watches
+/// entire directory trees with a single fanotify mark, falling back to inotify when missing required privileges:
+/// \snippet Tests/Libraries/FileSystemWatcher/FileSystemWatcherTest.cpp fileSystemWatcherFanotifySnippet
 struct SC::FileSystemWatcher
 {
   private:
@@ -63,12 +70,11 @@ struct SC::FileSystemWatcher
     struct FolderWatcherInternal;
     struct FolderWatcherSizes
     {
-        static constexpr int MaxNumberOfSubdirs   = 128; // Max number of subfolders tracked in a watcher
         static constexpr int MaxChangesBufferSize = 1024;
         static constexpr int Windows =
             MaxChangesBufferSize + sizeof(void*) + sizeof(FileDescriptor) + sizeof(AsyncFilePoll);
         static constexpr int Apple   = sizeof(void*);
-        static constexpr int Linux   = 1056;
+        static constexpr int Linux   = 128;
         static constexpr int Default = Linux;
 
         static constexpr size_t Alignment = alignof(void*);
@@ -79,7 +85,7 @@ struct SC::FileSystemWatcher
     {
         static constexpr int Windows = 3 * sizeof(void*);
         static constexpr int Apple   = 43 * sizeof(void*) + sizeof(Mutex);
-        static constexpr int Linux   = sizeof(void*) * 4;
+        static constexpr int Linux   = sizeof(void*) * 8;
         static constexpr int Default = Linux;
 
         static constexpr size_t Alignment = alignof(void*);
@@ -120,6 +126,25 @@ struct SC::FileSystemWatcher
 #endif
     };
 
+    /// @brief Kernel API used on Linux to receive notifications
+    enum class LinuxBackend
+    {
+        Inotify,  ///< One inotify watch for each directory of the watched tree (default)
+        Fanotify, ///< A single fanotify filesystem mark for the entire tree, independently from its size.
+                  ///< Requires `CAP_SYS_ADMIN` and `CAP_DAC_READ_SEARCH`, falling back to Inotify if missing.
+    };
+
+    /// @brief Set of coalesced notifications delivered to FolderWatcher::notifyBatchCallback
+    struct ChangeSet
+    {
+        StringView               basePath;      ///< Reference to the watched directory
+        Span<const Notification> notifications; ///< Changed paths (each one appears once, in order of first change)
+
+        /// @brief Some notifications have been lost (for example because the kernel event queue overflowed).
+        /// The watch has been re-established but contents of `basePath` must be re-scanned to find what's changed.
+        bool overflow = false;
+    };
+
     /// @brief Represents a single folder being watched.
     /// While in use, the address of this object must not change, as it's inserted in a linked list.
     /// @note You can create an SC::ArenaMap to create a buffer of these objects, that can be easily reused.
@@ -127,6 +152,11 @@ struct SC::FileSystemWatcher
     {
         Function<void(const Notification&)> notifyCallback; ///< Function that will be called on a notification
 
+        /// @brief Function called with all changes coalesced during FileSystemWatcher::batchWindow.
+        /// When valid it's called instead of FolderWatcher::notifyCallback.
+        /// @note Only the Linux backend coalesces changes, other backends deliver one notification for each ChangeSet
+        Function<void(const ChangeSet&)> notifyBatchCallback;
+
         /// @brief Stop watching this directory. After calling it the FolderWatcher can be reused or released.
         /// @return Valid result if directory was unwatched successfully.
         Result stopWatching();
@@ -134,9 +164,15 @@ struct SC::FileSystemWatcher
         /// @brief Sets debug name for AsyncFilePoll used on Windows (used only for debug purposes)
         void setDebugName(const char* debugName);
 
+        /// @brief Returns the backend actually used on Linux to watch this directory.
+        /// It can be LinuxBackend::Inotify even if FileSystemWatcher::linuxBackend requested fanotify.
+        [[nodiscard]] LinuxBackend getLinuxBackend() const;
+
       private:
         friend struct FileSystemWatcher;
         friend struct IntrusiveDoubleLinkedList<FolderWatcher>;
+        void notify(const Notification& notification) const;
+
         FileSystemWatcher* parent = nullptr;
         FolderWatcher*     next   = nullptr;
         FolderWatcher*     prev   = nullptr;
@@ -156,13 +192,22 @@ struct SC::FileSystemWatcher
         AsyncLoopWakeUp asyncWakeUp = {};
         EventObject     eventObject = {};
 #elif SC_PLATFORM_LINUX
-        AsyncFilePoll asyncPoll = {};
+        AsyncFilePoll    asyncPoll         = {};
+        AsyncFilePoll    asyncFanotifyPoll = {}; // Used only with LinuxBackend::Fanotify
+        AsyncLoopTimeout asyncTimeout      = {}; // Delivers coalesced changes at the end of batchWindow
 #endif
     };
 
     /// @brief Delivers notifications on a background thread.
     using ThreadRunner = OpaqueObject<ThreadRunnerDefinition>;
 
+    /// @brief Time window used to coalesce changes delivered to FolderWatcher::notifyBatchCallback.
+    /// All changes happening within the window after the first one are delivered together in a single ChangeSet.
+    Time::Milliseconds batchWindow = Time::Milliseconds(50);
+
+    /// @brief Kernel API used on Linux to receive notifications (it must be set before calling init)
+    LinuxBackend linuxBackend = LinuxBackend::Inotify;
+
     /// @brief Setup watcher to receive notifications from a background thread
     /// @param runner Address of a ThreadRunner object that must be valid until close()
     /// @return Valid Result if the watcher has been initialized correctly
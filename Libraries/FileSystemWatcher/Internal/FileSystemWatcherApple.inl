@@ -350,7 +350,7 @@ struct SC::FileSystemWatcher::Internal
                 }
                 else
                 {
-                    watcher->notifyCallback(internal.notification);
+                    watcher->notify(internal.notification);
                 }
             }
             // TODO: If someone removes this watcher in the callback we will skip notifying remaining ones.
@@ -362,7 +362,7 @@ struct SC::FileSystemWatcher::Internal
 
     void onMainLoop(AsyncLoopWakeUp::Result& result)
     {
-        watcher->notifyCallback(notification);
+        watcher->notify(notification);
         result.reactivateRequest(true);
     }
 
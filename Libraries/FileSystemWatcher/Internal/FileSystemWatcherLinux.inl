@@ -2,13 +2,18 @@
 // SPDX-License-Identifier: MIT
 
 #include <errno.h>
-#include <string.h>      // strlen
-#include <sys/inotify.h> // inotify
-#include <sys/select.h>  // fd_set / FD_ZERO
-#include <sys/stat.h>    // fstat
-#include <unistd.h>      // read
+#include <fcntl.h>        // open / open_by_handle_at
+#include <limits.h>       // PATH_MAX
+#include <stdio.h>        // snprintf
+#include <string.h>       // strlen / memcmp
+#include <sys/fanotify.h> // fanotify
+#include <sys/inotify.h>  // inotify
+#include <sys/select.h>   // fd_set / FD_ZERO
+#include <sys/stat.h>     // fstat
+#include <sys/statfs.h>   // fstatfs
+#include <unistd.h>       // read / readlink
 
-#include "../../Containers/Array.h"
+#include "../../Containers/Vector.h"
 #include "../../File/File.h"
 #include "../../FileSystemIterator/FileSystemIterator.h"
 #include "../../Strings/String.h"
@@ -20,16 +25,121 @@ struct SC::FileSystemWatcher::FolderWatcherInternal
     struct Pair
     {
         int32_t notifyID   = 0;
-        int32_t nameOffset = 0;
+        int32_t nameOffset = 0; // Offset in relativePaths of the null terminated directory path (empty for root)
 
         bool operator==(Pair other) const { return notifyID == other.notifyID; }
     };
 
-    Array<Pair, FolderWatcherSizes::MaxNumberOfSubdirs> notifyHandles;
+    Vector<Pair> notifyHandles; // One for the watched folder (the first) and one for each of its sub-folders
 
     Buffer relativePaths;
 
     FolderWatcher* parentEntry = nullptr; // We could in theory use SC_COMPILER_FIELD_OFFSET somehow to obtain it...
+
+    // Fanotify watches use these fields instead of notifyHandles (mountFd is invalid for inotify watches)
+    FileDescriptor mountFd;  // Watched folder, used to open directory handles of events on its filesystem
+    uint64_t       fsid = 0; // Identifier of the filesystem holding the watched folder
+    Buffer         realPath; // Null terminated canonical path of the watched folder
+
+    /// @brief Changes coalesced by relative path, waiting to be delivered to FolderWatcher::notifyBatchCallback
+    struct Changes
+    {
+        struct Change
+        {
+            uint32_t  hash       = 0;
+            uint32_t  pathOffset = 0; // Offset in paths of the null terminated relative path
+            uint32_t  pathLength = 0;
+            Operation operation  = Operation::Modified;
+        };
+        Vector<Change>   changes;
+        Vector<uint32_t> table; // Open addressing hash table of (1 + index) in changes (0 == empty slot)
+        Buffer           paths;
+
+        bool overflow  = false; // Events have been lost, so the watch must be rescanned
+        bool rescanned = false; // Watch has already been rescanned after overflow, waiting for batch delivery
+
+        [[nodiscard]] bool isEmpty() const { return changes.isEmpty() and not overflow; }
+
+        void clear()
+        {
+            changes.clear();
+            table.clear();
+            paths.clear();
+            overflow  = false;
+            rescanned = false;
+        }
+
+        [[nodiscard]] StringView getPath(const Change& change) const
+        {
+            return StringView({paths.data() + change.pathOffset, change.pathLength}, true, StringEncoding::Utf8);
+        }
+
+        /// @brief Adds a change, merging it with an existing one for the same path
+        [[nodiscard]] bool add(StringView relativePath, Operation operation)
+        {
+            if ((changes.size() + 1) * 2 > table.size())
+            {
+                SC_TRY(rehash(table.isEmpty() ? 64 : table.size() * 2));
+            }
+            const uint32_t hash = computeHash(relativePath);
+            const size_t   mask = table.size() - 1;
+            for (size_t idx = hash & mask;; idx = (idx + 1) & mask)
+            {
+                if (table[idx] == 0)
+                {
+                    Change change;
+                    change.hash       = hash;
+                    change.pathOffset = static_cast<uint32_t>(paths.size());
+                    change.pathLength = static_cast<uint32_t>(relativePath.sizeInBytes());
+                    change.operation  = operation;
+                    SC_TRY(paths.append(relativePath.toCharSpan()));
+                    SC_TRY(paths.push_back(0)); // null terminator
+                    SC_TRY(changes.push_back(change));
+                    table[idx] = static_cast<uint32_t>(changes.size());
+                    return true;
+                }
+                Change& change = changes[table[idx] - 1];
+                if (change.hash == hash and getPath(change) == relativePath)
+                {
+                    // A path added, removed or renamed is reported as such even if it has also been modified
+                    if (operation == Operation::AddRemoveRename)
+                    {
+                        change.operation = operation;
+                    }
+                    return true;
+                }
+            }
+        }
+
+      private:
+        static uint32_t computeHash(StringView text)
+        {
+            uint32_t hash = 2166136261u; // FNV-1a
+            for (char character : text.toCharSpan())
+            {
+                hash = (hash ^ static_cast<uint8_t>(character)) * 16777619u;
+            }
+            return hash;
+        }
+
+        [[nodiscard]] bool rehash(size_t newSize)
+        {
+            table.clear();
+            SC_TRY(table.resize(newSize, 0));
+            const size_t mask = newSize - 1;
+            for (size_t changeIdx = 0; changeIdx < changes.size(); ++changeIdx)
+            {
+                size_t idx = changes[changeIdx].hash & mask;
+                while (table[idx] != 0)
+                {
+                    idx = (idx + 1) & mask;
+                }
+                table[idx] = static_cast<uint32_t>(changeIdx + 1);
+            }
+            return true;
+        }
+    };
+    Changes changes;
 };
 
 struct SC::FileSystemWatcher::ThreadRunnerInternal
@@ -42,11 +152,23 @@ struct SC::FileSystemWatcher::ThreadRunnerInternal
 
 struct SC::FileSystemWatcher::Internal
 {
+    static constexpr uint32_t NotifyMask = IN_ATTRIB | IN_CREATE | IN_MODIFY | IN_DELETE | IN_DELETE_SELF |
+                                           IN_MOVE_SELF | IN_MOVED_FROM | IN_MOVED_TO;
+
+    static constexpr uint64_t FanotifyMask =
+        FAN_ATTRIB | FAN_CREATE | FAN_MODIFY | FAN_DELETE | FAN_MOVED_FROM | FAN_MOVED_TO | FAN_ONDIR;
+
+    static constexpr int MaxReadsPerNotification = 16; // Bounds time spent draining the queue during event floods
+
     FileSystemWatcher*    self            = nullptr;
     EventLoopRunner*      eventLoopRunner = nullptr;
     ThreadRunnerInternal* threadingRunner = nullptr;
 
     FileDescriptor notifyFd;
+    FileDescriptor fanotifyFd; // Valid only if LinuxBackend::Fanotify has been requested and it's supported
+
+    int64_t              batchDeadline = 0; // Monotonic time (ms) for delivering coalesced changes (0 == none)
+    Vector<Notification> batchNotifications;
 
     [[nodiscard]] Result init(FileSystemWatcher& parent, ThreadRunner& runner)
     {
@@ -54,7 +176,10 @@ struct SC::FileSystemWatcher::Internal
         threadingRunner = &runner.get();
 
         SC_TRY(threadingRunner->shutdownPipe.createPipe());
-        return notifyFd.assign(::inotify_init1(IN_CLOEXEC));
+        // Non blocking, as the queue is drained reading until EAGAIN after ::select() signals it
+        SC_TRY(notifyFd.assign(::inotify_init1(IN_NONBLOCK | IN_CLOEXEC)));
+        initFanotify();
+        return Result(true);
     }
 
     [[nodiscard]] Result init(FileSystemWatcher& parent, EventLoopRunner& runner)
@@ -67,7 +192,39 @@ struct SC::FileSystemWatcher::Internal
 
         SC_TRY(eventLoopRunner->eventLoop->associateExternallyCreatedFileDescriptor(notifyFd));
         runner.asyncPoll.callback.bind<Internal, &Internal::onEventLoopNotification>(*this);
-        return runner.asyncPoll.start(*eventLoopRunner->eventLoop, notifyHandle);
+        runner.asyncTimeout.callback.bind<Internal, &Internal::onEventLoopBatchTimeout>(*this);
+        SC_TRY(runner.asyncPoll.start(*eventLoopRunner->eventLoop, notifyHandle));
+
+        initFanotify();
+        int fanotifyHandle;
+        if (fanotifyFd.get(fanotifyHandle, Result(false)))
+        {
+            SC_TRY(eventLoopRunner->eventLoop->associateExternallyCreatedFileDescriptor(fanotifyFd));
+            runner.asyncFanotifyPoll.callback.bind<Internal, &Internal::onEventLoopFanotifyNotification>(*this);
+            SC_TRY(runner.asyncFanotifyPoll.start(*eventLoopRunner->eventLoop, fanotifyHandle));
+        }
+        return Result(true);
+    }
+
+    /// @brief Creates the fanotify group if requested, leaving fanotifyFd invalid if it's not supported.
+    /// Privileges are checked later when adding the marks, falling back to inotify for each FolderWatcher.
+    void initFanotify()
+    {
+        if (self->linuxBackend == LinuxBackend::Fanotify)
+        {
+            // FAN_REPORT_DFID_NAME (Linux 5.9+) reports directory handle and name, instead of an open fd
+            const int fanotifyHandle =
+                ::fanotify_init(FAN_CLASS_NOTIF | FAN_REPORT_DFID_NAME | FAN_CLOEXEC | FAN_NONBLOCK, O_RDONLY);
+            if (fanotifyHandle != -1)
+            {
+                (void)fanotifyFd.assign(fanotifyHandle);
+            }
+        }
+    }
+
+    static LinuxBackend getLinuxBackend(const FolderWatcher& watcher)
+    {
+        return watcher.internal.get().mountFd.isValid() ? LinuxBackend::Fanotify : LinuxBackend::Inotify;
     }
 
     [[nodiscard]] Result close()
@@ -75,11 +232,19 @@ struct SC::FileSystemWatcher::Internal
         if (eventLoopRunner)
         {
             SC_TRY(eventLoopRunner->asyncPoll.stop(*eventLoopRunner->eventLoop));
+            if (eventLoopRunner->asyncFanotifyPoll.isActive())
+            {
+                SC_TRY(eventLoopRunner->asyncFanotifyPoll.stop(*eventLoopRunner->eventLoop));
+            }
+            if (eventLoopRunner->asyncTimeout.isActive())
+            {
+                SC_TRY(eventLoopRunner->asyncTimeout.stop(*eventLoopRunner->eventLoop));
+            }
         }
 
-        for (FolderWatcher* entry = self->watchers.front; entry != nullptr; entry = entry->next)
+        while (self->watchers.front != nullptr)
         {
-            SC_TRY(stopWatching(*entry));
+            SC_TRY(stopWatching(*self->watchers.front));
         }
 
         if (threadingRunner)
@@ -94,7 +259,9 @@ struct SC::FileSystemWatcher::Internal
                 SC_TRY(threadingRunner->thread.join());
             }
         }
+        batchDeadline = 0;
         SC_TRY(notifyFd.close());
+        SC_TRY(fanotifyFd.close());
         return Result(true);
     }
 
@@ -104,69 +271,37 @@ struct SC::FileSystemWatcher::Internal
         folderWatcher.parent = nullptr;
 
         FolderWatcherInternal& folderInternal = folderWatcher.internal.get();
-
-        int rootNotifyFd;
-        SC_TRY(notifyFd.get(rootNotifyFd, Result::Error("invalid notifyFd")));
-
-        for (FolderWatcherInternal::Pair pair : folderInternal.notifyHandles)
+        if (folderInternal.mountFd.isValid())
         {
-            const int res = ::inotify_rm_watch(rootNotifyFd, pair.notifyID);
-            SC_TRY_MSG(res != -1, "inotify_rm_watch");
+            SC_TRY(removeUnusedFanotifyMark(folderInternal));
         }
+        SC_TRY(removeUnusedWatches(folderInternal.notifyHandles.toSpanConst()));
         folderInternal.notifyHandles.clear();
         folderInternal.relativePaths.clear();
-        return Result(true);
+        folderInternal.realPath.clear();
+        folderInternal.changes.clear();
+        return folderInternal.mountFd.close();
     }
 
     [[nodiscard]] Result startWatching(FolderWatcher* entry)
     {
-        // TODO: Add check for trying to watch folders already being watched or children of recursive watches
-        StringNative<1024> buffer = StringEncoding::Native; // TODO: this needs to go into caller context
-        StringView         encodedPath;
-        SC_TRY(StringConverter(buffer).convertNullTerminateFastPath(entry->path.view(), encodedPath));
         FolderWatcherInternal& opaque = entry->internal.get();
-
-        int rootNotifyFd;
-        SC_TRY(notifyFd.get(rootNotifyFd, Result::Error("invalid notifyFd")));
-        const int newHandle = ::inotify_add_watch(rootNotifyFd, encodedPath.getNullTerminatedNative(),
-                                                  IN_ATTRIB | IN_CREATE | IN_MODIFY | IN_DELETE | IN_DELETE_SELF |
-                                                      IN_MOVE_SELF | IN_MOVED_FROM | IN_MOVED_TO);
-        if (newHandle == -1)
+        opaque.parentEntry            = entry;
+        opaque.changes.clear();
+        if (fanotifyFd.isValid() and addFanotifyMark(*entry))
         {
-            return Result::Error("inotify_add_watch");
+            // Nothing else to do, a single mark watches the entire tree (including sub-folders created later)
         }
-        FolderWatcherInternal::Pair pair;
-        pair.notifyID   = newHandle;
-        pair.nameOffset = 0;
-        SC_TRY(opaque.notifyHandles.push_back(pair));
-
-        // Watch all subfolders of current directory.
-        // TODO: We should also dynamically add / remove watched directories added after now...
-        StringConverter    converter(opaque.relativePaths, StringEncoding::Utf8);
-        FileSystemIterator iterator;
-        iterator.options.recursive = true;
-        SC_TRY(iterator.init(encodedPath));
-        while (iterator.enumerateNext())
+        // Watching the same folder (or a sub-folder) of a recursive watch re-uses its inotify watch descriptors
+        else if (not copyWatchesFromParentWatcher(*entry))
         {
-            if (iterator.get().isDirectory())
+            const Result res = addWatches(*entry);
+            if (not res)
             {
-                int notifyFd = ::inotify_add_watch(rootNotifyFd, iterator.get().path.getNullTerminatedNative(),
-                                                   IN_ATTRIB | IN_CREATE | IN_MODIFY | IN_DELETE | IN_DELETE_SELF |
-                                                       IN_MOVE_SELF | IN_MOVED_FROM | IN_MOVED_TO);
-                if (notifyFd == -1)
-                {
-                    (void)stopWatching(*entry); // This is to remove notifications for all directories added so far
-                    return Result::Error("inotify_add_watch (subdirectory)");
-                }
-                pair.notifyID   = notifyFd;
-                pair.nameOffset = opaque.relativePaths.size();
-                SC_TRY(converter.appendNullTerminated(iterator.get().name, false)); // keep null terminator
-                SC_TRY(opaque.notifyHandles.push_back(pair));
+                (void)stopWatching(*entry); // This is to remove notifications for all directories added so far
+                return res;
             }
         }
-        SC_TRY(iterator.checkErrors());
-
-        opaque.parentEntry = entry;
 
         // Launch the thread that monitors the inotify watch if we're on thread runner
         if (threadingRunner and not threadingRunner->thread.wasStarted())
@@ -191,128 +326,741 @@ struct SC::FileSystemWatcher::Internal
             int shutdownHandle;
             SC_ASSERT_RELEASE(runner.shutdownPipe.readPipe.get(shutdownHandle, Result(false)));
 
-            // Setup a select fd_set to listen on both notifyHandle and shutdownHandle simultaneously
+            int fanotifyHandle = -1;
+            (void)fanotifyFd.get(fanotifyHandle, Result(false));
+
+            // Setup a select fd_set to listen on notifyHandle, fanotifyHandle and shutdownHandle simultaneously
             fd_set fds;
             FD_ZERO(&fds);
             FD_SET(notifyHandle, &fds);
             FD_SET(shutdownHandle, &fds);
-            const int maxFd = notifyHandle > shutdownHandle ? notifyHandle : shutdownHandle;
+            int maxFd = notifyHandle > shutdownHandle ? notifyHandle : shutdownHandle;
+            if (fanotifyHandle != -1)
+            {
+                FD_SET(fanotifyHandle, &fds);
+                maxFd = fanotifyHandle > maxFd ? fanotifyHandle : maxFd;
+            }
 
             int selectRes;
             do
             {
-                // Block until some events are received on the notifyFd or when shutdownPipe is written to
-                selectRes = ::select(maxFd + 1, &fds, nullptr, nullptr, nullptr);
+                // Block until some events are received on the notifyFd or when shutdownPipe is written to.
+                // When coalesced changes are pending, wake up at the end of the batch window to deliver them.
+                struct timeval  timeout;
+                struct timeval* timeoutPtr = nullptr;
+                if (batchDeadline != 0)
+                {
+                    const int64_t now       = Time::Monotonic::now().getMonotonicMilliseconds();
+                    const int64_t remaining = batchDeadline > now ? batchDeadline - now : 0;
+
+                    timeout.tv_sec  = static_cast<time_t>(remaining / 1000);
+                    timeout.tv_usec = static_cast<suseconds_t>((remaining % 1000) * 1000);
+                    timeoutPtr      = &timeout;
+                }
+                selectRes = ::select(maxFd + 1, &fds, nullptr, nullptr, timeoutPtr);
             } while (selectRes == -1 and errno == EINTR);
 
-            if (FD_ISSET(shutdownHandle, &fds))
+            if (selectRes > 0 and FD_ISSET(shutdownHandle, &fds))
             {
                 return; // Interrupted by shutdownPipe.writePipe.write (from close())
             }
-            // Here select has received data on notifyHandle
-            readAndNotify(notifyFd, self->watchers);
+            if (selectRes > 0 and FD_ISSET(notifyHandle, &fds))
+            {
+                readAndNotify();
+            }
+            if (selectRes > 0 and fanotifyHandle != -1 and FD_ISSET(fanotifyHandle, &fds))
+            {
+                readAndNotifyFanotify();
+            }
+            if (batchDeadline != 0 and Time::Monotonic::now().getMonotonicMilliseconds() >= batchDeadline)
+            {
+                notifyBatches();
+            }
         }
         threadingRunner->shouldStop.exchange(false);
     }
 
     void onEventLoopNotification(AsyncFilePoll::Result& result)
     {
-        readAndNotify(notifyFd, self->watchers);
+        readAndNotify();
+        startBatchTimeout();
+        result.reactivateRequest(true);
+    }
+
+    void onEventLoopFanotifyNotification(AsyncFilePoll::Result& result)
+    {
+        readAndNotifyFanotify();
+        startBatchTimeout();
         result.reactivateRequest(true);
     }
 
-    static void readAndNotify(const FileDescriptor& notifyFd, IntrusiveDoubleLinkedList<FolderWatcher> watchers)
+    void startBatchTimeout()
+    {
+        if (batchDeadline != 0 and not eventLoopRunner->asyncTimeout.isActive())
+        {
+            AsyncEventLoop& eventLoop = *eventLoopRunner->eventLoop;
+            (void)eventLoopRunner->asyncTimeout.start(eventLoop, self->batchWindow);
+        }
+    }
+
+    void onEventLoopBatchTimeout(AsyncLoopTimeout::Result&) { notifyBatches(); }
+
+  private:
+    /// @brief Last directory handle resolved to a path, as consecutive fanotify events often share the directory
+    struct ResolvedDirectory
+    {
+        alignas(struct file_handle) char handle[sizeof(struct file_handle) + MAX_HANDLE_SZ];
+
+        uint64_t fsid       = 0;
+        size_t   handleSize = 0; // Zero if nothing has been cached
+        bool     isValid    = false;
+        char     path[PATH_MAX];
+        size_t   pathLength = 0;
+    };
+
+    /// @brief Marks the filesystem holding the folder, that is then able to receive notifications for all of its
+    /// sub-folders. Fails if process is missing CAP_SYS_ADMIN (mark) or CAP_DAC_READ_SEARCH (open_by_handle_at).
+    [[nodiscard]] Result addFanotifyMark(FolderWatcher& entry)
+    {
+        FolderWatcherInternal& opaque = entry.internal.get();
+
+        const Result res = markFilesystem(entry);
+        if (not res)
+        {
+            (void)opaque.mountFd.close();
+            opaque.realPath.clear();
+        }
+        return res;
+    }
+
+    [[nodiscard]] Result markFilesystem(FolderWatcher& entry)
+    {
+        StringNative<1024> buffer = StringEncoding::Native;
+        StringView         encodedPath;
+        SC_TRY(StringConverter(buffer).convertNullTerminateFastPath(entry.path.view(), encodedPath));
+        FolderWatcherInternal& opaque = entry.internal.get();
+
+        const int rootHandle = ::open(encodedPath.getNullTerminatedNative(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+        SC_TRY_MSG(rootHandle != -1, "open");
+        SC_TRY(opaque.mountFd.assign(rootHandle));
+
+        struct statfs fileSystemStat;
+        SC_TRY_MSG(::fstatfs(rootHandle, &fileSystemStat) == 0, "fstatfs");
+        static_assert(sizeof(fileSystemStat.f_fsid) == sizeof(opaque.fsid), "fsid");
+        ::memcpy(&opaque.fsid, &fileSystemStat.f_fsid, sizeof(opaque.fsid));
+
+        // Check that the directory handles reported by events can be resolved to the canonical watched path
+        ResolvedDirectory root;
+        struct file_handle* handle = reinterpret_cast<struct file_handle*>(root.handle);
+        handle->handle_bytes       = MAX_HANDLE_SZ;
+
+        int mountID;
+        SC_TRY_MSG(::name_to_handle_at(rootHandle, "", handle, &mountID, AT_EMPTY_PATH) == 0, "name_to_handle_at");
+        SC_TRY_MSG(resolveHandle(rootHandle, root), "open_by_handle_at");
+        SC_TRY(opaque.realPath.append({root.path, root.pathLength}));
+        SC_TRY(opaque.realPath.push_back(0)); // null terminator
+
+        int fanotifyHandle;
+        SC_TRY(fanotifyFd.get(fanotifyHandle, Result::Error("invalid fanotifyFd")));
+        const int res =
+            ::fanotify_mark(fanotifyHandle, FAN_MARK_ADD | FAN_MARK_FILESYSTEM, FanotifyMask, rootHandle, nullptr);
+        SC_TRY_MSG(res == 0, "fanotify_mark");
+        return Result(true);
+    }
+
+    /// @brief Removes the filesystem mark if no other FolderWatcher is using it
+    [[nodiscard]] Result removeUnusedFanotifyMark(FolderWatcherInternal& opaque)
+    {
+        for (FolderWatcher* entry = self->watchers.front; entry != nullptr; entry = entry->next)
+        {
+            const FolderWatcherInternal& other = entry->internal.get();
+            if (&other != &opaque and other.mountFd.isValid() and other.fsid == opaque.fsid)
+            {
+                return Result(true);
+            }
+        }
+        int fanotifyHandle, rootHandle;
+        SC_TRY(fanotifyFd.get(fanotifyHandle, Result::Error("invalid fanotifyFd")));
+        SC_TRY(opaque.mountFd.get(rootHandle, Result::Error("invalid mountFd")));
+        const int res =
+            ::fanotify_mark(fanotifyHandle, FAN_MARK_REMOVE | FAN_MARK_FILESYSTEM, FanotifyMask, rootHandle, nullptr);
+        SC_TRY_MSG(res == 0 or errno == ENOENT, "fanotify_mark (remove)");
+        return Result(true);
+    }
+
+    /// @brief Obtains the path of the directory handle, opening it relative to a directory on the same filesystem
+    [[nodiscard]] static bool resolveHandle(int mountHandle, ResolvedDirectory& directory)
+    {
+        struct file_handle* handle = reinterpret_cast<struct file_handle*>(directory.handle);
+
+        directory.pathLength = 0;
+        const int dirHandle  = ::open_by_handle_at(mountHandle, handle, O_PATH | O_CLOEXEC);
+        if (dirHandle == -1)
+        {
+            return false; // For example ESTALE if the directory has been deleted in the meantime
+        }
+        char procPath[32];
+        ::snprintf(procPath, sizeof(procPath), "/proc/self/fd/%d", dirHandle);
+        const ssize_t pathLength = ::readlink(procPath, directory.path, sizeof(directory.path));
+        ::close(dirHandle);
+        if (pathLength <= 0 or static_cast<size_t>(pathLength) >= sizeof(directory.path))
+        {
+            return false;
+        }
+        directory.pathLength = static_cast<size_t>(pathLength);
+        return true;
+    }
+
+    /// @brief Resolves directory handle of an event to its path, re-using last resolved one if it's the same
+    [[nodiscard]] bool resolveDirectory(uint64_t fsid, const struct file_handle& handle, ResolvedDirectory& directory)
+    {
+        if (handle.handle_bytes > MAX_HANDLE_SZ)
+        {
+            return false;
+        }
+        const size_t handleSize = sizeof(struct file_handle) + handle.handle_bytes;
+        if (directory.handleSize == handleSize and directory.fsid == fsid and
+            ::memcmp(directory.handle, &handle, handleSize) == 0)
+        {
+            return directory.isValid;
+        }
+        // Any directory on the same filesystem can be used to open the handle
+        int mountHandle = -1;
+        for (FolderWatcher* entry = self->watchers.front; entry != nullptr and mountHandle == -1; entry = entry->next)
+        {
+            const FolderWatcherInternal& opaque = entry->internal.get();
+            if (opaque.fsid == fsid and not opaque.mountFd.get(mountHandle, Result(false)))
+            {
+                mountHandle = -1;
+            }
+        }
+        if (mountHandle == -1)
+        {
+            return false;
+        }
+        ::memcpy(directory.handle, &handle, handleSize);
+        directory.handleSize = handleSize;
+        directory.fsid       = fsid;
+        directory.isValid    = resolveHandle(mountHandle, directory);
+        return directory.isValid;
+    }
+
+    /// @brief Obtains the path of a directory relative to the watched folder, returning false if it's not inside it
+    [[nodiscard]] static bool getFanotifyRelativeDirectory(const FolderWatcherInternal& opaque,
+                                                           StringView directoryPath, StringView& relativeDirectory)
+    {
+        const StringView rootPath({opaque.realPath.data(), opaque.realPath.size() - 1}, true, StringEncoding::Utf8);
+        if (not directoryPath.startsWith(rootPath))
+        {
+            return false;
+        }
+        relativeDirectory = directoryPath.sliceStartEndBytes(rootPath.sizeInBytes(), directoryPath.sizeInBytes());
+        if (not relativeDirectory.isEmpty() and not rootPath.endsWithAnyOf({'/'}) and
+            not relativeDirectory.startsWithAnyOf({'/'}))
+        {
+            return false; // For example "/dir/abc" must not match "/dir/a"
+        }
+        relativeDirectory = relativeDirectory.trimStartAnyOf({'/'});
+        return true;
+    }
+
+    void readAndNotifyFanotify()
+    {
+        int fanotifyHandle;
+        SC_ASSERT_RELEASE(fanotifyFd.get(fanotifyHandle, Result(false)));
+
+        ResolvedDirectory directory;
+        alignas(struct fanotify_event_metadata) char fanotifyBuffer[4 * 1024];
+        for (int readIdx = 0; readIdx < MaxReadsPerNotification; ++readIdx)
+        {
+            ssize_t numReadBytes;
+            do
+            {
+                numReadBytes = ::read(fanotifyHandle, fanotifyBuffer, sizeof(fanotifyBuffer));
+            } while (numReadBytes == -1 and errno == EINTR);
+            if (numReadBytes <= 0)
+            {
+                break; // EAGAIN, queue has been fully drained
+            }
+            notifyFanotifyWatchers({fanotifyBuffer, static_cast<size_t>(numReadBytes)}, directory);
+        }
+        notifyOverflows();
+    }
+
+    void notifyFanotifyWatchers(Span<char> actuallyRead, ResolvedDirectory& directory)
+    {
+        const char* const endOfEvents = actuallyRead.data() + actuallyRead.sizeInBytes();
+
+        const struct fanotify_event_metadata* event = nullptr;
+
+        SmallString<1024> bufferString;
+        for (const char* iterator = actuallyRead.data(); iterator < endOfEvents; iterator += event->event_len)
+        {
+            event = reinterpret_cast<const struct fanotify_event_metadata*>(iterator);
+            if (event->event_len < sizeof(*event) or iterator + event->event_len > endOfEvents)
+            {
+                break; // Same as FAN_EVENT_OK
+            }
+            if (event->vers != FANOTIFY_METADATA_VERSION)
+            {
+                continue;
+            }
+            if (event->mask & FAN_Q_OVERFLOW)
+            {
+                setOverflow(LinuxBackend::Fanotify);
+                continue;
+            }
+            // Directory handle and name are stored in the information records following the event metadata
+            const struct fanotify_event_info_header* info = nullptr;
+            for (const char* infoIterator = iterator + event->metadata_len; infoIterator < iterator + event->event_len;
+                 infoIterator += info->len)
+            {
+                info = reinterpret_cast<const struct fanotify_event_info_header*>(infoIterator);
+                if (info->len == 0)
+                {
+                    break;
+                }
+                if (info->info_type == FAN_EVENT_INFO_TYPE_DFID_NAME or info->info_type == FAN_EVENT_INFO_TYPE_DFID)
+                {
+                    const auto& fid = *reinterpret_cast<const struct fanotify_event_info_fid*>(infoIterator);
+                    notifyFanotifyEvent(*event, fid, directory, bufferString);
+                }
+            }
+        }
+    }
+
+    void notifyFanotifyEvent(const struct fanotify_event_metadata& event, const struct fanotify_event_info_fid& fid,
+                             ResolvedDirectory& directory, String& bufferString)
+    {
+        uint64_t fsid;
+        ::memcpy(&fsid, &fid.fsid, sizeof(fsid));
+        const struct file_handle& handle = *reinterpret_cast<const struct file_handle*>(fid.handle);
+        if (not resolveDirectory(fsid, handle, directory))
+        {
+            return; // Not a watched filesystem or directory deleted in the meantime
+        }
+        const char* name = fid.hdr.info_type == FAN_EVENT_INFO_TYPE_DFID_NAME
+                               ? reinterpret_cast<const char*>(handle.f_handle + handle.handle_bytes)
+                               : "";
+
+        const StringView directoryPath({directory.path, directory.pathLength}, false, StringEncoding::Utf8);
+        const StringView relativeName({name, ::strlen(name)}, true, StringEncoding::Utf8);
+
+        Notification notification;
+        if (event.mask & (FAN_ATTRIB | FAN_MODIFY))
+        {
+            notification.operation = Operation::Modified;
+        }
+        if (event.mask & ~(FAN_ATTRIB | FAN_MODIFY | FAN_ONDIR))
+        {
+            notification.operation = Operation::AddRemoveRename;
+        }
+
+        // A single filesystem mark delivers events for all of its paths, that are then filtered for each watcher
+        FolderWatcher* next = nullptr;
+        for (FolderWatcher* entry = self->watchers.front; entry != nullptr; entry = next)
+        {
+            next = entry->next;
+
+            const FolderWatcherInternal& opaque = entry->internal.get();
+            StringView                   relativeDirectory;
+            if (not opaque.mountFd.isValid() or opaque.fsid != fsid or
+                not getFanotifyRelativeDirectory(opaque, directoryPath, relativeDirectory))
+            {
+                continue;
+            }
+            if (relativeDirectory.isEmpty() and relativeName.isEmpty())
+            {
+                continue; // The watched folder itself
+            }
+            notification.basePath = entry->path.view();
+            if (joinRelativePath(relativeDirectory, relativeName, bufferString, notification.relativePath))
+            {
+                (void)notifyChange(*entry, notification);
+            }
+        }
+        if ((event.mask & FAN_ONDIR) and (event.mask & (FAN_MOVED_FROM | FAN_MOVED_TO | FAN_DELETE)))
+        {
+            directory.handleSize = 0; // A directory has been moved or deleted, so the cached path could be stale
+        }
+    }
+
+    void setOverflow(LinuxBackend backend)
+    {
+        for (FolderWatcher* entry = self->watchers.front; entry != nullptr; entry = entry->next)
+        {
+            if (getLinuxBackend(*entry) == backend)
+            {
+                entry->internal.get().changes.overflow  = true;
+                entry->internal.get().changes.rescanned = false; // Also events lost after last rescan are recovered
+            }
+        }
+    }
+
+    /// @brief Removes inotify watch descriptors not used anymore by any FolderWatcher
+    [[nodiscard]] Result removeUnusedWatches(Span<const FolderWatcherInternal::Pair> pairs)
+    {
+        int rootNotifyFd;
+        SC_TRY(notifyFd.get(rootNotifyFd, Result::Error("invalid notifyFd")));
+        for (FolderWatcherInternal::Pair pair : pairs)
+        {
+            if (findWatcher(pair.notifyID, nullptr) == nullptr)
+            {
+                // Fails with EINVAL if the kernel already removed it (for example because directory was deleted)
+                const int res = ::inotify_rm_watch(rootNotifyFd, pair.notifyID);
+                SC_TRY_MSG(res != -1 or errno == EINVAL, "inotify_rm_watch");
+            }
+        }
+        return Result(true);
+    }
+
+    /// @brief Finds first FolderWatcher (following `after`) using the given inotify watch descriptor
+    FolderWatcher* findWatcher(int32_t notifyID, FolderWatcher* after)
+    {
+        FolderWatcher* entry = after ? after->next : self->watchers.front;
+        for (; entry != nullptr; entry = entry->next)
+        {
+            if (entry->internal.get().notifyHandles.contains(FolderWatcherInternal::Pair{notifyID, 0}))
+            {
+                return entry;
+            }
+        }
+        return nullptr;
+    }
+
+    [[nodiscard]] static Result addPair(FolderWatcherInternal& opaque, int32_t notifyID, StringView relativeDirectory)
+    {
+        FolderWatcherInternal::Pair pair;
+        pair.notifyID   = notifyID;
+        pair.nameOffset = static_cast<int32_t>(opaque.relativePaths.size());
+        SC_TRY(opaque.relativePaths.append(relativeDirectory.toCharSpan()));
+        SC_TRY(opaque.relativePaths.push_back(0)); // null terminator
+        return Result(opaque.notifyHandles.push_back(pair));
+    }
+
+    [[nodiscard]] static StringView getRelativeDirectory(const FolderWatcherInternal& opaque, size_t index)
+    {
+        const char* dirStart = opaque.relativePaths.data() + opaque.notifyHandles[index].nameOffset;
+        return StringView({dirStart, ::strlen(dirStart)}, true, StringEncoding::Utf8);
+    }
+
+    /// @brief Copies watch descriptors from a recursive FolderWatcher of the same folder or of one of its parents
+    [[nodiscard]] bool copyWatchesFromParentWatcher(FolderWatcher& entry)
+    {
+        const StringView path = entry.path.view();
+        for (FolderWatcher* other = self->watchers.front; other != nullptr; other = other->next)
+        {
+            const StringView otherPath = other->path.view();
+            if (other == &entry or other->internal.get().notifyHandles.isEmpty() or not path.startsWith(otherPath))
+                continue;
+            StringView subDirectory = path.sliceStartEndBytes(otherPath.sizeInBytes(), path.sizeInBytes());
+            if (not subDirectory.isEmpty())
+            {
+                if (not subDirectory.startsWithAnyOf({'/'}))
+                    continue; // For example "/dir/abc" must not match "/dir/a"
+                subDirectory = subDirectory.trimStartAnyOf({'/'});
+            }
+            const FolderWatcherInternal& otherOpaque = other->internal.get();
+            FolderWatcherInternal&       opaque      = entry.internal.get();
+
+            // Root must be the first pair, as all others are expressed relative to it
+            bool foundRoot = false;
+            for (size_t idx = 0; idx < otherOpaque.notifyHandles.size(); ++idx)
+            {
+                if (getRelativeDirectory(otherOpaque, idx) == subDirectory)
+                {
+                    foundRoot = addPair(opaque, otherOpaque.notifyHandles[idx].notifyID, StringView());
+                    break;
+                }
+            }
+            if (not foundRoot)
+            {
+                opaque.notifyHandles.clear();
+                opaque.relativePaths.clear();
+                continue;
+            }
+            for (size_t idx = 0; idx < otherOpaque.notifyHandles.size(); ++idx)
+            {
+                StringView directory = getRelativeDirectory(otherOpaque, idx);
+                if (not subDirectory.isEmpty())
+                {
+                    if (not directory.startsWith(subDirectory) or directory == subDirectory)
+                        continue;
+                    directory = directory.sliceStartBytes(subDirectory.sizeInBytes());
+                    if (not directory.startsWithAnyOf({'/'}))
+                        continue;
+                    directory = directory.trimStartAnyOf({'/'});
+                }
+                else if (directory.isEmpty())
+                {
+                    continue; // Root has already been added
+                }
+                if (not addPair(opaque, otherOpaque.notifyHandles[idx].notifyID, directory))
+                {
+                    opaque.notifyHandles.clear();
+                    opaque.relativePaths.clear();
+                    return false;
+                }
+            }
+            return true;
+        }
+        return false;
+    }
+
+    /// @brief Adds a watch for the folder and all of its sub-folders
+    [[nodiscard]] Result addWatches(FolderWatcher& entry)
+    {
+        StringNative<1024> buffer = StringEncoding::Native; // TODO: this needs to go into caller context
+        StringView         encodedPath;
+        SC_TRY(StringConverter(buffer).convertNullTerminateFastPath(entry.path.view(), encodedPath));
+        FolderWatcherInternal& opaque = entry.internal.get();
+
+        int rootNotifyFd;
+        SC_TRY(notifyFd.get(rootNotifyFd, Result::Error("invalid notifyFd")));
+        // Adding a watch for a directory already watched returns the same descriptor, that is then shared
+        const int newHandle = ::inotify_add_watch(rootNotifyFd, encodedPath.getNullTerminatedNative(), NotifyMask);
+        if (newHandle == -1)
+        {
+            return Result::Error("inotify_add_watch");
+        }
+        SC_TRY(addPair(opaque, newHandle, StringView()));
+
+        // Watch all subfolders of current directory.
+        // TODO: We should also dynamically add / remove watched directories added after now...
+        FileSystemIterator iterator;
+        iterator.options.recursive = true;
+        SC_TRY(iterator.init(encodedPath));
+        while (iterator.enumerateNext())
+        {
+            if (iterator.get().isDirectory())
+            {
+                const int notifyID = ::inotify_add_watch(rootNotifyFd, iterator.get().path.getNullTerminatedNative(),
+                                                         NotifyMask);
+                // Relative path of the sub-folder (and not just its name) as the iteration is recursive
+                const StringView relativeDirectory =
+                    iterator.get().path.sliceStartBytes(encodedPath.sizeInBytes()).trimStartAnyOf({'/'});
+                if (notifyID == -1 or not addPair(opaque, notifyID, relativeDirectory))
+                {
+                    return Result::Error("inotify_add_watch (subdirectory)");
+                }
+            }
+        }
+        return iterator.checkErrors();
+    }
+
+    /// @brief Re-establishes all watches of a FolderWatcher after some events have been lost
+    [[nodiscard]] Result rescan(FolderWatcher& entry)
+    {
+        FolderWatcherInternal& opaque = entry.internal.get();
+
+        Vector<FolderWatcherInternal::Pair> previousHandles = move(opaque.notifyHandles);
+        opaque.notifyHandles.clear();
+        opaque.relativePaths.clear();
+        // Sub-folders created or moved while events were lost will get their watch now.
+        // On failure the watch is kept for all folders that could be added.
+        const Result res = addWatches(entry);
+        SC_TRY(removeUnusedWatches(previousHandles.toSpanConst()));
+        return res;
+    }
+
+    void readAndNotify()
     {
         int notifyHandle;
         SC_ASSERT_RELEASE(notifyFd.get(notifyHandle, Result(false)));
-        int  numReadBytes;
-        char inotifyBuffer[3 * 1024];
-        // TODO: Handle the case where kernel is sending more than 3kb of events.
-        do
-        {
-            numReadBytes = ::read(notifyHandle, inotifyBuffer, sizeof(inotifyBuffer));
-        } while (numReadBytes == -1 and errno == EINTR);
 
-        Span<char> actuallyRead = {inotifyBuffer, static_cast<size_t>(numReadBytes)};
-        notifyWatchers(actuallyRead, watchers);
+        alignas(struct inotify_event) char inotifyBuffer[4 * 1024];
+        for (int readIdx = 0; readIdx < MaxReadsPerNotification; ++readIdx)
+        {
+            ssize_t numReadBytes;
+            do
+            {
+                numReadBytes = ::read(notifyHandle, inotifyBuffer, sizeof(inotifyBuffer));
+            } while (numReadBytes == -1 and errno == EINTR);
+            if (numReadBytes <= 0)
+            {
+                break; // EAGAIN, queue has been fully drained
+            }
+            notifyWatchers({inotifyBuffer, static_cast<size_t>(numReadBytes)});
+        }
+        notifyOverflows();
     }
 
-    static void notifyWatchers(Span<char> actuallyRead, IntrusiveDoubleLinkedList<FolderWatcher> watchers)
+    void notifyWatchers(Span<char> actuallyRead)
     {
         const struct inotify_event* event     = nullptr;
         const struct inotify_event* prevEvent = nullptr;
 
-        // Loop through all inotify_event and find the associated FolderWatcher to notify
+        // Loop through all inotify_event and find the associated FolderWatchers to notify
         SmallString<1024> bufferString;
         for (const char* iterator = actuallyRead.data();                  //
              iterator < actuallyRead.data() + actuallyRead.sizeInBytes(); //
              iterator += sizeof(*event) + event->len)
         {
             event = reinterpret_cast<const struct inotify_event*>(iterator);
-            for (const FolderWatcher* entry = watchers.front; entry != nullptr; entry = entry->next)
+            if (event->mask & IN_Q_OVERFLOW)
             {
-                size_t foundIndex;
-                // Check if current FolderWatcher has a watcher matching the one from current event
-                if (entry->internal.get().notifyHandles.contains(FolderWatcherInternal::Pair{event->wd, 0},
-                                                                 &foundIndex))
+                // Kernel queue overflowed: all inotify watchers could have lost some events and must be rescanned
+                setOverflow(LinuxBackend::Inotify);
+                continue;
+            }
+            if (event->mask & IN_IGNORED)
+            {
+                // Watch has been removed by kernel (directory deleted) and its descriptor could be later re-used
+                for (FolderWatcher* entry = self->watchers.front; entry != nullptr; entry = entry->next)
                 {
-                    (void)notifySingleEvent(event, prevEvent, entry, foundIndex, bufferString);
-                    prevEvent = event;
-                    break;
+                    (void)entry->internal.get().notifyHandles.removeAll(
+                        [event](FolderWatcherInternal::Pair pair) { return pair.notifyID == event->wd; });
                 }
+                continue;
             }
+            // All FolderWatchers sharing the watch descriptor get notified (overlapping recursive watches)
+            for (FolderWatcher* entry = findWatcher(event->wd, nullptr); entry != nullptr;
+                 entry                = findWatcher(event->wd, entry))
+            {
+                size_t foundIndex;
+                (void)entry->internal.get().notifyHandles.contains(FolderWatcherInternal::Pair{event->wd, 0},
+                                                                   &foundIndex);
+                (void)notifySingleEvent(event, prevEvent, *entry, foundIndex, bufferString);
+            }
+            prevEvent = event;
         }
     }
 
-    [[nodiscard]] static Result notifySingleEvent(const struct inotify_event* event,
-                                                  const struct inotify_event* prevEvent, const FolderWatcher* entry,
-                                                  size_t foundIndex, String& bufferString)
+    [[nodiscard]] Result notifySingleEvent(const struct inotify_event* event, const struct inotify_event* prevEvent,
+                                           FolderWatcher& entry, size_t foundIndex, String& bufferString)
     {
         Notification notification;
 
-        notification.basePath = entry->path.view();
+        notification.basePath = entry.path.view();
 
         // 1. Compute relative Path
-        if (foundIndex == 0)
+        const StringView relativeDirectory = getRelativeDirectory(entry.internal.get(), foundIndex);
+        const StringView relativeName({event->name, event->len > 0 ? ::strlen(event->name) : 0}, true,
+                                      StringEncoding::Utf8);
+        SC_TRY(joinRelativePath(relativeDirectory, relativeName, bufferString, notification.relativePath));
+
+        // 2. Compute event Type
+        if (event->mask & (IN_ATTRIB | IN_MODIFY))
         {
-            // Something changed in the original root folder being watched
-            notification.relativePath = StringView({event->name, ::strlen(event->name)}, true, StringEncoding::Utf8);
+            notification.operation = Operation::Modified;
         }
-        else
+        if (event->mask & ~(IN_ATTRIB | IN_MODIFY))
         {
-            // Something changed in any of the sub folders of the original root folder being watched
-            const FolderWatcherInternal& internal = entry->internal.get();
-            const char* dirStart = internal.relativePaths.data() + internal.notifyHandles[foundIndex].nameOffset;
+            notification.operation = Operation::AddRemoveRename;
+        }
 
-            const StringView relativeDirectory({dirStart, ::strlen(dirStart)}, true, StringEncoding::Utf8);
-            const StringView relativeName({event->name, ::strlen(event->name)}, true, StringEncoding::Utf8);
+        // 3. Try to coalesce Modified after AddRemoveRename for consistency with the other backends
+        // I'm not really sure that Modified is consistently pushed after AddRemoveRename from Linux Kernel.
+        if (not entry.notifyBatchCallback.isValid() and notification.operation == Operation::Modified and
+            prevEvent != nullptr and (prevEvent->wd == event->wd))
+        {
+            return Result(false);
+        }
+        return notifyChange(entry, notification);
+    }
 
+    [[nodiscard]] static Result joinRelativePath(StringView relativeDirectory, StringView relativeName,
+                                                 String& bufferString, StringView& relativePath)
+    {
+        if (relativeDirectory.isEmpty() or relativeName.isEmpty())
+        {
+            // Something changed in the original root folder being watched (or in a sub folder itself)
+            relativePath = relativeDirectory.isEmpty() ? relativeName : relativeDirectory;
+        }
+        else
+        {
+            // Something changed in any of the sub folders of the original root folder being watched
             StringConverter converter(bufferString, StringConverter::Clear);
             SC_TRY(converter.appendNullTerminated(relativeDirectory));
             SC_TRY(converter.appendNullTerminated("/"));
             SC_TRY(converter.appendNullTerminated(relativeName));
-            notification.relativePath = bufferString.view();
+            relativePath = bufferString.view();
         }
+        return Result(true);
+    }
 
-        // 2. Compute event Type
-        if (event->mask & (IN_ATTRIB | IN_MODIFY))
+    /// @brief Coalesces the change in the batch or directly invokes user callback with the notification
+    [[nodiscard]] Result notifyChange(FolderWatcher& entry, const Notification& notification)
+    {
+        if (entry.notifyBatchCallback.isValid())
         {
-            // Try to coalesce Modified after AddRemoveRename for consistency with the other backends
-            // I'm not really sure that Modified is consistently pushed after AddRemoveRename from Linux Kernel.
-            if (prevEvent != nullptr and (prevEvent->wd == event->wd))
+            SC_TRY(entry.internal.get().changes.add(notification.relativePath, notification.operation));
+            if (batchDeadline == 0)
             {
-                return Result(false);
+                batchDeadline = Time::Monotonic::now().getMonotonicMilliseconds() + self->batchWindow.ms;
             }
-            notification.operation = Operation::Modified;
+            return Result(true);
         }
-        if (event->mask & ~(IN_ATTRIB | IN_MODIFY))
+        entry.notifyCallback(notification);
+        return Result(true);
+    }
+
+    /// @brief Rescans watchers that lost events, notifying the ones that are not using notifyBatchCallback
+    void notifyOverflows()
+    {
+        FolderWatcher* next = nullptr;
+        for (FolderWatcher* entry = self->watchers.front; entry != nullptr; entry = next)
         {
-            notification.operation = Operation::AddRemoveRename;
+            next = entry->next;
+
+            FolderWatcherInternal::Changes& changes = entry->internal.get().changes;
+            if (not changes.overflow or changes.rescanned)
+                continue; // Overflow of batch watchers is kept until delivery, but they must be rescanned once
+            if (getLinuxBackend(*entry) == LinuxBackend::Inotify)
+            {
+                (void)rescan(*entry); // Filesystem marks of fanotify don't need to be re-established
+            }
+            changes.rescanned = true;
+            if (entry->notifyBatchCallback.isValid())
+            {
+                if (batchDeadline == 0)
+                {
+                    batchDeadline = Time::Monotonic::now().getMonotonicMilliseconds() + self->batchWindow.ms;
+                }
+            }
+            else
+            {
+                changes.overflow  = false;
+                changes.rescanned = false;
+                // An empty relative path tells that anything inside the watched folder could have changed
+                Notification notification;
+                notification.basePath  = entry->path.view();
+                notification.operation = Operation::AddRemoveRename;
+                entry->notifyCallback(notification);
+            }
         }
+    }
 
-        // 3. Finally invoke user callback with the notification
-        entry->notifyCallback(notification);
-        return Result(true);
+    /// @brief Delivers all coalesced changes to FolderWatcher::notifyBatchCallback
+    void notifyBatches()
+    {
+        batchDeadline = 0;
+        FolderWatcher* next = nullptr;
+        for (FolderWatcher* entry = self->watchers.front; entry != nullptr; entry = next)
+        {
+            next = entry->next;
+            if (not entry->notifyBatchCallback.isValid() or entry->internal.get().changes.isEmpty())
+                continue;
+            // Changes are moved out, so that the callback is free to stop (or re-start) watching
+            FolderWatcherInternal::Changes changes = move(entry->internal.get().changes);
+            entry->internal.get().changes.clear();
+
+            batchNotifications.clear();
+            bool failed = false;
+            for (const FolderWatcherInternal::Changes::Change& change : changes.changes)
+            {
+                Notification notification;
+                notification.basePath     = entry->path.view();
+                notification.relativePath = changes.getPath(change);
+                notification.operation    = change.operation;
+                failed                    = failed or not batchNotifications.push_back(notification);
+            }
+            ChangeSet changeSet;
+            changeSet.basePath      = entry->path.view();
+            changeSet.notifications = batchNotifications.toSpanConst();
+            changeSet.overflow      = changes.overflow or failed;
+            entry->notifyBatchCallback(changeSet);
+        }
     }
 };
 
@@ -246,7 +246,7 @@ struct SC::FileSystemWatcher::Internal
             case FILE_ACTION_MODIFIED: notification.operation = Operation::Modified; break;
             default: notification.operation = Operation::AddRemoveRename; break;
             }
-            entry.notifyCallback(notification);
+            entry.notify(notification);
             if (not event->NextEntryOffset)
                 break;
             *reinterpret_cast<uint8_t**>(&event) += event->NextEntryOffset;
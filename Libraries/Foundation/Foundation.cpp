@@ -6,6 +6,7 @@
 #include "../Foundation/Internal/Globals.inl"
 #include "../Foundation/Internal/Limits.inl"
 #include "../Foundation/Internal/Memory.inl"
+#include "../Foundation/Internal/SlabAllocator.inl"
 #include "../Foundation/Internal/VirtualMemory.inl"
 
 #if not SC_COMPILER_ENABLE_STD_CPP
@@ -31,6 +31,9 @@ struct SC::GlobalSettings
 /// Example (Virtual Allocator):
 /// \snippet Tests/Libraries/Foundation/GlobalsTest.cpp GlobalsSnippetVirtual
 ///
+/// Example (Arena Allocator):
+/// \snippet Tests/Libraries/Foundation/GlobalsTest.cpp GlobalsSnippetArena
+///
 /// Example (Memory dump):
 /// \snippet Tests/Libraries/Containers/GlobalsContainerTest.cpp GlobalContainerVirtualMemoryDumpSnippet
 struct SC::Globals
@@ -0,0 +1,739 @@
+// Copyright (c) Stefano Cristiano
+// SPDX-License-Identifier: MIT
+#include "../LibC.h" // memcpy
+#include "../VirtualMemory.h"
+#if _MSC_VER
+#include <intrin.h>
+#endif
+
+//------------------------------------------------------------------------------------------------------------------
+// SlabAllocator
+//------------------------------------------------------------------------------------------------------------------
+struct SC::SlabAllocator::ThreadCache
+{
+    void*  ownerTag;                  // Identifies the thread owning this cache (nullptr if it's not owned)
+    Slab*  available[NumClasses];     // Slabs with free blocks (the first one is where blocks are taken from)
+    Slab*  full[NumClasses];          // Slabs with no free blocks left when they've been last checked
+    size_t remotePending[NumClasses]; // Hint of blocks released by other threads to slabs of this cache
+};
+
+struct SC::SlabAllocator::Slab
+{
+    ThreadCache* owner;
+    Slab*        prev;
+    Slab*        next;
+    void*        localFree;  // Intrusive list of blocks released by the owner thread
+    void*        remoteFree; // Intrusive lock-free list of blocks released by other threads
+    uint32_t     blockBytes;
+    uint32_t     classIndex;
+    uint32_t     numBlocks;
+    uint32_t     numCarved; // Blocks past this index have never been handed out
+    uint32_t     numUsed;   // Blocks handed out (including the ones in remoteFree)
+    bool         isFull;
+
+    static constexpr size_t BlocksOffset = 128;
+
+    char* getBlocks() { return reinterpret_cast<char*>(this) + BlocksOffset; }
+};
+
+struct SC::SlabAllocator::LargeHeader
+{
+    VirtualMemory virtualMemory;
+    LargeHeader*  prev;
+    LargeHeader*  next;
+    size_t        numBytes;
+    size_t        alignment; // Requested alignment (kept when reallocating)
+
+    static constexpr size_t HeaderSize = 64; // Placed right before the (aligned) allocation
+
+    char* getMemory() { return reinterpret_cast<char*>(this) + HeaderSize; }
+
+    // Bytes from the start of the reservation to the end of the allocation
+    size_t getEndOffset(size_t bytes)
+    {
+        return static_cast<size_t>(getMemory() - static_cast<char*>(virtualMemory.memory)) + bytes;
+    }
+
+    static LargeHeader* fromMemory(void* memory)
+    {
+        return reinterpret_cast<LargeHeader*>(static_cast<char*>(memory) - HeaderSize);
+    }
+};
+
+struct SC::SlabAllocator::Internal
+{
+    static_assert(sizeof(Slab) <= Slab::BlocksOffset, "Slab::BlocksOffset");
+    static_assert(sizeof(LargeHeader) <= LargeHeader::HeaderSize, "LargeHeader::HeaderSize");
+    static_assert(sizeof(ThreadCache) * (MaxThreads + 1) <= SlabBytes, "ThreadCache must fit first slab");
+    static_assert((MinClassBytes << (NumClasses - 1)) == MaxClassBytes, "NumClasses");
+
+    // Minimal set of atomic operations, to avoid depending on the Threading library
+#if _MSC_VER
+    static void* exchange(void** target, void* value) { return _InterlockedExchangePointer(target, value); }
+    static void* load(void* const* target)
+    {
+        return _InterlockedCompareExchangePointer(const_cast<void**>(target), nullptr, nullptr);
+    }
+    static void store(void** target, void* value) { (void)_InterlockedExchangePointer(target, value); }
+    static bool compareExchange(void** target, void*& expected, void* desired)
+    {
+        void* previous = _InterlockedCompareExchangePointer(target, desired, expected);
+        const bool res = previous == expected;
+        expected       = previous;
+        return res;
+    }
+#if _WIN64
+    static size_t fetchAdd(size_t& target, size_t value)
+    {
+        return static_cast<size_t>(_InterlockedExchangeAdd64(reinterpret_cast<volatile __int64*>(&target),
+                                                             static_cast<__int64>(value)));
+    }
+#else
+    static size_t fetchAdd(size_t& target, size_t value)
+    {
+        return static_cast<size_t>(
+            _InterlockedExchangeAdd(reinterpret_cast<volatile long*>(&target), static_cast<long>(value)));
+    }
+#endif
+    static size_t loadSize(size_t& target) { return fetchAdd(target, 0); }
+    static size_t exchangeSize(size_t& target, size_t value)
+    {
+        return reinterpret_cast<size_t>(exchange(reinterpret_cast<void**>(&target), reinterpret_cast<void*>(value)));
+    }
+    static int32_t exchange32(int32_t& target, int32_t value)
+    {
+        return _InterlockedExchange(reinterpret_cast<volatile long*>(&target), value);
+    }
+    static int32_t load32(int32_t& target)
+    {
+        return _InterlockedCompareExchange(reinterpret_cast<volatile long*>(&target), 0, 0);
+    }
+    static uint64_t increment64(uint64_t& target)
+    {
+        return static_cast<uint64_t>(_InterlockedIncrement64(reinterpret_cast<volatile __int64*>(&target)));
+    }
+#else
+    static void* exchange(void** target, void* value) { return __atomic_exchange_n(target, value, __ATOMIC_ACQ_REL); }
+    static void* load(void* const* target) { return __atomic_load_n(target, __ATOMIC_ACQUIRE); }
+    static void  store(void** target, void* value) { __atomic_store_n(target, value, __ATOMIC_RELEASE); }
+    static bool  compareExchange(void** target, void*& expected, void* desired)
+    {
+        return __atomic_compare_exchange_n(target, &expected, desired, true, __ATOMIC_RELEASE, __ATOMIC_RELAXED);
+    }
+    static size_t fetchAdd(size_t& target, size_t value)
+    {
+        return __atomic_fetch_add(&target, value, __ATOMIC_RELAXED);
+    }
+    static size_t loadSize(size_t& target) { return __atomic_load_n(&target, __ATOMIC_ACQUIRE); }
+    static size_t exchangeSize(size_t& target, size_t value)
+    {
+        return __atomic_exchange_n(&target, value, __ATOMIC_ACQ_REL);
+    }
+    static int32_t exchange32(int32_t& target, int32_t value)
+    {
+        return __atomic_exchange_n(&target, value, __ATOMIC_ACQ_REL);
+    }
+    static int32_t load32(int32_t& target) { return __atomic_load_n(&target, __ATOMIC_RELAXED); }
+    static uint64_t increment64(uint64_t& target) { return __atomic_add_fetch(&target, 1, __ATOMIC_RELAXED); }
+#endif
+
+    // Hints the CPU that we're busy waiting, releasing resources to the sibling hyper-thread
+    static void pause()
+    {
+#if _MSC_VER
+#if defined(_M_ARM64) || defined(_M_ARM64EC) || defined(_M_ARM)
+        __yield();
+#else
+        _mm_pause();
+#endif
+#elif defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+        __asm__ __volatile__("yield");
+#endif
+    }
+
+    struct SpinLock
+    {
+        int32_t& value;
+        SpinLock(int32_t& value) : value(value)
+        {
+            // Spin on a plain load, to avoid bouncing the cache line between cores with exchanges
+            while (exchange32(value, 1) != 0)
+            {
+                do
+                {
+                    pause();
+                } while (load32(value) != 0);
+            }
+        }
+        ~SpinLock() { (void)exchange32(value, 0); }
+    };
+
+    // Allows a thread to use a few SlabAllocator at the same time without going through the spin lock
+    static constexpr size_t NumCachedAllocators = 4;
+
+    struct ThreadLocalState
+    {
+        struct Entry
+        {
+            uint64_t     identifier; // SlabAllocator::identifier of the allocator owning cache
+            ThreadCache* cache;
+        };
+        Entry entries[NumCachedAllocators]; // Most recently used first
+
+        ThreadCache* find(uint64_t identifier)
+        {
+            for (size_t idx = 0; idx < NumCachedAllocators; ++idx)
+            {
+                if (entries[idx].identifier == identifier)
+                {
+                    const Entry found = entries[idx];
+                    for (; idx > 0; --idx)
+                    {
+                        entries[idx] = entries[idx - 1];
+                    }
+                    entries[0] = found;
+                    return found.cache;
+                }
+            }
+            return nullptr;
+        }
+
+        void insert(uint64_t identifier, ThreadCache* cache)
+        {
+            // Evicted allocator will find its cache again (through the owner tag) on next use
+            for (size_t idx = NumCachedAllocators - 1; idx > 0; --idx)
+            {
+                entries[idx] = entries[idx - 1];
+            }
+            entries[0] = {identifier, cache};
+        }
+
+        void remove(uint64_t identifier)
+        {
+            for (Entry& entry : entries)
+            {
+                if (entry.identifier == identifier)
+                {
+                    entry = {0, nullptr};
+                }
+            }
+        }
+
+        // Hands caches of the exiting thread over to other threads, for all allocators (even the evicted ones)
+        ~ThreadLocalState()
+        {
+            for (Entry& entry : entries)
+            {
+                entry = {0, nullptr};
+            }
+            SpinLock registryLock(getRegistryLock());
+            for (SlabAllocator* it = getRegistry(); it != nullptr; it = it->nextAllocator)
+            {
+                SpinLock lock(it->spinLock);
+                for (size_t idx = 0; it->caches != nullptr and idx < MaxThreads; ++idx)
+                {
+                    if (getOwnerTag(it->caches[idx]) == this)
+                    {
+                        setOwnerTag(it->caches[idx], nullptr);
+                    }
+                }
+            }
+        }
+    };
+
+    // List of live allocators (protected by its registry lock)
+    static SlabAllocator*& getRegistry()
+    {
+        static SlabAllocator* registry = nullptr;
+        return registry;
+    }
+
+    static int32_t& getRegistryLock()
+    {
+        static int32_t registryLock = 0;
+        return registryLock;
+    }
+
+    static ThreadLocalState& getThreadLocalState()
+    {
+        static thread_local ThreadLocalState state = {};
+        return state;
+    }
+
+    // Address of the thread local state is unique for each thread
+    static const void* getCurrentThreadTag() { return &getThreadLocalState(); }
+
+    static const void* getOwnerTag(ThreadCache& cache) { return load(&cache.ownerTag); }
+    static void setOwnerTag(ThreadCache& cache, const void* tag) { store(&cache.ownerTag, const_cast<void*>(tag)); }
+
+    static size_t getClassIndex(size_t numBytes)
+    {
+        size_t classIndex = 0;
+        while ((MinClassBytes << classIndex) < numBytes)
+        {
+            classIndex++;
+        }
+        return classIndex;
+    }
+
+    static bool isSlabMemory(const SlabAllocator& self, const void* memory)
+    {
+        const char* ptr = static_cast<const char*>(memory);
+        return self.slabsStart != nullptr and ptr >= self.slabsStart and ptr < self.slabsStart + self.maxSlabsBytes;
+    }
+
+    static Slab* getSlab(const SlabAllocator& self, const void* memory)
+    {
+        const size_t offset = static_cast<size_t>(static_cast<const char*>(memory) - self.slabsStart);
+        return reinterpret_cast<Slab*>(self.slabsStart + (offset / SlabBytes) * SlabBytes);
+    }
+
+    // Intrusive doubly linked list of slabs
+    static void pushFront(Slab*& list, Slab& slab)
+    {
+        slab.prev = nullptr;
+        slab.next = list;
+        if (list != nullptr)
+            list->prev = &slab;
+        list = &slab;
+    }
+
+    static void unlink(Slab*& list, Slab& slab)
+    {
+        if (slab.prev != nullptr)
+            slab.prev->next = slab.next;
+        else
+            list = slab.next;
+        if (slab.next != nullptr)
+            slab.next->prev = slab.prev;
+        slab.prev = nullptr;
+        slab.next = nullptr;
+    }
+
+    // Must be called with spinLock held
+    static bool initialize(SlabAllocator& self)
+    {
+        if (not self.virtualMemory.reserve(self.maxSlabsBytes + SlabBytes))
+            return false;
+        const uintptr_t start = reinterpret_cast<uintptr_t>(self.virtualMemory.memory);
+        self.slabsStart       = reinterpret_cast<char*>((start + SlabBytes - 1) & ~uintptr_t(SlabBytes - 1));
+        // First slab holds the thread caches (zero initialized by the OS)
+        if (not commitSlabs(self, 1))
+        {
+            self.slabsStart = nullptr;
+            (void)self.virtualMemory.release();
+            return false;
+        }
+        self.caches = reinterpret_cast<ThreadCache*>(self.slabsStart);
+        // Shared cache is marked with a tag that can't belong to any thread, so it's never adopted
+        setOwnerTag(self.caches[MaxThreads], &self);
+        return true;
+    }
+
+    // Must be called with spinLock held
+    static bool commitSlabs(SlabAllocator& self, size_t numSlabs)
+    {
+        if (numSlabs * SlabBytes > self.maxSlabsBytes)
+            return false;
+        const size_t alignmentBytes =
+            static_cast<size_t>(self.slabsStart - static_cast<char*>(self.virtualMemory.memory));
+        if (not self.virtualMemory.commit(alignmentBytes + numSlabs * SlabBytes))
+            return false;
+        (void)fetchAdd(self.statistics.numBytesCommitted, (numSlabs - self.numSlabs) * SlabBytes);
+        self.numSlabs = numSlabs;
+        return true;
+    }
+
+    static ThreadCache* getThreadCache(SlabAllocator& self)
+    {
+        ThreadLocalState& state  = getThreadLocalState();
+        ThreadCache*      cached = state.find(self.identifier);
+        if (cached != nullptr)
+            return cached;
+
+        SpinLock lock(self.spinLock);
+        if (self.caches == nullptr and not initialize(self))
+            return nullptr;
+        ThreadCache* found = nullptr;
+        for (size_t idx = 0; idx < MaxThreads; ++idx)
+        {
+            if (getOwnerTag(self.caches[idx]) == &state)
+            {
+                found = &self.caches[idx];
+                break;
+            }
+        }
+        for (size_t idx = 0; found == nullptr and idx < MaxThreads; ++idx)
+        {
+            if (getOwnerTag(self.caches[idx]) == nullptr)
+            {
+                found = &self.caches[idx];
+                setOwnerTag(*found, &state);
+            }
+        }
+        if (found == nullptr)
+        {
+            // Not remembered in thread local state, so that a cache released later by some other thread is adopted
+            return &self.caches[MaxThreads];
+        }
+        state.insert(self.identifier, found);
+        return found;
+    }
+
+    static Slab* acquireSlab(SlabAllocator& self, ThreadCache& cache, size_t classIndex)
+    {
+        Slab* slab;
+        {
+            SpinLock lock(self.spinLock);
+            slab = self.freeSlabs;
+            if (slab != nullptr)
+            {
+                self.freeSlabs = slab->next;
+            }
+            else
+            {
+                if (not commitSlabs(self, self.numSlabs + 1))
+                    return nullptr;
+                slab = reinterpret_cast<Slab*>(self.slabsStart + (self.numSlabs - 1) * SlabBytes);
+            }
+        }
+        slab->owner      = &cache;
+        slab->prev       = nullptr;
+        slab->next       = nullptr;
+        slab->localFree  = nullptr;
+        slab->remoteFree = nullptr;
+        slab->blockBytes = static_cast<uint32_t>(MinClassBytes << classIndex);
+        slab->classIndex = static_cast<uint32_t>(classIndex);
+        slab->numBlocks  = static_cast<uint32_t>((SlabBytes - Slab::BlocksOffset) / slab->blockBytes);
+        slab->numCarved  = 0;
+        slab->numUsed    = 0;
+        slab->isFull     = false;
+        return slab;
+    }
+
+    static void releaseSlab(SlabAllocator& self, Slab& slab)
+    {
+        SpinLock lock(self.spinLock);
+        slab.next      = self.freeSlabs;
+        self.freeSlabs = &slab;
+    }
+
+    // Moves all blocks released by other threads to the local free list of the slab, in a single batch
+    static uint32_t reclaimRemoteBlocks(Slab& slab)
+    {
+        if (load(&slab.remoteFree) == nullptr)
+            return 0;
+        void*    list      = exchange(&slab.remoteFree, nullptr);
+        void*    last      = list;
+        uint32_t numBlocks = 1;
+        while (*static_cast<void**>(last) != nullptr)
+        {
+            last = *static_cast<void**>(last);
+            numBlocks++;
+        }
+        *static_cast<void**>(last) = slab.localFree;
+        slab.localFree             = list;
+        slab.numUsed -= numBlocks;
+        return numBlocks;
+    }
+
+    static void* popBlock(Slab& slab)
+    {
+        void* block = slab.localFree;
+        if (block != nullptr)
+        {
+            slab.localFree = *static_cast<void**>(block);
+        }
+        else if (slab.numCarved < slab.numBlocks)
+        {
+            block = slab.getBlocks() + size_t(slab.numCarved) * slab.blockBytes;
+            slab.numCarved++;
+        }
+        else
+        {
+            return nullptr;
+        }
+        slab.numUsed++;
+        return block;
+    }
+
+    static void* allocateBlock(SlabAllocator& self, ThreadCache& cache, size_t classIndex)
+    {
+        for (;;)
+        {
+            Slab* slab = cache.available[classIndex];
+            if (slab == nullptr)
+            {
+                // Look for blocks released by other threads in full slabs only when some have been released
+                if (loadSize(cache.remotePending[classIndex]) > 0)
+                {
+                    (void)exchangeSize(cache.remotePending[classIndex], 0);
+                    Slab* it = cache.full[classIndex];
+                    while (it != nullptr)
+                    {
+                        Slab* next = it->next;
+                        if (reclaimRemoteBlocks(*it) > 0)
+                        {
+                            unlink(cache.full[classIndex], *it);
+                            it->isFull = false;
+                            pushFront(cache.available[classIndex], *it);
+                        }
+                        it = next;
+                    }
+                }
+                slab = cache.available[classIndex];
+                if (slab == nullptr)
+                {
+                    slab = acquireSlab(self, cache, classIndex);
+                    if (slab == nullptr)
+                        return nullptr;
+                    pushFront(cache.available[classIndex], *slab);
+                }
+            }
+            void* block = popBlock(*slab);
+            if (block != nullptr)
+                return block;
+            if (reclaimRemoteBlocks(*slab) == 0)
+            {
+                unlink(cache.available[classIndex], *slab);
+                slab->isFull = true;
+                pushFront(cache.full[classIndex], *slab);
+            }
+        }
+    }
+
+    static void releaseBlock(SlabAllocator& self, Slab& slab, void* block)
+    {
+        ThreadCache& cache = *slab.owner;
+        if (getOwnerTag(cache) == getCurrentThreadTag())
+        {
+            *static_cast<void**>(block) = slab.localFree;
+            slab.localFree              = block;
+            slab.numUsed--;
+            if (slab.isFull)
+            {
+                unlink(cache.full[slab.classIndex], slab);
+                slab.isFull = false;
+                pushFront(cache.available[slab.classIndex], slab);
+            }
+            else if (slab.numUsed == 0 and cache.available[slab.classIndex] != &slab)
+            {
+                // Give the empty slab back, so that it can be reused for any size class by any thread
+                unlink(cache.available[slab.classIndex], slab);
+                releaseSlab(self, slab);
+            }
+        }
+        else
+        {
+            void* head = load(&slab.remoteFree);
+            do
+            {
+                *static_cast<void**>(block) = head;
+            } while (not compareExchange(&slab.remoteFree, head, block));
+            (void)fetchAdd(cache.remotePending[slab.classIndex], 1);
+        }
+    }
+
+    static void* allocateLarge(SlabAllocator& self, size_t numBytes, size_t alignment)
+    {
+        // Reservation is page aligned, so the aligned allocation (preceded by the header) starts at most alignment
+        // bytes (that is always at least HeaderSize) past its beginning
+        VirtualMemory largeMemory;
+        if (not largeMemory.reserve(alignment + numBytes))
+            return nullptr;
+        const uintptr_t start   = reinterpret_cast<uintptr_t>(largeMemory.memory) + LargeHeader::HeaderSize;
+        const uintptr_t aligned = (start + alignment - 1) & ~uintptr_t(alignment - 1);
+
+        LargeHeader* header = LargeHeader::fromMemory(reinterpret_cast<void*>(aligned));
+        const size_t offset = static_cast<size_t>(aligned - reinterpret_cast<uintptr_t>(largeMemory.memory));
+        if (not largeMemory.commit(offset + numBytes))
+        {
+            (void)largeMemory.release();
+            return nullptr;
+        }
+        header->virtualMemory = largeMemory;
+        header->numBytes      = numBytes;
+        header->alignment     = alignment;
+        header->prev          = nullptr;
+        {
+            SpinLock lock(self.spinLock);
+            header->next = self.largeList;
+            if (self.largeList != nullptr)
+                self.largeList->prev = header;
+            self.largeList = header;
+        }
+        (void)fetchAdd(self.statistics.numBytesUsed, numBytes);
+        (void)fetchAdd(self.statistics.numBytesCommitted, largeMemory.committedBytes);
+        return header->getMemory();
+    }
+
+    static void* allocate(SlabAllocator& self, size_t numBytes, size_t alignment)
+    {
+        if ((alignment & (alignment - 1)) != 0)
+            return nullptr; // Alignment must be a power of two
+        const size_t classBytes = max(numBytes, alignment);
+        if (classBytes > MaxClassBytes or alignment > Slab::BlocksOffset)
+        {
+            return allocateLarge(self, numBytes, max(alignment, size_t(LargeHeader::HeaderSize)));
+        }
+        ThreadCache* cache = getThreadCache(self);
+        if (cache == nullptr)
+            return nullptr;
+        const size_t classIndex = getClassIndex(classBytes);
+        void*        block;
+        if (cache == &self.caches[MaxThreads])
+        {
+            // Blocks of the shared cache are always released through the lock-free list of their slab (as its owner
+            // tag never matches calling thread), so only allocation needs the lock
+            SpinLock lock(self.sharedLock);
+            block = allocateBlock(self, *cache, classIndex);
+        }
+        else
+        {
+            block = allocateBlock(self, *cache, classIndex);
+        }
+        if (block != nullptr)
+        {
+            (void)fetchAdd(self.statistics.numBytesUsed, MinClassBytes << classIndex);
+        }
+        return block;
+    }
+
+    static void release(SlabAllocator& self, void* memory)
+    {
+        if (isSlabMemory(self, memory))
+        {
+            Slab* slab = getSlab(self, memory);
+            (void)fetchAdd(self.statistics.numBytesUsed, size_t(0) - slab->blockBytes);
+            releaseBlock(self, *slab, memory);
+        }
+        else
+        {
+            releaseLarge(self, LargeHeader::fromMemory(memory));
+        }
+    }
+
+    static void releaseLarge(SlabAllocator& self, LargeHeader* header)
+    {
+        {
+            SpinLock lock(self.spinLock);
+            if (header->prev != nullptr)
+                header->prev->next = header->next;
+            else
+                self.largeList = header->next;
+            if (header->next != nullptr)
+                header->next->prev = header->prev;
+        }
+        VirtualMemory largeMemory = header->virtualMemory; // Copy it, as it lives inside the memory being released
+        (void)fetchAdd(self.statistics.numBytesUsed, size_t(0) - header->numBytes);
+        (void)fetchAdd(self.statistics.numBytesCommitted, size_t(0) - largeMemory.committedBytes);
+        (void)largeMemory.release();
+    }
+};
+
+SC::SlabAllocator::SlabAllocator(size_t maxSlabsBytes)
+    : maxSlabsBytes(VirtualMemory::roundUpToPageSize(maxSlabsBytes) / SlabBytes * SlabBytes)
+{
+    static uint64_t numAllocators = 0;
+    identifier                    = Internal::increment64(numAllocators);
+    atomicStatistics              = true;
+
+    Internal::SpinLock registryLock(Internal::getRegistryLock());
+    SlabAllocator*&    registry = Internal::getRegistry();
+    nextAllocator               = registry;
+    if (registry != nullptr)
+        registry->prevAllocator = this;
+    registry = this;
+}
+
+SC::SlabAllocator::~SlabAllocator()
+{
+    {
+        Internal::SpinLock registryLock(Internal::getRegistryLock());
+        if (prevAllocator != nullptr)
+            prevAllocator->nextAllocator = nextAllocator;
+        else
+            Internal::getRegistry() = nextAllocator;
+        if (nextAllocator != nullptr)
+            nextAllocator->prevAllocator = prevAllocator;
+    }
+    while (largeList != nullptr)
+    {
+        Internal::releaseLarge(*this, largeList);
+    }
+    (void)virtualMemory.release();
+    Internal::getThreadLocalState().remove(identifier);
+}
+
+void SC::SlabAllocator::releaseThreadCache()
+{
+    Internal::ThreadLocalState& state = Internal::getThreadLocalState();
+    ThreadCache*                cache = state.find(identifier);
+    if (cache != nullptr)
+    {
+        Internal::SpinLock lock(spinLock);
+        Internal::setOwnerTag(*cache, nullptr);
+        state.remove(identifier);
+    }
+}
+
+void* SC::SlabAllocator::allocateImpl(const void*, size_t numBytes, size_t alignment)
+{
+    (void)Internal::fetchAdd(statistics.numAllocate, 1);
+    return Internal::allocate(*this, numBytes, alignment);
+}
+
+void* SC::SlabAllocator::reallocateImpl(void* allocatedMemory, size_t numBytes)
+{
+    (void)Internal::fetchAdd(statistics.numReallocate, 1);
+    if (allocatedMemory == nullptr)
+        return Internal::allocate(*this, numBytes, alignof(uint64_t));
+
+    size_t oldBytes;
+    size_t alignment = alignof(uint64_t);
+    if (Internal::isSlabMemory(*this, allocatedMemory))
+    {
+        oldBytes = Internal::getSlab(*this, allocatedMemory)->blockBytes;
+        // Keep the same block if the new size still belongs to its size class
+        if (numBytes <= oldBytes and (numBytes > oldBytes / 2 or oldBytes == MinClassBytes))
+            return allocatedMemory;
+    }
+    else
+    {
+        LargeHeader* header = LargeHeader::fromMemory(allocatedMemory);
+        oldBytes            = header->numBytes;
+        if (header->alignment > LargeHeader::HeaderSize)
+            alignment = header->alignment;
+        if (numBytes > MaxClassBytes)
+        {
+            // Grow or shrink in place if the reserved address space allows it
+            const size_t oldCommitted = header->virtualMemory.committedBytes;
+            if (header->getEndOffset(numBytes) <= header->virtualMemory.reservedBytes and
+                header->virtualMemory.commit(header->getEndOffset(numBytes)))
+            {
+                (void)Internal::fetchAdd(statistics.numBytesUsed, numBytes - oldBytes);
+                (void)Internal::fetchAdd(statistics.numBytesCommitted,
+                                         header->virtualMemory.committedBytes - oldCommitted);
+                header->numBytes = numBytes;
+                return allocatedMemory;
+            }
+        }
+    }
+    void* newMemory = Internal::allocate(*this, numBytes, alignment);
+    if (newMemory != nullptr)
+    {
+        ::memcpy(newMemory, allocatedMemory, min(oldBytes, numBytes));
+        Internal::release(*this, allocatedMemory);
+    }
+    return newMemory;
+}
+
+void SC::SlabAllocator::releaseImpl(void* allocatedMemory)
+{
+    if (allocatedMemory == nullptr)
+        return;
+    (void)Internal::fetchAdd(statistics.numRelease, 1);
+    Internal::release(*this, allocatedMemory);
+}
@@ -1,6 +1,7 @@
 // Copyright (c) Stefano Cristiano
 // SPDX-License-Identifier: MIT
 #include "../VirtualMemory.h"
+#include "../LibC.h" // memcpy
 #if SC_PLATFORM_WINDOWS
 #include <windows.h>
 #else
@@ -148,3 +149,225 @@ void SC::VirtualAllocator::syncFixedAllocator()
     FixedAllocator::memory        = virtualMemory.memory;
     FixedAllocator::capacityBytes = virtualMemory.committedBytes;
 }
+
+//------------------------------------------------------------------------------------------------------------------
+// ArenaAllocator
+//------------------------------------------------------------------------------------------------------------------
+struct SC::ArenaAllocator::Block
+{
+    VirtualMemory virtualMemory;
+
+    Block* next     = nullptr;
+    size_t position = 0; // Bytes used in this block, saved when moving to next block
+
+    // Allocations start right after the Block header
+    static constexpr size_t HeaderSize = (sizeof(VirtualMemory) + sizeof(Block*) + sizeof(size_t) + 15) & ~size_t(15);
+
+    char*  getMemory() { return static_cast<char*>(virtualMemory.memory) + HeaderSize; }
+    size_t getCapacity() const { return virtualMemory.reservedBytes - HeaderSize; }
+
+    static Block* create(size_t reserveBytes)
+    {
+        VirtualMemory virtualMemory;
+        if (not virtualMemory.reserve(HeaderSize + reserveBytes))
+            return nullptr;
+        if (not virtualMemory.commit(HeaderSize))
+        {
+            (void)virtualMemory.release();
+            return nullptr;
+        }
+        Block* block = static_cast<Block*>(virtualMemory.memory);
+        placementNew(*block);
+        block->virtualMemory = virtualMemory;
+        return block;
+    }
+
+    static void destroy(Block* block)
+    {
+        VirtualMemory virtualMemory = block->virtualMemory; // Copy it, as it lives inside the memory being released
+        (void)virtualMemory.release();
+    }
+};
+
+SC::ArenaAllocator::ArenaAllocator(void* memory, size_t capacityBytes)
+    : memory(static_cast<char*>(memory)), capacityBytes(capacityBytes)
+{}
+
+SC::ArenaAllocator::ArenaAllocator(size_t blockBytes) : blockBytes(blockBytes) {}
+
+SC::ArenaAllocator::~ArenaAllocator() { releaseBlocks(); }
+
+void SC::ArenaAllocator::reset()
+{
+    for (Block* block = firstBlock; block != nullptr; block = block->next)
+    {
+        block->position = 0;
+    }
+    if (firstBlock != nullptr)
+    {
+        currentBlock  = firstBlock;
+        memory        = firstBlock->getMemory();
+        capacityBytes = firstBlock->getCapacity();
+    }
+    position       = 0;
+    lastAllocation = nullptr;
+}
+
+void SC::ArenaAllocator::releaseBlocks()
+{
+    if (firstBlock == nullptr)
+    {
+        reset();
+        return;
+    }
+    Block* block = firstBlock;
+    while (block != nullptr)
+    {
+        Block* next = block->next;
+        Block::destroy(block);
+        block = next;
+    }
+    firstBlock     = nullptr;
+    currentBlock   = nullptr;
+    memory         = nullptr;
+    capacityBytes  = 0;
+    position       = 0;
+    lastAllocation = nullptr;
+}
+
+SC::size_t SC::ArenaAllocator::size() const
+{
+    size_t totalBytes = position;
+    for (Block* block = firstBlock; block != currentBlock; block = block->next)
+    {
+        totalBytes += block->position;
+    }
+    return totalBytes;
+}
+
+bool SC::ArenaAllocator::moveToNextBlock(size_t numBytes, size_t alignment)
+{
+    if (blockBytes == 0)
+        return false; // Fixed slice of memory can't grow
+
+    const size_t neededBytes = numBytes + alignment;
+    if (currentBlock != nullptr)
+    {
+        currentBlock->position = position;
+    }
+    // Reuse blocks kept after a reset, as long as they're large enough (smaller ones are skipped until next reset)
+    Block* block = currentBlock != nullptr ? currentBlock->next : firstBlock;
+    while (block != nullptr and block->getCapacity() < neededBytes)
+    {
+        block = block->next;
+    }
+    if (block == nullptr)
+    {
+        block = Block::create(max(blockBytes, neededBytes));
+        if (block == nullptr)
+            return false;
+        // Insert the new block right after the current one, so that skipped blocks can still be reused later
+        if (currentBlock == nullptr)
+        {
+            block->next = firstBlock;
+            firstBlock  = block;
+        }
+        else
+        {
+            block->next        = currentBlock->next;
+            currentBlock->next = block;
+        }
+    }
+    currentBlock   = block;
+    memory         = block->getMemory();
+    capacityBytes  = block->getCapacity();
+    position       = 0;
+    lastAllocation = nullptr; // It belongs to the previous block, so it can't be grown in place anymore
+    return true;
+}
+
+void* SC::ArenaAllocator::allocateImpl(const void* owner, size_t numBytes, size_t alignment)
+{
+    if (owner != nullptr and usedBytesAfter(owner) == 0)
+        return nullptr; // Owner doesn't belong to this arena
+    if (alignment == 0)
+        alignment = 1;
+
+    for (int attempt = 0; attempt < 2; ++attempt)
+    {
+        const uintptr_t start   = reinterpret_cast<uintptr_t>(memory) + position;
+        const uintptr_t aligned = (start + alignment - 1) & ~(uintptr_t(alignment) - 1);
+        const size_t    newEnd  = static_cast<size_t>(aligned - reinterpret_cast<uintptr_t>(memory)) + numBytes;
+        if (memory != nullptr and newEnd <= capacityBytes)
+        {
+            if (currentBlock == nullptr or currentBlock->virtualMemory.commit(Block::HeaderSize + newEnd))
+            {
+                position       = newEnd;
+                lastAllocation = reinterpret_cast<void*>(aligned);
+                return lastAllocation;
+            }
+        }
+        if (not moveToNextBlock(numBytes, alignment))
+            break;
+    }
+    return nullptr;
+}
+
+void* SC::ArenaAllocator::reallocateImpl(void* allocatedMemory, size_t numBytes)
+{
+    if (allocatedMemory == nullptr)
+        return allocateImpl(nullptr, numBytes, alignof(uint64_t));
+
+    char* allocatedBytes = static_cast<char*>(allocatedMemory);
+    if (allocatedMemory == lastAllocation and allocatedBytes >= memory and allocatedBytes <= memory + position)
+    {
+        // Grow or shrink in place the last allocation, if there is enough space left in current slice
+        const size_t newEnd = static_cast<size_t>(allocatedBytes - memory) + numBytes;
+        if (newEnd <= capacityBytes and
+            (currentBlock == nullptr or currentBlock->virtualMemory.commit(Block::HeaderSize + newEnd)))
+        {
+            position = newEnd;
+            return allocatedMemory;
+        }
+    }
+    // Size of the original allocation is unknown, but it can't extend past the used portion of its slice
+    const size_t availableBytes = usedBytesAfter(allocatedMemory);
+    if (availableBytes == 0)
+        return nullptr; // Not allocated by this arena
+
+    size_t alignment = 1;
+    for (size_t candidate = 16; candidate > 1; candidate /= 2)
+    {
+        if ((reinterpret_cast<uintptr_t>(allocatedMemory) & (candidate - 1)) == 0)
+        {
+            alignment = candidate;
+            break;
+        }
+    }
+    void* newMemory = allocateImpl(nullptr, numBytes, alignment);
+    if (newMemory != nullptr)
+    {
+        ::memcpy(newMemory, allocatedMemory, min(availableBytes, numBytes));
+    }
+    return newMemory;
+}
+
+void SC::ArenaAllocator::releaseImpl(void*) {}
+
+SC::size_t SC::ArenaAllocator::usedBytesAfter(const void* allocation) const
+{
+    const char* ptr = static_cast<const char*>(allocation);
+    if (memory != nullptr and ptr >= memory and ptr < memory + position)
+    {
+        return static_cast<size_t>(memory + position - ptr);
+    }
+    for (Block* block = firstBlock; block != nullptr and block != currentBlock; block = block->next)
+    {
+        const char* blockMemory = block->getMemory();
+        if (ptr >= blockMemory and ptr < blockMemory + block->position)
+        {
+            return static_cast<size_t>(blockMemory + block->position - ptr);
+        }
+    }
+    return 0;
+}
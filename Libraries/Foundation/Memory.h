@@ -40,6 +40,10 @@ struct SC::MemoryAllocator
         size_t numAllocate   = 0; ///< How many times MemoryAllocator::allocate has been called
         size_t numReallocate = 0; ///< How many times MemoryAllocator::reallocate has been called
         size_t numRelease    = 0; ///< How many times MemoryAllocator::release has been called
+
+        // Occupancy (numBytesUsed / numBytesCommitted) is tracked only by some allocators (like SC::SlabAllocator)
+        size_t numBytesUsed      = 0; ///< Bytes currently handed out to callers (including size class rounding)
+        size_t numBytesCommitted = 0; ///< Bytes of memory currently held by the allocator
     };
     Statistics statistics; ///< Holds statistics about how many allocations/release have been issued
 
@@ -62,7 +66,8 @@ struct SC::MemoryAllocator
     /// @return Raw pointer to allocated memory, to be freed with MemoryAllocator::release
     void* allocate(const void* owner, size_t numBytes, size_t alignment)
     {
-        statistics.numAllocate += 1;
+        if (not atomicStatistics)
+            statistics.numAllocate += 1;
         return allocateImpl(owner, numBytes, alignment);
     }
 
@@ -72,7 +77,8 @@ struct SC::MemoryAllocator
     /// @return A new pointer of memory with size numBytes, to be freed with MemoryAllocator::release
     void* reallocate(void* memory, size_t numBytes)
     {
-        statistics.numReallocate += 1;
+        if (not atomicStatistics)
+            statistics.numReallocate += 1;
         return reallocateImpl(memory, numBytes);
     }
 
@@ -80,7 +86,7 @@ struct SC::MemoryAllocator
     /// @param memory Memory to release / deallocate
     void release(void* memory)
     {
-        if (memory != nullptr)
+        if (memory != nullptr and not atomicStatistics)
         {
             statistics.numRelease += 1;
         }
@@ -101,6 +107,11 @@ struct SC::MemoryAllocator
     virtual void releaseImpl(void* memory) = 0;
 
     virtual ~MemoryAllocator() {}
+
+  protected:
+    // Set by allocators usable from multiple threads, that update numAllocate / numReallocate / numRelease on their
+    // own with atomic operations (as the non-atomic increments done here would race)
+    bool atomicStatistics = false;
 };
 
 /// @brief A MemoryAllocator implementation using a finite slice of memory
@@ -7,6 +7,8 @@ namespace SC
 {
 struct SC_COMPILER_EXPORT VirtualMemory;
 struct SC_COMPILER_EXPORT VirtualAllocator;
+struct SC_COMPILER_EXPORT ArenaAllocator;
+struct SC_COMPILER_EXPORT SlabAllocator;
 } // namespace SC
 //! @addtogroup group_foundation_utility
 //! @{
@@ -64,4 +66,118 @@ struct SC::VirtualAllocator : public FixedAllocator
     void syncFixedAllocator();
 };
 
+/// @brief A monotonic MemoryAllocator freeing all of its allocations at once with ArenaAllocator::reset.
+///
+/// Allocating just bumps a pointer and releasing a single allocation does nothing, as no per-allocation bookkeeping
+/// is kept. The arena can be a fixed slice of memory or a chain of VirtualMemory blocks, reserved when needed and
+/// committed one page at a time. @n
+/// It's meant to be pushed as Globals::ThreadLocal allocator for the lifetime of some temporary work (see
+/// SC::HttpServer::requestArena), so that SC::BufferTL, SC::VectorTL etc. never hit the system heap.
+/// @note Reallocating anything but the last allocation copies it to a new one, leaving the old one unused.
+///
+/// \snippet Tests/Libraries/Foundation/GlobalsTest.cpp GlobalsSnippetArena
+struct SC::ArenaAllocator : public MemoryAllocator
+{
+    /// @brief Creates an arena on a finite slice of memory, that will fail allocations when full
+    ArenaAllocator(void* memory, size_t capacityBytes);
+
+    /// @brief Creates an arena chaining VirtualMemory blocks, each one reserving blockBytes of address space
+    /// @note Allocations larger than blockBytes get a dedicated larger block
+    ArenaAllocator(size_t blockBytes);
+    ~ArenaAllocator();
+
+    ArenaAllocator(const ArenaAllocator&)            = delete;
+    ArenaAllocator& operator=(const ArenaAllocator&) = delete;
+
+    /// @brief Frees all allocations at once, keeping already committed memory and blocks for later reuse
+    void reset();
+
+    /// @brief Frees all allocations at once, giving back to the OS all VirtualMemory blocks
+    void releaseBlocks();
+
+    /// @brief Returns total number of bytes used by allocations (including alignment padding)
+    [[nodiscard]] size_t size() const;
+
+  protected:
+    struct Block;
+    Block* firstBlock   = nullptr; // Chain of VirtualMemory blocks (nullptr if using a fixed slice)
+    Block* currentBlock = nullptr; // Block containing current slice
+
+    char*  memory        = nullptr; // Start of current slice
+    size_t capacityBytes = 0;       // Reserved bytes of current slice
+    size_t position      = 0;       // Bytes used in current slice
+    size_t blockBytes    = 0;       // Address space to reserve for each new VirtualMemory block
+
+    void* lastAllocation = nullptr;
+
+    virtual void* allocateImpl(const void* owner, size_t numBytes, size_t alignment) override;
+    virtual void* reallocateImpl(void* memory, size_t numBytes) override;
+    virtual void  releaseImpl(void* memory) override;
+
+    [[nodiscard]] bool   moveToNextBlock(size_t numBytes, size_t alignment);
+    [[nodiscard]] size_t usedBytesAfter(const void* allocation) const;
+};
+
+/// @brief A thread-safe MemoryAllocator serving small allocations from per-thread slabs of fixed size blocks.
+///
+/// Allocations are rounded up to a power of two size class (from SlabAllocator::MinClassBytes to
+/// SlabAllocator::MaxClassBytes) and carved out of slabs, committed on demand from a single VirtualMemory
+/// reservation. @n
+/// Every thread gets its own cache of slabs, so that allocating and releasing from the same thread doesn't need any
+/// lock or atomic operation. Releasing a block owned by another thread pushes it on a lock-free list of its slab, that
+/// the owner thread reclaims in a single batch the next time it runs out of blocks of that size class. @n
+/// Larger allocations (or the ones asking for an alignment over 128 bytes) get a dedicated VirtualMemory
+/// reservation. @n
+/// Occupancy and fragmentation can be computed from MemoryAllocator::Statistics::numBytesUsed and
+/// MemoryAllocator::Statistics::numBytesCommitted.
+/// @note At most SlabAllocator::MaxThreads threads can own a cache at the same time, while additional threads
+/// allocate from a single shared cache, protected by a spin lock. A thread cache (with its slabs) is handed over to
+/// other threads when its thread exits or earlier, when calling SlabAllocator::releaseThreadCache.
+///
+/// \snippet Tests/Libraries/Foundation/SlabAllocatorTest.cpp SlabAllocatorSnippet
+struct SC::SlabAllocator : public MemoryAllocator
+{
+    static constexpr size_t SlabBytes     = 64 * 1024; ///< Size of a slab (containing blocks of the same size class)
+    static constexpr size_t MinClassBytes = 16;        ///< Block size of the smallest size class
+    static constexpr size_t MaxClassBytes = 16 * 1024; ///< Block size of the largest size class
+    static constexpr size_t NumClasses    = 11;        ///< Number of power of two size classes
+    static constexpr size_t MaxThreads    = 64;        ///< Maximum number of threads owning a cache (others share one)
+
+    /// @brief Creates the allocator, that will lazily reserve maxSlabsBytes of address space on first allocation
+    SlabAllocator(size_t maxSlabsBytes = 1024 * 1024 * 1024);
+    ~SlabAllocator();
+
+    SlabAllocator(const SlabAllocator&)            = delete;
+    SlabAllocator& operator=(const SlabAllocator&) = delete;
+
+    /// @brief Detaches calling thread from its cache, so that another thread can adopt it (together with its slabs).
+    /// @note This happens automatically when the thread exits, so it's needed only by long running threads that will
+    /// not allocate anymore from this allocator.
+    void releaseThreadCache();
+
+  protected:
+    struct Internal;
+    struct Slab;
+    struct ThreadCache;
+    struct LargeHeader;
+
+    VirtualMemory virtualMemory;
+    size_t        maxSlabsBytes;
+    char*         slabsStart = nullptr; // First slab address (aligned to SlabBytes)
+    size_t        numSlabs   = 0;       // Number of slabs committed so far
+    Slab*         freeSlabs  = nullptr; // Slabs returned by thread caches, available for any size class
+    LargeHeader*  largeList  = nullptr; // Allocations larger than MaxClassBytes
+    ThreadCache*  caches     = nullptr; // Array of MaxThreads caches + 1 shared cache (in the first slab)
+    uint64_t      identifier = 0;       // Unique value used to validate thread local cache lookups
+    int32_t       spinLock   = 0;
+    int32_t       sharedLock = 0; // Protects the shared cache, used by threads not finding a free cache
+
+    SlabAllocator* prevAllocator = nullptr; // List of live allocators, where exiting threads release their caches
+    SlabAllocator* nextAllocator = nullptr;
+
+    virtual void* allocateImpl(const void* owner, size_t numBytes, size_t alignment) override;
+    virtual void* reallocateImpl(void* memory, size_t numBytes) override;
+    virtual void  releaseImpl(void* memory) override;
+};
+
 //! @}
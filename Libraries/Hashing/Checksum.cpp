@@ -0,0 +1,327 @@
+// Copyright (c) Stefano Cristiano
+// SPDX-License-Identifier: MIT
+#include "Checksum.h"
+
+#include <string.h> // memcpy
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define SC_CHECKSUM_CRC32C_SSE42 1
+#if SC_COMPILER_MSVC
+#include <intrin.h> // __cpuid
+#else
+#include <cpuid.h> // __get_cpuid
+#endif
+#include <nmmintrin.h> // _mm_crc32_*
+#elif defined(__aarch64__) && defined(__ARM_FEATURE_CRC32)
+#define SC_CHECKSUM_CRC32C_ARM64 1
+#include <arm_acle.h> // __crc32c*
+#endif
+
+namespace SC
+{
+namespace
+{
+// Slicing-by-8 tables for the reflected Castagnoli polynomial, computed at compile time
+struct Crc32cTables
+{
+    uint32_t values[8][256];
+
+    constexpr Crc32cTables() : values()
+    {
+        for (uint32_t idx = 0; idx < 256; ++idx)
+        {
+            uint32_t crc = idx;
+            for (int bit = 0; bit < 8; ++bit)
+            {
+                crc = (crc >> 1) ^ ((crc & 1) ? 0x82F63B78u : 0u);
+            }
+            values[0][idx] = crc;
+        }
+        for (uint32_t idx = 0; idx < 256; ++idx)
+        {
+            for (int slice = 1; slice < 8; ++slice)
+            {
+                const uint32_t previous = values[slice - 1][idx];
+                values[slice][idx]      = (previous >> 8) ^ values[0][previous & 0xff];
+            }
+        }
+    }
+};
+constexpr Crc32cTables crc32cTables;
+} // namespace
+} // namespace SC
+
+struct SC::Checksum::Internal
+{
+    static constexpr uint64_t Prime1 = 0x9E3779B185EBCA87ULL;
+    static constexpr uint64_t Prime2 = 0xC2B2AE3D27D4EB4FULL;
+    static constexpr uint64_t Prime3 = 0x165667B19E3779F9ULL;
+    static constexpr uint64_t Prime4 = 0x85EBCA77C2B2AE63ULL;
+    static constexpr uint64_t Prime5 = 0x27D4EB2F165667C5ULL;
+
+    static uint32_t read32(const uint8_t* ptr)
+    {
+        uint32_t value;
+        memcpy(&value, ptr, sizeof(value));
+        return value;
+    }
+
+    static uint64_t read64(const uint8_t* ptr)
+    {
+        uint64_t value;
+        memcpy(&value, ptr, sizeof(value));
+        return value;
+    }
+
+    //---------------------------------------------------------------------------------------------------
+    // CRC32C
+    //---------------------------------------------------------------------------------------------------
+    static uint32_t crc32cSoftware(uint32_t crc, const uint8_t* ptr, size_t size)
+    {
+        const auto& table = crc32cTables.values;
+        while (size >= 8)
+        {
+            const uint32_t low  = read32(ptr) ^ crc; // Little endian
+            const uint32_t high = read32(ptr + 4);
+
+            crc = table[7][low & 0xff] ^ table[6][(low >> 8) & 0xff] ^ table[5][(low >> 16) & 0xff] ^
+                  table[4][low >> 24] ^ table[3][high & 0xff] ^ table[2][(high >> 8) & 0xff] ^
+                  table[1][(high >> 16) & 0xff] ^ table[0][high >> 24];
+            ptr += 8;
+            size -= 8;
+        }
+        while (size-- > 0)
+        {
+            crc = (crc >> 8) ^ table[0][(crc ^ *ptr++) & 0xff];
+        }
+        return crc;
+    }
+
+#if SC_CHECKSUM_CRC32C_SSE42
+    static bool hasHardwareCrc32c()
+    {
+#if SC_COMPILER_MSVC
+        int info[4];
+        __cpuid(info, 1);
+        return (info[2] & (1 << 20)) != 0;
+#else
+        unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+        return __get_cpuid(1, &eax, &ebx, &ecx, &edx) and (ecx & bit_SSE4_2) != 0;
+#endif
+    }
+
+#if !SC_COMPILER_MSVC
+    __attribute__((target("sse4.2")))
+#endif
+    static uint32_t crc32cHardware(uint32_t crc, const uint8_t* ptr, size_t size)
+    {
+        uint64_t crc64 = crc;
+        while (size >= 8)
+        {
+            crc64 = _mm_crc32_u64(crc64, read64(ptr));
+            ptr += 8;
+            size -= 8;
+        }
+        crc = static_cast<uint32_t>(crc64);
+        while (size-- > 0)
+        {
+            crc = _mm_crc32_u8(crc, *ptr++);
+        }
+        return crc;
+    }
+#elif SC_CHECKSUM_CRC32C_ARM64
+    static bool hasHardwareCrc32c() { return true; }
+
+    static uint32_t crc32cHardware(uint32_t crc, const uint8_t* ptr, size_t size)
+    {
+        while (size >= 8)
+        {
+            crc = __crc32cd(crc, read64(ptr));
+            ptr += 8;
+            size -= 8;
+        }
+        while (size-- > 0)
+        {
+            crc = __crc32cb(crc, *ptr++);
+        }
+        return crc;
+    }
+#else
+    static bool hasHardwareCrc32c() { return false; }
+
+    static uint32_t crc32cHardware(uint32_t crc, const uint8_t* ptr, size_t size)
+    {
+        return crc32cSoftware(crc, ptr, size);
+    }
+#endif
+
+    static uint32_t crc32cUpdate(uint32_t crc, const uint8_t* ptr, size_t size)
+    {
+        static const bool hardware = hasHardwareCrc32c();
+        return hardware ? crc32cHardware(crc, ptr, size) : crc32cSoftware(crc, ptr, size);
+    }
+
+    //---------------------------------------------------------------------------------------------------
+    // XXH64
+    //---------------------------------------------------------------------------------------------------
+    static uint64_t rotl(uint64_t value, int bits) { return (value << bits) | (value >> (64 - bits)); }
+
+    static uint64_t round(uint64_t acc, uint64_t input) { return rotl(acc + input * Prime2, 31) * Prime1; }
+
+    static uint64_t mergeRound(uint64_t acc, uint64_t value) { return (acc ^ round(0, value)) * Prime1 + Prime4; }
+
+    static void hashStripes(uint64_t (&state)[4], const uint8_t*& ptr, const uint8_t* end)
+    {
+        uint64_t v1 = state[0], v2 = state[1], v3 = state[2], v4 = state[3];
+        while (end - ptr >= 32)
+        {
+            v1 = round(v1, read64(ptr));
+            v2 = round(v2, read64(ptr + 8));
+            v3 = round(v3, read64(ptr + 16));
+            v4 = round(v4, read64(ptr + 24));
+            ptr += 32;
+        }
+        state[0] = v1, state[1] = v2, state[2] = v3, state[3] = v4;
+    }
+
+    static uint64_t hashDigest(const Checksum& self)
+    {
+        const uint64_t* state = self.state;
+
+        uint64_t value;
+        if (self.totalSize >= 32)
+        {
+            value = rotl(state[0], 1) + rotl(state[1], 7) + rotl(state[2], 12) + rotl(state[3], 18);
+            value = mergeRound(value, state[0]);
+            value = mergeRound(value, state[1]);
+            value = mergeRound(value, state[2]);
+            value = mergeRound(value, state[3]);
+        }
+        else
+        {
+            value = self.seed + Prime5;
+        }
+        value += self.totalSize;
+
+        const uint8_t* ptr = self.buffer;
+        const uint8_t* end = ptr + self.bufferSize;
+        while (end - ptr >= 8)
+        {
+            value = rotl(value ^ round(0, read64(ptr)), 27) * Prime1 + Prime4;
+            ptr += 8;
+        }
+        if (end - ptr >= 4)
+        {
+            value = rotl(value ^ (static_cast<uint64_t>(read32(ptr)) * Prime1), 23) * Prime2 + Prime3;
+            ptr += 4;
+        }
+        while (ptr < end)
+        {
+            value = rotl(value ^ ((*ptr) * Prime5), 11) * Prime1;
+            ptr++;
+        }
+        value ^= value >> 33;
+        value *= Prime2;
+        value ^= value >> 29;
+        value *= Prime3;
+        value ^= value >> 32;
+        return value;
+    }
+};
+
+bool SC::Checksum::setType(Type newType, uint64_t newSeed)
+{
+    type       = newType;
+    seed       = newSeed;
+    totalSize  = 0;
+    bufferSize = 0;
+    switch (type)
+    {
+    case TypeCRC32C: crc = ~static_cast<uint32_t>(seed); return true;
+    case TypeXXHash64:
+        state[0] = seed + Internal::Prime1 + Internal::Prime2;
+        state[1] = seed + Internal::Prime2;
+        state[2] = seed;
+        state[3] = seed - Internal::Prime1;
+        return true;
+    }
+    return false;
+}
+
+bool SC::Checksum::add(Span<const uint8_t> data)
+{
+    const uint8_t* ptr  = data.data();
+    const size_t   size = data.sizeInBytes();
+    switch (type)
+    {
+    case TypeCRC32C: crc = Internal::crc32cUpdate(crc, ptr, size); return true;
+    case TypeXXHash64: {
+        const uint8_t* end = ptr + size;
+        totalSize += size;
+        if (bufferSize + size < sizeof(buffer))
+        {
+            if (size > 0)
+            {
+                memcpy(buffer + bufferSize, ptr, size);
+            }
+            bufferSize += static_cast<uint32_t>(size);
+            return true;
+        }
+        if (bufferSize > 0)
+        {
+            const size_t toCopy = sizeof(buffer) - bufferSize;
+            memcpy(buffer + bufferSize, ptr, toCopy);
+            ptr += toCopy;
+            const uint8_t* bufferPtr = buffer;
+            Internal::hashStripes(state, bufferPtr, buffer + sizeof(buffer));
+            bufferSize = 0;
+        }
+        Internal::hashStripes(state, ptr, end);
+        bufferSize = static_cast<uint32_t>(end - ptr);
+        if (bufferSize > 0)
+        {
+            memcpy(buffer, ptr, bufferSize);
+        }
+        return true;
+    }
+    }
+    return false;
+}
+
+SC::uint64_t SC::Checksum::getValue() const
+{
+    switch (type)
+    {
+    case TypeCRC32C: return ~crc;
+    case TypeXXHash64: return Internal::hashDigest(*this);
+    }
+    return 0;
+}
+
+bool SC::Checksum::getHash(Hashing::Result& res) const
+{
+    const uint64_t value = getValue();
+    switch (type)
+    {
+    case TypeCRC32C: res.size = CRC32C_DIGEST_LENGTH; break;
+    case TypeXXHash64: res.size = XXHASH64_DIGEST_LENGTH; break;
+    }
+    for (size_t idx = 0; idx < res.size; ++idx)
+    {
+        res.hash[idx] = static_cast<uint8_t>(value >> (8 * (res.size - 1 - idx)));
+    }
+    return true;
+}
+
+SC::uint32_t SC::Checksum::crc32c(Span<const uint8_t> data, uint32_t previous)
+{
+    return ~Internal::crc32cUpdate(~previous, data.data(), data.sizeInBytes());
+}
+
+SC::uint64_t SC::Checksum::xxHash64(Span<const uint8_t> data, uint64_t seed)
+{
+    Checksum checksum;
+    (void)checksum.setType(TypeXXHash64, seed);
+    (void)checksum.add(data);
+    return checksum.getValue();
+}
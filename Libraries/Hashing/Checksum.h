@@ -0,0 +1,73 @@
+// Copyright (c) Stefano Cristiano
+// SPDX-License-Identifier: MIT
+#pragma once
+#include "Hashing.h"
+namespace SC
+{
+//! @addtogroup group_hashing
+//! @{
+
+/// @brief Compute CRC32C or XXH64 non-cryptographic checksums for stream of data.
+/// @n
+/// Unlike SC::Hashing, checksums are computed in-process without calling any OS API, so they're always available and
+/// much faster, making them a good fit for detecting corruption of data being transferred or stored.
+/// - CRC32C uses SSE 4.2 (x86_64) or ARMv8 CRC32 (arm64) instructions when available, falling back to a portable
+///   table based implementation otherwise
+/// - XXH64 is the 64 bit variant of [xxHash](https://github.com/Cyan4973/xxHash)
+///
+/// SC::Checksum::getHash writes checksum in canonical (big endian) representation, so that its hex encoding matches
+/// the output of common command line tools.
+///
+/// \snippet Tests/Libraries/Hashing/HashingTest.cpp ChecksumSnippet
+struct Checksum
+{
+    enum Type
+    {
+        TypeCRC32C,  ///< Compute CRC-32C (Castagnoli) for the incoming stream of bytes
+        TypeXXHash64 ///< Compute XXH64 for the incoming stream of bytes
+    };
+
+    static constexpr auto CRC32C_DIGEST_LENGTH   = 4;
+    static constexpr auto XXHASH64_DIGEST_LENGTH = 8;
+
+    Checksum() { (void)setType(TypeCRC32C); }
+
+    /// @brief Set type of checksum to compute, resetting its state
+    /// @param newType CRC32C, XXHash64
+    /// @param seed Initial value (CRC32C) or seed (XXHash64)
+    /// @return `true` if the checksum type has been changed successfully
+    [[nodiscard]] bool setType(Type newType, uint64_t seed = 0);
+
+    /// @brief Add data to be checksummed. Can be called multiple times before Checksum::getHash
+    /// @param data Data to be checksummed
+    /// @return `true` if data has been checksummed successfully
+    [[nodiscard]] bool add(Span<const uint8_t> data);
+
+    /// @brief Obtains checksum of all data added so far (more data can be added after calling this method)
+    /// @param[out] res Result object holding the checksum (in big endian representation)
+    /// @return `true` if the checksum has been computed successfully
+    [[nodiscard]] bool getHash(Hashing::Result& res) const;
+
+    /// @brief Obtains checksum of all data added so far as an integer (CRC32C uses only the lower 32 bits)
+    [[nodiscard]] uint64_t getValue() const;
+
+    /// @brief Computes CRC32C of a single buffer, optionally continuing from a previously computed one
+    [[nodiscard]] static uint32_t crc32c(Span<const uint8_t> data, uint32_t previous = 0);
+
+    /// @brief Computes XXH64 of a single buffer
+    [[nodiscard]] static uint64_t xxHash64(Span<const uint8_t> data, uint64_t seed = 0);
+
+  private:
+    struct Internal;
+    Type type = TypeCRC32C;
+
+    uint32_t crc = 0;
+
+    uint64_t seed       = 0;
+    uint64_t state[4]   = {0};
+    uint64_t totalSize  = 0;
+    uint8_t  buffer[32] = {0};
+    uint32_t bufferSize = 0;
+};
+//! @}
+} // namespace SC
@@ -10,6 +10,7 @@
 SC::Result SC::HttpClient::get(AsyncEventLoop& loop, StringView url)
 {
     eventLoop = &loop;
+    timedOut  = false;
 
     uint16_t      port;
     HttpURLParser parser;
@@ -33,6 +34,7 @@ SC::Result SC::HttpClient::get(AsyncEventLoop& loop, StringView url)
     const char* dbgName = customDebugName.isEmpty() ? "HttpClient" : customDebugName.bytesIncludingTerminator();
     connectAsync.setDebugName(dbgName);
     connectAsync.callback.bind<HttpClient, &HttpClient::onConnected>(*this);
+    connectAsync.timeout = timeout;
     return connectAsync.start(*eventLoop, clientSocket, localHost);
 }
 
@@ -43,12 +45,17 @@ SC::StringView SC::HttpClient::getResponse() const
 
 void SC::HttpClient::onConnected(AsyncSocketConnect::Result& result)
 {
-    SC_COMPILER_UNUSED(result);
+    if (result.isTimedOut())
+    {
+        onTimeout();
+        return;
+    }
     const char* dbgName =
         customDebugName.isEmpty() ? "HttpClient::clientSocket" : customDebugName.bytesIncludingTerminator();
     sendAsync.setDebugName(dbgName);
 
     sendAsync.callback.bind<HttpClient, &HttpClient::onAfterSend>(*this);
+    sendAsync.timeout = timeout;
     auto res = sendAsync.start(*eventLoop, clientSocket, content.toSpanConst());
     if (not res)
     {
@@ -58,7 +65,11 @@ void SC::HttpClient::onConnected(AsyncSocketConnect::Result& result)
 
 void SC::HttpClient::onAfterSend(AsyncSocketSend::Result& result)
 {
-    SC_COMPILER_UNUSED(result);
+    if (result.isTimedOut())
+    {
+        onTimeout();
+        return;
+    }
     SC_ASSERT_RELEASE(content.resizeWithoutInitializing(content.capacity()));
 
     const char* dbgName =
@@ -66,6 +77,7 @@ void SC::HttpClient::onAfterSend(AsyncSocketSend::Result& result)
     receiveAsync.setDebugName(dbgName);
 
     receiveAsync.callback.bind<HttpClient, &HttpClient::onAfterRead>(*this);
+    receiveAsync.timeout = timeout;
     auto res = receiveAsync.start(*eventLoop, clientSocket, content.toSpan());
     if (not res)
     {
@@ -75,6 +87,11 @@ void SC::HttpClient::onAfterSend(AsyncSocketSend::Result& result)
 
 void SC::HttpClient::onAfterRead(AsyncSocketReceive::Result& result)
 {
+    if (result.isTimedOut())
+    {
+        onTimeout();
+        return;
+    }
     // TODO: parse response and re-arm receive to read it entirely
     SC_ASSERT_RELEASE(clientSocket.close());
     if (not result.completionData.disconnected)
@@ -82,3 +99,11 @@ void SC::HttpClient::onAfterRead(AsyncSocketReceive::Result& result)
         callback(*this);
     }
 }
+
+void SC::HttpClient::onTimeout()
+{
+    SC_ASSERT_RELEASE(clientSocket.close());
+    content.clear();
+    timedOut = true;
+    callback(*this);
+}
@@ -26,7 +26,15 @@ struct SC::HttpClient
     /// @return Valid Result if dns resolution and creation of underlying client tcp socket succeeded
     [[nodiscard]] Result get(AsyncEventLoop& loop, StringView url);
 
-    Delegate<HttpClient&> callback; ///< The callback that is called after `GET` operation succeeded
+    Delegate<HttpClient&> callback; ///< The callback that is called after `GET` operation succeeded or timed out
+
+    /// @brief Maximum time for each of connecting, sending the request and receiving the response (0 == no timeout).
+    /// The connection is closed when it expires, and HttpClient::callback is invoked with HttpClient::isTimedOut
+    /// returning `true` (and an empty response).
+    Time::Milliseconds timeout;
+
+    /// @brief Returns `true` if the last `GET` has been interrupted because HttpClient::timeout expired
+    [[nodiscard]] bool isTimedOut() const { return timedOut; }
 
     /// @brief Get the response StringView sent by the server
     [[nodiscard]] StringView getResponse() const;
@@ -40,6 +48,7 @@ struct SC::HttpClient
     void onConnected(AsyncSocketConnect::Result& result);
     void onAfterSend(AsyncSocketSend::Result& result);
     void onAfterRead(AsyncSocketReceive::Result& result);
+    void onTimeout();
 
     SmallBuffer<1024> content;
 
@@ -50,5 +59,7 @@ struct SC::HttpClient
     AsyncSocketReceive receiveAsync;
     SocketDescriptor   clientSocket;
     AsyncEventLoop*    eventLoop = nullptr;
+
+    bool timedOut = false;
 };
 //! @}
@@ -3,6 +3,8 @@
 #include "HttpServer.h"
 #include "../Async/Async.h"
 #include "../Containers/ArenaMap.h"
+#include "../Foundation/Globals.h"
+#include "../Foundation/VirtualMemory.h"
 #include "../Socket/Socket.h"
 #include "../Strings/String.h"
 #include "../Strings/StringBuilder.h"
@@ -87,6 +89,7 @@ struct SC::HttpServer::Internal
     void onCloseSocket(AsyncSocketClose::Result& result);
 
     void closeAsync(HttpServerClient& requestClient);
+    void updateReceiveTimeout(HttpServerClient& client);
 
     Result parse(HttpRequest& request, const uint32_t maxHeaderSize, Span<const char> readData);
 };
@@ -101,6 +104,8 @@ struct SC::HttpServerClient
     AsyncSocketReceive asyncReceive;
     AsyncSocketSend    asyncSend;
     AsyncSocketClose   asyncClose;
+
+    Time::Absolute headersDeadline; // Connection is closed if headers have not been received before this time
 };
 
 SC::HttpServer::HttpServer() : internal(*reinterpret_cast<Internal*>(internalRaw))
@@ -247,6 +252,9 @@ void SC::HttpServer::Internal::onNewClient(AsyncSocketAccept::Result& result)
     // TODO: This can potentially fail
     SC_TRUST_RESULT(buffer.resizeWithoutInitializing(1024));
 
+    client.headersDeadline = eventLoop->getLoopTime().offsetBy(server.headersTimeout);
+    updateReceiveTimeout(client);
+
     // This cannot fail because start reports only incorrect API usage (AsyncRequest already in use etc.)
     SC_TRUST_RESULT(client.asyncReceive.start(*eventLoop, client.socket, buffer.toSpan()));
 
@@ -263,6 +271,10 @@ void SC::HttpServer::Internal::onReceive(AsyncSocketReceive::Result& result)
     Span<char> readData;
     if (not result.get(readData))
     {
+        if (result.isTimedOut())
+        {
+            closeAsync(client); // Client has been idle or too slow sending headers
+        }
         // TODO: Invoke on error
         return;
     }
@@ -273,7 +285,18 @@ void SC::HttpServer::Internal::onReceive(AsyncSocketReceive::Result& result)
     }
     if (client.request.headersEndReceived)
     {
-        server.onRequest(client.request, client.response);
+        if (server.requestArena != nullptr)
+        {
+            Globals arenaGlobals = {*server.requestArena};
+            Globals::push(Globals::ThreadLocal, arenaGlobals);
+            server.onRequest(client.request, client.response);
+            Globals::pop(Globals::ThreadLocal);
+            server.requestArena->reset();
+        }
+        else
+        {
+            server.onRequest(client.request, client.response);
+        }
     }
     if (client.response.mustBeFlushed())
     {
@@ -281,6 +304,7 @@ void SC::HttpServer::Internal::onReceive(AsyncSocketReceive::Result& result)
 
         auto outspan = client.response.outputBuffer.toSpan();
         client.asyncSend.callback.bind<Internal, &Internal::onAfterSend>(*this);
+        client.asyncSend.timeout = server.sendTimeout;
         auto res = client.asyncSend.start(*eventLoop, client.socket, outspan);
         if (not res)
         {
@@ -290,13 +314,35 @@ void SC::HttpServer::Internal::onReceive(AsyncSocketReceive::Result& result)
     }
     else if (not result.completionData.disconnected)
     {
+        updateReceiveTimeout(client);
         result.reactivateRequest(true);
     }
 }
 
+void SC::HttpServer::Internal::updateReceiveTimeout(HttpServerClient& client)
+{
+    Time::Milliseconds timeout;
+    if (not client.request.headersEndReceived)
+    {
+        // Headers must be received before the headers deadline, without staying idle for longer than idleTimeout
+        const Time::Absolute now = eventLoop->getLoopTime();
+        if (server.headersTimeout.ms > 0)
+        {
+            timeout = client.headersDeadline.isLaterThan(now) ? client.headersDeadline.subtractExact(now)
+                                                              : Time::Milliseconds(1);
+        }
+        if (server.idleTimeout.ms > 0 and (timeout.ms == 0 or server.idleTimeout < timeout))
+        {
+            timeout = server.idleTimeout;
+        }
+    }
+    // After all headers have been received, the client is waiting for the (maybe asynchronous) response
+    client.asyncReceive.timeout = timeout;
+}
+
 void SC::HttpServer::Internal::onAfterSend(AsyncSocketSend::Result& result)
 {
-    if (result.isValid())
+    if (result.isValid() or result.isTimedOut())
     {
         SC_COMPILER_WARNING_PUSH_OFFSETOF
         HttpServerClient& requestClient = SC_COMPILER_FIELD_OFFSET(HttpServerClient, asyncSend, result.getAsync());
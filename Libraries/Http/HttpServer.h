@@ -8,6 +8,7 @@
 #include "../Foundation/Buffer.h"
 #include "../Foundation/Function.h"
 #include "../Strings/StringView.h"
+#include "../Time/Time.h"
 
 namespace SC
 {
@@ -17,6 +18,7 @@ struct SC_COMPILER_EXPORT HttpResponse;
 struct SC_COMPILER_EXPORT HttpRequest;
 
 struct AsyncEventLoop;
+struct ArenaAllocator;
 struct SocketDescriptor;
 struct HttpServerClient;
 } // namespace SC
@@ -152,6 +154,25 @@ struct SC::HttpServer
     /// SC::HttpServer::getRequest, SC::HttpServer::getResponse or SC::HttpServer::getSocket
     Function<void(HttpRequest&, HttpResponse&)> onRequest;
 
+    /// @brief Optional arena pushed as Globals::ThreadLocal allocator while invoking SC::HttpServer::onRequest.
+    /// The arena is reset as soon as the callback returns, so SC::BufferTL, SC::VectorTL etc. used as temporaries
+    /// inside the request handler will not hit the system heap.
+    /// @warning Nothing allocated from the arena must outlive the SC::HttpServer::onRequest invocation
+    ArenaAllocator* requestArena = nullptr;
+
+    /// @brief Maximum time for a client to send all request headers since it has connected (0 == no timeout).
+    /// Connections still sending headers when it expires are closed (protecting against slow clients).
+    Time::Milliseconds headersTimeout;
+
+    /// @brief Maximum time a client can stay idle while sending request headers (0 == no timeout).
+    /// Idle connections are closed when it expires.
+    Time::Milliseconds idleTimeout;
+
+    /// @brief Maximum time to send an entire response to a client (0 == no timeout).
+    /// This is a deadline for the whole send (and not an idle timeout), so it must account for the largest response
+    /// and the slowest client to be served. Connections still sending the response when it expires are closed.
+    Time::Milliseconds sendTimeout;
+
     /// @brief Obtain client request (or a nullptr if it doesn't exists) with the key returned by
     /// SC::HttpResponse::getClientKey
     [[nodiscard]] HttpRequest* getRequest(ArenaMapKey<HttpServerClient> key) const;
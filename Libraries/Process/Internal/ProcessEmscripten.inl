@@ -20,4 +20,5 @@ SC::ProcessFork::ProcessFork() {}
 SC::ProcessFork::~ProcessFork() {}
 SC::Result SC::ProcessFork::waitForChild() { return Result(true); }
 SC::Result SC::ProcessFork::resumeChildFork() { return Result(true); }
+void SC::ProcessFork::terminateChild(int32_t) {}
 SC::Result SC::ProcessFork::fork(State) { return Result(true); }
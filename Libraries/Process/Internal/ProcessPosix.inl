@@ -381,6 +381,14 @@ SC::Result SC::ProcessFork::waitForChild()
     return Process::Internal::waitForPid(processID.pid, exitStatus.status);
 }
 
+void SC::ProcessFork::terminateChild(int32_t exitCode)
+{
+    if (side == ForkChild)
+    {
+        ::_exit(exitCode);
+    }
+}
+
 SC::Result SC::ProcessFork::resumeChildFork()
 {
     if (side == ForkChild)
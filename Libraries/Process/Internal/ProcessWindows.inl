@@ -342,6 +342,14 @@ SC::ProcessFork::~ProcessFork()
     }
 }
 
+void SC::ProcessFork::terminateChild(int32_t exitCode)
+{
+    if (side == ForkChild)
+    {
+        ::NtTerminateProcess(NtCurrentProcess(), static_cast<NTSTATUS>(exitCode));
+    }
+}
+
 SC::FileDescriptor& SC::ProcessFork::getWritePipe()
 {
     return side == ForkChild ? forkToParent.writePipe : parentToFork.writePipe;
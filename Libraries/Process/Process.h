@@ -391,6 +391,8 @@ struct SC::ProcessEnvironment
 ///
 /// Example: Fork current process modifying memory in forked process leaving parent's one unmodified.
 /// \snippet Tests/Libraries/Process/ProcessTest.cpp ProcessFork
+///
+/// @see SC::ProcessForkSnapshot for a ready to use background snapshot persistence built on ProcessFork
 struct SC::ProcessFork
 {
     ProcessFork();
@@ -425,6 +427,17 @@ struct SC::ProcessFork
     /// @brief Gets the return code from the exited child fork
     int32_t getExitStatus() const { return exitStatus.status; }
 
+    /// @brief Immediately terminates the child fork with the given exit code, without running any destructor.
+    /// @note Does nothing when called on the parent side of the fork
+    void terminateChild(int32_t exitCode);
+
+    /// @brief Gets the OS handle of the child fork (for example to be monitored with SC::AsyncProcessExit)
+#if SC_PLATFORM_WINDOWS
+    ProcessDescriptor::Handle getChildHandle() const { return processHandle; }
+#else
+    ProcessDescriptor::Handle getChildHandle() const { return processID.pid; }
+#endif
+
     /// @brief Gets the descriptor to "write" something to the other side
     FileDescriptor& getWritePipe();
 
@@ -0,0 +1,189 @@
+// Copyright (c) Stefano Cristiano
+// SPDX-License-Identifier: MIT
+#include "ProcessForkSnapshot.h"
+#include "../File/File.h"
+#include "../FileSystem/Path.h"
+#include "../Strings/StringBuilder.h"
+
+#include <string.h> // memcpy
+
+//-------------------------------------------------------------------------------------------------------
+// ProcessForkSnapshot (parent side)
+//-------------------------------------------------------------------------------------------------------
+
+SC::Result SC::ProcessForkSnapshot::startFork(AsyncEventLoop& loop, StringView directory, StringView fileName)
+{
+    SC_TRY_MSG(not running, "ProcessForkSnapshot::start - Snapshot is already running");
+    SC_TRY_MSG(chunkSize > 0, "ProcessForkSnapshot::start - chunkSize must be > 0");
+    SC_TRY_MSG(Path::isAbsolute(directory, Path::AsNative), "ProcessForkSnapshot::start - directory must be absolute");
+
+    // Everything the child needs is allocated before forking
+    SC_TRY(fileSystem.init(directory));
+    SC_TRY(StringBuilder(destinationName, StringBuilder::Clear).append(fileName));
+    SC_TRY(StringBuilder(temporaryName, StringBuilder::Clear).format("{}.tmp", fileName));
+    SC_TRY(Path::join(temporaryPath, {directory, temporaryName.view()}));
+    chunk.clear();
+    SC_TRY(chunk.reserve(chunkSize));
+    bytesWritten = 0;
+
+    SC_TRY(fork.fork(ProcessFork::Immediate));
+    if (fork.getSide() == ProcessFork::ForkChild)
+    {
+        return Result(true);
+    }
+
+    Result monitoring = startMonitoring(loop);
+    if (not monitoring)
+    {
+        (void)fork.waitForChild(); // Avoid leaving a zombie process around
+    }
+    return monitoring;
+}
+
+SC::Result SC::ProcessForkSnapshot::startMonitoring(AsyncEventLoop& loop)
+{
+    eventLoop = &loop;
+
+    processExit.callback = [this](AsyncProcessExit::Result& result) { onProcessExit(result); };
+    SC_TRY(processExit.start(loop, fork.getChildHandle()));
+
+#if !SC_PLATFORM_WINDOWS
+    // Windows anonymous pipes do not support overlapped I/O, so progress is only reported on Posix
+    progressBufferUsed = 0;
+
+    FileDescriptor& readPipe = fork.getReadPipe();
+    SC_TRY(readPipe.setBlocking(false));
+    SC_TRY(loop.associateExternallyCreatedFileDescriptor(readPipe));
+    SC_TRY(readPipe.get(progressRead.handle, Result::Error("ProcessForkSnapshot - Invalid pipe")));
+    progressRead.buffer   = {progressBuffer, sizeof(progressBuffer)};
+    progressRead.callback = [this](AsyncFileRead::Result& result) { onProgressRead(result); };
+    SC_TRY(progressRead.start(loop));
+#endif
+    running = true;
+    return Result(true);
+}
+
+void SC::ProcessForkSnapshot::onProgressRead(AsyncFileRead::Result& result)
+{
+    Span<char> data;
+    if (not result.get(data) or result.completionData.endOfFile)
+    {
+        return; // Completion (or failure) is reported by onProcessExit
+    }
+    parseProgress(data);
+    progressRead.buffer = {progressBuffer + progressBufferUsed, sizeof(progressBuffer) - progressBufferUsed};
+    result.reactivateRequest(true);
+}
+
+void SC::ProcessForkSnapshot::parseProgress(Span<const char> data)
+{
+    // Data has already been read at progressBuffer + progressBufferUsed, possibly ending with a partial message
+    const size_t totalBytes  = progressBufferUsed + data.sizeInBytes();
+    const size_t numMessages = totalBytes / sizeof(uint64_t);
+    if (numMessages > 0)
+    {
+        // Only the most recent message is relevant, as it carries the total bytes written so far
+        uint64_t lastMessage;
+        ::memcpy(&lastMessage, progressBuffer + (numMessages - 1) * sizeof(uint64_t), sizeof(uint64_t));
+        progressBufferUsed = totalBytes - numMessages * sizeof(uint64_t);
+        ::memmove(progressBuffer, progressBuffer + numMessages * sizeof(uint64_t), progressBufferUsed);
+        if (lastMessage != progressLast)
+        {
+            progressLast = lastMessage;
+            if (onProgress.isValid())
+            {
+                onProgress(lastMessage);
+            }
+        }
+    }
+    else
+    {
+        progressBufferUsed = totalBytes;
+    }
+}
+
+void SC::ProcessForkSnapshot::onProcessExit(AsyncProcessExit::Result& result)
+{
+    ProcessDescriptor::ExitStatus exitStatus;
+
+    Result res = result.get(exitStatus);
+#if !SC_PLATFORM_WINDOWS
+    // Child has exited, so whatever it has written is already in the pipe and can be read without blocking
+    FileDescriptor& readPipe = fork.getReadPipe();
+    for (;;)
+    {
+        Span<char> data;
+        Span<char> available = {progressBuffer + progressBufferUsed, sizeof(progressBuffer) - progressBufferUsed};
+        if (not readPipe.read(available, data) or data.empty())
+            break;
+        parseProgress(data);
+    }
+    (void)progressRead.stop(*eventLoop);
+    (void)AsyncEventLoop::removeAllAssociationsFor(readPipe);
+#endif
+    running = false;
+    if (res and exitStatus.status != 0)
+    {
+        res = Result::Error("ProcessForkSnapshot - Child failed writing snapshot");
+    }
+    if (onComplete.isValid())
+    {
+        onComplete(res);
+    }
+}
+
+//-------------------------------------------------------------------------------------------------------
+// ProcessForkSnapshot (child side)
+//-------------------------------------------------------------------------------------------------------
+
+bool SC::ProcessForkSnapshot::ChildWriter::open()
+{
+    return File(snapshot.file).open(snapshot.temporaryPath.view(), File::WriteCreateTruncate);
+}
+
+bool SC::ProcessForkSnapshot::ChildWriter::flush()
+{
+    if (not snapshot.chunk.isEmpty())
+    {
+        SC_TRY(snapshot.file.write(snapshot.chunk.toSpanConst()));
+        snapshot.bytesWritten += snapshot.chunk.size();
+        snapshot.chunk.clear();
+    }
+#if !SC_PLATFORM_WINDOWS
+    // Nobody reads progress on Windows, so avoid blocking on a full pipe
+    return snapshot.fork.getWritePipe().write(Span<const char>::reinterpret_bytes(
+        &snapshot.bytesWritten, sizeof(snapshot.bytesWritten)));
+#else
+    return true;
+#endif
+}
+
+bool SC::ProcessForkSnapshot::ChildWriter::serializeBytes(const void* object, size_t numBytes)
+{
+    Span<const char> data = Span<const char>::reinterpret_bytes(object, numBytes);
+    if (snapshot.chunk.size() + numBytes > snapshot.chunkSize)
+    {
+        SC_TRY(flush());
+        if (numBytes >= snapshot.chunkSize)
+        {
+            // Large arrays of packed items are written directly, skipping the copy into the chunk
+            SC_TRY(snapshot.file.write(data));
+            snapshot.bytesWritten += numBytes;
+            return true;
+        }
+    }
+    return snapshot.chunk.append(data); // Will not allocate as chunkSize bytes have been reserved
+}
+
+void SC::ProcessForkSnapshot::finishChild(bool success)
+{
+    // Data must reach the storage device before renaming, or a crash could replace a good snapshot with a broken one
+    success = success and file.sync() and file.close();
+    success = success and fileSystem.rename(temporaryName.view(), destinationName.view());
+    if (not success)
+    {
+        (void)file.close();
+        (void)fileSystem.removeFileIfExists(temporaryName.view());
+    }
+    fork.terminateChild(success ? 0 : 1);
+}
@@ -0,0 +1,109 @@
+// Copyright (c) Stefano Cristiano
+// SPDX-License-Identifier: MIT
+#pragma once
+
+#include "../Async/Async.h"
+#include "../FileSystem/FileSystem.h"
+#include "../SerializationBinary/SerializationBinary.h"
+#include "Process.h"
+
+namespace SC
+{
+struct SC_COMPILER_EXPORT ProcessForkSnapshot;
+} // namespace SC
+
+//! @addtogroup group_process
+//! @{
+
+/// @brief Persists a snapshot of a Reflection-described object to disk from a forked child process (like `BGSAVE`).
+/// @n
+/// SC::ProcessForkSnapshot::start forks current process and returns immediately on the parent side, that can keep
+/// modifying the object while the child process serializes its Copy-On-Write snapshot with
+/// SC::SerializationBinary::writeStreamWithSchema. @n
+/// The child writes serialized data in chunks of SC::ProcessForkSnapshot::chunkSize bytes to a temporary file
+/// (`fileName` + `.tmp`), flushes it to the storage device and atomically renames it to `fileName`, so that a
+/// previously existing snapshot is never left half-written. @n
+/// Progress (bytes written) is sent back through a pipe and completion is detected with SC::AsyncProcessExit, so
+/// both SC::ProcessForkSnapshot::onProgress and SC::ProcessForkSnapshot::onComplete are invoked on the parent
+/// SC::AsyncEventLoop thread. @n
+/// The file can be loaded back with SC::SerializationBinary::loadVersionedWithSchema.
+///
+/// @note SC::ProcessForkSnapshot::onProgress is not invoked on Windows, where anonymous pipes cannot be read
+/// asynchronously.
+/// @warning All caveats of SC::ProcessFork apply. The object must not be destroyed while a snapshot is running.
+///
+/// \snippet Tests/Libraries/Process/ProcessTest.cpp ProcessForkSnapshotSnippet
+struct SC::ProcessForkSnapshot
+{
+    /// @brief Called on the parent side every time the child has written a chunk to the file
+    Function<void(uint64_t bytesWritten)> onProgress;
+
+    /// @brief Called on the parent side when the child has exited (valid Result if snapshot has been persisted)
+    Function<void(Result)> onComplete;
+
+    size_t chunkSize = 1024 * 1024; ///< Size of the chunks written by the child to the temporary file
+
+    /// @brief Forks current process and writes a snapshot of `root` in the child, returning immediately on parent side
+    /// @tparam T Type of the root object (must be described by Reflection)
+    /// @param eventLoop The event loop that will invoke onProgress and onComplete
+    /// @param root The object to be serialized (only the child fork reads it)
+    /// @param directory Absolute path of the directory where the snapshot will be written
+    /// @param fileName Name of the snapshot file
+    /// @return Valid Result if the child fork has been started successfully
+    template <typename T>
+    [[nodiscard]] Result start(AsyncEventLoop& eventLoop, T& root, StringView directory, StringView fileName)
+    {
+        SC_TRY(startFork(eventLoop, directory, fileName));
+        if (fork.getSide() == ProcessFork::ForkChild)
+        {
+            ChildWriter writer(*this);
+            bool success = writer.open() and SerializationBinary::writeStreamWithSchema(root, writer);
+            finishChild(success and writer.flush()); // never returns
+        }
+        return Result(true);
+    }
+
+    /// @brief Returns `true` if a snapshot is currently being written by a child fork
+    [[nodiscard]] bool isRunning() const { return running; }
+
+  private:
+    struct ChildWriter
+    {
+        ChildWriter(ProcessForkSnapshot& snapshot) : snapshot(snapshot) {}
+
+        [[nodiscard]] bool open();
+        [[nodiscard]] bool flush();
+        [[nodiscard]] bool serializeBytes(const void* object, size_t numBytes);
+
+      private:
+        ProcessForkSnapshot& snapshot;
+    };
+
+    ProcessFork      fork;
+    FileSystem       fileSystem;
+    AsyncEventLoop*  eventLoop = nullptr;
+    AsyncProcessExit processExit;
+    AsyncFileRead    progressRead;
+
+    bool running = false;
+
+    // Prepared by the parent before forking, so that the child doesn't need to allocate them
+    String         temporaryPath;
+    String         temporaryName;
+    String         destinationName;
+    Buffer         chunk;
+    FileDescriptor file;
+    uint64_t       bytesWritten = 0;
+
+    char     progressBuffer[sizeof(uint64_t) * 16];
+    size_t   progressBufferUsed = 0;
+    uint64_t progressLast       = 0;
+
+    Result startFork(AsyncEventLoop& loop, StringView directory, StringView fileName);
+    Result startMonitoring(AsyncEventLoop& loop);
+    void   finishChild(bool success);
+    void   onProcessExit(AsyncProcessExit::Result& result);
+    void   onProgressRead(AsyncFileRead::Result& result);
+    void   parseProgress(Span<const char> data);
+};
+//! @}
@@ -5,6 +5,7 @@
 #include "../../Reflection/ReflectionSC.h" // TODO: Split the SC Containers specifics in separate header
 // Compiler must be after
 #include "../../Reflection/ReflectionSchemaCompiler.h"
+#include "SerializationBinaryReadWriteExact.h"
 #include "SerializationBinarySchema.h"
 
 #include "../../Foundation/Result.h"
@@ -76,6 +77,42 @@ struct SerializerBinaryReadVersioned
     };
 };
 
+/// @brief Reads array items with the exact reader when their source schema matches the one of `T`
+template <typename BinaryStream, typename T, bool IsPrimitive = Reflection::IsPrimitive<T>::value>
+struct SerializerReadExactItems
+{
+    [[nodiscard]] static bool isSameLayout(const SerializationSchema& schema, uint32_t sourceTypeIndex)
+    {
+        constexpr auto sinkTypes = Reflection::Schema::template compile<T>().typeInfos;
+        return detail::isSameSchemaSubtree(schema.sourceTypes, sourceTypeIndex, {sinkTypes.values, sinkTypes.size}, 0);
+    }
+
+    [[nodiscard]] static constexpr bool read(T* object, BinaryStream& stream, size_t numItems)
+    {
+        if SC_LANGUAGE_IF_CONSTEXPR (Reflection::ExtendedTypeInfo<T>::IsPacked)
+        {
+            return stream.serializeBytes(object, numItems * sizeof(T));
+        }
+        else
+        {
+            for (size_t idx = 0; idx < numItems; ++idx)
+            {
+                if (not SerializerBinaryReadWriteExact<BinaryStream, T>::serialize(object[idx], stream))
+                    return false;
+            }
+            return true;
+        }
+    }
+};
+
+template <typename BinaryStream, typename T>
+struct SerializerReadExactItems<BinaryStream, T, true>
+{
+    // Primitives with the same type are already bulk read by SerializerReadVersionedItems
+    [[nodiscard]] static constexpr bool isSameLayout(const SerializationSchema&, uint32_t) { return false; }
+    [[nodiscard]] static constexpr bool read(T*, BinaryStream&, size_t) { return false; }
+};
+
 template <typename BinaryStream, typename T>
 struct SerializerReadVersionedItems
 {
@@ -105,12 +142,22 @@ struct SerializerReadVersionedItems
             return true;
         }
 
-        for (uint32_t idx = 0; idx < commonSubsetItems; ++idx)
+        using ExactItems = SerializerReadExactItems<BinaryStream, T>;
+        if (ExactItems::isSameLayout(schema, arrayItemTypeIndex))
         {
-            schema.sourceTypeIndex = arrayItemTypeIndex;
-            if (not SerializerBinaryReadVersioned<BinaryStream, T>::readVersioned(object[idx], stream, schema))
+            // Items layout has not changed: match member tags once for the entire array instead of once per item
+            if (not ExactItems::read(object, stream, commonSubsetItems))
                 return false;
         }
+        else
+        {
+            for (uint32_t idx = 0; idx < commonSubsetItems; ++idx)
+            {
+                schema.sourceTypeIndex = arrayItemTypeIndex;
+                if (not SerializerBinaryReadVersioned<BinaryStream, T>::readVersioned(object[idx], stream, schema))
+                    return false;
+            }
+        }
 
         if (numSourceItems > numDestinationItems)
         {
@@ -5,6 +5,49 @@
 #include "SerializationBinarySkipper.h"
 namespace SC
 {
+namespace detail
+{
+/// @brief Checks if two schema sub-trees produce the same binary layout (types, sizes, member tags and order).
+/// When this is `true` the data described by sourceTypes can be read with the exact (non versioned) readers.
+[[nodiscard]] inline bool isSameSchemaSubtree(Span<const Reflection::TypeInfo> sourceTypes, uint32_t sourceIndex,
+                                              Span<const Reflection::TypeInfo> sinkTypes, uint32_t sinkIndex)
+{
+    const Reflection::TypeInfo source = sourceTypes.data()[sourceIndex];
+    const Reflection::TypeInfo sink   = sinkTypes.data()[sinkIndex];
+    if (source.type != sink.type or source.sizeInBytes != sink.sizeInBytes)
+        return false;
+    if (source.isPrimitiveType())
+        return true;
+    if (source.getNumberOfChildren() != sink.getNumberOfChildren())
+        return false;
+    if (source.type == Reflection::TypeCategory::TypeStruct)
+    {
+        if (source.structInfo.isPacked != sink.structInfo.isPacked)
+            return false;
+    }
+    else if (source.arrayInfo.numElements != sink.arrayInfo.numElements)
+    {
+        return false;
+    }
+    for (uint32_t idx = 0; idx < static_cast<uint32_t>(source.getNumberOfChildren()); ++idx)
+    {
+        const Reflection::TypeInfo sourceChild = sourceTypes.data()[sourceIndex + idx + 1];
+        const Reflection::TypeInfo sinkChild   = sinkTypes.data()[sinkIndex + idx + 1];
+        if (source.type == Reflection::TypeCategory::TypeStruct and
+            (sourceChild.memberInfo.memberTag != sinkChild.memberInfo.memberTag or
+             sourceChild.memberInfo.offsetInBytes != sinkChild.memberInfo.offsetInBytes))
+            return false;
+        if (sourceChild.type != sinkChild.type or sourceChild.sizeInBytes != sinkChild.sizeInBytes)
+            return false;
+        if (sourceChild.hasValidLinkIndex() != sinkChild.hasValidLinkIndex())
+            return false;
+        if (sourceChild.hasValidLinkIndex() and
+            not isSameSchemaSubtree(sourceTypes, sourceChild.getLinkIndex(), sinkTypes, sinkChild.getLinkIndex()))
+            return false;
+    }
+    return true;
+}
+} // namespace detail
 
 //! @addtogroup group_serialization_binary
 //! @{
@@ -172,6 +172,28 @@ struct SerializationBinary
         return write(value, buffer, numberOfWrites);
     }
 
+    /// @brief Writes the reflection schema of object `T` followed by contents of object `T` to a custom writer.
+    /// Produces the same bytes as SerializationBinary::writeWithSchema, but without requiring the entire serialized
+    /// object to be held in memory (for example to stream it in chunks directly to a file).
+    /// @tparam T Type of object to be serialized (must be described by Reflection)
+    /// @tparam BinaryWriter Any type exposing `[[nodiscard]] bool serializeBytes(const void* object, size_t numBytes)`
+    /// @param value The object to be serialized
+    /// @param writer The writer that will receive serialized bytes
+    /// @return `true` if serialization succeeded
+    /// @see SerializationBinary::loadVersionedWithSchema
+    template <typename T, typename BinaryWriter>
+    [[nodiscard]] static bool writeStreamWithSchema(T& value, BinaryWriter& writer)
+    {
+        constexpr auto     typeInfos = Reflection::Schema::template compile<T>().typeInfos;
+        constexpr uint32_t numInfos  = typeInfos.size;
+        static_assert(alignof(Reflection::TypeInfo) == sizeof(uint32_t), "Alignof TypeInfo");
+        // Implying same endianness when reading here
+        SC_TRY(writer.serializeBytes(&numInfos, sizeof(numInfos)));
+        SC_TRY(writer.serializeBytes(typeInfos.values, typeInfos.size * sizeof(Reflection::TypeInfo)));
+        using Writer = Serialization::SerializerBinaryReadWriteExact<BinaryWriter, T>;
+        return Writer::serialize(value, writer);
+    }
+
     /// @brief Loads object `T` using the schema information that has been prepended by
     /// SerializationBinary::writeWithSchema. The schema allows a "best effort" de-serialization trying to match fields
     /// with corresponding `memberTag`.
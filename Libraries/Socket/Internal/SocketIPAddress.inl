@@ -77,6 +77,17 @@ bool SC::SocketIPAddress::isValid() const
     return false; // Unknown family
 }
 
+SC::Result SC::SocketIPAddress::updateAddressFamily()
+{
+    switch (handle.reinterpret_as<struct sockaddr const>().sa_family)
+    {
+    case AF_INET: addressFamily = SocketFlags::AddressFamilyIPV4; break;
+    case AF_INET6: addressFamily = SocketFlags::AddressFamilyIPV6; break;
+    default: return Result::Error("SocketIPAddress::updateAddressFamily - Unknown address family");
+    }
+    return Result(true);
+}
+
 SC::Result SC::SocketIPAddress::fromAddressPort(SpanStringView interfaceAddress, uint16_t port)
 {
     static_assert(sizeof(sockaddr_in6) >= sizeof(sockaddr_in), "size");
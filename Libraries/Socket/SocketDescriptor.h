@@ -129,6 +129,12 @@ struct SC::SocketIPAddress
 
     /// @brief Checks if this is a valid IPV4 or IPV6 address
     bool isValid() const;
+
+    /// @brief Updates address family from a native address written by the OS into SocketIPAddress::handle
+    /// (for example the sender of a datagram received with SC::AsyncSocketReceiveFrom)
+    /// @return A valid Result if handle contains an IPV4 or IPV6 address
+    [[nodiscard]] Result updateAddressFamily();
+
     /// @brief Handle to native OS representation of the IP Address
     AlignedStorage<28> handle = {};
 
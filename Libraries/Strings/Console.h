@@ -47,6 +47,18 @@ struct SC_COMPILER_EXPORT Console
         return false; // UTF16/32 format strings are not supported
     }
 
+    /// @brief Prints a format string parsed at compile time with SC_STRING_FORMAT
+    /// @note Passing a number of arguments different from what is needed by fmt fails to compile
+    /// @param fmt Format string, obtained with SC_STRING_FORMAT
+    /// @param args Arguments to be formatted in the string
+    /// @return `true` if message has been printed successfully to Console
+    template <int NumSegments, int NumArguments, typename... Types>
+    bool print(const StringFormatCompiled<NumSegments, NumArguments>& fmt, Types&&... args)
+    {
+        StringFormatOutput output(StringEncoding::Utf8, *this);
+        return StringFormat<StringIteratorASCII>::format(output, fmt, forward<Types>(args)...);
+    }
+
     /// @brief Prints a StringView to console
     /// @param str The StringView to print
     void print(const StringView str);
@@ -118,4 +118,19 @@ bool StringBuilder::appendHex(Span<const uint8_t> data, AppendHexCase casing)
 
 void StringBuilder::clear() { stringData.clear(); }
 
+bool StringBuilder::reserveFormat(size_t maxLength)
+{
+    // maxLength is a loose upper bound (a float or double counts up to 98 bytes) so inline buffers (SmallString) are
+    // not reserved, as that would move to the heap many strings whose formatted length fits their inline capacity.
+    // Formatting grows them as needed anyway, and the reserve just avoids repeated re-allocations of heap buffers.
+    if (stringData.isInline())
+    {
+        return true;
+    }
+    // maxLength is in UTF8 bytes and N bytes of UTF8 never take more than 2 * N bytes in UTF16
+    // (+ 1 is for the null terminator)
+    const size_t requiredBytes = stringData.size() + (maxLength + 1) * StringEncodingGetSize(encoding);
+    return requiredBytes <= stringData.capacity() or stringData.reserve(requiredBytes);
+}
+
 } // namespace SC
@@ -6,6 +6,7 @@
 #include "../../Foundation/Result.h"
 #include "../../Strings/String.h"
 #include "../../Strings/StringConverter.h"
+#include "StringSearch.inl"
 
 #if SC_PLATFORM_WINDOWS
 #define WIN32_LEAN_AND_MEAN
@@ -124,7 +125,7 @@ bool SC::StringConverter::convertEncodingToUTF8(StringView text, Buffer& buffer,
         CFStringGetBytes(tmpStr, charRange, kCFStringEncodingUTF8, 0, false, NULL, 0, &numChars);
 #else
         int numChars = -1;
-        SC_TRY(convertUTF16LE_to_UTF8(text, buffer, numChars));
+        SC_TRY(convertUTF16LE_to_UTF8(text, nullptr, numChars));
 #endif
 
         if (numChars <= 0)
@@ -138,6 +139,12 @@ bool SC::StringConverter::convertEncodingToUTF8(StringView text, Buffer& buffer,
 #elif SC_PLATFORM_APPLE
         CFStringGetBytes(tmpStr, charRange, kCFStringEncodingUTF8, 0, false,
                          reinterpret_cast<UInt8*>(buffer.data() + oldSize), numChars, NULL);
+#else
+        if (not convertUTF16LE_to_UTF8(text, buffer.data() + oldSize, numChars))
+        {
+            (void)buffer.resizeWithoutInitializing(oldSize);
+            return false;
+        }
 #endif
         eventuallyNullTerminate(buffer, StringEncoding::Utf8, encodedText, terminate);
         return true;
@@ -181,7 +188,7 @@ bool SC::StringConverter::convertEncodingToUTF16(StringView text, Buffer& buffer
         CFIndex writtenCodeUnits = numChars / static_cast<CFIndex>(destinationCharSize);
 #else
         int writtenCodeUnits = -1;
-        SC_TRY(convertUTF8_to_UTF16LE(text, buffer, writtenCodeUnits));
+        SC_TRY(convertUTF8_to_UTF16LE(text, nullptr, writtenCodeUnits));
 #endif
         if (writtenCodeUnits <= 0)
         {
@@ -195,6 +202,12 @@ bool SC::StringConverter::convertEncodingToUTF16(StringView text, Buffer& buffer
 #elif SC_PLATFORM_APPLE
         CFStringGetBytes(tmpStr, charRange, kCFStringEncodingUTF16, 0, false,
                          reinterpret_cast<UInt8*>(buffer.data() + oldSize), numChars, NULL);
+#else
+        if (not convertUTF8_to_UTF16LE(text, buffer.data() + oldSize, writtenCodeUnits))
+        {
+            (void)buffer.resizeWithoutInitializing(oldSize);
+            return false;
+        }
 #endif
         eventuallyNullTerminate(buffer, destinationEncoding, encodedText, terminate);
         return true;
@@ -283,146 +296,150 @@ bool SC::StringConverter::pushNullTerm(Buffer& stringData, StringEncoding encodi
 
 #if !SC_PLATFORM_WINDOWS && !SC_PLATFORM_APPLE
 
-// Fallbacks for platforms without a supported fast conversion function (Linux for now)
+// Fallbacks for platforms without a supported fast conversion function (Linux for now).
+// They're called a first time with a nullptr destination to compute the exact number of code units with vector
+// instructions, so that the destination buffer is resized only once, and a second time to validate and convert the
+// text in a single pass, writing at most the number of code units computed by the first call.
+// ASCII runs are converted 16 code units at a time (see detail::StringSearch::widenASCII / narrowASCII), as well as
+// runs of code points that are all encoded with the same number of bytes (widenUTF8Blocks / narrowUTF16Blocks).
+
+// Code points converted one at a time before trying again to convert a block of them with vector instructions.
+// Trying after every code point slows down conversion of text made of short runs (as CJK text with punctuation).
+static constexpr int SequencesBetweenBlocks = 8;
 
-bool SC::StringConverter::convertUTF8_to_UTF16LE(const SC::StringView sourceUtf8, SC::Buffer& destination,
+bool SC::StringConverter::convertUTF8_to_UTF16LE(const SC::StringView sourceUtf8, char* destination,
                                                  int& writtenCodeUnits)
 {
-    const char*  utf8    = sourceUtf8.bytesWithoutTerminator();
-    const size_t utf8Len = sourceUtf8.sizeInBytes();
-
-    // Calculate the maximum possible size for the UTF-16 string
-    // Each UTF-8 character can be represented by at most one UTF-16 code unit
-    SC_TRY(destination.resizeWithoutInitializing(utf8Len + 1));
+    const char*  source       = sourceUtf8.bytesWithoutTerminator();
+    const size_t sourceLength = sourceUtf8.sizeInBytes();
+    if (destination == nullptr)
+    {
+        writtenCodeUnits = static_cast<int>(detail::StringSearch::countUTF16CodeUnits(source, sourceLength));
+        return true;
+    }
 
-    uint16_t* utf16 = reinterpret_cast<uint16_t*>(destination.data());
+    const uint8_t* utf8     = reinterpret_cast<const uint8_t*>(source);
+    const uint8_t* end      = utf8 + sourceLength;
+    char*          utf16    = destination;
+    const char*    utf16End = destination + static_cast<size_t>(writtenCodeUnits) * 2;
 
-    size_t srcIndex = 0;
-    size_t dstIndex = 0;
-
-    // Assuming little-endian byte order for UTF-16
-    while (srcIndex < utf8Len)
+    // Assuming little-endian byte order for UTF-16, copied as destination can be unaligned.
+    // Each well-formed sequence is converted to the code units counted for its bytes by countUTF16CodeUnits and
+    // conversion stops at first malformed sequence, so code units written here can't exceed the counted ones.
+    const auto writeCodeUnit = [&utf16](uint32_t codePoint)
     {
-        uint32_t codePoint;
+        const uint16_t codeUnit = static_cast<uint16_t>(codePoint);
+        ::memcpy(utf16, &codeUnit, sizeof(codeUnit));
+        utf16 += sizeof(codeUnit);
+    };
 
-        // Decode the next UTF-8 character
-        if ((utf8[srcIndex] & 0x80) == 0x00)
-        {
-            // Single-byte character
-            codePoint = static_cast<uint32_t>(utf8[srcIndex++]);
-        }
-        else if ((utf8[srcIndex] & 0xE0) == 0xC0)
-        {
-            // Two-byte character
-            codePoint = static_cast<uint32_t>(((utf8[srcIndex] & 0x1F) << 6) | (utf8[srcIndex + 1] & 0x3F));
-            srcIndex += 2;
-        }
-        else if ((utf8[srcIndex] & 0xF0) == 0xE0)
-        {
-            // Three-byte character
-            codePoint = static_cast<uint32_t>(((utf8[srcIndex] & 0x0F) << 12) | ((utf8[srcIndex + 1] & 0x3F) << 6) |
-                                              (utf8[srcIndex + 2] & 0x3F));
-            srcIndex += 3;
-        }
-        else if ((utf8[srcIndex] & 0xF8) == 0xF0)
-        {
-            // Four-byte character
-            codePoint = static_cast<uint32_t>(((utf8[srcIndex] & 0x07) << 18) | ((utf8[srcIndex + 1] & 0x3F) << 12) |
-                                              ((utf8[srcIndex + 2] & 0x3F) << 6) | (utf8[srcIndex + 3] & 0x3F));
-            srcIndex += 4;
-        }
-        else
-        {
-            return false;
-        }
+    while (utf8 < end)
+    {
+        const size_t numASCII = detail::StringSearch::widenASCII(reinterpret_cast<const char*>(utf8),
+                                                                 static_cast<size_t>(end - utf8), utf16, utf16End);
+        utf8 += numASCII;
+        utf16 += numASCII * 2;
 
-        // Encode the code point in UTF-16
-        if (codePoint <= 0xFFFF)
-        {
-            // Single 16-bit code unit
-            utf16[dstIndex++] = (uint16_t)codePoint;
-        }
-        else if (codePoint <= 0x10FFFF)
-        {
-            // Surrogate pair
-            utf16[dstIndex++] = (uint16_t)(((codePoint - 0x10000) >> 10) | 0xD800);
-            utf16[dstIndex++] = (uint16_t)(((codePoint - 0x10000) & 0x3FF) | 0xDC00);
-        }
-        else
+        while (utf8 < end and *utf8 >= 0x80)
         {
-            return false;
+            // Blocks made only of 2 or only of 3 bytes sequences first, then a few sequences one at a time
+            detail::StringSearch::widenUTF8Blocks(utf8, end, utf16, utf16End);
+            for (int idx = 0; idx < SequencesBetweenBlocks and utf8 < end and *utf8 >= 0x80; ++idx)
+            {
+                uint32_t codePoint;
+                SC_TRY(detail::StringSearch::decodeUTF8Sequence(utf8, end, codePoint));
+                if (codePoint <= 0xFFFF)
+                {
+                    writeCodeUnit(codePoint); // Single 16-bit code unit
+                }
+                else
+                {
+                    writeCodeUnit(((codePoint - 0x10000) >> 10) | 0xD800); // Surrogate pair
+                    writeCodeUnit(((codePoint - 0x10000) & 0x3FF) | 0xDC00);
+                }
+            }
         }
     }
-    writtenCodeUnits = static_cast<int>(dstIndex);
-    return true;
+    return utf16 == utf16End;
 }
 
-bool SC::StringConverter::convertUTF16LE_to_UTF8(const SC::StringView sourceUtf16, SC::Buffer& destination,
+bool SC::StringConverter::convertUTF16LE_to_UTF8(const SC::StringView sourceUtf16, char* destination,
                                                  int& writtenCodeUnits)
 {
-    const uint16_t* utf16    = reinterpret_cast<const uint16_t*>(sourceUtf16.bytesWithoutTerminator());
-    const size_t    utf16Len = sourceUtf16.sizeInBytes() / sizeof(uint16_t);
+    const char*  utf16    = sourceUtf16.bytesWithoutTerminator();
+    const size_t utf16Len = sourceUtf16.sizeInBytes() / sizeof(uint16_t);
+    if (destination == nullptr)
+    {
+        writtenCodeUnits = static_cast<int>(detail::StringSearch::countUTF8Bytes(utf16, utf16Len));
+        return true;
+    }
 
-    // Calculate the maximum possible size for the UTF-8 string
-    // UTF-8 uses at most 4 bytes per character
-    SC_TRY(destination.resizeWithoutInitializing(4 * utf16Len + 1));
+    // Assuming little-endian byte order for UTF-16, read byte by byte as source can be unaligned
+    const auto codeUnitAt = [utf16](size_t index) -> uint32_t
+    {
+        const uint8_t* bytes = reinterpret_cast<const uint8_t*>(utf16) + index * 2;
+        return bytes[0] | (static_cast<uint32_t>(bytes[1]) << 8);
+    };
 
-    char*  utf8     = destination.data();
-    size_t srcIndex = 0;
-    size_t dstIndex = 0;
+    // Each well-formed code point is converted to the bytes counted for its code units by countUTF8Bytes and
+    // conversion stops at first unpaired surrogate, so bytes written here can't exceed the counted ones.
+    char*       utf8    = destination;
+    const char* utf8End = destination + static_cast<size_t>(writtenCodeUnits);
 
-    // Assuming little-endian byte order for UTF-16
+    size_t srcIndex = 0;
     while (srcIndex < utf16Len)
     {
-        uint32_t codePoint;
-
-        if ((utf16[srcIndex] & 0xFC00) == 0xD800 && (srcIndex + 1) < utf16Len &&
-            (utf16[srcIndex + 1] & 0xFC00) == 0xDC00)
+        const size_t numASCII =
+            detail::StringSearch::narrowASCII(utf16 + srcIndex * 2, utf16Len - srcIndex, utf8, utf8End);
+        srcIndex += numASCII;
+        utf8 += numASCII;
+        if (srcIndex == utf16Len)
         {
-            // Surrogate pair
-            codePoint = 0x10000U + ((utf16[srcIndex] & 0x3FFU) << 10U) + (utf16[srcIndex + 1] & 0x3FF);
-            srcIndex += 2;
-        }
-        else
-        {
-            // Single 16-bit code unit
-            codePoint = utf16[srcIndex];
-            srcIndex += 1;
+            break;
         }
 
-        // Encode the code point in UTF-8
-        if (codePoint <= 0x7F)
-        {
-            // Single-byte character
-            utf8[dstIndex++] = static_cast<char>(codePoint);
-        }
-        else if (codePoint <= 0x7FF)
-        {
-            // Two-byte character
-            utf8[dstIndex++] = static_cast<char>(0xC0 | ((codePoint >> 6) & 0x1F));
-            utf8[dstIndex++] = static_cast<char>(0x80 | (codePoint & 0x3F));
-        }
-        else if (codePoint <= 0xFFFF)
-        {
-            // Three-byte character
-            utf8[dstIndex++] = static_cast<char>(0xE0 | ((codePoint >> 12) & 0x0F));
-            utf8[dstIndex++] = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
-            utf8[dstIndex++] = static_cast<char>(0x80 | (codePoint & 0x3F));
-        }
-        else if (codePoint <= 0x10FFFF)
+        // Blocks of code units all needing 2 or all needing 3 bytes first, then a few code points one at a time
+        const char* source = utf16 + srcIndex * 2;
+        detail::StringSearch::narrowUTF16Blocks(source, utf16 + utf16Len * 2, utf8, utf8End);
+        srcIndex = static_cast<size_t>(source - utf16) / 2;
+        for (int idx = 0; idx < SequencesBetweenBlocks and srcIndex < utf16Len and codeUnitAt(srcIndex) >= 0x80; ++idx)
         {
-            // Four-byte character
-            utf8[dstIndex++] = static_cast<char>(0xF0 | ((codePoint >> 18) & 0x07));
-            utf8[dstIndex++] = static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
-            utf8[dstIndex++] = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
-            utf8[dstIndex++] = static_cast<char>(0x80 | (codePoint & 0x3F));
-        }
-        else
-        {
-            return false; // Invalid sequence
+            uint32_t codePoint = codeUnitAt(srcIndex++);
+            if ((codePoint & 0xFC00) == 0xD800)
+            {
+                // High surrogate must be followed by a low surrogate
+                SC_TRY(srcIndex < utf16Len and (codeUnitAt(srcIndex) & 0xFC00) == 0xDC00);
+                codePoint = 0x10000U + ((codePoint & 0x3FFU) << 10U) + (codeUnitAt(srcIndex++) & 0x3FF);
+            }
+            else if ((codePoint & 0xFC00) == 0xDC00)
+            {
+                return false; // Unpaired low surrogate
+            }
+
+            // Encode the code point in UTF-8 (it's not ASCII)
+            if (codePoint <= 0x7FF)
+            {
+                utf8[0] = static_cast<char>(0xC0 | ((codePoint >> 6) & 0x1F));
+                utf8[1] = static_cast<char>(0x80 | (codePoint & 0x3F));
+                utf8 += 2;
+            }
+            else if (codePoint <= 0xFFFF)
+            {
+                utf8[0] = static_cast<char>(0xE0 | ((codePoint >> 12) & 0x0F));
+                utf8[1] = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+                utf8[2] = static_cast<char>(0x80 | (codePoint & 0x3F));
+                utf8 += 3;
+            }
+            else
+            {
+                utf8[0] = static_cast<char>(0xF0 | ((codePoint >> 18) & 0x07));
+                utf8[1] = static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+                utf8[2] = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+                utf8[3] = static_cast<char>(0x80 | (codePoint & 0x3F));
+                utf8 += 4;
+            }
         }
     }
-    writtenCodeUnits = static_cast<int>(dstIndex);
-    return true;
+    return utf8 == utf8End;
 }
 #endif
@@ -177,6 +177,17 @@ bool StringFormatterFor<String>::format(StringFormatOutput& data, const StringVi
     return StringFormatterFor<StringView>::format(data, specifier, value.view());
 }
 
+size_t StringFormatMaxLengthFor<String>::get(StringView specifier, const String& value)
+{
+    return StringFormatMaxLengthFor<StringView>::get(specifier, value.view());
+}
+
+size_t StringFormatMaxLengthFor<const char*>::get(StringView specifier, const char* value)
+{
+    SC_COMPILER_UNUSED(specifier);
+    return strlen(value);
+}
+
 //-----------------------------------------------------------------------------------------------------------------------
 // StringFormatOutput
 //-----------------------------------------------------------------------------------------------------------------------
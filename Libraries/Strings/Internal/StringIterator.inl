@@ -2,12 +2,20 @@
 // SPDX-License-Identifier: MIT
 
 #include "../../Strings/StringIterator.h"
+#include "StringSearch.inl"
 
 namespace SC
 {
 template <typename CharIterator>
 bool StringIterator<CharIterator>::reverseAdvanceUntilMatches(CodePoint c)
 {
+    if (detail::StringIteratorIsByteSearchable<CharIterator>::value and c < 128)
+    {
+        const char  set[1] = {static_cast<char>(c)};
+        const char* found  = detail::StringSearch::reverseFindAnyOf(start, it, set, 1);
+        it                 = found != nullptr ? found : start;
+        return found != nullptr;
+    }
     while (it > start)
     {
         it = getPreviousOf(it);
@@ -41,6 +49,17 @@ bool StringIterator<CharIterator>::advanceAfterFinding(StringIterator other)
         return false;
     }
 
+    if (detail::StringIteratorIsByteSearchable<CharIterator>::value)
+    {
+        const char* found = detail::StringSearch::findString(it, thisLength, other.it, otherLength);
+        if (found != nullptr)
+        {
+            it = found + otherLength;
+            return true;
+        }
+        return false;
+    }
+
     const size_t difference = thisLength - otherLength;
     for (size_t index = 0; index <= difference; index++)
     {
@@ -93,6 +112,19 @@ template bool StringIterator<StringIteratorUTF16>::advanceOfBytes(ssize_t bytesL
 template <typename CharIterator>
 bool StringIterator<CharIterator>::advanceUntilMatchesAny(Span<const CodePoint> items, CodePoint& matched)
 {
+    char   set[detail::StringSearch::MaxSetSize];
+    size_t setSize;
+    if (detail::StringIteratorIsByteSearchable<CharIterator>::value and
+        detail::StringSearch::makeASCIISet(items, set, setSize))
+    {
+        const char* found = detail::StringSearch::findAnyOf(it, end, set, setSize);
+        it                = found != nullptr ? found : end;
+        if (found != nullptr)
+        {
+            matched = static_cast<CodePoint>(*found);
+        }
+        return found != nullptr;
+    }
     while (it < end)
     {
         const auto decoded = CharIterator::decode(it);
@@ -119,6 +151,19 @@ template bool StringIterator<StringIteratorUTF16>::advanceUntilMatchesAny(Span<c
 template <typename CharIterator>
 bool StringIterator<CharIterator>::reverseAdvanceUntilMatchesAny(Span<const CodePoint> items, CodePoint& matched)
 {
+    char   set[detail::StringSearch::MaxSetSize];
+    size_t setSize;
+    if (detail::StringIteratorIsByteSearchable<CharIterator>::value and
+        detail::StringSearch::makeASCIISet(items, set, setSize))
+    {
+        const char* found = detail::StringSearch::reverseFindAnyOf(start, it, set, setSize);
+        it                = found != nullptr ? found : start;
+        if (found != nullptr)
+        {
+            matched = static_cast<CodePoint>(*found);
+        }
+        return found != nullptr;
+    }
     while (it > start)
     {
         it                 = getPreviousOf(it);
@@ -0,0 +1,1032 @@
+// Copyright (c) Stefano Cristiano
+// SPDX-License-Identifier: MIT
+#pragma once
+#include "../../Strings/StringIterator.h"
+
+#include <string.h> // memchr / memcmp / memcpy
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define SC_STRING_SEARCH_SSE2 1
+#if SC_COMPILER_MSVC
+#include <intrin.h> // __cpuid / __cpuidex / _xgetbv / _BitScanForward64 / _BitScanReverse64
+#define SC_STRING_SEARCH_TARGET_AVX2
+#else
+#define SC_STRING_SEARCH_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#include <immintrin.h> // SSE2 / AVX2
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define SC_STRING_SEARCH_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace SC
+{
+namespace detail
+{
+/// @brief Byte oriented search and ASCII conversion primitives, vectorized with SSE2 / AVX2 (x86_64) or NEON (ARM64).
+/// They're used for ASCII and UTF8 strings, where matching bytes is the same as matching code points.
+/// UTF8 multi-byte sequences are made only of bytes >= 0x80 and a sequence never matches in the middle of another.
+struct StringSearch
+{
+    static constexpr size_t MaxSetSize = 8; // Maximum number of bytes matched by findAnyOf and reverseFindAnyOf
+
+    /// @brief Converts code points to a set of bytes, failing if they're not all ASCII or if they're too many
+    [[nodiscard]] static bool makeASCIISet(Span<const StringCodePoint> codePoints, char (&set)[MaxSetSize],
+                                           size_t& setSize)
+    {
+        if (codePoints.sizeInElements() == 0 or codePoints.sizeInElements() > MaxSetSize)
+        {
+            return false;
+        }
+        setSize = 0;
+        for (StringCodePoint codePoint : codePoints)
+        {
+            if (codePoint > 127)
+            {
+                return false;
+            }
+            set[setSize++] = static_cast<char>(codePoint);
+        }
+        return true;
+    }
+
+    /// @brief Finds first occurrence of `pattern` in `text` (returning `nullptr` if it's not found)
+    [[nodiscard]] static const char* findString(const char* text, size_t textLength, const char* pattern,
+                                                size_t patternLength)
+    {
+        if (patternLength == 0)
+        {
+            return text;
+        }
+        if (patternLength > textLength)
+        {
+            return nullptr;
+        }
+        if (patternLength == 1)
+        {
+            return static_cast<const char*>(::memchr(text, pattern[0], textLength));
+        }
+        // Candidates matching both first and last byte of the pattern are compared with memcmp
+        const char* const last = text + textLength - patternLength; // Last position where pattern can start
+        const char*       it   = text;
+        const char*       found;
+#if SC_STRING_SEARCH_SSE2
+        if (isAVX2Available() and findStringAVX2(it, last, pattern, patternLength, found))
+        {
+            return found;
+        }
+#endif
+#if SC_STRING_SEARCH_SSE2 || SC_STRING_SEARCH_NEON
+        const Block first    = splat(pattern[0]);
+        const Block lastByte = splat(pattern[patternLength - 1]);
+        while (last - it >= static_cast<ssize_t>(BlockSize) - 1) // Signed as `it` can step past `last`
+        {
+            const Block matches = both(equals(load(it), first), equals(load(it + patternLength - 1), lastByte));
+            if (findCandidate(toMask(matches), it, pattern, patternLength, found))
+            {
+                return found;
+            }
+            it += BlockSize;
+        }
+#endif
+        for (; it <= last; ++it)
+        {
+            if (it[0] == pattern[0] and it[patternLength - 1] == pattern[patternLength - 1] and
+                ::memcmp(it + 1, pattern + 1, patternLength - 2) == 0)
+            {
+                return it;
+            }
+        }
+        return nullptr;
+    }
+
+    /// @brief Finds first byte in `[text, textEnd)` that is equal to any of the bytes in `set`
+    [[nodiscard]] static const char* findAnyOf(const char* text, const char* textEnd, const char* set,
+                                               size_t setSize)
+    {
+        if (setSize == 1)
+        {
+            return static_cast<const char*>(::memchr(text, set[0], static_cast<size_t>(textEnd - text)));
+        }
+        const char* it = text;
+        const char* found;
+#if SC_STRING_SEARCH_SSE2
+        if (isAVX2Available() and findAnyOfAVX2(it, textEnd, set, setSize, found))
+        {
+            return found;
+        }
+#endif
+#if SC_STRING_SEARCH_SSE2 || SC_STRING_SEARCH_NEON
+        Block needles[MaxSetSize];
+        for (size_t idx = 0; idx < setSize; ++idx)
+        {
+            needles[idx] = splat(set[idx]);
+        }
+        for (; static_cast<size_t>(textEnd - it) >= BlockSize; it += BlockSize)
+        {
+            const uint64_t mask = toMask(equalsAnyOf(load(it), needles, setSize));
+            if (mask != 0)
+            {
+                return it + lowestBit(mask) / MaskBitsPerByte;
+            }
+        }
+#endif
+        for (; it < textEnd; ++it)
+        {
+            if (isInSet(*it, set, setSize))
+            {
+                return it;
+            }
+        }
+        return nullptr;
+    }
+
+    /// @brief Finds last byte in `[textStart, text)` that is equal to any of the bytes in `set`
+    [[nodiscard]] static const char* reverseFindAnyOf(const char* textStart, const char* text, const char* set,
+                                                      size_t setSize)
+    {
+        const char* it = text;
+#if SC_STRING_SEARCH_SSE2 || SC_STRING_SEARCH_NEON
+        Block needles[MaxSetSize];
+        for (size_t idx = 0; idx < setSize; ++idx)
+        {
+            needles[idx] = splat(set[idx]);
+        }
+        while (static_cast<size_t>(it - textStart) >= BlockSize)
+        {
+            it -= BlockSize;
+            const uint64_t mask = toMask(equalsAnyOf(load(it), needles, setSize));
+            if (mask != 0)
+            {
+                return it + highestBit(mask) / MaskBitsPerByte;
+            }
+        }
+#endif
+        while (it > textStart)
+        {
+            --it;
+            if (isInSet(*it, set, setSize))
+            {
+                return it;
+            }
+        }
+        return nullptr;
+    }
+
+    /// @brief Returns the number of leading ASCII (< 0x80) bytes of `text`
+    [[nodiscard]] static size_t countASCII(const char* text, size_t textLength)
+    {
+        const char* it  = text;
+        const char* end = text + textLength;
+#if SC_STRING_SEARCH_SSE2
+        if (isAVX2Available() and countASCIIAVX2(it, end))
+        {
+            return static_cast<size_t>(it - text);
+        }
+#endif
+#if SC_STRING_SEARCH_SSE2 || SC_STRING_SEARCH_NEON
+        for (; static_cast<size_t>(end - it) >= BlockSize; it += BlockSize)
+        {
+            const uint64_t mask = nonASCIIMask(load(it));
+            if (mask != 0)
+            {
+                return static_cast<size_t>(it - text) + lowestBit(mask) / MaskBitsPerByte;
+            }
+        }
+#endif
+        while (it < end and static_cast<uint8_t>(*it) < 0x80)
+        {
+            ++it;
+        }
+        return static_cast<size_t>(it - text);
+    }
+
+    /// @brief Converts the leading ASCII bytes of `text` to UTF16LE code units, 16 at a time
+    /// @param text The UTF8 source
+    /// @param textLength Number of bytes in `text`
+    /// @param utf16 Destination with space for at least as many code units as the leading ASCII bytes of `text`
+    /// @param utf16End End of the destination. Where there's enough space, the entire block containing the first
+    /// non-ASCII byte is written too (avoiding a byte by byte loop), leaving code units to be overwritten after the
+    /// returned ones.
+    /// @return Number of leading ASCII bytes converted (and code units written)
+    [[nodiscard]] static size_t widenASCII(const char* text, size_t textLength, char* utf16, const char* utf16End)
+    {
+        const char* it  = text;
+        const char* end = text + textLength;
+#if SC_STRING_SEARCH_SSE2 || SC_STRING_SEARCH_NEON
+        for (; static_cast<size_t>(end - it) >= BlockSize and static_cast<size_t>(utf16End - utf16) >= 2 * BlockSize;
+             it += BlockSize, utf16 += 2 * BlockSize)
+        {
+            const Block block = load(it);
+#if SC_STRING_SEARCH_SSE2
+            const __m128i zero = _mm_setzero_si128();
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(utf16), _mm_unpacklo_epi8(block, zero));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(utf16 + BlockSize), _mm_unpackhi_epi8(block, zero));
+#else
+            vst1q_u8(reinterpret_cast<uint8_t*>(utf16), vreinterpretq_u8_u16(vmovl_u8(vget_low_u8(block))));
+            vst1q_u8(reinterpret_cast<uint8_t*>(utf16 + BlockSize), vreinterpretq_u8_u16(vmovl_high_u8(block)));
+#endif
+            const uint64_t mask = nonASCIIMask(block);
+            if (mask != 0)
+            {
+                return static_cast<size_t>(it - text) + lowestBit(mask) / MaskBitsPerByte;
+            }
+        }
+#endif
+        for (; it < end and static_cast<uint8_t>(*it) < 0x80; ++it, utf16 += 2)
+        {
+            utf16[0] = *it;
+            utf16[1] = 0;
+        }
+        return static_cast<size_t>(it - text);
+    }
+
+    /// @brief Converts the leading ASCII code units of UTF16LE `text` to bytes, 16 at a time
+    /// @param text The UTF16LE source (no alignment required)
+    /// @param numCodeUnits Number of code units in `text`
+    /// @param utf8 Destination with space for at least as many bytes as the leading ASCII code units of `text`
+    /// @param utf8End End of the destination. Where there's enough space, the entire block containing the first
+    /// non-ASCII code unit is written too (see widenASCII).
+    /// @return Number of leading ASCII code units converted (and bytes written)
+    [[nodiscard]] static size_t narrowASCII(const char* text, size_t numCodeUnits, char* utf8, const char* utf8End)
+    {
+        const char* it  = text;
+        const char* end = text + numCodeUnits * 2;
+#if SC_STRING_SEARCH_SSE2 || SC_STRING_SEARCH_NEON
+        for (; static_cast<size_t>(end - it) >= 2 * BlockSize and static_cast<size_t>(utf8End - utf8) >= BlockSize;
+             it += 2 * BlockSize, utf8 += BlockSize)
+        {
+#if SC_STRING_SEARCH_SSE2
+            const __m128i zero         = _mm_setzero_si128();
+            const __m128i nonASCIIBits = _mm_set1_epi16(static_cast<short>(0xFF80));
+            const Block   low          = load(it);
+            const Block   high         = load(it + BlockSize);
+            const Block bytes = _mm_packus_epi16(low, high);
+            const Block ascii = _mm_packs_epi16(_mm_cmpeq_epi16(_mm_and_si128(low, nonASCIIBits), zero),
+                                                _mm_cmpeq_epi16(_mm_and_si128(high, nonASCIIBits), zero));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(utf8), bytes);
+            const uint64_t mask = toMask(ascii) ^ 0xFFFF;
+#else
+            const uint16x8_t low   = vreinterpretq_u16_u8(load(it));
+            const uint16x8_t high  = vreinterpretq_u16_u8(load(it + BlockSize));
+            const uint8x16_t ascii = vcombine_u8(vmovn_u16(vcltq_u16(low, vdupq_n_u16(0x80))),
+                                                 vmovn_u16(vcltq_u16(high, vdupq_n_u16(0x80))));
+            vst1q_u8(reinterpret_cast<uint8_t*>(utf8), vcombine_u8(vmovn_u16(low), vmovn_u16(high)));
+            const uint64_t mask = toMask(vmvnq_u8(ascii));
+#endif
+            if (mask != 0)
+            {
+                return static_cast<size_t>(it - text) / 2 + lowestBit(mask) / MaskBitsPerByte;
+            }
+        }
+#endif
+        for (; it < end and it[1] == 0 and static_cast<uint8_t>(it[0]) < 0x80; it += 2)
+        {
+            *utf8++ = it[0];
+        }
+        return static_cast<size_t>(it - text) / 2;
+    }
+
+    /// @brief Converts the leading blocks of UTF8 `it` made only of 2 bytes sequences (SSE2 / NEON) or only of 3 bytes
+    /// sequences (AVX2 / NEON) to UTF16LE, validating them.
+    /// It stops at first block not matching, that should be decoded (and validated) with decodeUTF8Sequence.
+    /// @param it The UTF8 source, advanced past converted sequences
+    /// @param end End of the UTF8 source
+    /// @param utf16 The UTF16LE destination, advanced past written code units
+    /// @param utf16End End of the UTF16LE destination (it's never written past it)
+    /// @note Lead bytes of the first two sequences (or of first and last sequence of the block with NEON, that only
+    /// converts entire blocks) are checked before any vector instruction, as this is called often in short runs.
+    SC_COMPILER_FORCE_INLINE static void widenUTF8Blocks(const uint8_t*& it, const uint8_t* end, char*& utf16,
+                                                         const char* utf16End)
+    {
+#if SC_STRING_SEARCH_SSE2
+        if (end - it >= 32 and (it[0] & 0xF0) == 0xE0 and (it[3] & 0xF0) == 0xE0)
+        {
+            if (isAVX2Available())
+            {
+                widenUTF8ThreeBytesAVX2(it, end, utf16, utf16End);
+            }
+        }
+        else if (end - it >= 16 and (it[0] & 0xE0) == 0xC0 and (it[2] & 0xE0) == 0xC0)
+        {
+            widenUTF8TwoBytes(it, end, utf16, utf16End);
+        }
+#elif SC_STRING_SEARCH_NEON
+        if (end - it >= 48 and (it[0] & 0xF0) == 0xE0 and (it[45] & 0xF0) == 0xE0)
+        {
+            widenUTF8ThreeBytes(it, end, utf16, utf16End);
+        }
+        else if (end - it >= 32 and (it[0] & 0xE0) == 0xC0 and (it[30] & 0xE0) == 0xC0)
+        {
+            widenUTF8TwoBytes(it, end, utf16, utf16End);
+        }
+#else
+        (void)it;
+        (void)end;
+        (void)utf16;
+        (void)utf16End;
+#endif
+    }
+
+    /// @brief Converts the leading blocks of UTF16LE `it` made only of code units needing 2 UTF8 bytes (SSE2 / NEON)
+    /// or only of code units needing 3 UTF8 bytes that are not surrogates (AVX2 / NEON) to UTF8.
+    /// It stops at first block not matching, that should be converted one code unit at a time.
+    /// @param it The UTF16LE source (no alignment required), advanced past converted code units
+    /// @param end End of the UTF16LE source
+    /// @param utf8 The UTF8 destination, advanced past written bytes
+    /// @param utf8End End of the UTF8 destination (it's never written past it)
+    /// @note First two code units (or first and last of the block with NEON) are checked before any vector instruction
+    SC_COMPILER_FORCE_INLINE static void narrowUTF16Blocks(const char*& it, const char* end, char*& utf8,
+                                                           const char* utf8End)
+    {
+#if SC_STRING_SEARCH_SSE2 || SC_STRING_SEARCH_NEON
+#if SC_STRING_SEARCH_SSE2
+        constexpr size_t BlockUnits  = 8;
+        constexpr size_t CheckedUnit = 1;
+#else
+        constexpr size_t BlockUnits  = 16;
+        constexpr size_t CheckedUnit = BlockUnits - 1;
+#endif
+        if (static_cast<size_t>(end - it) < BlockUnits * 2)
+        {
+            return;
+        }
+        const auto bytesFor = [it](size_t index) -> int
+        {
+            const uint8_t* bytes    = reinterpret_cast<const uint8_t*>(it) + index * 2;
+            const uint32_t codeUnit = bytes[0] | (static_cast<uint32_t>(bytes[1]) << 8);
+            return codeUnit < 0x80 ? 1 : codeUnit < 0x800 ? 2 : (codeUnit & 0xF800) == 0xD800 ? 4 : 3;
+        };
+        const int numBytes = bytesFor(0);
+        if (numBytes != bytesFor(CheckedUnit))
+        {
+            return;
+        }
+        if (numBytes == 2)
+        {
+            narrowUTF16TwoBytes(it, end, utf8, utf8End);
+        }
+        else if (numBytes == 3)
+        {
+#if SC_STRING_SEARCH_SSE2
+            if (isAVX2Available())
+            {
+                narrowUTF16ThreeBytesAVX2(it, end, utf8, utf8End);
+            }
+#else
+            narrowUTF16ThreeBytes(it, end, utf8, utf8End);
+#endif
+        }
+#else
+        (void)it;
+        (void)end;
+        (void)utf8;
+        (void)utf8End;
+#endif
+    }
+
+    /// @brief Checks that `text` is well-formed UTF8 (no overlong forms, surrogates or code points above U+10FFFF).
+    /// ASCII runs are skipped with vector instructions, validating multi-byte sequences one by one.
+    [[nodiscard]] static bool isValidUTF8(const char* text, size_t textLength)
+    {
+        const uint8_t* it  = reinterpret_cast<const uint8_t*>(text);
+        const uint8_t* end = it + textLength;
+        while (it < end)
+        {
+            it += countASCII(reinterpret_cast<const char*>(it), static_cast<size_t>(end - it));
+            uint32_t codePoint;
+            while (it < end and *it >= 0x80)
+            {
+                if (not decodeUTF8Sequence(it, end, codePoint))
+                {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    /// @brief Decodes the multi-byte UTF8 sequence starting at `it`, advancing it past the sequence.
+    /// Continuation bytes, truncated sequences, overlong forms, surrogates and code points above U+10FFFF are not
+    /// well-formed (see table 3-7 of the Unicode standard) and return `false`.
+    /// @note `it` is advanced by a constant in each branch, so that next iteration of decoding loops doesn't need to
+    /// wait for validation of current sequence (that would serialize them).
+    [[nodiscard]] SC_COMPILER_FORCE_INLINE static bool decodeUTF8Sequence(const uint8_t*& it, const uint8_t* end,
+                                                                          uint32_t& codePoint)
+    {
+        const uint32_t lead      = it[0];
+        const size_t   available = static_cast<size_t>(end - it);
+        if (lead < 0xE0)
+        {
+            if (lead < 0xC2 or available < 2 or (it[1] & 0xC0) != 0x80)
+            {
+                return false; // Continuation byte, overlong (C0, C1) or truncated
+            }
+            codePoint = ((lead & 0x1F) << 6) | (it[1] & 0x3Fu);
+            it += 2;
+            return true;
+        }
+        if (lead < 0xF0)
+        {
+            if (available < 3 or (it[1] & 0xC0) != 0x80 or (it[2] & 0xC0) != 0x80)
+            {
+                return false;
+            }
+            codePoint = ((lead & 0x0F) << 12) | ((it[1] & 0x3Fu) << 6) | (it[2] & 0x3Fu);
+            if (codePoint < 0x800 or (codePoint >= 0xD800 and codePoint <= 0xDFFF))
+            {
+                return false; // Overlong or surrogate
+            }
+            it += 3;
+            return true;
+        }
+        if (available < 4 or (it[1] & 0xC0) != 0x80 or (it[2] & 0xC0) != 0x80 or (it[3] & 0xC0) != 0x80)
+        {
+            return false;
+        }
+        codePoint = ((lead & 0x07) << 18) | ((it[1] & 0x3Fu) << 12) | ((it[2] & 0x3Fu) << 6) | (it[3] & 0x3Fu);
+        if (lead > 0xF4 or codePoint < 0x10000 or codePoint > 0x10FFFF)
+        {
+            return false; // Overlong or above U+10FFFF
+        }
+        it += 4;
+        return true;
+    }
+
+    /// @brief Counts UTF16 code units needed to encode UTF8 `text` (exact only if `text` is well-formed).
+    /// It's the number of bytes that are not continuation bytes, plus one for each 4 bytes sequence (surrogate pair).
+    [[nodiscard]] static size_t countUTF16CodeUnits(const char* text, size_t textLength)
+    {
+        const char* it    = text;
+        const char* end   = text + textLength;
+        size_t      count = 0;
+#if SC_STRING_SEARCH_SSE2
+        const __m128i continuationLimit = _mm_set1_epi8(static_cast<char>(0xC0)); // Signed -64
+        const __m128i fourBytesLead     = _mm_set1_epi8(static_cast<char>(0xEF));
+        const __m128i two               = _mm_set1_epi8(2);
+        const __m128i zero              = _mm_setzero_si128();
+        __m128i       sums              = zero;
+        for (; static_cast<size_t>(end - it) >= BlockSize; it += BlockSize)
+        {
+            const Block block = load(it);
+            // Comparisons produce -1 where true. Continuation bytes (0x80 - 0xBF) are less than 0xC0 when signed and
+            // bytes below 0xF0 are the ones where unsigned saturated subtraction of 0xEF is zero.
+            const Block continuations     = _mm_cmplt_epi8(block, continuationLimit);
+            const Block notFourBytesLeads = equals(_mm_subs_epu8(block, fourBytesLead), zero);
+            // Each byte becomes 0 (continuation), 1 or 2 (four bytes lead), summed with the "sum of absolute
+            // differences" instruction into two 64 bit lanes.
+            const Block codeUnits = _mm_add_epi8(two, _mm_add_epi8(continuations, notFourBytesLeads));
+            sums                  = _mm_add_epi64(sums, _mm_sad_epu8(codeUnits, zero));
+        }
+        count += sumLanes(sums);
+#elif SC_STRING_SEARCH_NEON
+        for (; static_cast<size_t>(end - it) >= BlockSize; it += BlockSize)
+        {
+            const Block block = load(it);
+            // Each comparison produces 0xFF (-1) for the lanes where it's true
+            const uint8x16_t notContinuations = vmvnq_u8(vandq_u8(vcgeq_u8(block, vdupq_n_u8(0x80)), //
+                                                                  vcleq_u8(block, vdupq_n_u8(0xBF))));
+            const uint8x16_t fourBytesLeads   = vcgeq_u8(block, vdupq_n_u8(0xF0));
+            count += vaddvq_u8(vshrq_n_u8(notContinuations, 7)) + vaddvq_u8(vshrq_n_u8(fourBytesLeads, 7));
+        }
+#endif
+        for (; it < end; ++it)
+        {
+            const uint8_t byte = static_cast<uint8_t>(*it);
+            count += ((byte & 0xC0) != 0x80 ? 1 : 0) + (byte >= 0xF0 ? 1 : 0);
+        }
+        return count;
+    }
+
+    /// @brief Counts UTF8 bytes needed to encode UTF16LE `text` (exact only if `text` is well-formed).
+    /// Code units need 1 (ASCII), 2 (< U+0800) or 3 bytes, while surrogates need 2 bytes (4 for the pair).
+    [[nodiscard]] static size_t countUTF8Bytes(const char* text, size_t numCodeUnits)
+    {
+        const char* it    = text;
+        const char* end   = text + numCodeUnits * 2;
+        size_t      count = 0;
+#if SC_STRING_SEARCH_SSE2
+        const __m128i zero         = _mm_setzero_si128();
+        const __m128i three        = _mm_set1_epi16(3);
+        const __m128i nonASCIIBits = _mm_set1_epi16(static_cast<short>(0xFF80));
+        const __m128i twoBytesBits = _mm_set1_epi16(static_cast<short>(0xF800));
+        const __m128i surrogate    = _mm_set1_epi16(static_cast<short>(0xD800));
+        __m128i       sums         = zero;
+        for (; static_cast<size_t>(end - it) >= BlockSize; it += BlockSize)
+        {
+            const Block block = load(it);
+            // Comparisons produce -1 for each of the 8 code units where they're true
+            const Block upperBits  = _mm_and_si128(block, twoBytesBits);
+            const Block ascii      = _mm_cmpeq_epi16(_mm_and_si128(block, nonASCIIBits), zero);
+            const Block belowU800  = _mm_cmpeq_epi16(upperBits, zero);
+            const Block surrogates = _mm_cmpeq_epi16(upperBits, surrogate);
+            // Each code unit becomes 1, 2 or 3 (fitting in its low byte), summed with "sum of absolute differences"
+            const Block bytes = _mm_add_epi16(_mm_add_epi16(three, ascii), _mm_add_epi16(belowU800, surrogates));
+            sums              = _mm_add_epi64(sums, _mm_sad_epu8(bytes, zero));
+        }
+        count += sumLanes(sums);
+#elif SC_STRING_SEARCH_NEON
+        for (; static_cast<size_t>(end - it) >= BlockSize; it += BlockSize)
+        {
+            const uint16x8_t block      = vreinterpretq_u16_u8(load(it));
+            const uint16x8_t ascii      = vcltq_u16(block, vdupq_n_u16(0x80));
+            const uint16x8_t belowU800  = vcltq_u16(block, vdupq_n_u16(0x800));
+            const uint16x8_t surrogates = vceqq_u16(vandq_u16(block, vdupq_n_u16(0xF800)), vdupq_n_u16(0xD800));
+            const uint16x8_t saved      = vaddq_u16(vaddq_u16(vshrq_n_u16(ascii, 15), vshrq_n_u16(belowU800, 15)),
+                                                    vshrq_n_u16(surrogates, 15));
+            count += 3 * (BlockSize / 2) - vaddvq_u16(saved);
+        }
+#endif
+        for (; it < end; it += 2)
+        {
+            const uint8_t* bytes    = reinterpret_cast<const uint8_t*>(it);
+            const uint32_t codeUnit = bytes[0] | (static_cast<uint32_t>(bytes[1]) << 8);
+            count += codeUnit < 0x80 ? 1 : (codeUnit < 0x800 or (codeUnit & 0xF800) == 0xD800) ? 2 : 3;
+        }
+        return count;
+    }
+
+  private:
+    static bool isInSet(char character, const char* set, size_t setSize)
+    {
+        for (size_t idx = 0; idx < setSize; ++idx)
+        {
+            if (character == set[idx])
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    static int lowestBit(uint64_t value)
+    {
+#if SC_COMPILER_MSVC
+        unsigned long index;
+        _BitScanForward64(&index, value);
+        return static_cast<int>(index);
+#else
+        return __builtin_ctzll(value);
+#endif
+    }
+
+    static int highestBit(uint64_t value)
+    {
+#if SC_COMPILER_MSVC
+        unsigned long index;
+        _BitScanReverse64(&index, value);
+        return static_cast<int>(index);
+#else
+        return 63 - __builtin_clzll(value);
+#endif
+    }
+
+    // 16 bytes blocks, with SSE2 (always available on x86_64) or NEON (always available on ARM64)
+#if SC_STRING_SEARCH_SSE2
+    using Block = __m128i;
+
+    static constexpr size_t BlockSize       = 16;
+    static constexpr int    MaskBitsPerByte = 1; // movemask produces one bit for each byte
+
+    static Block    load(const char* src) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(src)); }
+    static Block    splat(char value) { return _mm_set1_epi8(value); }
+    static Block    equals(Block first, Block second) { return _mm_cmpeq_epi8(first, second); }
+    static Block    both(Block first, Block second) { return _mm_and_si128(first, second); }
+    static Block    either(Block first, Block second) { return _mm_or_si128(first, second); }
+    static uint64_t toMask(Block matches) { return static_cast<uint32_t>(_mm_movemask_epi8(matches)); }
+    static uint64_t nonASCIIMask(Block block) { return static_cast<uint32_t>(_mm_movemask_epi8(block)); }
+
+    static size_t sumLanes(__m128i sums)
+    {
+        return static_cast<size_t>(_mm_cvtsi128_si64(sums) + _mm_cvtsi128_si64(_mm_unpackhi_epi64(sums, sums)));
+    }
+#elif SC_STRING_SEARCH_NEON
+    using Block = uint8x16_t;
+
+    static constexpr size_t BlockSize       = 16;
+    static constexpr int    MaskBitsPerByte = 4; // shift right and narrow produces one nibble for each byte
+
+    static Block load(const char* src) { return vld1q_u8(reinterpret_cast<const uint8_t*>(src)); }
+    static Block splat(char value) { return vdupq_n_u8(static_cast<uint8_t>(value)); }
+    static Block equals(Block first, Block second) { return vceqq_u8(first, second); }
+    static Block both(Block first, Block second) { return vandq_u8(first, second); }
+    static Block either(Block first, Block second) { return vorrq_u8(first, second); }
+
+    static uint64_t toMask(Block matches)
+    {
+        return vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(matches), 4)), 0);
+    }
+    static uint64_t nonASCIIMask(Block block) { return toMask(vcgeq_u8(block, vdupq_n_u8(0x80))); }
+#endif
+
+#if SC_STRING_SEARCH_SSE2 || SC_STRING_SEARCH_NEON
+    static Block equalsAnyOf(Block block, const Block* needles, size_t numNeedles)
+    {
+        Block matches = equals(block, needles[0]);
+        for (size_t idx = 1; idx < numNeedles; ++idx)
+        {
+            matches = either(matches, equals(block, needles[idx]));
+        }
+        return matches;
+    }
+
+    /// @brief Verifies candidates in the mask (positions where first and last byte of pattern are matching)
+    static bool findCandidate(uint64_t mask, const char* it, const char* pattern, size_t patternLength,
+                              const char*& found)
+    {
+        constexpr uint64_t ByteMask = (uint64_t(1) << MaskBitsPerByte) - 1;
+        while (mask != 0)
+        {
+            const int   index     = lowestBit(mask) / MaskBitsPerByte;
+            const char* candidate = it + index;
+            if (::memcmp(candidate + 1, pattern + 1, patternLength - 2) == 0)
+            {
+                found = candidate;
+                return true;
+            }
+            mask &= ~(ByteMask << (index * MaskBitsPerByte));
+        }
+        return false;
+    }
+#endif
+
+#if SC_STRING_SEARCH_SSE2
+    // 8 sequences of 2 bytes (16 bytes) are decoded in 16 bit lanes, converting only the leading well-formed sequences
+    // of the last block (where code units after them are written too, but they will be overwritten by next conversions)
+    static void widenUTF8TwoBytes(const uint8_t*& it, const uint8_t* end, char*& utf16, const char* utf16End)
+    {
+        // Lead bytes (0xC2 - 0xDF) must be at even positions and continuation bytes (0x80 - 0xBF) at odd ones.
+        // Comparisons are signed, so continuation bytes are the ones less than 0xC0 (-64).
+        const __m128i continuationLimit = _mm_set1_epi8(static_cast<char>(0xC0));
+        const __m128i leadLow           = _mm_set1_epi8(static_cast<char>(0xC1));
+        const __m128i leadHigh          = _mm_set1_epi8(static_cast<char>(0xE0));
+        const __m128i leadBits          = _mm_set1_epi16(0x1F);
+        const __m128i continuationBits  = _mm_set1_epi16(0x3F);
+        while (end - it >= 16 and utf16End - utf16 >= 16)
+        {
+            const Block block         = load(reinterpret_cast<const char*>(it));
+            const Block continuations = _mm_cmplt_epi8(block, continuationLimit);
+            const Block leads = both(_mm_cmpgt_epi8(block, leadLow), _mm_cmplt_epi8(block, leadHigh));
+            // Bytes that are not where they should be in a block of 2 bytes sequences
+            const uint64_t misplaced = (toMask(continuations) ^ 0xAAAA) | (toMask(leads) ^ 0x5555);
+            // Each 16 bit lane holds lead byte in the low byte and continuation byte in the high byte
+            const Block codeUnits = either(_mm_slli_epi16(_mm_and_si128(block, leadBits), 6),
+                                           _mm_and_si128(_mm_srli_epi16(block, 8), continuationBits));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(utf16), codeUnits);
+            if (misplaced == 0)
+            {
+                it += 16; // Advancing by a constant doesn't make next block wait for this one to be validated
+                utf16 += 16;
+                continue;
+            }
+            const int numSequences = lowestBit(misplaced) / 2;
+            it += numSequences * 2;
+            utf16 += numSequences * 2;
+            break;
+        }
+    }
+
+    // 8 code units (16 bytes) in the [U+0080, U+07FF] range are encoded in 16 bit lanes, converting only the leading
+    // valid ones of the last block (see widenUTF8TwoBytes)
+    static void narrowUTF16TwoBytes(const char*& it, const char* end, char*& utf8, const char* utf8End)
+    {
+        const __m128i zero         = _mm_setzero_si128();
+        const __m128i twoBytesBits = _mm_set1_epi16(static_cast<short>(0xF800));
+        const __m128i nonASCIIBits = _mm_set1_epi16(static_cast<short>(0xFF80));
+        const __m128i markers      = _mm_set1_epi16(static_cast<short>(0x80C0));
+        const __m128i lowBits      = _mm_set1_epi16(0x3F);
+        while (end - it >= 16 and utf8End - utf8 >= 16)
+        {
+            const Block block   = load(it);
+            const Block ascii   = _mm_cmpeq_epi16(_mm_and_si128(block, nonASCIIBits), zero);
+            const Block twoByte = _mm_cmpeq_epi16(_mm_and_si128(block, twoBytesBits), zero);
+            const uint64_t invalid = toMask(_mm_andnot_si128(ascii, twoByte)) ^ 0xFFFF; // 2 bits per code unit
+            // Lead byte (0xC0 | upper 5 bits) goes in the low byte and continuation (0x80 | lower 6 bits) in high byte
+            const Block bytes = either(markers, either(_mm_srli_epi16(block, 6),
+                                                       _mm_slli_epi16(_mm_and_si128(block, lowBits), 8)));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(utf8), bytes);
+            if (invalid == 0)
+            {
+                it += 16; // Advancing by a constant doesn't make next block wait for this one to be validated
+                utf8 += 16;
+                continue;
+            }
+            const int numValid = lowestBit(invalid) / 2;
+            it += numValid * 2;
+            utf8 += numValid * 2;
+            break;
+        }
+    }
+#elif SC_STRING_SEARCH_NEON
+    // De-interleaving loads split lead and continuation bytes of 16 sequences (48 bytes) in separate registers
+    static void widenUTF8ThreeBytes(const uint8_t*& it, const uint8_t* end, char*& utf16, const char* utf16End)
+    {
+        const auto decode = [](uint8x8_t lead, uint8x8_t first, uint8x8_t second)
+        {
+            return vorrq_u16(vorrq_u16(vshlq_n_u16(vmovl_u8(vand_u8(lead, vdup_n_u8(0x0F))), 12),
+                                       vshlq_n_u16(vmovl_u8(vand_u8(first, vdup_n_u8(0x3F))), 6)),
+                             vmovl_u8(vand_u8(second, vdup_n_u8(0x3F))));
+        };
+        const auto isInvalid = [](uint16x8_t codeUnits) // Overlong forms (< U+0800) and surrogates
+        {
+            return vorrq_u16(vcltq_u16(codeUnits, vdupq_n_u16(0x800)),
+                             vceqq_u16(vandq_u16(codeUnits, vdupq_n_u16(0xF800)), vdupq_n_u16(0xD800)));
+        };
+        const auto isContinuation = [](uint8x16_t bytes)
+        { return vceqq_u8(vandq_u8(bytes, vdupq_n_u8(0xC0)), vdupq_n_u8(0x80)); };
+        while (end - it >= 48 and utf16End - utf16 >= 32)
+        {
+            const uint8x16x3_t bytes = vld3q_u8(it);
+            const uint8x16_t   leads = vceqq_u8(vandq_u8(bytes.val[0], vdupq_n_u8(0xF0)), vdupq_n_u8(0xE0));
+            if (vminvq_u8(vandq_u8(leads, vandq_u8(isContinuation(bytes.val[1]), isContinuation(bytes.val[2])))) == 0)
+            {
+                break;
+            }
+            const uint16x8_t low =
+                decode(vget_low_u8(bytes.val[0]), vget_low_u8(bytes.val[1]), vget_low_u8(bytes.val[2]));
+            const uint16x8_t high =
+                decode(vget_high_u8(bytes.val[0]), vget_high_u8(bytes.val[1]), vget_high_u8(bytes.val[2]));
+            if (vmaxvq_u16(vorrq_u16(isInvalid(low), isInvalid(high))) != 0)
+            {
+                break;
+            }
+            vst1q_u8(reinterpret_cast<uint8_t*>(utf16), vreinterpretq_u8_u16(low));
+            vst1q_u8(reinterpret_cast<uint8_t*>(utf16 + BlockSize), vreinterpretq_u8_u16(high));
+            it += 48;
+            utf16 += 32;
+        }
+    }
+
+    // De-interleaving loads split lead and continuation bytes of 16 sequences (32 bytes) in separate registers
+    static void widenUTF8TwoBytes(const uint8_t*& it, const uint8_t* end, char*& utf16, const char* utf16End)
+    {
+        while (end - it >= 32 and utf16End - utf16 >= 32)
+        {
+            const uint8x16x2_t bytes = vld2q_u8(it);
+            // Lead bytes must be in the 0xC2 - 0xDF range (C0 and C1 are overlong forms)
+            const uint8x16_t leads = vcleq_u8(vsubq_u8(bytes.val[0], vdupq_n_u8(0xC2)), vdupq_n_u8(0xDF - 0xC2));
+            const uint8x16_t continuations = vceqq_u8(vandq_u8(bytes.val[1], vdupq_n_u8(0xC0)), vdupq_n_u8(0x80));
+            if (vminvq_u8(vandq_u8(leads, continuations)) == 0)
+            {
+                break;
+            }
+            const uint8x16_t lead  = vandq_u8(bytes.val[0], vdupq_n_u8(0x1F));
+            const uint8x16_t other = vandq_u8(bytes.val[1], vdupq_n_u8(0x3F));
+            const uint16x8_t low =
+                vorrq_u16(vshlq_n_u16(vmovl_u8(vget_low_u8(lead)), 6), vmovl_u8(vget_low_u8(other)));
+            const uint16x8_t high = vorrq_u16(vshlq_n_u16(vmovl_high_u8(lead), 6), vmovl_high_u8(other));
+            vst1q_u8(reinterpret_cast<uint8_t*>(utf16), vreinterpretq_u8_u16(low));
+            vst1q_u8(reinterpret_cast<uint8_t*>(utf16 + BlockSize), vreinterpretq_u8_u16(high));
+            it += 32;
+            utf16 += 32;
+        }
+    }
+
+    // Interleaving stores merge the 3 bytes of 16 code units (32 bytes) computed in separate registers
+    static void narrowUTF16ThreeBytes(const char*& it, const char* end, char*& utf8, const char* utf8End)
+    {
+        const auto isInvalid = [](uint16x8_t codeUnits) // Below U+0800 or surrogates
+        {
+            return vorrq_u16(vcltq_u16(codeUnits, vdupq_n_u16(0x800)),
+                             vceqq_u16(vandq_u16(codeUnits, vdupq_n_u16(0xF800)), vdupq_n_u16(0xD800)));
+        };
+        const uint8x16_t lowBits = vdupq_n_u8(0x3F);
+        while (end - it >= 32 and utf8End - utf8 >= 48)
+        {
+            const uint16x8_t low  = vreinterpretq_u16_u8(load(it));
+            const uint16x8_t high = vreinterpretq_u16_u8(load(it + BlockSize));
+            if (vmaxvq_u16(vorrq_u16(isInvalid(low), isInvalid(high))) != 0)
+            {
+                break;
+            }
+            uint8x16x3_t bytes;
+            bytes.val[0] = vorrq_u8(vcombine_u8(vmovn_u16(vshrq_n_u16(low, 12)), vmovn_u16(vshrq_n_u16(high, 12))),
+                                    vdupq_n_u8(0xE0));
+            bytes.val[1] = vorrq_u8(vandq_u8(vcombine_u8(vshrn_n_u16(low, 6), vshrn_n_u16(high, 6)), lowBits),
+                                    vdupq_n_u8(0x80));
+            bytes.val[2] = vorrq_u8(vandq_u8(vcombine_u8(vmovn_u16(low), vmovn_u16(high)), lowBits), vdupq_n_u8(0x80));
+            vst3q_u8(reinterpret_cast<uint8_t*>(utf8), bytes);
+            it += 32;
+            utf8 += 48;
+        }
+    }
+
+    // Interleaving stores merge lead and continuation bytes of 16 code units (32 bytes) computed in separate registers
+    static void narrowUTF16TwoBytes(const char*& it, const char* end, char*& utf8, const char* utf8End)
+    {
+        while (end - it >= 32 and utf8End - utf8 >= 32)
+        {
+            const uint16x8_t low  = vreinterpretq_u16_u8(load(it));
+            const uint16x8_t high = vreinterpretq_u16_u8(load(it + BlockSize));
+            if (vminvq_u16(vminq_u16(low, high)) < 0x80 or vmaxvq_u16(vmaxq_u16(low, high)) > 0x7FF)
+            {
+                break;
+            }
+            uint8x16x2_t bytes;
+            bytes.val[0] = vorrq_u8(vcombine_u8(vshrn_n_u16(low, 6), vshrn_n_u16(high, 6)), vdupq_n_u8(0xC0));
+            bytes.val[1] = vorrq_u8(vandq_u8(vcombine_u8(vmovn_u16(low), vmovn_u16(high)), vdupq_n_u8(0x3F)),
+                                    vdupq_n_u8(0x80));
+            vst2q_u8(reinterpret_cast<uint8_t*>(utf8), bytes);
+            it += 32;
+            utf8 += 32;
+        }
+    }
+#endif
+
+#if SC_STRING_SEARCH_SSE2
+    // 32 bytes blocks with AVX2, selected at runtime as it's not part of x86_64 baseline
+    static bool isAVX2Available()
+    {
+        static const bool available = []()
+        {
+#if SC_COMPILER_MSVC
+            int info[4];
+            __cpuid(info, 1);
+            const bool osSavesYMM = (info[2] & (1 << 27)) != 0 and (_xgetbv(0) & 6) == 6;
+            __cpuidex(info, 7, 0);
+            return osSavesYMM and (info[1] & (1 << 5)) != 0;
+#else
+            return __builtin_cpu_supports("avx2") != 0;
+#endif
+        }();
+        return available;
+    }
+
+    SC_STRING_SEARCH_TARGET_AVX2
+    static bool findStringAVX2(const char*& it, const char* last, const char* pattern, size_t patternLength,
+                               const char*& found)
+    {
+        const __m256i first    = _mm256_set1_epi8(pattern[0]);
+        const __m256i lastByte = _mm256_set1_epi8(pattern[patternLength - 1]);
+        for (; last - it >= 31; it += 32) // Signed comparison as `it` can step past `last`
+        {
+            const __m256i block0  = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(it));
+            const __m256i block1  = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(it + patternLength - 1));
+            const __m256i matches = _mm256_and_si256(_mm256_cmpeq_epi8(block0, first), //
+                                                     _mm256_cmpeq_epi8(block1, lastByte));
+            if (findCandidate(static_cast<uint32_t>(_mm256_movemask_epi8(matches)), it, pattern, patternLength, found))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    SC_STRING_SEARCH_TARGET_AVX2
+    static bool findAnyOfAVX2(const char*& it, const char* textEnd, const char* set, size_t setSize,
+                              const char*& found)
+    {
+        __m256i needles[MaxSetSize];
+        for (size_t idx = 0; idx < setSize; ++idx)
+        {
+            needles[idx] = _mm256_set1_epi8(set[idx]);
+        }
+        for (; static_cast<size_t>(textEnd - it) >= 32; it += 32)
+        {
+            const __m256i block   = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(it));
+            __m256i       matches = _mm256_cmpeq_epi8(block, needles[0]);
+            for (size_t idx = 1; idx < setSize; ++idx)
+            {
+                matches = _mm256_or_si256(matches, _mm256_cmpeq_epi8(block, needles[idx]));
+            }
+            const uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(matches));
+            if (mask != 0)
+            {
+                found = it + lowestBit(mask);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    SC_STRING_SEARCH_TARGET_AVX2
+    static bool countASCIIAVX2(const char*& it, const char* end)
+    {
+        for (; static_cast<size_t>(end - it) >= 32; it += 32)
+        {
+            const __m256i  block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(it));
+            const uint32_t mask  = static_cast<uint32_t>(_mm256_movemask_epi8(block));
+            if (mask != 0)
+            {
+                it += lowestBit(mask);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // 8 sequences of 3 bytes (24 bytes) are gathered in 32 bit lanes, decoded and validated together.
+    // Only the leading well-formed sequences of the last block are converted (see widenUTF8TwoBytes), so that short
+    // runs need a single step.
+    SC_STRING_SEARCH_TARGET_AVX2
+    static void widenUTF8ThreeBytesAVX2(const uint8_t*& it, const uint8_t* end, char*& utf16, const char* utf16End)
+    {
+        // Comparisons are signed, so continuation bytes (0x80 - 0xBF) are the ones less than 0xC0 (-64)
+        const __m256i continuationLimit = _mm256_set1_epi8(static_cast<char>(0xC0));
+        const __m256i leadLow           = _mm256_set1_epi8(static_cast<char>(0xDF));
+        const __m256i leadHigh          = _mm256_set1_epi8(static_cast<char>(0xF0));
+        const __m256i gather = _mm256_setr_epi8(2, 1, 0, -1, 5, 4, 3, -1, 8, 7, 6, -1, 11, 10, 9, -1, //
+                                                2, 1, 0, -1, 5, 4, 3, -1, 8, 7, 6, -1, 11, 10, 9, -1);
+        const __m256i continuationBits = _mm256_set1_epi32(0x3F);
+        const __m256i leadBits         = _mm256_set1_epi32(0x0F);
+        const __m256i surrogateBits    = _mm256_set1_epi32(0xF800);
+        const __m256i surrogate        = _mm256_set1_epi32(0xD800);
+        const __m256i minimum          = _mm256_set1_epi32(0x800);
+        while (end - it >= 32 and utf16End - utf16 >= 16)
+        {
+            const __m256i  block         = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(it));
+            const uint32_t continuations = static_cast<uint32_t>(
+                _mm256_movemask_epi8(_mm256_cmpgt_epi8(continuationLimit, block)));
+            const uint32_t leads = static_cast<uint32_t>(_mm256_movemask_epi8(
+                _mm256_and_si256(_mm256_cmpgt_epi8(block, leadLow), _mm256_cmpgt_epi8(leadHigh, block))));
+            // Bytes that are not where they should be in a block of 3 bytes sequences
+            const uint32_t misplaced = ((continuations ^ 0xDB6DB6) | (leads ^ 0x249249)) & 0xFFFFFF;
+            // Each 32 bit lane gets last continuation byte in the low byte and lead byte in the third byte
+            const __m128i low      = _mm_loadu_si128(reinterpret_cast<const __m128i*>(it));
+            const __m128i high     = _mm_loadu_si128(reinterpret_cast<const __m128i*>(it + 12));
+            const __m256i bytes    = _mm256_shuffle_epi8(_mm256_inserti128_si256(_mm256_castsi128_si256(low), high, 1),
+                                                         gather);
+            const __m256i codeUnit = _mm256_or_si256(
+                _mm256_or_si256(_mm256_and_si256(bytes, continuationBits),
+                                _mm256_slli_epi32(_mm256_and_si256(_mm256_srli_epi32(bytes, 8), continuationBits), 6)),
+                _mm256_slli_epi32(_mm256_and_si256(_mm256_srli_epi32(bytes, 16), leadBits), 12));
+            // Overlong forms (< U+0800) and surrogates
+            const __m256i invalid =
+                _mm256_or_si256(_mm256_cmpgt_epi32(minimum, codeUnit),
+                                _mm256_cmpeq_epi32(_mm256_and_si256(codeUnit, surrogateBits), surrogate));
+            const uint32_t invalidMask = static_cast<uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(invalid)));
+            const __m256i  packed = _mm256_permute4x64_epi64(_mm256_packus_epi32(codeUnit, codeUnit), 0x08);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(utf16), _mm256_castsi256_si128(packed));
+            if ((misplaced | invalidMask) == 0)
+            {
+                it += 24; // Advancing by a constant doesn't make next block wait for this one to be validated
+                utf16 += 16;
+                continue;
+            }
+            const int numValid = lowestBit(invalidMask | (1u << (lowestBit(misplaced | 0x1000000) / 3)));
+            it += numValid * 3;
+            utf16 += numValid * 2;
+            break;
+        }
+    }
+
+    // 8 code units (16 bytes) are expanded to 32 bit lanes, encoded and compacted to 24 bytes.
+    // Only the leading valid code units of the last block are converted (see widenUTF8TwoBytes).
+    SC_STRING_SEARCH_TARGET_AVX2
+    static void narrowUTF16ThreeBytesAVX2(const char*& it, const char* end, char*& utf8, const char* utf8End)
+    {
+        const __m128i zero          = _mm_setzero_si128();
+        const __m128i upperBits     = _mm_set1_epi16(static_cast<short>(0xF800));
+        const __m128i surrogate     = _mm_set1_epi16(static_cast<short>(0xD800));
+        const __m256i lowBits       = _mm256_set1_epi32(0x3F);
+        const __m256i markers       = _mm256_set1_epi32(0x8080E0);
+        const __m256i compact       = _mm256_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1, //
+                                                       0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1);
+        while (end - it >= 16 and utf8End - utf8 >= 24)
+        {
+            const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(it));
+            // Code units must be >= U+0800 and not surrogates
+            const __m128i upper   = _mm_and_si128(block, upperBits);
+            const __m128i invalid = _mm_or_si128(_mm_cmpeq_epi16(upper, zero), _mm_cmpeq_epi16(upper, surrogate));
+            const uint32_t invalidMask = static_cast<uint32_t>(_mm_movemask_epi8(invalid)); // 2 bits per code unit
+            // Lead byte goes in the low byte of each 32 bit lane, followed by the two continuation bytes
+            const __m256i codeUnit = _mm256_cvtepu16_epi32(block);
+            const __m256i encoded  = _mm256_or_si256(
+                _mm256_or_si256(markers, _mm256_srli_epi32(codeUnit, 12)),
+                _mm256_or_si256(_mm256_slli_epi32(_mm256_and_si256(_mm256_srli_epi32(codeUnit, 6), lowBits), 8),
+                                _mm256_slli_epi32(_mm256_and_si256(codeUnit, lowBits), 16)));
+            const __m256i bytes = _mm256_shuffle_epi8(encoded, compact);
+            // Second store overwrites the 4 unused bytes of the first one
+            const __m128i high      = _mm256_extracti128_si256(bytes, 1);
+            const int     highLast4 = _mm_cvtsi128_si32(_mm_srli_si128(high, 8));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(utf8), _mm256_castsi256_si128(bytes));
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(utf8 + 12), high);
+            ::memcpy(utf8 + 20, &highLast4, sizeof(highLast4));
+            if (invalidMask == 0)
+            {
+                it += 16; // Advancing by a constant doesn't make next block wait for this one to be validated
+                utf8 += 24;
+                continue;
+            }
+            const int numValid = lowestBit(invalidMask) / 2;
+            it += numValid * 2;
+            utf8 += numValid * 3;
+            break;
+        }
+    }
+#endif
+};
+
+/// @brief ASCII and UTF8 iterators can use StringSearch, while UTF16 is searched code point by code point
+template <typename CharIterator>
+struct StringIteratorIsByteSearchable
+{
+    static constexpr bool value = true;
+};
+template <>
+struct StringIteratorIsByteSearchable<StringIteratorUTF16>
+{
+    static constexpr bool value = false;
+};
+} // namespace detail
+} // namespace SC
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: MIT
 
 #include "../../Strings/StringView.h"
+#include "StringSearch.inl"
 
 #include <errno.h>  // errno
 #include <stdint.h> // INT32_MIN/MAX
@@ -367,6 +368,47 @@ bool SC::StringView::isFloatingNumber() const
         });
 }
 
+bool SC::StringView::isValidEncoding() const
+{
+    switch (getEncoding())
+    {
+    case StringEncoding::Ascii: return detail::StringSearch::countASCII(text, textSizeInBytes) == textSizeInBytes;
+    case StringEncoding::Utf8: return detail::StringSearch::isValidUTF8(text, textSizeInBytes);
+    case StringEncoding::Utf16: {
+        if (textSizeInBytes % 2 != 0)
+        {
+            return false;
+        }
+        for (size_t idx = 0; idx < textSizeInBytes; idx += 2)
+        {
+            uint16_t unit;
+            memcpy(&unit, text + idx, sizeof(unit)); // Avoid potential unaligned read
+            if (unit >= 0xD800 and unit <= 0xDBFF)
+            {
+                // High surrogate must be followed by a low surrogate
+                uint16_t nextUnit;
+                if (idx + 4 > textSizeInBytes)
+                {
+                    return false;
+                }
+                memcpy(&nextUnit, text + idx + 2, sizeof(nextUnit));
+                if (nextUnit < 0xDC00 or nextUnit > 0xDFFF)
+                {
+                    return false;
+                }
+                idx += 2;
+            }
+            else if (unit >= 0xDC00 and unit <= 0xDFFF)
+            {
+                return false; // Unpaired low surrogate
+            }
+        }
+        return true;
+    }
+    }
+    Assert::unreachable();
+}
+
 //-----------------------------------------------------------------------------------------------------------------------
 // StringViewTokenizer
 //-----------------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,278 @@
+// Copyright (c) Stefano Cristiano
+// SPDX-License-Identifier: MIT
+#include "Logger.h"
+
+//-----------------------------------------------------------------------------------------------------------------------
+// LoggerArgumentString
+//-----------------------------------------------------------------------------------------------------------------------
+char* SC::LoggerArgumentString::write(char* it, StringView text)
+{
+    const size_t  numBytes = text.sizeInBytes();
+    const uint8_t encoding = static_cast<uint8_t>(text.getEncoding());
+    ::memcpy(it, &numBytes, sizeof(numBytes));
+    it += sizeof(numBytes);
+    ::memcpy(it, &encoding, sizeof(encoding));
+    it += sizeof(encoding);
+    if (numBytes > 0)
+    {
+        ::memcpy(it, text.bytesWithoutTerminator(), numBytes);
+    }
+    return it + numBytes;
+}
+
+SC::StringView SC::LoggerArgumentString::read(const char*& it)
+{
+    size_t  numBytes;
+    uint8_t encoding;
+    ::memcpy(&numBytes, it, sizeof(numBytes));
+    it += sizeof(numBytes);
+    ::memcpy(&encoding, it, sizeof(encoding));
+    it += sizeof(encoding);
+    const StringView text({it, numBytes}, false, static_cast<StringEncoding>(encoding));
+    it += numBytes;
+    return text;
+}
+
+//-----------------------------------------------------------------------------------------------------------------------
+// LoggerProducer
+//-----------------------------------------------------------------------------------------------------------------------
+char* SC::LoggerProducer::beginRecord(size_t argumentsBytes, FormatFunction function, const void* format)
+{
+    // Records are 8 bytes aligned, so that there is always room for the "continue from start" marker at the end
+    const size_t recordBytes = (sizeof(RecordHeader) + argumentsBytes + 7) & ~static_cast<size_t>(7);
+    if (recordBytes > capacity / 2)
+    {
+        // A record of at most half of the ring buffer always fits, even when it must continue from start
+        (void)numDroppedRecords.fetch_add(1);
+        return nullptr;
+    }
+    const uint32_t numBytes = static_cast<uint32_t>(recordBytes);
+
+    bool blocked = false;
+    for (;;)
+    {
+        const uint32_t tail   = static_cast<uint32_t>(tailIndex.load(memory_order_acquire));
+        uint32_t       offset = writeIndex & (capacity - 1);
+        const uint32_t toEnd  = capacity - offset;
+        const uint32_t needed = numBytes <= toEnd ? numBytes : toEnd + numBytes;
+        if (capacity - (writeIndex - tail) >= needed)
+        {
+            if (numBytes > toEnd)
+            {
+                const uint32_t continueFromStart = 0;
+                ::memcpy(memory + offset, &continueFromStart, sizeof(continueFromStart));
+                writeIndex += toEnd;
+                offset = 0;
+            }
+            const RecordHeader header = {numBytes, 0, function, format};
+            ::memcpy(memory + offset, &header, sizeof(header));
+            writeIndex += numBytes; // Published by endRecord, after arguments have been written
+            return memory + offset + sizeof(header);
+        }
+        if (policy == OverflowPolicy::Drop)
+        {
+            (void)numDroppedRecords.fetch_add(1);
+            return nullptr;
+        }
+        if (not blocked)
+        {
+            blocked = true;
+            (void)numBlockedRecords.fetch_add(1);
+        }
+        // Checking tailIndex again after publishing waitingForSpace (both sequentially consistent) ensures that either
+        // the writer thread sees waitingForSpace after consuming records or that this thread sees the updated tail.
+        (void)waitingForSpace.exchange(true);
+        if (static_cast<uint32_t>(tailIndex.load()) == tail)
+        {
+            spaceAvailable.wait();
+        }
+        (void)waitingForSpace.exchange(false);
+    }
+}
+
+void SC::LoggerProducer::endRecord()
+{
+    const int32_t previousHead = headIndex.load(memory_order_relaxed);
+    headIndex.store(static_cast<int32_t>(writeIndex), memory_order_seq_cst);
+    // The writer thread is woken up only when the ring buffer was empty, as otherwise it has been already woken up.
+    // Writer thread stores tailIndex and loads headIndex (both sequentially consistent) before waiting, so either it
+    // sees the new headIndex or this thread sees tailIndex reaching previousHead.
+    if (tailIndex.load() == previousHead)
+    {
+        logger->recordsAvailable.signal();
+    }
+}
+
+//-----------------------------------------------------------------------------------------------------------------------
+// Logger
+//-----------------------------------------------------------------------------------------------------------------------
+struct SC::Logger::Internal
+{
+    static void runWriter(Logger& logger)
+    {
+        while (not logger.stopRequested.load())
+        {
+            if (not writeAllProducers(logger))
+            {
+                logger.recordsAvailable.wait();
+                if (logger.flushIntervalMs > 0 and not logger.stopRequested.load())
+                {
+                    Thread::Sleep(logger.flushIntervalMs); // Lets more records accumulate in the same batch
+                }
+            }
+        }
+    }
+
+    /// @brief Formats records of all producers (removing producerToRemove, if any) and writes them in a single batch
+    /// @return `true` if some record has been consumed (the writer thread must check producers again before waiting)
+    static bool writeAllProducers(Logger& logger, LoggerProducer* producerToRemove = nullptr)
+    {
+        logger.mutex.lock();
+        logger.buffer.clear();
+        StringBuilder builder(logger.buffer, StringEncoding::Utf8, StringBuilder::DoNotClear);
+        bool consumed = false;
+        for (LoggerProducer* producer = logger.producers; producer != nullptr; producer = producer->next)
+        {
+            consumed = formatRecords(*producer, builder) or consumed;
+        }
+        // Producer is removed together with formatting its last records, so that the writer thread can't see it again
+        for (LoggerProducer** it = &logger.producers; producerToRemove != nullptr and *it != nullptr; it = &(*it)->next)
+        {
+            if (*it == producerToRemove)
+            {
+                *it = producerToRemove->next;
+                break;
+            }
+        }
+        // Waiting for the previous batch to be written before releasing mutex keeps batches in order, and it ensures
+        // that all records formatted so far have been written when returning (as needed by flush and removeProducer)
+        logger.writeMutex.lock();
+        const bool hasRecords = not logger.buffer.isEmpty() and logger.writeFunction.isValid();
+        if (hasRecords)
+        {
+            Buffer batch       = move(logger.writeBuffer);
+            logger.writeBuffer = move(logger.buffer);
+            logger.buffer      = move(batch); // Reuses memory of previous batch
+        }
+        logger.mutex.unlock();
+        if (hasRecords)
+        {
+            // StringBuilder keeps a null terminator at the end of the batch
+            const Buffer& batch = logger.writeBuffer;
+            logger.writeFunction(StringView({batch.data(), batch.size() - 1}, true, StringEncoding::Utf8));
+        }
+        logger.writeMutex.unlock();
+        return consumed;
+    }
+
+    /// @return `true` if some record has been consumed
+    static bool formatRecords(LoggerProducer& producer, StringBuilder& builder)
+    {
+        // Sequentially consistent to pair with the tailIndex store (see LoggerProducer::endRecord)
+        const uint32_t headIndex = static_cast<uint32_t>(producer.headIndex.load());
+        const uint32_t tailIndex = static_cast<uint32_t>(producer.tailIndex.load(memory_order_relaxed));
+        uint32_t       readIndex = tailIndex;
+        while (readIndex != headIndex)
+        {
+            const uint32_t offset = readIndex & (producer.capacity - 1);
+
+            LoggerProducer::RecordHeader header;
+            ::memcpy(&header.numBytes, producer.memory + offset, sizeof(header.numBytes));
+            if (header.numBytes == 0)
+            {
+                readIndex += producer.capacity - offset; // Record continues from start of the ring buffer
+                continue;
+            }
+            ::memcpy(&header, producer.memory + offset, sizeof(header));
+            // A record failing to format (for example for an invalid specifier) is just skipped
+            (void)header.function(builder, header.format, producer.memory + offset + sizeof(header));
+            readIndex += header.numBytes;
+        }
+        // Arguments have been formatted into the batch buffer, so their space can be reused
+        producer.tailIndex.store(static_cast<int32_t>(readIndex), memory_order_seq_cst);
+        if (producer.waitingForSpace.load())
+        {
+            producer.spaceAvailable.signal();
+        }
+        return readIndex != tailIndex;
+    }
+};
+
+SC::Result SC::Logger::create(Function<void(StringView)>&& function, uint32_t intervalMs)
+{
+    SC_TRY_MSG(not writerThread.wasStarted(), "Logger::create - already created");
+    writeFunction   = move(function);
+    flushIntervalMs = intervalMs;
+    (void)stopRequested.exchange(false);
+    return writerThread.start(
+        [this](Thread& thread)
+        {
+            thread.setThreadName(SC_NATIVE_STR("Logger"));
+            Internal::runWriter(*this);
+        });
+}
+
+SC::Result SC::Logger::destroy()
+{
+    if (writerThread.wasStarted())
+    {
+        (void)stopRequested.exchange(true);
+        recordsAvailable.signal();
+        SC_TRY(writerThread.join());
+    }
+    (void)Internal::writeAllProducers(*this);
+    mutex.lock();
+    while (producers != nullptr)
+    {
+        LoggerProducer* producer = producers;
+        producers                = producer->next;
+        producer->next           = nullptr;
+        producer->logger         = nullptr;
+        producer->memory         = nullptr;
+        producer->capacity       = 0;
+    }
+    mutex.unlock();
+    return Result(true);
+}
+
+SC::Result SC::Logger::addProducer(LoggerProducer& producer, Span<char> memory,
+                                   LoggerProducer::OverflowPolicy policy)
+{
+    SC_TRY_MSG(producer.logger == nullptr, "Logger::addProducer - producer is already registered");
+    SC_TRY_MSG(memory.sizeInBytes() >= 256, "Logger::addProducer - memory must be at least 256 bytes");
+    uint32_t capacity = 256;
+    while (capacity < (1u << 30) and capacity * 2 <= memory.sizeInBytes())
+    {
+        capacity *= 2;
+    }
+    producer.memory     = memory.data();
+    producer.capacity   = capacity;
+    producer.writeIndex = 0;
+    producer.policy     = policy;
+    producer.headIndex.store(0, memory_order_relaxed);
+    producer.tailIndex.store(0, memory_order_relaxed);
+    producer.logger = this;
+
+    mutex.lock();
+    producer.next = producers;
+    producers     = &producer;
+    mutex.unlock();
+    return Result(true);
+}
+
+SC::Result SC::Logger::removeProducer(LoggerProducer& producer)
+{
+    SC_TRY_MSG(producer.logger == this, "Logger::removeProducer - producer is not registered");
+    (void)Internal::writeAllProducers(*this, &producer);
+    producer.next     = nullptr;
+    producer.logger   = nullptr;
+    producer.memory   = nullptr;
+    producer.capacity = 0;
+    return Result(true);
+}
+
+SC::Result SC::Logger::flush()
+{
+    (void)Internal::writeAllProducers(*this);
+    return Result(true);
+}
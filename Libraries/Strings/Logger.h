@@ -0,0 +1,287 @@
+// Copyright (c) Stefano Cristiano
+// SPDX-License-Identifier: MIT
+#pragma once
+#include "../Strings/String.h"
+#include "../Strings/StringBuilder.h"
+#include "../Threading/Atomic.h"
+#include "../Threading/Threading.h"
+
+namespace SC
+{
+struct Logger;
+struct LoggerProducer;
+template <typename T>
+struct LoggerArgument;
+} // namespace SC
+
+//! @addtogroup group_strings
+//! @{
+
+/// @brief Encodes a log argument in binary form when logging, decoding it when formatting on Logger writer thread.
+/// The generic version copies bytes of trivially copyable types (numbers, `char`, `bool` and pointers).
+/// Strings are copied with their encoding and decoded as StringView.
+template <typename T>
+struct SC::LoggerArgument
+{
+    static_assert(TypeTraits::IsTriviallyCopyable<T>::value, "Type cannot be logged (specialize LoggerArgument)");
+
+    static size_t size(const T&) { return sizeof(T); }
+
+    static char* write(char* it, const T& value)
+    {
+        ::memcpy(it, &value, sizeof(T));
+        return it + sizeof(T);
+    }
+
+    static T read(const char*& it)
+    {
+        T value;
+        ::memcpy(&value, it, sizeof(T));
+        it += sizeof(T);
+        return value;
+    }
+};
+
+namespace SC
+{
+/// @brief Encodes strings as their length, encoding and bytes, decoding them as a StringView
+struct SC_COMPILER_EXPORT LoggerArgumentString
+{
+    static size_t size(StringView text) { return sizeof(size_t) + 1 + text.sizeInBytes(); }
+
+    static char*      write(char* it, StringView text);
+    static StringView read(const char*& it);
+};
+
+template <>
+struct LoggerArgument<StringView> : public LoggerArgumentString
+{
+};
+
+template <>
+struct LoggerArgument<const char*> : public LoggerArgumentString
+{
+    static StringView view(const char* text) { return StringView::fromNullTerminated(text, StringEncoding::Ascii); }
+
+    static size_t size(const char* text) { return LoggerArgumentString::size(view(text)); }
+    static char*  write(char* it, const char* text) { return LoggerArgumentString::write(it, view(text)); }
+};
+
+template <>
+struct LoggerArgument<String> : public LoggerArgumentString
+{
+    static size_t size(const String& text) { return LoggerArgumentString::size(text.view()); }
+    static char*  write(char* it, const String& text) { return LoggerArgumentString::write(it, text.view()); }
+};
+
+template <int N>
+struct LoggerArgument<SmallString<N>> : public LoggerArgument<String>
+{
+};
+
+template <int N>
+struct LoggerArgument<char[N]> : public LoggerArgumentString
+{
+    static StringView view(const char* text) { return StringView({text, N - 1}, true, StringEncoding::Ascii); }
+
+    static size_t size(const char* text) { return LoggerArgumentString::size(view(text)); }
+    static char*  write(char* it, const char* text) { return LoggerArgumentString::write(it, view(text)); }
+};
+} // namespace SC
+
+/// @brief Single producer / single consumer ring buffer where a thread writes log records consumed by a SC::Logger.
+///
+/// Each thread logging must use its own LoggerProducer, registered with Logger::addProducer.
+/// Logging never formats and it takes a lock only to wake up the writer thread when logging to an empty ring buffer:
+/// arguments are encoded in binary form (see SC::LoggerArgument) together with the format string parsed at compile
+/// time by SC_STRING_FORMAT, and they're formatted later by Logger writer thread.
+/// When the ring buffer is full, the OverflowPolicy decides if the record must be dropped or if the producer must
+/// wait for the writer thread to make some room.
+/// @warning The logging thread must stop logging before the producer is removed (Logger::removeProducer) or before
+/// its Logger is destroyed (Logger::destroy), as they release the ring buffer without synchronizing with logging.
+struct SC::LoggerProducer
+{
+    /// @brief What to do when logging to a full ring buffer
+    enum class OverflowPolicy
+    {
+        Drop,  ///< Record is dropped (and counted by LoggerProducer::getNumDroppedRecords)
+        Block, ///< Logging thread waits for the writer thread (and counts it in LoggerProducer::getNumBlockedRecords)
+    };
+
+    LoggerProducer() = default;
+
+    LoggerProducer(const LoggerProducer&)            = delete;
+    LoggerProducer& operator=(const LoggerProducer&) = delete;
+
+    /// @brief Logs a record, that will be formatted with fmt on Logger writer thread
+    /// @param fmt The format string, obtained with SC_STRING_FORMAT
+    /// @param args Arguments to be formatted (copied in the ring buffer)
+    /// @return `true` if the record has been written in the ring buffer (`false` if it has been dropped)
+    template <int NumSegments, int NumArguments, typename... Types>
+    bool log(const StringFormatCompiled<NumSegments, NumArguments>& fmt, const Types&... args);
+
+    /// @brief Number of records dropped because the ring buffer was full (or because they were bigger than half of it)
+    int32_t getNumDroppedRecords() const { return numDroppedRecords.load(); }
+
+    /// @brief Number of records that had to wait for the writer thread because the ring buffer was full
+    int32_t getNumBlockedRecords() const { return numBlockedRecords.load(); }
+
+  private:
+    friend struct Logger;
+    using FormatFunction = bool (*)(StringBuilder&, const void*, const char*);
+
+    struct RecordHeader
+    {
+        uint32_t       numBytes; // Record size including header (`0` means "continue from start of ring buffer")
+        uint32_t       unused;
+        FormatFunction function;
+        const void*    format;
+    };
+
+    template <typename... Types>
+    struct Decoder;
+
+    template <typename Format, typename... Types>
+    static bool formatRecord(StringBuilder& builder, const void* format, const char* arguments)
+    {
+        return Decoder<Types...>::format(builder, *static_cast<const Format*>(format), arguments);
+    }
+
+    char* beginRecord(size_t argumentsBytes, FormatFunction function, const void* format);
+    void  endRecord();
+
+    // Owned by the logging thread
+    char*          memory     = nullptr;
+    uint32_t       capacity   = 0; // Power of two
+    uint32_t       writeIndex = 0;
+    OverflowPolicy policy     = OverflowPolicy::Drop;
+
+    Atomic<int32_t> headIndex = 0; // Published by logging thread
+    Atomic<int32_t> numDroppedRecords = 0;
+    Atomic<int32_t> numBlockedRecords = 0;
+
+    Atomic<bool> waitingForSpace = false; // Set by logging thread when blocked on a full ring buffer (Block policy)
+    EventObject  spaceAvailable;          // Signaled by writer thread after consuming records, if waitingForSpace
+
+    char padding[64]; // Avoids false sharing of headIndex and tailIndex
+
+    Atomic<int32_t> tailIndex = 0; // Published by writer thread
+
+    // Owned by Logger (protected by its mutex)
+    Logger*         logger = nullptr;
+    LoggerProducer* next   = nullptr;
+};
+
+/// @brief Asynchronous logger formatting and writing records of multiple SC::LoggerProducer on a background thread.
+///
+/// Logging threads only copy the arguments to their own LoggerProducer ring buffer, without formatting or writing to
+/// the (possibly slow) destination, so that for example an event loop is not blocked when stdout is a slow pipe.
+/// The writer thread sleeps until a producer logs to an empty ring buffer, then it waits `flushIntervalMs` milliseconds
+/// to let more records accumulate and it drains all producers, formatting all records in a single buffer, that is
+/// passed to the write function in a single call (without holding any lock).
+/// Records of a single producer are written in order, records of different producers are not ordered among them.
+///
+/// Example:
+/// @snippet Tests/Libraries/Strings/LoggerTest.cpp loggerSnippet
+struct SC::Logger
+{
+    Logger() = default;
+    ~Logger() { (void)destroy(); }
+
+    Logger(const Logger&)            = delete;
+    Logger& operator=(const Logger&) = delete;
+
+    /// @brief Starts the writer thread
+    /// @param writeFunction Called (on the writer thread or by Logger::flush) with batches of formatted records.
+    ///                      Calls are serialized and made in order.
+    /// @param flushIntervalMs How long the writer thread waits, after being woken up by a new record, before writing.
+    ///                        Longer intervals make bigger batches, but producers with the Block policy may wait
+    ///                        that long too (`0` writes records as soon as possible).
+    [[nodiscard]] Result create(Function<void(StringView)>&& writeFunction, uint32_t flushIntervalMs = 1);
+
+    /// @brief Stops the writer thread, writing all pending records and removing all producers
+    /// @warning No producer must be logging while the Logger is destroyed
+    [[nodiscard]] Result destroy();
+
+    /// @brief Registers a producer, that will use the given memory as its ring buffer
+    /// @param producer The producer to register (it must not be already registered)
+    /// @param memory Memory for the ring buffer (it's rounded down to a power of two, minimum 256 bytes).
+    ///               It must be valid until the producer is removed.
+    /// @param policy What to do when logging to a full ring buffer
+    [[nodiscard]] Result addProducer(LoggerProducer& producer, Span<char> memory,
+                                     LoggerProducer::OverflowPolicy policy = LoggerProducer::OverflowPolicy::Drop);
+
+    /// @brief Writes all pending records of the producer and removes it
+    /// @warning The producer must not be logging while it's being removed
+    [[nodiscard]] Result removeProducer(LoggerProducer& producer);
+
+    /// @brief Writes all records logged so far by all producers, before returning
+    [[nodiscard]] Result flush();
+
+  private:
+    friend struct LoggerProducer;
+    struct Internal;
+
+    Function<void(StringView)> writeFunction;
+
+    uint32_t        flushIntervalMs = 1;
+    LoggerProducer* producers       = nullptr;
+    Buffer          buffer;      // Batch of records being formatted
+    Buffer          writeBuffer; // Batch of records being written
+
+    Thread       writerThread;
+    Mutex        mutex;      // Protects producers list and buffer (serializing consumers)
+    Mutex        writeMutex; // Protects writeBuffer and writeFunction (serializing writes, without holding mutex)
+    EventObject  recordsAvailable; // Signaled by producers logging to an empty ring buffer (and by destroy)
+    Atomic<bool> stopRequested = false;
+};
+
+//! @}
+
+//-----------------------------------------------------------------------------------------------------------------------
+// Implementations Details
+//-----------------------------------------------------------------------------------------------------------------------
+template <typename T, typename... Rest>
+struct SC::LoggerProducer::Decoder<T, Rest...>
+{
+    template <typename Format, typename... Decoded>
+    static bool format(StringBuilder& builder, const Format& fmt, const char* it, const Decoded&... decoded)
+    {
+        const auto value = LoggerArgument<T>::read(it);
+        return Decoder<Rest...>::format(builder, fmt, it, decoded..., value);
+    }
+};
+
+template <>
+struct SC::LoggerProducer::Decoder<>
+{
+    template <typename Format, typename... Decoded>
+    static bool format(StringBuilder& builder, const Format& fmt, const char*, const Decoded&... decoded)
+    {
+        return builder.append(fmt, decoded...);
+    }
+};
+
+template <int NumSegments, int NumArguments, typename... Types>
+bool SC::LoggerProducer::log(const StringFormatCompiled<NumSegments, NumArguments>& fmt, const Types&... args)
+{
+    static_assert(NumArguments == static_cast<int>(sizeof...(Types)), "Wrong number of arguments for format string");
+    using Format = StringFormatCompiled<NumSegments, NumArguments>;
+
+    const size_t sizes[] = {0, LoggerArgument<Types>::size(args)...};
+
+    size_t argumentsBytes = 0;
+    for (const size_t size : sizes)
+    {
+        argumentsBytes += size;
+    }
+    char* it = beginRecord(argumentsBytes, &formatRecord<Format, Types...>, &fmt);
+    if (it == nullptr)
+    {
+        return false;
+    }
+    const int written[] = {0, (it = LoggerArgument<Types>::write(it, args), 0)...};
+    SC_COMPILER_UNUSED(written);
+    endRecord();
+    return true;
+}
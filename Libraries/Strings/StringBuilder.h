@@ -67,6 +67,34 @@ struct SC_COMPILER_EXPORT StringBuilder
     template <typename... Types>
     [[nodiscard]] bool append(StringView fmt, Types&&... args);
 
+    /// @brief Formats a format string parsed at compile time with SC_STRING_FORMAT, replacing destination contents.
+    /// A heap destination buffer is reserved once, with an upper bound of the formatted length (see
+    /// StringFormat::maxLength), while inline buffers (SmallString) are never moved to the heap by the reserve alone.
+    /// The format string is not parsed again on every call.
+    /// @note Passing a number of arguments different from what is needed by fmt fails to compile
+    /// @param fmt The format string, obtained with SC_STRING_FORMAT
+    /// @param args arguments to format
+    /// @return `true` if format succeeded
+    /// @n
+    /**
+        @code{.cpp}
+        String        buffer(StringEncoding::Ascii); // Or SmallString<N>
+        StringBuilder builder(buffer);
+        SC_TRY(builder.format(SC_STRING_FORMAT("[{1}-{0}]"), "Storia", "Bella"));
+        SC_ASSERT_RELEASE(builder.view() == "[Bella-Storia]");
+        @endcode
+    */
+    template <int NumSegments, int NumArguments, typename... Types>
+    [[nodiscard]] bool format(const StringFormatCompiled<NumSegments, NumArguments>& fmt, Types&&... args);
+
+    /// @brief Formats a format string parsed at compile time with SC_STRING_FORMAT, appending to destination contents.
+    /// @note Passing a number of arguments different from what is needed by fmt fails to compile
+    /// @param fmt The format string, obtained with SC_STRING_FORMAT
+    /// @param args arguments to format
+    /// @return `true` if format succeeded
+    template <int NumSegments, int NumArguments, typename... Types>
+    [[nodiscard]] bool append(const StringFormatCompiled<NumSegments, NumArguments>& fmt, Types&&... args);
+
     /// @brief Assigns StringView to destination buffer
     /// @param text StringView to assign to destination buffer
     /// @return `true` if assign succeeded
@@ -120,6 +148,10 @@ struct SC_COMPILER_EXPORT StringBuilder
 
   private:
     void clear();
+    bool reserveFormat(size_t maxLength);
+
+    template <typename Format, typename... Types>
+    bool appendFormat(const Format& fmt, Types&&... args);
 
     Buffer&        stringData;
     StringEncoding encoding;
@@ -145,9 +177,33 @@ inline bool SC::StringBuilder::append(StringView fmt, Types&&... args)
     {
         return false; // UTF16 format strings are not supported
     }
-    const bool hadNullTerminator = StringConverter::popNullTermIfNotEmpty(stringData, encoding);
     // It's ok parsing format string '{' and '}' both for utf8 and ascii with StringIteratorASCII
     // because on a valid UTF8 string, these chars are unambiguously recognizable
+    return appendFormat(fmt, forward<Types>(args)...);
+}
+
+template <int NumSegments, int NumArguments, typename... Types>
+inline bool SC::StringBuilder::format(const StringFormatCompiled<NumSegments, NumArguments>& fmt, Types&&... args)
+{
+    clear();
+    return append(fmt, forward<Types>(args)...);
+}
+
+template <int NumSegments, int NumArguments, typename... Types>
+inline bool SC::StringBuilder::append(const StringFormatCompiled<NumSegments, NumArguments>& fmt, Types&&... args)
+{
+    if (not reserveFormat(StringFormat<StringIteratorASCII>::maxLength(fmt, args...)))
+    {
+        return false;
+    }
+    return appendFormat(fmt, forward<Types>(args)...);
+}
+
+template <typename Format, typename... Types>
+inline bool SC::StringBuilder::appendFormat(const Format& fmt, Types&&... args)
+{
+    const bool hadNullTerminator = StringConverter::popNullTermIfNotEmpty(stringData, encoding);
+
     StringFormatOutput sfo(encoding, stringData);
     if (StringFormat<StringIteratorASCII>::format(sfo, fmt, forward<Types>(args)...))
     {
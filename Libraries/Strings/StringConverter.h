@@ -127,10 +127,12 @@ struct SC::StringConverter
     // Appends the input string null terminated
     [[nodiscard]] bool internalAppend(StringView input, StringView* encodedText);
 
-    // Fallbacks for platforms without an API to do the conversion out of the box (Linux)
-    [[nodiscard]] static bool convertUTF16LE_to_UTF8(const StringView sourceUtf16, Buffer& destination,
+    // Fallbacks for platforms without an API to do the conversion out of the box (Linux).
+    // With a nullptr destination they compute writtenCodeUnits, to be passed back unmodified when converting the
+    // text into a destination of that size (failing on malformed input).
+    [[nodiscard]] static bool convertUTF16LE_to_UTF8(const StringView sourceUtf16, char* destination,
                                                      int& writtenCodeUnits);
-    [[nodiscard]] static bool convertUTF8_to_UTF16LE(const StringView sourceUtf8, Buffer& destination,
+    [[nodiscard]] static bool convertUTF8_to_UTF16LE(const StringView sourceUtf8, char* destination,
                                                      int& writtenCodeUnits);
 };
 //! @}
@@ -50,6 +50,96 @@ struct SC_COMPILER_EXPORT StringFormatOutput
     size_t         backupSize = 0;
 };
 
+/// @brief A literal chunk of a format string, optionally followed by an argument slot (see SC::StringFormatCompiled)
+struct StringFormatSegment
+{
+    const char* literal         = nullptr; ///< Text written before the argument (escapes already resolved)
+    size_t      literalLength   = 0;       ///< Length in bytes of literal
+    const char* specifier       = nullptr; ///< Specification string found after `:` in the argument slot
+    size_t      specifierLength = 0;       ///< Length in bytes of specifier
+    int         position        = -1;      ///< Position of the argument to format (`-1` if there is no argument slot)
+};
+
+/// @brief Splits format strings in StringFormatSegment at compile time (used by SC_STRING_FORMAT)
+struct StringFormatParser
+{
+    /// @brief Splits fmt in literal chunks and argument slots, with the same rules used by StringFormat::format
+    /// @param fmt The format string
+    /// @param length Length in bytes of fmt
+    /// @param segments Where parsed segments are written (can be `nullptr` to just count them)
+    /// @param numArguments Receives the number of arguments needed by fmt
+    /// @return Number of segments or `-1` if fmt is not a valid format string
+    static constexpr int parse(const char* fmt, size_t length, StringFormatSegment* segments, int& numArguments);
+
+    /// @brief Returns the number of segments of a format string literal (`-1` if invalid)
+    template <size_t N>
+    static constexpr int countSegments(const char (&fmt)[N])
+    {
+        int numArguments = 0;
+        return parse(fmt, N - 1, nullptr, numArguments);
+    }
+
+    /// @brief Returns the number of arguments needed by a format string literal
+    template <size_t N>
+    static constexpr int countArguments(const char (&fmt)[N])
+    {
+        int numArguments = 0;
+        (void)parse(fmt, N - 1, nullptr, numArguments);
+        return numArguments;
+    }
+};
+
+/// @brief A format string literal already split in literal chunks and argument slots at compile time.
+/// Create it with SC_STRING_FORMAT and pass it to StringBuilder::format, StringBuilder::append or Console::print.
+/// @tparam NumSegments Number of segments in the format string
+/// @tparam NumArguments Number of arguments needed by the format string
+template <int NumSegments, int NumArguments>
+struct StringFormatCompiled
+{
+    template <size_t N>
+    constexpr StringFormatCompiled(const char (&fmt)[N]) : segments{}, literalBytes(0)
+    {
+        int numArguments = 0;
+        (void)StringFormatParser::parse(fmt, N - 1, segments, numArguments);
+        for (const StringFormatSegment& segment : segments)
+        {
+            literalBytes += segment.literalLength;
+        }
+    }
+
+    StringFormatSegment segments[NumSegments > 0 ? NumSegments : 1];
+
+    size_t literalBytes; ///< Sum of the lengths of all literal chunks
+};
+
+/// @brief Upper bound of the length in bytes of an argument formatted as UTF8 by StringFormatterFor.
+/// Types without a specialization return `0` (buffer will just grow while formatting them).
+template <typename T>
+struct StringFormatMaxLengthFor
+{
+    static constexpr size_t get(StringView, const T&) { return 0; }
+};
+
+/// @brief Parses a format string literal at compile time, returning a reference to a SC::StringFormatCompiled.
+/// Invalid format strings fail to compile, as well as passing it with a wrong number of arguments.
+/**
+    @code{.cpp}
+    String        buffer(StringEncoding::Ascii);
+    StringBuilder builder(buffer);
+    SC_TRY(builder.format(SC_STRING_FORMAT("{1}_{0:.2}"), 1.2222, "salve"));
+    SC_ASSERT_RELEASE(buffer == "salve_1.22");
+    @endcode
+*/
+#define SC_STRING_FORMAT(literal)                                                                                      \
+    ([]() -> const auto&                                                                                               \
+     {                                                                                                                 \
+         static_assert(SC::StringFormatParser::countSegments(literal) >= 0, "Invalid format string");                 \
+         static constexpr SC::StringFormatCompiled<SC::StringFormatParser::countSegments(literal),                    \
+                                                   SC::StringFormatParser::countArguments(literal)>                   \
+             compiled(literal);                                                                                        \
+         return compiled;                                                                                              \
+     }())
+
 /// @brief Formats String with a simple DSL embedded in the format string
 ///
 /// This is a small implementation to format using a minimal string based DSL, but good enough for simple usages.
@@ -84,6 +174,18 @@ struct StringFormat
     template <typename... Types>
     [[nodiscard]] static bool format(StringFormatOutput& data, StringView fmt, Types&&... args);
 
+    /// @brief Formats a format string already parsed at compile time with SC_STRING_FORMAT
+    /// @note Passing a number of arguments different from what is needed by fmt fails to compile
+    template <int NumSegments, int NumArguments, typename... Types>
+    [[nodiscard]] static bool format(StringFormatOutput&                                  data,
+                                     const StringFormatCompiled<NumSegments, NumArguments>& fmt, Types&&... args);
+
+    /// @brief Upper bound of bytes written by format, when formatting to UTF8 (or ASCII).
+    /// Arguments of types without a StringFormatMaxLengthFor specialization are counted as zero bytes.
+    template <int NumSegments, int NumArguments, typename... Types>
+    [[nodiscard]] static size_t maxLength(const StringFormatCompiled<NumSegments, NumArguments>& fmt,
+                                          const Types&... args);
+
   private:
     struct Implementation;
 };
@@ -118,6 +220,27 @@ struct SC::StringFormat<RangeIterator>::Implementation
         return false;
     }
 
+    template <int Total, int N, typename T, typename... Rest>
+    static size_t maxLengthArgument(StringView specifier, int position, const T& arg, const Rest&... rest)
+    {
+        if (position == Total - N)
+        {
+            using First = typename TypeTraits::RemoveConst<typename TypeTraits::RemoveReference<T>::type>::type;
+            return StringFormatMaxLengthFor<First>::get(specifier, arg);
+        }
+        else
+        {
+            return maxLengthArgument<Total, N - 1>(specifier, position, rest...);
+        }
+    }
+
+    template <int Total, int N, typename... Args>
+    static typename SC::TypeTraits::EnableIf<sizeof...(Args) == 0, size_t>::type maxLengthArgument(StringView, int,
+                                                                                                   const Args&...)
+    {
+        return 0;
+    }
+
     template <typename... Types>
     static bool parsePosition(StringFormatOutput& data, RangeIterator& it, int32_t& parsedPosition, Types&&... args)
     {
@@ -148,6 +271,27 @@ struct SC::StringFormat<RangeIterator>::Implementation
         return false;
     }
 
+    template <typename... Types>
+    static bool executeSegments(StringFormatOutput& data, const StringFormatSegment* segments, int numSegments,
+                                Types&&... args)
+    {
+        for (int idx = 0; idx < numSegments; ++idx)
+        {
+            const StringFormatSegment& segment = segments[idx];
+            // Literal chunks are UTF8 (binary compatible with ASCII), so they can hold non-ASCII text too
+            if (not data.append(StringView({segment.literal, segment.literalLength}, false, StringEncoding::Utf8)))
+                return false;
+            if (segment.position >= 0)
+            {
+                const StringView specifier({segment.specifier, segment.specifierLength}, false, StringEncoding::Ascii);
+                constexpr auto   maxArgs = sizeof...(args);
+                if (not formatArgument<maxArgs, maxArgs>(data, specifier, segment.position, forward<Types>(args)...))
+                    return false;
+            }
+        }
+        return true;
+    }
+
     template <typename... Types>
     static bool executeFormat(StringFormatOutput& data, RangeIterator it, Types&&... args)
     {
@@ -196,6 +340,129 @@ struct SC::StringFormat<RangeIterator>::Implementation
     }
 };
 
+constexpr int SC::StringFormatParser::parse(const char* fmt, size_t length, StringFormatSegment* segments,
+                                            int& numArguments)
+{
+    int    numSegments  = 0;
+    int    nextPosition = 0;
+    size_t start        = 0;
+    size_t idx          = 0;
+    numArguments        = 0;
+    while (idx < length)
+    {
+        const char matchedChar = fmt[idx];
+        if (matchedChar != '{' and matchedChar != '}')
+        {
+            idx++;
+            continue;
+        }
+        StringFormatSegment segment;
+        segment.literal       = fmt + start;
+        segment.literalLength = idx - start;
+        if (idx + 1 < length and fmt[idx + 1] == matchedChar)
+        {
+            segment.literalLength += 1; // keep only one of the two '{' or '}' used for escaping
+            idx += 2;
+        }
+        else if (matchedChar == '}')
+        {
+            return -1; // a single, unescaped '}'
+        }
+        else
+        {
+            size_t end   = idx + 1;
+            size_t colon = length;
+            while (end < length and fmt[end] != '}')
+            {
+                if (fmt[end] == ':' and colon == length)
+                {
+                    colon = end;
+                }
+                end++;
+            }
+            if (end == length)
+            {
+                return -1; // a '{' without its '}'
+            }
+            const size_t positionEnd = colon < end ? colon : end;
+            segment.position         = nextPosition;
+            if (positionEnd > idx + 1)
+            {
+                segment.position = 0;
+                for (size_t digit = idx + 1; digit < positionEnd; ++digit)
+                {
+                    if (fmt[digit] < '0' or fmt[digit] > '9')
+                    {
+                        return -1;
+                    }
+                    segment.position = segment.position * 10 + (fmt[digit] - '0');
+                }
+            }
+            if (colon < end)
+            {
+                segment.specifier       = fmt + colon + 1;
+                segment.specifierLength = end - colon - 1;
+            }
+            nextPosition += 1;
+            numArguments = segment.position + 1 > numArguments ? segment.position + 1 : numArguments;
+            idx          = end + 1;
+        }
+        start = idx;
+        if (segments != nullptr)
+        {
+            segments[numSegments] = segment;
+        }
+        numSegments++;
+    }
+    if (start < length)
+    {
+        if (segments != nullptr)
+        {
+            segments[numSegments].literal       = fmt + start;
+            segments[numSegments].literalLength = length - start;
+        }
+        numSegments++;
+    }
+    return numSegments;
+}
+
+template <typename RangeIterator>
+template <int NumSegments, int NumArguments, typename... Types>
+bool SC::StringFormat<RangeIterator>::format(StringFormatOutput&                                  data,
+                                             const StringFormatCompiled<NumSegments, NumArguments>& fmt,
+                                             Types&&... args)
+{
+    static_assert(NumArguments == static_cast<int>(sizeof...(Types)), "Wrong number of arguments for format string");
+    data.onFormatBegin();
+    if (Implementation::executeSegments(data, fmt.segments, NumSegments, forward<Types>(args)...))
+        SC_LANGUAGE_LIKELY { return data.onFormatSucceeded(); }
+    else
+    {
+        data.onFormatFailed();
+        return false;
+    }
+}
+
+template <typename RangeIterator>
+template <int NumSegments, int NumArguments, typename... Types>
+SC::size_t SC::StringFormat<RangeIterator>::maxLength(const StringFormatCompiled<NumSegments, NumArguments>& fmt,
+                                                      const Types&... args)
+{
+    size_t length = fmt.literalBytes;
+    for (int idx = 0; idx < NumSegments; ++idx)
+    {
+        const StringFormatSegment& segment = fmt.segments[idx];
+        if (segment.position >= 0)
+        {
+            const StringView specifier({segment.specifier, segment.specifierLength}, false, StringEncoding::Ascii);
+            constexpr auto   maxArgs = sizeof...(args);
+            length += Implementation::template maxLengthArgument<maxArgs, maxArgs>(specifier, segment.position,
+                                                                                   args...);
+        }
+    }
+    return length;
+}
+
 template <typename RangeIterator>
 template <typename... Types>
 bool SC::StringFormat<RangeIterator>::format(StringFormatOutput& data, StringView fmt, Types&&... args)
@@ -256,4 +523,54 @@ struct StringFormatterFor<char[N]>
         return StringFormatterFor<StringView>::format(data, specifier, sv);
     }
 };
+
+/// @brief Upper bound of a number formatted with snprintf, that is MaxLength without a specifier or the longest output
+/// accepted by StringFormatterFor when a specifier is given (as longer outputs make format fail).
+template <size_t MaxLength>
+struct StringFormatMaxLengthNumber
+{
+    template <typename T>
+    static constexpr size_t get(StringView specifier, const T&)
+    {
+        return specifier.isEmpty() ? MaxLength : 98;
+    }
+};
+
+// clang-format off
+template <> struct StringFormatMaxLengthFor<float>        : public StringFormatMaxLengthNumber<47> {}; // -FLT_MAX
+template <> struct StringFormatMaxLengthFor<double>       : public StringFormatMaxLengthNumber<98> {}; // longer fail
+#if SC_COMPILER_MSVC || SC_COMPILER_CLANG_CL
+#if SC_PLATFORM_64_BIT == 0
+template <> struct StringFormatMaxLengthFor<SC::ssize_t>  : public StringFormatMaxLengthNumber<11> {};
+#endif
+#else
+#if !SC_PLATFORM_LINUX
+template <> struct StringFormatMaxLengthFor<SC::size_t>   : public StringFormatMaxLengthNumber<20> {};
+template <> struct StringFormatMaxLengthFor<SC::ssize_t>  : public StringFormatMaxLengthNumber<20> {};
+#endif
+#endif
+template <> struct StringFormatMaxLengthFor<SC::int64_t>  : public StringFormatMaxLengthNumber<20> {};
+template <> struct StringFormatMaxLengthFor<SC::uint64_t> : public StringFormatMaxLengthNumber<20> {};
+template <> struct StringFormatMaxLengthFor<SC::int32_t>  : public StringFormatMaxLengthNumber<11> {};
+template <> struct StringFormatMaxLengthFor<SC::uint32_t> : public StringFormatMaxLengthNumber<11> {};
+template <> struct StringFormatMaxLengthFor<SC::int16_t>  : public StringFormatMaxLengthNumber<6> {};
+template <> struct StringFormatMaxLengthFor<SC::uint16_t> : public StringFormatMaxLengthNumber<5> {};
+template <> struct StringFormatMaxLengthFor<SC::int8_t>   : public StringFormatMaxLengthNumber<4> {};
+template <> struct StringFormatMaxLengthFor<SC::uint8_t>  : public StringFormatMaxLengthNumber<3> {};
+template <> struct StringFormatMaxLengthFor<const void*>  : public StringFormatMaxLengthNumber<18> {};
+template <> struct StringFormatMaxLengthFor<char>         {static constexpr size_t get(StringView, char) { return 1; }};
+template <> struct StringFormatMaxLengthFor<bool>         {static constexpr size_t get(StringView, bool) { return 5; }};
+template <> struct StringFormatMaxLengthFor<StringView>   {static size_t get(StringView, const StringView);};
+template <> struct SC_COMPILER_EXPORT StringFormatMaxLengthFor<String>      {static size_t get(StringView, const String&);};
+template <> struct SC_COMPILER_EXPORT StringFormatMaxLengthFor<const char*> {static size_t get(StringView, const char*);};
+
+template <int N> struct StringFormatMaxLengthFor<SmallString<N>> {static size_t get(StringView sv, const SmallString<N>& s){return StringFormatMaxLengthFor<StringView>::get(sv, s.view());}};
+template <int N> struct StringFormatMaxLengthFor<char[N]> {static constexpr size_t get(StringView, const char*) { return N - 1; }};
+// clang-format on
+
+inline size_t StringFormatMaxLengthFor<StringView>::get(StringView, const StringView value)
+{
+    // Each UTF16 code unit (2 bytes) can become up to 3 bytes in UTF8
+    return value.getEncoding() == StringEncoding::Utf16 ? value.sizeInBytes() / 2 * 3 : value.sizeInBytes();
+}
 } // namespace SC
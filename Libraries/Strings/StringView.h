@@ -499,6 +499,18 @@ struct SC::StringView
     /// @endcode
     [[nodiscard]] bool isFloatingNumber() const;
 
+    /// @brief Check if StringView is well-formed in its encoding.
+    /// Ascii must contain only code points below 128, Utf8 must not contain invalid or overlong sequences, surrogates
+    /// or code points above U+10FFFF and Utf16 must not contain unpaired surrogates.
+    /// @return `true` if StringView is well-formed
+    ///
+    /// Example:
+    /// @code{.cpp}
+    /// SC_TEST_EXPECT(StringView("\xc3\xa0"_u8).isValidEncoding());
+    /// SC_TEST_EXPECT(not StringView("\xc0\xaf"_u8).isValidEncoding()); // Overlong '/'
+    /// @endcode
+    [[nodiscard]] bool isValidEncoding() const;
+
     /// @brief Try parsing current StringView as a 32 bit integer.
     /// @param value Will receive the parsed 32 bit integer, if function returns `true`.
     /// @return `true` if the StringView has been successfully parsed as a 32 bit integer.
@@ -7,11 +7,13 @@
 extern "C"
 {
     long    _InterlockedExchangeAdd(long volatile* Addend, long Value);
+    long    _InterlockedExchange(long volatile* Target, long Value);
     char    _InterlockedExchange8(char volatile* Target, char Value);
     void    __dmb(unsigned int _Type);
     void    __iso_volatile_store8(volatile __int8*, __int8);
     __int8  __iso_volatile_load8(const volatile __int8*);
     __int32 __iso_volatile_load32(const volatile __int32*);
+    void    __iso_volatile_store32(volatile __int32*, __int32);
     void    _ReadWriteBarrier(void);
 
 #ifdef __clang__
@@ -136,6 +138,23 @@ struct Atomic<int32_t>
         return res;
     }
 
+    void store(int32_t desired, memory_order mem)
+    {
+#if _MSC_VER
+        if (mem == memory_order_seq_cst)
+        {
+            (void)_InterlockedExchange(reinterpret_cast<volatile long*>(&value), desired);
+        }
+        else
+        {
+            SC_COMPILER_MSVC_COMPILER_MEMORY_BARRIER();
+            __iso_volatile_store32(reinterpret_cast<volatile int*>(&value), desired);
+        }
+#else
+        __atomic_store(&value, &desired, mem);
+#endif
+    }
+
   private:
     volatile int32_t value;
 };
@@ -0,0 +1,90 @@
+// Copyright (c) Stefano Cristiano
+// SPDX-License-Identifier: MIT
+#pragma once
+#include "../../../Libraries/Containers/Vector.h"
+#include "../../../Libraries/Reflection/Reflection.h"
+#include "../../../Libraries/SerializationBinary/SerializationBinaryOptions.h"
+namespace SC
+{
+/// @brief Caches conversion plans used by SerializationBinaryTypeErased::loadVersioned, keyed by schemas (and options).
+///
+/// A conversion plan is compiled once for each pair of source and sink schemas (and options), matching struct members
+/// by `memberTag`. It's a flat list of copy, convert and skip operations where nested structs are inlined and
+/// consecutive members with identical layout are merged into a single bulk copy.
+/// Executing the plan for each record avoids repeating member tag matching for every struct instance.
+struct SerializationBinaryTypeErasedPlanCache
+{
+    /// @brief Removes all cached plans
+    void clear();
+
+    /// @brief Returns number of cached plans
+    [[nodiscard]] size_t getNumberOfPlans() const { return plans.size(); }
+
+  private:
+    friend struct SerializationBinaryTypeErasedReadVersioned;
+    struct Compiler;
+
+    struct Operation
+    {
+        enum Type : uint8_t
+        {
+            Copy,      // Reads numBytes into sink at sinkOffset
+            Convert,   // Reads a sourceCategory primitive converting it to sinkCategory (numBytes) at sinkOffset
+            SkipBytes, // Discards numBytes of source members with fixed size not existing in sink
+            Skip,      // Discards a source member with variable size described by source type at index
+            Array,     // Reads an array or vector at sinkOffset as described by arrays[index]
+        };
+        Type                     type           = Copy;
+        Reflection::TypeCategory sourceCategory = Reflection::TypeCategory::TypeInvalid;
+        Reflection::TypeCategory sinkCategory   = Reflection::TypeCategory::TypeInvalid;
+
+        uint32_t sinkOffset = 0;
+        uint32_t numBytes   = 0;
+        uint32_t index      = 0;
+    };
+
+    struct ArrayOperation
+    {
+        uint32_t sinkTypeIndex       = 0; // Sink array type index (to find its vector vtable)
+        uint32_t sourceNumBytes      = 0; // Size of the source array (when it's not a vector)
+        uint32_t sinkNumBytes        = 0; // Size of the sink array (when it's not a vector)
+        uint32_t sourceItemSize      = 0;
+        uint32_t sinkItemSize        = 0;
+        uint32_t sourceItemTypeIndex = 0; // Used to skip excess source items
+        uint32_t itemProgram         = 0; // Program reading a single item (when items are not bulk copied)
+
+        bool sourceIsVector   = false;
+        bool sinkIsVector     = false;
+        bool bulkCopy         = false; // Items have the same layout and can be read with a single copy
+        bool skipFixedSize    = false; // Excess source items can be discarded without the skipper
+        bool initializeVector = true;  // Vector items must be initialized on resize
+    };
+
+    struct Program
+    {
+        uint32_t firstOperation = 0;
+        uint32_t numOperations  = 0;
+    };
+
+    struct Plan
+    {
+        uint64_t hash    = 0;
+        uint32_t program = 0;
+
+        // Schemas are compared on hash match, as source schema comes from (untrusted) serialized data
+        uint32_t firstSchemaByte  = 0; // Source and sink schemas bytes, stored in schemas
+        uint32_t sourceSchemaSize = 0;
+        uint32_t sinkSchemaSize   = 0;
+        bool     allowDropExcessStructMembers = false;
+    };
+
+    Vector<Operation>      operations;
+    Vector<ArrayOperation> arrays;
+    Vector<Program>        programs;
+    Vector<Plan>           plans;
+    Vector<char>           schemas;
+
+    [[nodiscard]] bool getPlan(Span<const Reflection::TypeInfo> sourceTypes, Span<const Reflection::TypeInfo> sinkTypes,
+                               const SerializationBinaryOptions& options, uint32_t& program);
+};
+} // namespace SC
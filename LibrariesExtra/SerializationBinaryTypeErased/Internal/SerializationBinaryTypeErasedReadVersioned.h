@@ -6,6 +6,7 @@
 // Compiler must be after
 #include "../../../Libraries/SerializationBinary/Internal/SerializationBinarySchema.h"
 #include "SerializationBinaryTypeErasedCompiler.h"
+#include "SerializationBinaryTypeErasedPlan.h"
 namespace SC
 {
 struct SerializationBinaryBufferReader;
@@ -13,7 +14,8 @@ struct SerializationBinaryBufferReader;
 struct SerializationBinaryTypeErasedReadVersioned
 {
     template <typename T>
-    [[nodiscard]] bool loadVersioned(T& object, SerializationBinaryBufferReader& source, SerializationSchema& schema)
+    [[nodiscard]] bool loadVersioned(T& object, SerializationBinaryBufferReader& source, SerializationSchema& schema,
+                                     SerializationBinaryTypeErasedPlanCache* plans = nullptr)
     {
         constexpr auto flatSchema = Reflection::SchemaTypeErased::compile<T>();
 
@@ -33,6 +35,13 @@ struct SerializationBinaryTypeErasedReadVersioned
         {
             return false;
         }
+        uint32_t program;
+        if (plans != nullptr and plans->getPlan(sourceTypes, sinkTypes, options, program))
+        {
+            planCache = plans;
+            return runProgram(program, sinkObject);
+        }
+        // Plan cannot be compiled (incompatible types), so match members while reading to fail at the same point
         return read();
     }
 
@@ -53,6 +62,11 @@ struct SerializationBinaryTypeErasedReadVersioned
     Reflection::TypeInfo             sourceType;
     uint32_t                         sourceTypeIndex = 0;
 
+    SerializationBinaryTypeErasedPlanCache* planCache = nullptr;
+
+    [[nodiscard]] bool runProgram(uint32_t program, Span<char> object);
+    [[nodiscard]] bool runArray(const SerializationBinaryTypeErasedPlanCache::ArrayOperation& array, Span<char> object);
+
     [[nodiscard]] bool read();
     [[nodiscard]] bool readStruct();
     [[nodiscard]] bool readArrayVector();
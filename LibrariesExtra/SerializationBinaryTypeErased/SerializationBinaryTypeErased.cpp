@@ -1,5 +1,6 @@
 // Copyright (c) Stefano Cristiano
 // SPDX-License-Identifier: MIT
+#include "../../Libraries/Foundation/Result.h"
 #include "../../Libraries/SerializationBinary/Internal/SerializationBinaryBuffer.h"
 #include "Internal/SerializationBinaryTypeErasedReadVersioned.h"
 #include "Internal/SerializationBinaryTypeErasedReadWriteExact.h"
@@ -206,6 +207,354 @@ bool SC::SerializationBinaryTypeErasedReadVersioned::skipCurrent()
     return skipper.skip();
 }
 
+//-------------------------------------------------------------------------------------------------
+// SerializationBinaryTypeErasedPlanCache
+//-------------------------------------------------------------------------------------------------
+struct SC::SerializationBinaryTypeErasedPlanCache::Compiler
+{
+    SerializationBinaryTypeErasedPlanCache& cache;
+
+    Span<const Reflection::TypeInfo> sourceTypes;
+    Span<const Reflection::TypeInfo> sinkTypes;
+    SerializationBinaryOptions       options;
+
+    static uint32_t resolveLink(Span<const Reflection::TypeInfo> types, uint32_t index)
+    {
+        const Reflection::TypeInfo& type = types.data()[index];
+        return type.hasValidLinkIndex() ? static_cast<uint32_t>(type.getLinkIndex()) : index;
+    }
+
+    // Compiles the operations reading a source type into a sink type (located at offset zero) as a new program
+    [[nodiscard]] bool compileProgram(uint32_t sourceIndex, uint32_t sinkIndex, uint32_t& program)
+    {
+        Vector<Operation> programOperations;
+        SC_TRY(compileType(programOperations, sourceIndex, sinkIndex, 0));
+        Program newProgram;
+        newProgram.firstOperation = static_cast<uint32_t>(cache.operations.size());
+        newProgram.numOperations  = static_cast<uint32_t>(programOperations.size());
+        SC_TRY(cache.operations.append(programOperations.toSpanConst()));
+        program = static_cast<uint32_t>(cache.programs.size());
+        return cache.programs.push_back(newProgram);
+    }
+
+    [[nodiscard]] bool compileType(Vector<Operation>& ops, uint32_t sourceIndex, uint32_t sinkIndex, uint32_t offset)
+    {
+        const Reflection::TypeInfo sourceType = sourceTypes.data()[sourceIndex];
+        const Reflection::TypeInfo sinkType   = sinkTypes.data()[sinkIndex];
+        if (sourceType.isPrimitiveType())
+        {
+            if (sinkType.type == sourceType.type)
+            {
+                return pushCopy(ops, offset, sourceType.sizeInBytes);
+            }
+            else if (sinkType.isPrimitiveType())
+            {
+                Operation convert;
+                convert.type           = Operation::Convert;
+                convert.sourceCategory = sourceType.type;
+                convert.sinkCategory   = sinkType.type;
+                convert.sinkOffset     = offset;
+                convert.numBytes       = sinkType.sizeInBytes;
+                return ops.push_back(convert);
+            }
+        }
+        else if (sourceType.type == Reflection::TypeCategory::TypeStruct)
+        {
+            if (sinkType.type == Reflection::TypeCategory::TypeStruct)
+            {
+                if (sinkType.structInfo.isPacked and
+                    detail::isSameSchemaSubtree(sourceTypes, sourceIndex, sinkTypes, sinkIndex))
+                {
+                    return pushCopy(ops, offset, sinkType.sizeInBytes);
+                }
+                return compileStruct(ops, sourceIndex, sinkIndex, offset);
+            }
+        }
+        else if (sourceType.type == Reflection::TypeCategory::TypeArray ||
+                 sourceType.type == Reflection::TypeCategory::TypeVector)
+        {
+            if (sinkType.type == Reflection::TypeCategory::TypeArray ||
+                sinkType.type == Reflection::TypeCategory::TypeVector)
+            {
+                return compileArray(ops, sourceIndex, sinkIndex, offset);
+            }
+        }
+        return false;
+    }
+
+    [[nodiscard]] bool compileStruct(Vector<Operation>& ops, uint32_t sourceIndex, uint32_t sinkIndex, uint32_t offset)
+    {
+        const auto numSourceMembers = static_cast<uint32_t>(sourceTypes.data()[sourceIndex].getNumberOfChildren());
+        const auto numSinkMembers   = static_cast<uint32_t>(sinkTypes.data()[sinkIndex].getNumberOfChildren());
+        for (uint32_t idx = 0; idx < numSourceMembers; ++idx)
+        {
+            const auto sourceMemberIndex = sourceIndex + idx + 1;
+            const auto sourceTag         = sourceTypes.data()[sourceMemberIndex].memberInfo.memberTag;
+            uint32_t   findIdx;
+            for (findIdx = 0; findIdx < numSinkMembers; ++findIdx)
+            {
+                if (sinkTypes.data()[sinkIndex + findIdx + 1].memberInfo.memberTag == sourceTag)
+                    break;
+            }
+            const auto sourceTypeIndex = resolveLink(sourceTypes, sourceMemberIndex);
+            if (findIdx != numSinkMembers)
+            {
+                const auto sinkMemberIndex = sinkIndex + findIdx + 1;
+                const auto memberOffset    = offset + sinkTypes.data()[sinkMemberIndex].memberInfo.offsetInBytes;
+                SC_TRY(compileType(ops, sourceTypeIndex, resolveLink(sinkTypes, sinkMemberIndex), memberOffset));
+            }
+            else
+            {
+                if (not options.allowDropExcessStructMembers)
+                    return false;
+                const Reflection::TypeInfo sourceType = sourceTypes.data()[sourceTypeIndex];
+                if (sourceType.isPrimitiveOrPackedStruct())
+                {
+                    SC_TRY(pushSkipBytes(ops, sourceType.sizeInBytes));
+                }
+                else
+                {
+                    Operation skip;
+                    skip.type  = Operation::Skip;
+                    skip.index = sourceTypeIndex;
+                    SC_TRY(ops.push_back(skip));
+                }
+            }
+        }
+        return true;
+    }
+
+    [[nodiscard]] bool compileArray(Vector<Operation>& ops, uint32_t sourceIndex, uint32_t sinkIndex, uint32_t offset)
+    {
+        const Reflection::TypeInfo sourceType = sourceTypes.data()[sourceIndex];
+        const Reflection::TypeInfo sinkType   = sinkTypes.data()[sinkIndex];
+
+        const Reflection::TypeInfo sourceItem = sourceTypes.data()[sourceIndex + 1];
+        const Reflection::TypeInfo sinkItem   = sinkTypes.data()[sinkIndex + 1];
+
+        ArrayOperation array;
+        array.sinkTypeIndex       = sinkIndex;
+        array.sourceNumBytes      = sourceType.sizeInBytes;
+        array.sinkNumBytes        = sinkType.sizeInBytes;
+        array.sourceItemSize      = sourceItem.sizeInBytes;
+        array.sinkItemSize        = sinkItem.sizeInBytes;
+        array.sourceItemTypeIndex = resolveLink(sourceTypes, sourceIndex + 1);
+        array.sourceIsVector      = sourceType.type == Reflection::TypeCategory::TypeVector;
+        array.sinkIsVector        = sinkType.type == Reflection::TypeCategory::TypeVector;
+
+        const uint32_t sinkItemTypeIndex = resolveLink(sinkTypes, sinkIndex + 1);
+
+        const Reflection::TypeInfo sourceItemType = sourceTypes.data()[array.sourceItemTypeIndex];
+
+        const bool sameItemLayout =
+            detail::isSameSchemaSubtree(sourceTypes, array.sourceItemTypeIndex, sinkTypes, sinkItemTypeIndex);
+
+        array.skipFixedSize    = sourceItemType.isPrimitiveOrPackedStruct();
+        array.bulkCopy         = sourceItemType.isPrimitiveOrPackedStruct() and sameItemLayout;
+        array.initializeVector = not(array.bulkCopy and sourceItemType.isPrimitiveType());
+        if (array.sourceItemSize == 0 or array.sinkItemSize == 0)
+            return false;
+        if (not array.bulkCopy)
+        {
+            SC_TRY(compileProgram(array.sourceItemTypeIndex, sinkItemTypeIndex, array.itemProgram));
+        }
+        Operation operation;
+        operation.type       = Operation::Array;
+        operation.sinkOffset = offset;
+        operation.numBytes   = sinkType.sizeInBytes;
+        operation.index      = static_cast<uint32_t>(cache.arrays.size());
+        SC_TRY(cache.arrays.push_back(array));
+        return ops.push_back(operation);
+    }
+
+    [[nodiscard]] static bool pushCopy(Vector<Operation>& ops, uint32_t offset, uint32_t numBytes)
+    {
+        if (not ops.isEmpty())
+        {
+            Operation& last = ops.back();
+            if (last.type == Operation::Copy and last.sinkOffset + last.numBytes == offset)
+            {
+                last.numBytes += numBytes; // Merge with previous copy when contiguous in sink object too
+                return true;
+            }
+        }
+        Operation copy;
+        copy.type       = Operation::Copy;
+        copy.sinkOffset = offset;
+        copy.numBytes   = numBytes;
+        return ops.push_back(copy);
+    }
+
+    [[nodiscard]] static bool pushSkipBytes(Vector<Operation>& ops, uint32_t numBytes)
+    {
+        if (not ops.isEmpty() and ops.back().type == Operation::SkipBytes)
+        {
+            ops.back().numBytes += numBytes;
+            return true;
+        }
+        Operation skip;
+        skip.type     = Operation::SkipBytes;
+        skip.numBytes = numBytes;
+        return ops.push_back(skip);
+    }
+};
+
+void SC::SerializationBinaryTypeErasedPlanCache::clear()
+{
+    operations.clear();
+    arrays.clear();
+    programs.clear();
+    plans.clear();
+    schemas.clear();
+}
+
+bool SC::SerializationBinaryTypeErasedPlanCache::getPlan(Span<const Reflection::TypeInfo> sourceTypes,
+                                                         Span<const Reflection::TypeInfo> sinkTypes,
+                                                         const SerializationBinaryOptions& options, uint32_t& program)
+{
+    // FNV-1a of both schemas and of the options changing the plan
+    uint64_t   hash    = 0xcbf29ce484222325ULL;
+    const auto addHash = [&hash](Span<const char> bytes)
+    {
+        for (char byte : bytes)
+        {
+            hash = (hash ^ static_cast<uint8_t>(byte)) * 0x100000001b3ULL;
+        }
+    };
+    const auto sourceBytes = Span<const char>::reinterpret_bytes(sourceTypes.data(), sourceTypes.sizeInBytes());
+    const auto sinkBytes   = Span<const char>::reinterpret_bytes(sinkTypes.data(), sinkTypes.sizeInBytes());
+    addHash(sourceBytes);
+    addHash(sinkBytes);
+    addHash(Span<const char>::reinterpret_object(options.allowDropExcessStructMembers));
+    for (const Plan& plan : plans)
+    {
+        // Colliding hashes are easy to craft, so schemas are compared too before running a plan on the stream
+        if (plan.hash == hash and plan.allowDropExcessStructMembers == options.allowDropExcessStructMembers and
+            plan.sourceSchemaSize == sourceBytes.sizeInBytes() and plan.sinkSchemaSize == sinkBytes.sizeInBytes() and
+            ::memcmp(schemas.data() + plan.firstSchemaByte, sourceBytes.data(), sourceBytes.sizeInBytes()) == 0 and
+            ::memcmp(schemas.data() + plan.firstSchemaByte + plan.sourceSchemaSize, sinkBytes.data(),
+                     sinkBytes.sizeInBytes()) == 0)
+        {
+            program = plan.program;
+            return true;
+        }
+    }
+    Compiler compiler = {*this, sourceTypes, sinkTypes, options};
+    Plan     plan;
+    plan.hash                         = hash;
+    plan.firstSchemaByte              = static_cast<uint32_t>(schemas.size());
+    plan.sourceSchemaSize             = static_cast<uint32_t>(sourceBytes.sizeInBytes());
+    plan.sinkSchemaSize               = static_cast<uint32_t>(sinkBytes.sizeInBytes());
+    plan.allowDropExcessStructMembers = options.allowDropExcessStructMembers;
+    SC_TRY(compiler.compileProgram(0, 0, plan.program));
+    SC_TRY(schemas.append(sourceBytes));
+    SC_TRY(schemas.append(sinkBytes));
+    SC_TRY(plans.push_back(plan));
+    program = plan.program;
+    return true;
+}
+
+//-------------------------------------------------------------------------------------------------
+// SerializationBinaryTypeErasedReadVersioned (plan execution)
+//-------------------------------------------------------------------------------------------------
+bool SC::SerializationBinaryTypeErasedReadVersioned::runProgram(uint32_t program, Span<char> object)
+{
+    using Operation                  = SerializationBinaryTypeErasedPlanCache::Operation;
+    const auto&      programInfo     = planCache->programs[program];
+    const Operation* operation       = planCache->operations.data() + programInfo.firstOperation;
+    const Operation* operationsEnd   = operation + programInfo.numOperations;
+    const size_t     objectSizeBytes = object.sizeInBytes();
+    for (; operation != operationsEnd; ++operation)
+    {
+        if (operation->sinkOffset + operation->numBytes > objectSizeBytes)
+            return false;
+        switch (operation->type)
+        {
+        case Operation::Copy:
+            SC_TRY(sourceObject->serializeBytes(object.data() + operation->sinkOffset, operation->numBytes));
+            break;
+        case Operation::Convert: {
+            const Reflection::TypeInfo source(operation->sourceCategory, 0);
+            const Reflection::TypeInfo sink(operation->sinkCategory, 0);
+            Span<char>                 sinkSpan = {object.data() + operation->sinkOffset, operation->numBytes};
+            SC_TRY(SC::detail::tryPrimitiveConversion(options, source, sourceObject, sink, sinkSpan));
+            break;
+        }
+        case Operation::SkipBytes: SC_TRY(sourceObject->advanceBytes(operation->numBytes)); break;
+        case Operation::Skip:
+            sourceTypeIndex = operation->index;
+            SC_TRY(skipCurrent());
+            break;
+        case Operation::Array: {
+            const Span<char> arraySpan = {object.data() + operation->sinkOffset, operation->numBytes};
+            SC_TRY(runArray(planCache->arrays[operation->index], arraySpan));
+            break;
+        }
+        }
+    }
+    return true;
+}
+
+bool SC::SerializationBinaryTypeErasedReadVersioned::runArray(
+    const SerializationBinaryTypeErasedPlanCache::ArrayOperation& array, Span<char> object)
+{
+    uint64_t sourceNumBytes = array.sourceNumBytes;
+    if (array.sourceIsVector)
+    {
+        SC_TRY(sourceObject->serializeBytes(Span<char>::reinterpret_object(sourceNumBytes)));
+    }
+    const uint64_t sourceNumElements = sourceNumBytes / array.sourceItemSize;
+
+    Span<char> arraySinkStart;
+    if (array.sinkIsVector)
+    {
+        using ArrayAccess         = detail::SerializationBinaryTypeErasedArrayAccess;
+        const auto numWantedBytes = sourceNumElements * array.sinkItemSize;
+        const auto sinkType       = sinkTypes.data()[array.sinkTypeIndex];
+        SC_TRY(arrayAccess.resize(array.sinkTypeIndex, object, sinkType, numWantedBytes,
+                                  array.initializeVector ? ArrayAccess::Initialize::Yes : ArrayAccess::Initialize::No,
+                                  options.allowDropExcessArrayItems ? ArrayAccess::DropExcessItems::Yes
+                                                                    : ArrayAccess::DropExcessItems::No));
+        SC_TRY(arrayAccess.getSegmentSpan(array.sinkTypeIndex, sinkType, object, arraySinkStart));
+    }
+    else
+    {
+        SC_TRY(object.sliceStartLength(0, array.sinkNumBytes, arraySinkStart));
+    }
+    const uint64_t sinkNumElements = arraySinkStart.sizeInBytes() / array.sinkItemSize;
+    const uint64_t minElements     = min(sinkNumElements, sourceNumElements);
+    if (array.bulkCopy)
+    {
+        const size_t numBytes = static_cast<size_t>(minElements * array.sinkItemSize);
+        SC_TRY(sourceObject->serializeBytes(arraySinkStart.data(), numBytes));
+    }
+    else
+    {
+        for (uint64_t idx = 0; idx < minElements; ++idx)
+        {
+            const Span<char> item = {arraySinkStart.data() + idx * array.sinkItemSize, array.sinkItemSize};
+            SC_TRY(runProgram(array.itemProgram, item));
+        }
+    }
+    if (sourceNumElements > sinkNumElements)
+    {
+        // We must consume these excess items anyway, discarding their content
+        if (not options.allowDropExcessArrayItems)
+            return false;
+        if (array.skipFixedSize)
+        {
+            const uint64_t numExcessBytes = (sourceNumElements - minElements) * array.sourceItemSize;
+            return sourceObject->advanceBytes(static_cast<size_t>(numExcessBytes));
+        }
+        for (uint64_t idx = minElements; idx < sourceNumElements; ++idx)
+        {
+            sourceTypeIndex = array.sourceItemTypeIndex;
+            SC_TRY(skipCurrent());
+        }
+    }
+    return true;
+}
+
 //-------------------------------------------------------------------------------------------------
 // SerializationBinaryTypeErasedWriteExact
 //-------------------------------------------------------------------------------------------------
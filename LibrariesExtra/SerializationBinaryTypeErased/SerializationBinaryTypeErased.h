@@ -62,13 +62,32 @@ struct SerializationBinaryTypeErased
     template <typename T>
     [[nodiscard]] static bool loadVersioned(T& object, Span<const char> buffer, Span<const Reflection::TypeInfo> schema,
                                             SerializationBinaryOptions options = {}, size_t* numberOfReads = nullptr)
+    {
+        SerializationBinaryTypeErasedPlanCache plans;
+        return loadVersioned(object, buffer, schema, plans, options, numberOfReads);
+    }
+
+    /// @brief Deserialize object `T` from a Binary buffer with a reflection schema not matching `T` schema, reusing
+    /// conversion plans compiled by previous calls with the same schema.
+    /// @tparam T Type of object to be deserialized
+    /// @param object The object to deserialize
+    /// @param buffer The buffer holding the bytes to be used for deserialization
+    /// @param schema The schema used to serialize data in the buffer
+    /// @param plans Cache holding conversion plans, to be reused when loading many buffers with the same schema
+    /// @param options Options for data conversion (allow dropping fields, array items etc)
+    /// @param numberOfReads If provided, will return the number deserialization operations
+    /// @return `true` if deserialization succeeded
+    template <typename T>
+    [[nodiscard]] static bool loadVersioned(T& object, Span<const char> buffer, Span<const Reflection::TypeInfo> schema,
+                                            SerializationBinaryTypeErasedPlanCache& plans,
+                                            SerializationBinaryOptions options = {}, size_t* numberOfReads = nullptr)
     {
         SerializationBinaryTypeErasedReadVersioned loader;
 
         SerializationSchema serializationSchema(schema);
         serializationSchema.options = options;
         SerializationBinaryBufferReader readerBuffer(buffer);
-        if (not loader.loadVersioned(object, readerBuffer, serializationSchema))
+        if (not loader.loadVersioned(object, readerBuffer, serializationSchema, &plans))
             return false;
         if (numberOfReads)
             *numberOfReads = readerBuffer.numberOfOperations;
@@ -4,6 +4,9 @@
 #include "Libraries/AsyncStreams/AsyncRequestStreams.cpp"
 #include "Libraries/AsyncStreams/AsyncStreams.cpp"
 #include "Libraries/AsyncStreams/ZLibTransformStreams.cpp"
+#include "Libraries/AsyncStreams/LZ4TransformStreams.cpp"
+#include "Libraries/AsyncStreams/ParallelTransformStreams.cpp"
+#include "Libraries/AsyncStreams/HashingTransformStreams.cpp"
 #include "Libraries/Build/Build.cpp"
 #include "Libraries/File/File.cpp"
 #include "Libraries/FileSystem/FileSystem.cpp"
@@ -13,6 +16,7 @@
 #include "Libraries/FileSystemWatcher/FileSystemWatcher.cpp"
 #include "Libraries/Foundation/Foundation.cpp"
 #include "Libraries/Hashing/Hashing.cpp"
+#include "Libraries/Hashing/Checksum.cpp"
 #include "Libraries/Http/HttpClient.cpp"
 #include "Libraries/Http/HttpParser.cpp"
 #include "Libraries/Http/HttpServer.cpp"
@@ -20,8 +24,10 @@
 #include "Libraries/Http/HttpWebServer.cpp"
 #include "Libraries/Plugin/Plugin.cpp"
 #include "Libraries/Process/Process.cpp"
+#include "Libraries/Process/ProcessForkSnapshot.cpp"
 #include "Libraries/SerializationText/SerializationJson.cpp"
 #include "Libraries/Socket/Socket.cpp"
+#include "Libraries/Strings/Logger.cpp"
 #include "Libraries/Strings/Strings.cpp"
 #include "Libraries/Testing/Testing.cpp"
 #include "Libraries/Threading/ThreadPool.cpp"
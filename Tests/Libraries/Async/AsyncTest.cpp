@@ -57,6 +57,10 @@ SC::AsyncTest::AsyncTest(SC::TestReport& report) : TestCase(report, "AsyncTest")
         {
             processExit();
         }
+        if (test_section("process exit reuse"))
+        {
+            processExitReuse();
+        }
         if (test_section("socket accept"))
         {
             socketAccept();
@@ -73,14 +77,30 @@ SC::AsyncTest::AsyncTest(SC::TestReport& report) : TestCase(report, "AsyncTest")
         {
             socketSendMultiple();
         }
+        if (test_section("socket send zero copy"))
+        {
+            socketSendZeroCopy();
+        }
         if (test_section("error send/receive"))
         {
             socketSendReceiveError();
         }
+        if (test_section("socket receive timeout"))
+        {
+            socketReceiveTimeout();
+        }
         if (test_section("socket close"))
         {
             socketClose();
         }
+        if (test_section("socket sendTo/receiveFrom"))
+        {
+            socketSendToReceiveFrom();
+        }
+        if (test_section("socket sendTo/receiveFrom multiple"))
+        {
+            socketSendToReceiveFromMultiple();
+        }
         if (test_section("file read/write"))
         {
             fileReadWrite(false); // do not use thread-pool
@@ -100,12 +120,29 @@ SC::AsyncTest::AsyncTest(SC::TestReport& report) : TestCase(report, "AsyncTest")
         {
             fileClose();
         }
+        if (test_section("file read/write timeout"))
+        {
+            fileReadWriteTimeout();
+        }
+        if (test_section("file system operation"))
+        {
+            fileSystemOperation(false); // do not use thread-pool
+            fileSystemOperation(true);  // use thread-pool
+        }
+        if (test_section("file linked sequence"))
+        {
+            fileLinkedSequence();
+        }
         if (numTestsToRun == 2)
         {
             // If on Linux next run will test io_uring backend (if it's installed)
             options.apiType = AsyncEventLoop::Options::ApiType::ForceUseIOURing;
         }
     }
+    if (test_section("socket echo benchmark", Execute::OnlyExplicit))
+    {
+        socketEchoBenchmark();
+    }
 }
 
 namespace SC
@@ -352,6 +389,69 @@ SC_TRY(eventLoop.run());
 return Result(true);
 }
 
+SC::Result snippetForSocketSendTo(AsyncEventLoop& eventLoop, Console& console)
+{
+SocketDescriptor udpSocket;
+//! [AsyncSocketSendToSnippet]
+// Assuming an already created (and running) AsyncEventLoop named `eventLoop`
+// and a UDP socket named `udpSocket` created with AsyncEventLoop::createAsyncUDPSocket
+// ...
+SocketIPAddress destination;
+SC_TRY(destination.fromAddressPort("127.0.0.1", 5051));
+
+// The memory pointed by the spans must be valid until callback is called
+Span<const char> datagrams[] = {{"PING", 4}, {"PONG", 4}, {"PANG", 4}};
+
+AsyncSocketSendTo sendToAsync;
+sendToAsync.callback = [&](AsyncSocketSendTo::Result& res)
+{
+    if(res.isValid())
+    {
+        console.print("{} datagrams have been sent", res.completionData.numDatagrams);
+    }
+};
+// Sends three datagrams (with a single sendmmsg syscall on Linux).
+// Use the Span<const char> overload to send a single datagram.
+SC_TRY(sendToAsync.start(eventLoop, udpSocket, destination, datagrams));
+//! [AsyncSocketSendToSnippet]
+SC_TRY(eventLoop.run());
+return Result(true);
+}
+
+SC::Result snippetForSocketReceiveFrom(AsyncEventLoop& eventLoop, Console& console)
+{
+SocketDescriptor udpSocket;
+//! [AsyncSocketReceiveFromSnippet]
+// Assuming an already created (and running) AsyncEventLoop named `eventLoop`
+// and a bound UDP socket named `udpSocket` created with AsyncEventLoop::createAsyncUDPSocket
+// ...
+char receiveBuffer[16 * 1500]; // 16 slots of 1500 bytes each
+
+AsyncSocketReceiveFrom::Datagram datagrams[16];
+
+AsyncSocketReceiveFrom receiveFromAsync;
+receiveFromAsync.callback = [&](AsyncSocketReceiveFrom::Result& res)
+{
+    Span<AsyncSocketReceiveFrom::Datagram> received;
+    if(res.get(received))
+    {
+        for (AsyncSocketReceiveFrom::Datagram& datagram : received)
+        {
+            // datagram.data is a slice of receiveBuffer, datagram.ipAddress is the sender
+            console.print("Received {} bytes\n", datagram.data.sizeInBytes());
+        }
+        // IMPORTANT: Reactivate the request to receive more datagrams
+        res.reactivateRequest(true);
+    }
+};
+// Receives up to 16 datagrams per callback (with a single recvmmsg syscall on Linux).
+// Use the overload without datagrams to receive a single one.
+SC_TRY(receiveFromAsync.start(eventLoop, udpSocket, receiveBuffer, datagrams));
+//! [AsyncSocketReceiveFromSnippet]
+SC_TRY(eventLoop.run());
+return Result(true);
+}
+
 SC::Result snippetForSocketClose(AsyncEventLoop& eventLoop, Console& console)
 {
 SocketDescriptor client;
@@ -525,5 +625,36 @@ SC_TRY(asyncFileClose.start(eventLoop, handle));
 SC_TRY(eventLoop.run());
 return Result(true);
 }
+
+SC::Result snippetForFileSystemOperation(AsyncEventLoop& eventLoop, Console& console, ThreadPool& threadPool)
+{
+//! [AsyncFileSystemOperationSnippet]
+// Assuming an already created (and running) AsyncEventLoop named eventLoop
+// and an already created ThreadPool named threadPool
+// ...
+
+// Paths must be valid until the callback is called
+StringNative<255> filePath = StringEncoding::Native;
+SC_TRY(Path::join(filePath, {"/tmp", "MyFile.txt"}));
+
+AsyncTaskSequence task;
+AsyncFileSystemOperation asyncOpen;
+asyncOpen.callback = [&](AsyncFileSystemOperation::Result& result)
+{
+    if(result.isValid())
+    {
+        FileDescriptor fd;
+        (void)fd.assign(result.completionData.handle); // Caller owns the opened file
+        console.printLine("File was opened successfully");
+    }
+};
+// Executes the blocking open on threadPool on backends without native async open (all except io_uring)
+SC_TRY(asyncOpen.executeOn(task, threadPool));
+SC_TRY(asyncOpen.open(eventLoop, filePath.view().getNullTerminatedNative(),
+                      AsyncFileSystemOperation::OpenMode::WriteCreateTruncate));
+//! [AsyncFileSystemOperationSnippet]
+SC_TRY(eventLoop.run());
+return Result(true);
+}
 // clang-format on
 } // namespace SC
@@ -33,14 +33,23 @@ struct SC::AsyncTest : public SC::TestCase
     void loopWakeUp();
     void loopWakeUpEventObject();
     void processExit();
+    void processExitReuse();
     void socketAccept();
     void socketConnect();
     void socketSendReceive();
     void socketSendMultiple();
+    void socketSendZeroCopy();
     void socketClose();
     void socketSendReceiveError();
+    void socketReceiveTimeout();
+    void socketSendToReceiveFrom();
+    void socketSendToReceiveFromMultiple();
+    void socketEchoBenchmark();
     void fileReadWrite(bool useThreadPool);
     void fileEndOfFile(bool useThreadPool);
     void fileWriteMultiple(bool useThreadPool);
     void fileClose();
+    void fileReadWriteTimeout();
+    void fileSystemOperation(bool useThreadPool);
+    void fileLinkedSequence();
 };
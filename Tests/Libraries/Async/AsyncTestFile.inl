@@ -355,3 +355,282 @@ void SC::AsyncTest::fileClose()
     // SC_TEST_EXPECT(not fd.close());
     fd.detach();
 }
+
+void SC::AsyncTest::fileReadWriteTimeout()
+{
+#if SC_PLATFORM_WINDOWS
+    // Anonymous pipes created by PipeDescriptor don't support overlapped I/O, so they can't be cancelled
+#else
+    AsyncEventLoop eventLoop;
+    SC_TEST_EXPECT(eventLoop.create(options));
+
+    PipeDescriptor pipe;
+    SC_TEST_EXPECT(pipe.createPipe());
+    SC_TEST_EXPECT(pipe.readPipe.setBlocking(false));
+    SC_TEST_EXPECT(eventLoop.associateExternallyCreatedFileDescriptor(pipe.readPipe));
+    FileDescriptor::Handle handle = FileDescriptor::Invalid;
+    SC_TEST_EXPECT(pipe.readPipe.get(handle, Result::Error("handle")));
+
+    struct Context
+    {
+        int numRead     = 0;
+        int numTimedOut = 0;
+    } context;
+
+    // Nothing is written to the pipe, so the read fails when its timeout expires
+    char readBuffer[1] = {0};
+
+    AsyncFileRead asyncRead;
+    asyncRead.handle   = handle;
+    asyncRead.buffer   = {readBuffer, sizeof(readBuffer)};
+    asyncRead.timeout  = Time::Milliseconds(50);
+    asyncRead.callback = [&context](AsyncFileRead::Result& result)
+    {
+        if (result.isTimedOut())
+        {
+            context.numTimedOut++;
+        }
+        else if (result.isValid())
+        {
+            context.numRead++;
+        }
+    };
+    SC_TEST_EXPECT(asyncRead.start(eventLoop));
+    SC_TEST_EXPECT(eventLoop.run());
+    SC_TEST_EXPECT(context.numTimedOut == 1);
+    SC_TEST_EXPECT(context.numRead == 0);
+
+    // A read completed before its timeout must not leave a pending deadline keeping the loop alive
+    asyncRead.timeout = Time::Milliseconds(60 * 1000);
+    SC_TEST_EXPECT(asyncRead.start(eventLoop));
+    SC_TEST_EXPECT(pipe.writePipe.write(StringView("X").toCharSpan()));
+    const Time::Monotonic start = Time::Monotonic::now();
+    SC_TEST_EXPECT(eventLoop.run());
+    SC_TEST_EXPECT(context.numRead == 1);
+    SC_TEST_EXPECT(context.numTimedOut == 1);
+    SC_TEST_EXPECT(readBuffer[0] == 'X');
+    SC_TEST_EXPECT(Time::Monotonic::now().subtractExact(start).ms < 30 * 1000);
+
+    // Fill the pipe, so that a write fails when its timeout expires, as nobody is reading from it
+    SC_TEST_EXPECT(pipe.writePipe.setBlocking(false));
+    char writeBuffer[4096] = {0};
+    while (pipe.writePipe.write({writeBuffer, sizeof(writeBuffer)}))
+    {
+    }
+    SC_TEST_EXPECT(eventLoop.associateExternallyCreatedFileDescriptor(pipe.writePipe));
+    SC_TEST_EXPECT(pipe.writePipe.get(handle, Result::Error("handle")));
+
+    AsyncFileWrite asyncWrite;
+    asyncWrite.handle   = handle;
+    asyncWrite.timeout  = Time::Milliseconds(50);
+    asyncWrite.callback = [&context](AsyncFileWrite::Result& result)
+    {
+        if (result.isTimedOut())
+        {
+            context.numTimedOut++;
+        }
+    };
+    SC_TEST_EXPECT(asyncWrite.start(eventLoop, Span<const char>(writeBuffer, sizeof(writeBuffer))));
+    SC_TEST_EXPECT(eventLoop.run());
+    SC_TEST_EXPECT(context.numTimedOut == 2);
+    SC_TEST_EXPECT(eventLoop.close());
+    SC_TEST_EXPECT(pipe.close());
+#endif
+}
+
+void SC::AsyncTest::fileSystemOperation(bool useThreadPool)
+{
+    ThreadPool        threadPool;
+    AsyncTaskSequence task;
+    if (useThreadPool)
+    {
+        SC_TEST_EXPECT(threadPool.create(2));
+    }
+    AsyncEventLoop eventLoop;
+    SC_TEST_EXPECT(eventLoop.create(options));
+
+    // Operations are chained: mkdir -> open -> allocate -> sync -> stat file -> rename -> stat dir -> remove
+    struct Context
+    {
+        AsyncEventLoop&          eventLoop;
+        AsyncFileSystemOperation operations[8];
+        FileDescriptor           fd;
+        StringNative<255>        dirPath      = StringEncoding::Native;
+        StringNative<255>        filePath     = StringEncoding::Native;
+        StringNative<255>        renamedPath  = StringEncoding::Native;
+        int                      numCallbacks = 0;
+    } ctx = {eventLoop};
+
+    const StringView name = "AsyncFileSystemOperationTest";
+    SC_TEST_EXPECT(Path::join(ctx.dirPath, {report.applicationRootDirectory, name}));
+    SC_TEST_EXPECT(Path::join(ctx.filePath, {ctx.dirPath.view(), "test.txt"}));
+    SC_TEST_EXPECT(Path::join(ctx.renamedPath, {ctx.dirPath.view(), "renamed.txt"}));
+    if (useThreadPool)
+    {
+        for (AsyncFileSystemOperation& operation : ctx.operations)
+        {
+            SC_TEST_EXPECT(operation.executeOn(task, threadPool));
+        }
+    }
+    constexpr uint64_t allocationSize = 4096;
+
+    ctx.operations[0].callback = [this, &ctx](AsyncFileSystemOperation::Result& res)
+    {
+        ctx.numCallbacks++;
+        SC_TEST_EXPECT(res.isValid());
+        SC_TEST_EXPECT(res.getAsync().getOperation() == AsyncFileSystemOperation::Operation::MakeDirectory);
+        using OpenMode = AsyncFileSystemOperation::OpenMode;
+        SC_TEST_EXPECT(ctx.operations[1].open(ctx.eventLoop, ctx.filePath.view().getNullTerminatedNative(),
+                                              OpenMode::WriteCreateTruncate));
+    };
+    ctx.operations[1].callback = [this, &ctx](AsyncFileSystemOperation::Result& res)
+    {
+        ctx.numCallbacks++;
+        SC_TEST_EXPECT(res.isValid());
+        SC_TEST_EXPECT(ctx.fd.assign(res.completionData.handle));
+        SC_TEST_EXPECT(ctx.operations[2].allocate(ctx.eventLoop, res.completionData.handle, 0, allocationSize));
+    };
+    ctx.operations[2].callback = [this, &ctx](AsyncFileSystemOperation::Result& res)
+    {
+        ctx.numCallbacks++;
+        SC_TEST_EXPECT(res.isValid());
+        FileDescriptor::Handle handle = FileDescriptor::Invalid;
+        SC_TEST_EXPECT(ctx.fd.get(handle, Result::Error("handle")));
+        SC_TEST_EXPECT(ctx.operations[3].sync(ctx.eventLoop, handle, true));
+    };
+    ctx.operations[3].callback = [this, &ctx](AsyncFileSystemOperation::Result& res)
+    {
+        ctx.numCallbacks++;
+        SC_TEST_EXPECT(res.isValid());
+        SC_TEST_EXPECT(ctx.fd.close());
+        SC_TEST_EXPECT(ctx.operations[4].stat(ctx.eventLoop, ctx.filePath.view().getNullTerminatedNative()));
+    };
+    ctx.operations[4].callback = [this, &ctx](AsyncFileSystemOperation::Result& res)
+    {
+        ctx.numCallbacks++;
+        SC_TEST_EXPECT(res.isValid());
+        SC_TEST_EXPECT(res.completionData.fileSize == allocationSize);
+        SC_TEST_EXPECT(not res.completionData.isDirectory);
+        SC_TEST_EXPECT(res.completionData.modifiedTime.getMillisecondsSinceEpoch() > 0);
+        SC_TEST_EXPECT(ctx.operations[5].rename(ctx.eventLoop, ctx.filePath.view().getNullTerminatedNative(),
+                                                ctx.renamedPath.view().getNullTerminatedNative()));
+    };
+    ctx.operations[5].callback = [this, &ctx](AsyncFileSystemOperation::Result& res)
+    {
+        ctx.numCallbacks++;
+        SC_TEST_EXPECT(res.isValid());
+        SC_TEST_EXPECT(ctx.operations[6].stat(ctx.eventLoop, ctx.dirPath.view().getNullTerminatedNative()));
+    };
+    ctx.operations[6].callback = [this, &ctx](AsyncFileSystemOperation::Result& res)
+    {
+        ctx.numCallbacks++;
+        SC_TEST_EXPECT(res.isValid());
+        SC_TEST_EXPECT(res.completionData.isDirectory);
+        SC_TEST_EXPECT(ctx.operations[7].removeFile(ctx.eventLoop, ctx.renamedPath.view().getNullTerminatedNative()));
+    };
+    ctx.operations[7].callback = [this, &ctx](AsyncFileSystemOperation::Result& res)
+    {
+        ctx.numCallbacks++;
+        SC_TEST_EXPECT(res.isValid());
+    };
+    SC_TEST_EXPECT(ctx.operations[0].makeDirectory(eventLoop, ctx.dirPath.view().getNullTerminatedNative()));
+    SC_TEST_EXPECT(eventLoop.run());
+    SC_TEST_EXPECT(ctx.numCallbacks == 8);
+
+    // Removing a file that doesn't exist anymore must report an error
+    AsyncFileSystemOperation removeAgain;
+    if (useThreadPool)
+    {
+        SC_TEST_EXPECT(removeAgain.executeOn(task, threadPool));
+    }
+    removeAgain.callback = [this](AsyncFileSystemOperation::Result& res) { SC_TEST_EXPECT(not res.isValid()); };
+    SC_TEST_EXPECT(removeAgain.removeFile(eventLoop, ctx.renamedPath.view().getNullTerminatedNative()));
+    SC_TEST_EXPECT(eventLoop.run());
+
+    FileSystem fs;
+    SC_TEST_EXPECT(fs.init(report.applicationRootDirectory));
+    SC_TEST_EXPECT(fs.removeEmptyDirectory(name));
+    SC_TEST_EXPECT(eventLoop.close());
+}
+
+void SC::AsyncTest::fileLinkedSequence()
+{
+    AsyncEventLoop eventLoop;
+    SC_TEST_EXPECT(eventLoop.create(options));
+
+    StringNative<255> filePath = StringEncoding::Native;
+    StringNative<255> dirPath  = StringEncoding::Native;
+    const StringView  name     = "AsyncLinkedSequenceTest";
+    const StringView  fileName = "test.txt";
+    SC_TEST_EXPECT(Path::join(dirPath, {report.applicationRootDirectory, name}));
+    SC_TEST_EXPECT(Path::join(filePath, {dirPath.view(), fileName}));
+
+    FileSystem fs;
+    SC_TEST_EXPECT(fs.init(report.applicationRootDirectory));
+    SC_TEST_EXPECT(fs.makeDirectoryIfNotExists(name));
+    SC_TEST_EXPECT(fs.write(filePath.view(), "test"));
+
+    File::OpenOptions openOptions;
+    openOptions.blocking = false;
+
+    FileDescriptor fd;
+    SC_TEST_EXPECT(File(fd).open(filePath.view(), File::ReadAndWrite, openOptions));
+    SC_TEST_EXPECT(eventLoop.associateExternallyCreatedFileDescriptor(fd));
+    FileDescriptor::Handle handle = FileDescriptor::Invalid;
+    SC_TEST_EXPECT(fd.get(handle, Result::Error("handle")));
+
+    // Write-then-fsync-then-read, all started in the same loop iteration (linked in kernel on io_uring)
+    struct Context
+    {
+        char order[4]  = {0};
+        int  numCalled = 0;
+        char read[8]   = {0};
+    } context;
+    AsyncSequence sequence;
+    sequence.linkInKernel = true;
+
+    AsyncFileWrite           fileWrite;
+    AsyncFileSystemOperation fileSync;
+    AsyncFileRead            fileRead;
+    fileWrite.executeOn(sequence);
+    fileSync.executeOn(sequence);
+    fileRead.executeOn(sequence);
+
+    fileWrite.callback = [this, &context](AsyncFileWrite::Result& res)
+    {
+        size_t writtenBytes = 0;
+        SC_TEST_EXPECT(res.get(writtenBytes) and writtenBytes == 8);
+        context.order[context.numCalled++] = 'W';
+    };
+    fileSync.callback = [this, &context](AsyncFileSystemOperation::Result& res)
+    {
+        SC_TEST_EXPECT(res.isValid());
+        context.order[context.numCalled++] = 'S';
+    };
+    fileRead.callback = [this, &context](AsyncFileRead::Result& res)
+    {
+        Span<char> readData;
+        SC_TEST_EXPECT(res.get(readData) and readData.sizeInBytes() == 8);
+        context.order[context.numCalled++] = 'R';
+    };
+    fileWrite.handle = handle;
+    fileWrite.setOffset(0);
+    SC_TEST_EXPECT(fileWrite.start(eventLoop, Span<const char>("PINGPONG", 8)));
+    SC_TEST_EXPECT(fileSync.sync(eventLoop, handle, true));
+    fileRead.handle = handle;
+    fileRead.buffer = {context.read, sizeof(context.read)};
+    fileRead.setOffset(0);
+    SC_TEST_EXPECT(fileRead.start(eventLoop));
+    SC_TEST_EXPECT(eventLoop.run());
+
+    SC_TEST_EXPECT(context.numCalled == 3);
+    SC_TEST_EXPECT(StringView({context.order, 3}, false, StringEncoding::Ascii) == "WSR");
+    SC_TEST_EXPECT(StringView({context.read, 8}, false, StringEncoding::Ascii) == "PINGPONG");
+    SC_TEST_EXPECT(fd.close());
+    SC_TEST_EXPECT(eventLoop.close());
+
+    SC_TEST_EXPECT(fs.changeDirectory(dirPath.view()));
+    SC_TEST_EXPECT(fs.removeFile(fileName));
+    SC_TEST_EXPECT(fs.changeDirectory(report.applicationRootDirectory));
+    SC_TEST_EXPECT(fs.removeEmptyDirectory(name));
+}
@@ -52,3 +52,33 @@ void SC::AsyncTest::processExit()
     SC_TEST_EXPECT(outParams2.numCallbackCalled == 1);
     SC_TEST_EXPECT(outParams2.exitStatus.status != 0); // Status == Not OK
 }
+
+void SC::AsyncTest::processExitReuse()
+{
+    // The same AsyncProcessExit must be reusable to monitor multiple processes, one after the other
+    AsyncEventLoop eventLoop;
+    SC_TEST_EXPECT(eventLoop.create(options));
+    AsyncProcessExit asyncExit;
+    int              numCallbackCalled = 0;
+    asyncExit.callback = [&](AsyncProcessExit::Result& res)
+    {
+        ProcessDescriptor::ExitStatus exitStatus = {-1};
+        SC_TEST_EXPECT(res.get(exitStatus));
+        SC_TEST_EXPECT(exitStatus.status == 0);
+        numCallbackCalled++;
+    };
+    for (int idx = 0; idx < 3; ++idx)
+    {
+        Process process;
+#if SC_PLATFORM_WINDOWS
+        SC_TEST_EXPECT(process.launch({"where", "where.exe"}));
+#else
+        SC_TEST_EXPECT(process.launch({"sleep", "0.1"}));
+#endif
+        ProcessDescriptor::Handle processHandle = 0;
+        SC_TEST_EXPECT(process.handle.get(processHandle, Result::Error("Invalid Handle")));
+        SC_TEST_EXPECT(asyncExit.start(eventLoop, processHandle));
+        SC_TEST_EXPECT(eventLoop.run());
+        SC_TEST_EXPECT(numCallbackCalled == idx + 1);
+    }
+}
@@ -334,6 +334,66 @@ void SC::AsyncTest::socketSendMultiple()
     SC_TEST_EXPECT(finalString == "PINGPONGPENGPANG");
 }
 
+void SC::AsyncTest::socketSendZeroCopy()
+{
+    AsyncEventLoop eventLoop;
+    SC_TEST_EXPECT(eventLoop.create(options));
+    SocketDescriptor client, serverSideClient;
+    createTCPSocketPair(eventLoop, client, serverSideClient);
+
+    // Large enough to fill socket buffers, requiring multiple sends
+    constexpr size_t NumBytes = 1024 * 1024;
+
+    Buffer sendData;
+    SC_TEST_EXPECT(sendData.resize(NumBytes, 'z'));
+    sendData.data()[NumBytes - 1] = 'a';
+
+    struct Context
+    {
+        int    numSendCallbacks    = 0;
+        bool   firstBufferReusable = false;
+        bool   finalBufferReusable = false;
+        size_t numBytesReceived    = 0;
+        char   lastByte            = 0;
+    } context;
+
+    AsyncSocketSend sendAsync;
+    sendAsync.zeroCopy = true; // Falls back to regular sends where not supported
+    sendAsync.callback = [this, &context](AsyncSocketSend::Result& res)
+    {
+        SC_TEST_EXPECT(res.isValid());
+        SC_TEST_EXPECT(res.completionData.numBytes == NumBytes);
+        context.numSendCallbacks++;
+        if (context.numSendCallbacks == 1)
+        {
+            context.firstBufferReusable = res.completionData.bufferReusable;
+        }
+        context.finalBufferReusable = res.completionData.bufferReusable;
+    };
+    SC_TEST_EXPECT(sendAsync.start(eventLoop, client, sendData.toSpanConst()));
+
+    char               receiveBuffer[64 * 1024];
+    AsyncSocketReceive receiveAsync;
+    receiveAsync.callback = [this, &context](AsyncSocketReceive::Result& res)
+    {
+        Span<char> readData;
+        SC_TEST_EXPECT(res.get(readData));
+        if (not readData.empty())
+        {
+            context.numBytesReceived += readData.sizeInBytes();
+            context.lastByte = readData.data()[readData.sizeInBytes() - 1];
+        }
+        res.reactivateRequest(context.numBytesReceived < NumBytes and not res.completionData.disconnected);
+    };
+    SC_TEST_EXPECT(receiveAsync.start(eventLoop, serverSideClient, {receiveBuffer, sizeof(receiveBuffer)}));
+    SC_TEST_EXPECT(eventLoop.run());
+    SC_TEST_EXPECT(context.numBytesReceived == NumBytes and context.lastByte == 'a');
+    // Either called once with buffer immediately reusable or twice, the last one signaling buffer release
+    SC_TEST_EXPECT(context.finalBufferReusable);
+    SC_TEST_EXPECT((context.numSendCallbacks == 1 and context.firstBufferReusable) or
+                   (context.numSendCallbacks == 2 and not context.firstBufferReusable));
+}
+
 void SC::AsyncTest::socketClose()
 {
     AsyncEventLoop eventLoop;
@@ -430,3 +490,342 @@ void SC::AsyncTest::socketSendReceiveError()
     SC_TEST_EXPECT(numOnSend == 1);
     SC_TEST_EXPECT(numOnReceive == 1);
 }
+
+void SC::AsyncTest::socketReceiveTimeout()
+{
+    AsyncEventLoop eventLoop;
+    SC_TEST_EXPECT(eventLoop.create(options));
+    SocketDescriptor client, serverSideClient;
+    createTCPSocketPair(eventLoop, client, serverSideClient);
+
+    struct Context
+    {
+        int  numReceived = 0;
+        int  numTimedOut = 0;
+        char received    = 0;
+    } context;
+
+    const char sendBuffer[1] = {'X'};
+    SC_TEST_EXPECT(SocketClient(serverSideClient).write({sendBuffer, sizeof(sendBuffer)}));
+
+    //! [AsyncSocketReceiveTimeoutSnippet]
+    // Receive data, failing the request if nothing arrives from the remote endpoint within 50 milliseconds
+    char recvBuffer[1] = {0};
+
+    AsyncSocketReceive asyncRecv;
+    asyncRecv.timeout  = Time::Milliseconds(50);
+    asyncRecv.callback = [&context](AsyncSocketReceive::Result& result)
+    {
+        if (result.isTimedOut())
+        {
+            // Remote endpoint has been idle for too long, for example close the connection here
+            context.numTimedOut++;
+            return;
+        }
+        Span<char> data;
+        if (result.get(data))
+        {
+            context.received = data[0];
+            context.numReceived++;
+            result.reactivateRequest(true); // Timeout starts again for the re-activated receive
+        }
+    };
+    SC_TEST_EXPECT(asyncRecv.start(eventLoop, client, {recvBuffer, sizeof(recvBuffer)}));
+    //! [AsyncSocketReceiveTimeoutSnippet]
+    SC_TEST_EXPECT(eventLoop.run());
+    SC_TEST_EXPECT(context.numReceived == 1);
+    SC_TEST_EXPECT(context.received == 'X');
+    SC_TEST_EXPECT(context.numTimedOut == 1);
+
+    // A receive completed before its timeout must not leave a pending deadline keeping the loop alive
+    asyncRecv.timeout  = Time::Milliseconds(60 * 1000);
+    asyncRecv.callback = [this, &context](AsyncSocketReceive::Result& result)
+    {
+        SC_TEST_EXPECT(result.isValid() and not result.isTimedOut());
+        context.numReceived++;
+    };
+    SC_TEST_EXPECT(asyncRecv.start(eventLoop, client, {recvBuffer, sizeof(recvBuffer)}));
+    SC_TEST_EXPECT(SocketClient(serverSideClient).write({sendBuffer, sizeof(sendBuffer)}));
+    const Time::Monotonic start = Time::Monotonic::now();
+    SC_TEST_EXPECT(eventLoop.run());
+    SC_TEST_EXPECT(context.numReceived == 2);
+    SC_TEST_EXPECT(Time::Monotonic::now().subtractExact(start).ms < 30 * 1000);
+    SC_TEST_EXPECT(eventLoop.close());
+}
+
+void SC::AsyncTest::socketSendToReceiveFrom()
+{
+    AsyncEventLoop eventLoop;
+    SC_TEST_EXPECT(eventLoop.create(options));
+
+    SocketIPAddress serverAddress, clientAddress;
+    SC_TEST_EXPECT(serverAddress.fromAddressPort("127.0.0.1", 5051));
+    SC_TEST_EXPECT(clientAddress.fromAddressPort("127.0.0.1", 5052));
+    SocketDescriptor server, client;
+    SC_TEST_EXPECT(eventLoop.createAsyncUDPSocket(serverAddress.getAddressFamily(), server));
+    SC_TEST_EXPECT(eventLoop.createAsyncUDPSocket(clientAddress.getAddressFamily(), client));
+    SC_TEST_EXPECT(SocketServer(server).bind(serverAddress));
+    SC_TEST_EXPECT(SocketServer(client).bind(clientAddress));
+
+    struct Context
+    {
+        AsyncSocketSendTo      serverSendTo;
+        AsyncSocketReceiveFrom clientReceiveFrom;
+        SocketDescriptor&      server;
+
+        int  numSent     = 0;
+        int  numReceived = 0;
+        char serverBuffer[16];
+        char clientBuffer[16];
+    } context = {{}, {}, server};
+
+    // Server answers "PONG" to the sender of every datagram
+    AsyncSocketReceiveFrom serverReceiveFrom;
+    serverReceiveFrom.callback = [this, &context](AsyncSocketReceiveFrom::Result& res)
+    {
+        Span<char>      data;
+        SocketIPAddress sender;
+        SC_TEST_EXPECT(res.get(data, sender));
+        SC_TEST_EXPECT(StringView(data, false, StringEncoding::Ascii) == "PING");
+        SC_TEST_EXPECT(res.completionData.numDatagrams == 1);
+        const Span<const char> pong = {"PONG", 4};
+        SC_TEST_EXPECT(context.serverSendTo.start(res.eventLoop, context.server, sender, pong));
+    };
+    SC_TEST_EXPECT(serverReceiveFrom.start(eventLoop, server, context.serverBuffer));
+
+    context.clientReceiveFrom.callback = [this, &context](AsyncSocketReceiveFrom::Result& res)
+    {
+        Span<char>      data;
+        SocketIPAddress sender;
+        SC_TEST_EXPECT(res.get(data, sender));
+        SC_TEST_EXPECT(StringView(data, false, StringEncoding::Ascii) == "PONG");
+        SC_TEST_EXPECT(sender.getAddressFamily() == SocketFlags::AddressFamilyIPV4);
+        context.numReceived++;
+    };
+    SC_TEST_EXPECT(context.clientReceiveFrom.start(eventLoop, client, context.clientBuffer));
+
+    AsyncSocketSendTo clientSendTo;
+    clientSendTo.callback = [this, &context](AsyncSocketSendTo::Result& res)
+    {
+        SC_TEST_EXPECT(res.isValid());
+        SC_TEST_EXPECT(res.completionData.numBytes == 4);
+        context.numSent++;
+    };
+    const Span<const char> ping = {"PING", 4};
+    SC_TEST_EXPECT(clientSendTo.start(eventLoop, client, serverAddress, ping));
+    SC_TEST_EXPECT(eventLoop.run());
+    SC_TEST_EXPECT(context.numSent == 1);
+    SC_TEST_EXPECT(context.numReceived == 1);
+    SC_TEST_EXPECT(server.close());
+    SC_TEST_EXPECT(client.close());
+}
+
+void SC::AsyncTest::socketSendToReceiveFromMultiple()
+{
+    AsyncEventLoop eventLoop;
+    SC_TEST_EXPECT(eventLoop.create(options));
+
+    SocketIPAddress serverAddress;
+    SC_TEST_EXPECT(serverAddress.fromAddressPort("127.0.0.1", 5051));
+    SocketDescriptor server, client;
+    SC_TEST_EXPECT(eventLoop.createAsyncUDPSocket(serverAddress.getAddressFamily(), server));
+    SC_TEST_EXPECT(eventLoop.createAsyncUDPSocket(serverAddress.getAddressFamily(), client));
+    SC_TEST_EXPECT(SocketServer(server).bind(serverAddress));
+
+    // Sends 5 datagrams of different sizes with a single request
+    Span<const char> datagrams[] = {{"A", 1}, {"BB", 2}, {"CCC", 3}, {"DDDD", 4}, {"EEEEE", 5}};
+
+    AsyncSocketSendTo sendTo;
+    sendTo.callback = [this](AsyncSocketSendTo::Result& res)
+    {
+        SC_TEST_EXPECT(res.isValid());
+        SC_TEST_EXPECT(res.completionData.numDatagrams == 5);
+        SC_TEST_EXPECT(res.completionData.numBytes == 15);
+    };
+    SC_TEST_EXPECT(sendTo.start(eventLoop, client, serverAddress, datagrams));
+
+    struct Context
+    {
+        Buffer finalString;
+        size_t numDatagrams = 0;
+        size_t numExpected  = 5;
+    } context;
+
+    // Receives them in 8 slots of 16 bytes each, possibly in a single callback
+    char                             receiveBuffer[8 * 16];
+    AsyncSocketReceiveFrom::Datagram receivedDatagrams[8];
+    AsyncSocketReceiveFrom           receiveFrom;
+    receiveFrom.callback = [this, &context](AsyncSocketReceiveFrom::Result& res)
+    {
+        Span<AsyncSocketReceiveFrom::Datagram> received;
+        SC_TEST_EXPECT(res.get(received));
+        SC_TEST_EXPECT(received.sizeInElements() == res.completionData.numDatagrams);
+        for (AsyncSocketReceiveFrom::Datagram& datagram : received)
+        {
+            SC_TEST_EXPECT(datagram.data.sizeInBytes() <= 16);
+            SC_TEST_EXPECT(datagram.ipAddress.isValid());
+            SC_TEST_EXPECT(context.finalString.append(Span<const char>(datagram.data)));
+            SC_TEST_EXPECT(context.finalString.push_back(' '));
+        }
+        context.numDatagrams += received.sizeInElements();
+        res.reactivateRequest(context.numDatagrams < context.numExpected);
+    };
+    SC_TEST_EXPECT(receiveFrom.start(eventLoop, server, receiveBuffer, receivedDatagrams));
+    SC_TEST_EXPECT(eventLoop.run());
+    SC_TEST_EXPECT(context.numDatagrams == 5);
+    StringView finalString(context.finalString.toSpanConst(), false, StringEncoding::Ascii);
+    SC_TEST_EXPECT(finalString == "A BB CCC DDDD EEEEE ");
+
+#if SC_PLATFORM_LINUX
+    // UDP GSO: a single buffer is split by the kernel in datagrams of segmentSize bytes
+    char gsoBuffer[4 * 10];
+    for (size_t idx = 0; idx < sizeof(gsoBuffer); ++idx)
+    {
+        gsoBuffer[idx] = static_cast<char>('a' + idx / 10);
+    }
+    sendTo.segmentSize = 10;
+    sendTo.callback    = [this](AsyncSocketSendTo::Result& res)
+    {
+        SC_TEST_EXPECT(res.isValid());
+        SC_TEST_EXPECT(res.completionData.numBytes == 40);
+    };
+    const Span<const char> gsoData = {gsoBuffer, sizeof(gsoBuffer)};
+    SC_TEST_EXPECT(sendTo.start(eventLoop, client, serverAddress, gsoData));
+    context.finalString.clear();
+    context.numDatagrams = 0;
+    context.numExpected  = 4;
+    SC_TEST_EXPECT(receiveFrom.start(eventLoop, server, receiveBuffer, receivedDatagrams));
+    SC_TEST_EXPECT(eventLoop.run());
+    SC_TEST_EXPECT(context.numDatagrams == 4);
+    finalString = StringView(context.finalString.toSpanConst(), false, StringEncoding::Ascii);
+    SC_TEST_EXPECT(finalString == "aaaaaaaaaa bbbbbbbbbb cccccccccc dddddddddd ");
+#endif
+    SC_TEST_EXPECT(server.close());
+    SC_TEST_EXPECT(client.close());
+}
+
+void SC::AsyncTest::socketEchoBenchmark()
+{
+    // Ping-pong of small messages on a local TCP connection, comparing backends and io_uring setup flags.
+    // Loop iterations per operation count kernel waits (one epoll_pwait2 / io_uring_enter each), that is not the number
+    // of syscalls, as epoll also needs one send / recv syscall for each operation.
+    constexpr int    numRoundTrips = 100000;
+    constexpr size_t messageSize   = 64;
+
+    struct Configuration
+    {
+        StringView              name;
+        AsyncEventLoop::Options options;
+    };
+    Configuration configurations[5];
+    configurations[0].name            = "default";
+    configurations[1].name            = "epoll";
+    configurations[1].options.apiType = AsyncEventLoop::Options::ApiType::ForceUseEpoll;
+    configurations[2].name            = "io_uring";
+    configurations[2].options.apiType = AsyncEventLoop::Options::ApiType::ForceUseIOURing;
+    configurations[3].name            = "io_uring SQPOLL";
+    configurations[3].options.apiType = AsyncEventLoop::Options::ApiType::ForceUseIOURing;
+    configurations[3].options.ioURingSubmissionPolling = true;
+    configurations[4].name                             = "io_uring SINGLE_ISSUER + DEFER_TASKRUN";
+    configurations[4].options.apiType                  = AsyncEventLoop::Options::ApiType::ForceUseIOURing;
+    configurations[4].options.ioURingDeferTaskRun      = true;
+
+    for (const Configuration& configuration : configurations)
+    {
+        AsyncEventLoop eventLoop;
+        if (not eventLoop.create(configuration.options))
+        {
+            report.console.print("{}: not available\n", configuration.name);
+            continue;
+        }
+        SocketDescriptor client, serverSideClient;
+        createTCPSocketPair(eventLoop, client, serverSideClient);
+
+        struct Context
+        {
+            AsyncEventLoop&   eventLoop;
+            SocketDescriptor& client;
+            SocketDescriptor& serverSideClient;
+
+            AsyncSocketSend    clientSend;
+            AsyncSocketReceive clientReceive;
+            AsyncSocketSend    serverSend;
+            AsyncSocketReceive serverReceive;
+
+            char message[messageSize];
+            char clientBuffer[messageSize];
+            char serverBuffer[messageSize];
+
+            size_t   clientReceived = 0;
+            int      roundTrips     = 0;
+            uint64_t numIterations  = 0;
+            bool     failed         = false;
+        } context = {eventLoop, client, serverSideClient};
+        memset(context.message, 'x', sizeof(context.message));
+
+        // Server echoes back whatever it receives, waiting for the send to complete before receiving again
+        context.serverReceive.callback = [&context](AsyncSocketReceive::Result& res)
+        {
+            Span<char> data;
+            if (not res.get(data) or data.empty())
+            {
+                return; // Client disconnected
+            }
+            context.failed |= not context.serverSend.start(context.eventLoop, context.serverSideClient, data);
+        };
+        context.serverSend.callback = [&context](AsyncSocketSend::Result& res)
+        {
+            context.failed |= not res.isValid();
+            context.failed |= not context.serverReceive.start(context.eventLoop, context.serverSideClient,
+                                                              {context.serverBuffer, messageSize});
+        };
+        // Client sends next message only after the full echo of the previous one has been received
+        context.clientSend.callback = [&context](AsyncSocketSend::Result& res)
+        { context.failed |= not res.isValid(); };
+        context.clientReceive.callback = [&context](AsyncSocketReceive::Result& res)
+        {
+            Span<char> data;
+            context.failed |= not res.get(data);
+            context.clientReceived += data.sizeInBytes();
+            if (context.clientReceived == messageSize)
+            {
+                context.clientReceived = 0;
+                context.roundTrips++;
+                if (context.roundTrips == numRoundTrips or context.failed)
+                {
+                    SC_TRUST_RESULT(context.client.close()); // Causes EOF on server side, ending the loop
+                    return;
+                }
+                context.failed |= not context.clientSend.start(context.eventLoop, context.client,
+                                                               Span<const char>(context.message, messageSize));
+            }
+            res.getAsync().buffer = {context.clientBuffer + context.clientReceived,
+                                     messageSize - context.clientReceived};
+            res.reactivateRequest(true);
+        };
+
+        AsyncEventLoopListeners listeners;
+        listeners.afterBlockingPoll = [&context](AsyncEventLoop&) { context.numIterations++; };
+        eventLoop.setListeners(&listeners);
+
+        Time::HighResolutionCounter start;
+        start.snap();
+        SC_TEST_EXPECT(context.serverReceive.start(eventLoop, serverSideClient, {context.serverBuffer, messageSize}));
+        SC_TEST_EXPECT(context.clientReceive.start(eventLoop, client, {context.clientBuffer, messageSize}));
+        SC_TEST_EXPECT(context.clientSend.start(eventLoop, client, Span<const char>(context.message, messageSize)));
+        SC_TEST_EXPECT(eventLoop.run());
+        const int64_t nanoseconds = Time::HighResolutionCounter().snap().subtractExact(start).toNanoseconds().ns;
+        eventLoop.setListeners(nullptr);
+
+        SC_TEST_EXPECT(not context.failed);
+        SC_TEST_EXPECT(context.roundTrips == numRoundTrips);
+        SC_TEST_EXPECT(serverSideClient.close());
+        SC_TEST_EXPECT(eventLoop.close());
+
+        // Every round trip is made of four operations (two sends and two receives)
+        const double numOperations = 4.0 * context.roundTrips;
+        const double seconds       = static_cast<double>(nanoseconds) / 1e9;
+        report.console.print("{}: {:.0} ops/sec, {:.2} loop iterations/op\n", configuration.name,
+                             numOperations / seconds, static_cast<double>(context.numIterations) / numOperations);
+    }
+}
@@ -51,6 +51,10 @@ struct SC::AsyncRequestStreamsTest : public SC::TestCase
             {
                 fileToSocketToFile();
             }
+            if (test_section("socket to socket zero copy"))
+            {
+                socketToSocketZeroCopy();
+            }
             if (numTestsToRun == 2)
             {
                 // If on Linux next run will test io_uring backend (if it's installed)
@@ -63,6 +67,8 @@ struct SC::AsyncRequestStreamsTest : public SC::TestCase
 
     void fileToSocketToFile();
 
+    void socketToSocketZeroCopy();
+
     void createAsyncConnectedSockets(AsyncEventLoop& eventLoop, SocketDescriptor& client,
                                      SocketDescriptor& serverSideClient)
     {
@@ -356,6 +362,116 @@ void SC::AsyncRequestStreamsTest::fileToSocketToFile()
     SC_TEST_EXPECT(fs.removeFiles({"source.txt", "destination.txt"}));
 }
 
+void SC::AsyncRequestStreamsTest::socketToSocketZeroCopy()
+{
+    // This test:
+    // 1. Creates a TCP socket pair (client server)
+    // 2. Writes a sequence of chunks to a zero-copy writable socket stream, writing the next one only when the
+    //    previous buffer has been released by the kernel (as the pool only holds two buffers)
+    // 3. Reads all data from a readable socket stream on the other side, until the writer closes the socket
+    // 4. Checks that received data matches what has been sent
+
+    constexpr size_t numChunks = 8;
+    constexpr size_t chunkSize = 512;
+
+    Vector<char> source;
+    SC_TEST_EXPECT(source.resizeWithoutInitializing(numChunks * chunkSize));
+    for (size_t idx = 0; idx < source.size(); ++idx)
+    {
+        source[idx] = static_cast<char>(idx % 251);
+    }
+
+    AsyncEventLoop eventLoop;
+    SC_TEST_EXPECT(eventLoop.create(options));
+
+    // Writable side buffers
+    AsyncBuffersPool buffersPool1;
+    constexpr size_t numberOfBuffers1 = 2;
+    AsyncBufferView  buffers1[numberOfBuffers1];
+    buffersPool1.buffers = {buffers1, numberOfBuffers1};
+    Buffer buffer1;
+    SC_TEST_EXPECT(buffer1.resizeWithoutInitializing(chunkSize * numberOfBuffers1));
+    for (size_t idx = 0; idx < numberOfBuffers1; ++idx)
+    {
+        SC_TEST_EXPECT(buffer1.toSpan().sliceStartLength(idx * chunkSize, chunkSize, buffers1[idx].data));
+    }
+
+    // Readable side buffers
+    AsyncBuffersPool buffersPool2;
+    constexpr size_t numberOfBuffers2 = 3;
+    AsyncBufferView  buffers2[numberOfBuffers2];
+    buffersPool2.buffers = {buffers2, numberOfBuffers2};
+    Buffer buffer2;
+    SC_TEST_EXPECT(buffer2.resizeWithoutInitializing(chunkSize * numberOfBuffers2));
+    for (size_t idx = 0; idx < numberOfBuffers2; ++idx)
+    {
+        SC_TEST_EXPECT(buffer2.toSpan().sliceStartLength(idx * chunkSize, chunkSize, buffers2[idx].data));
+    }
+
+    SocketDescriptor client[2];
+    createAsyncConnectedSockets(eventLoop, client[0], client[1]);
+
+    // Create Writable Socket Stream with zero-copy sends
+    WritableSocketStream         writeSocketStream;
+    AsyncWritableStream::Request writeSocketRequests[numberOfBuffers1 + 1];
+    writeSocketStream.request.zeroCopy = true; // Buffers are held until kernel has finished reading them
+    SC_TEST_EXPECT(writeSocketStream.init(buffersPool1, writeSocketRequests, eventLoop, client[0]));
+    SC_TEST_EXPECT(writeSocketStream.registerAutoCloseDescriptor(true));
+    client[0].detach(); // Taken care by registerAutoCloseDescriptor(true)
+    (void)writeSocketStream.eventError.addListener([this](Result res) { SC_TEST_EXPECT(res); });
+
+    // Create Readable Socket Stream
+    ReadableSocketStream         readSocketStream;
+    AsyncReadableStream::Request readSocketRequests[numberOfBuffers2 + 1];
+    SC_TEST_EXPECT(readSocketStream.init(buffersPool2, readSocketRequests, eventLoop, client[1]));
+    SC_TEST_EXPECT(readSocketStream.registerAutoCloseDescriptor(true));
+    client[1].detach(); // Taken care by registerAutoCloseDescriptor(true)
+    (void)readSocketStream.eventError.addListener([this](Result res) { SC_TEST_EXPECT(res); });
+
+    struct Context
+    {
+        AsyncRequestStreamsTest& test;
+        AsyncWritableStream&     writable;
+        AsyncBuffersPool&        readablePool;
+        Span<const char>         source;
+
+        size_t numWritten = 0;
+        Buffer destination;
+
+        void writeNext()
+        {
+            if (numWritten == numChunks)
+            {
+                writable.end();
+                return;
+            }
+            Span<const char> chunk;
+            (void)source.sliceStartLength(numWritten * chunkSize, chunkSize, chunk);
+            numWritten++;
+            Result res = writable.write(chunk, [this](AsyncBufferView::ID) { writeNext(); });
+            (void)test.recordExpectation("writable.write", res);
+        }
+    } context = {*this, writeSocketStream, buffersPool2, source.toSpanConst()};
+
+    (void)readSocketStream.eventData.addListener(
+        [this, &context](AsyncBufferView::ID bufferID)
+        {
+            Span<const char> data;
+            SC_TEST_EXPECT(context.readablePool.getData(bufferID, data));
+            SC_TEST_EXPECT(context.destination.append(data));
+        });
+
+    context.writeNext();
+    SC_TEST_EXPECT(readSocketStream.start());
+    SC_TEST_EXPECT(eventLoop.run());
+
+    SC_TEST_EXPECT(context.numWritten == numChunks);
+    SC_TEST_EXPECT(not client[0].isValid());
+    SC_TEST_EXPECT(not client[1].isValid());
+    SC_TEST_EXPECT(context.destination.size() == source.size());
+    SC_TEST_EXPECT(memcmp(context.destination.data(), source.data(), source.size()) == 0);
+}
+
 namespace SC
 {
 void runAsyncRequestStreamTest(SC::TestReport& report) { AsyncRequestStreamsTest test(report); }
@@ -46,6 +46,18 @@ struct SC::AsyncStreamsTest : public SC::TestCase
         {
             writableStream();
         }
+        if (test_section("buffersPool size classes"))
+        {
+            buffersPoolSizeClasses();
+        }
+        if (test_section("buffersPool elastic"))
+        {
+            buffersPoolElastic();
+        }
+        if (test_section("buffersPool benchmark", Execute::OnlyExplicit))
+        {
+            buffersPoolBenchmark();
+        }
     }
 
     void event();
@@ -53,6 +65,9 @@ struct SC::AsyncStreamsTest : public SC::TestCase
     void readableSyncStream();
     void readableAsyncStream();
     void writableStream();
+    void buffersPoolSizeClasses();
+    void buffersPoolElastic();
+    void buffersPoolBenchmark();
 };
 
 void SC::AsyncStreamsTest::circularQueue()
@@ -372,6 +387,144 @@ void SC::AsyncStreamsTest::writableStream()
     SC_TEST_EXPECT(context.concatenated == "1234567");
 }
 
+void SC::AsyncStreamsTest::buffersPoolSizeClasses()
+{
+    // Buffers of 16, 64, 100 and 1024 bytes (in size classes 4, 6, 6 and 10)
+    char            memory[16 + 64 + 100 + 1024];
+    AsyncBufferView buffers[4];
+    buffers[0].data = {memory, 16};
+    buffers[1].data = {memory + 16, 64};
+    buffers[2].data = {memory + 16 + 64, 100};
+    buffers[3].data = {memory + 16 + 64 + 100, 1024};
+
+    AsyncBuffersPool pool;
+    pool.buffers = buffers;
+
+    AsyncBufferView::ID id[4];
+    Span<char>          data;
+
+    // Smallest size class holding a large enough buffer is used
+    SC_TEST_EXPECT(pool.requestNewBuffer(10, id[0], data));
+    SC_TEST_EXPECT(id[0].identifier == 0 and data.sizeInBytes() == 16);
+    SC_TEST_EXPECT(pool.requestNewBuffer(64, id[1], data));
+    SC_TEST_EXPECT(id[1].identifier == 1 and data.sizeInBytes() == 64);
+    // Buffers in size classes larger than requested size are preferred, as the first one is surely fitting
+    SC_TEST_EXPECT(pool.requestNewBuffer(80, id[2], data));
+    SC_TEST_EXPECT(id[2].identifier == 3 and data.sizeInBytes() == 1024);
+    // 100 bytes buffer is in the same size class of 80 bytes, so it's picked only when no larger class is available
+    SC_TEST_EXPECT(pool.requestNewBuffer(80, id[3], data));
+    SC_TEST_EXPECT(id[3].identifier == 2 and data.sizeInBytes() == 100);
+    SC_TEST_EXPECT(not pool.requestNewBuffer(0, id[3], data));
+    SC_TEST_EXPECT(pool.getStats().numStarvations == 1);
+    SC_TEST_EXPECT(pool.getStats().highWaterMark == 4);
+
+    // Buffers are restored to their original size when released
+    pool.setNewBufferSize(id[3], 10);
+    SC_TEST_EXPECT(pool.getData(id[3], data) and data.sizeInBytes() == 10);
+    pool.unrefBuffer(id[3]);
+    pool.unrefBuffer(id[1]);
+    SC_TEST_EXPECT(pool.getStats().numInUse == 2);
+    SC_TEST_EXPECT(pool.getStats().waitTimeNs > 0);
+
+    // A buffer that is too small in a size class that may fit is skipped
+    SC_TEST_EXPECT(pool.requestNewBuffer(90, id[1], data));
+    SC_TEST_EXPECT(id[1].identifier == 2 and data.sizeInBytes() == 100);
+    SC_TEST_EXPECT(not pool.requestNewBuffer(1000, id[3], data));
+    SC_TEST_EXPECT(pool.requestNewBuffer(33, id[3], data));
+    SC_TEST_EXPECT(id[3].identifier == 1 and data.sizeInBytes() == 64);
+    SC_TEST_EXPECT(pool.getStats().numRequests == 6);
+    SC_TEST_EXPECT(pool.getStats().numStarvations == 2);
+}
+
+void SC::AsyncStreamsTest::buffersPoolElastic()
+{
+    //! [AsyncBuffersPoolElasticSnippet]
+    char            memory[2 * 128];
+    AsyncBufferView buffers[2];
+    buffers[0].data = {memory, 128};
+    buffers[1].data = {memory + 128, 128};
+
+    AsyncBuffersPool pool;
+    pool.buffers           = buffers;
+    pool.elasticBufferSize = 256; // Allocate slabs of 256 bytes buffers when running out of buffers
+    pool.elasticMaxSlabs   = 2;   // Slabs double in size: 4 + 8 additional buffers at most
+
+    AsyncBufferView::ID ids[2 + 4 + 8];
+    Span<char>          data;
+    for (AsyncBufferView::ID& id : ids)
+    {
+        SC_TEST_EXPECT(pool.requestNewBuffer(1, id, data));
+    }
+    AsyncBufferView::ID failedID;
+    SC_TEST_EXPECT(not pool.requestNewBuffer(1, failedID, data)); // elasticMaxSlabs has been reached
+
+    const AsyncBuffersPool::Stats& stats = pool.getStats();
+    SC_TEST_EXPECT(stats.numSlabs == 2 and stats.numBuffers == 14 and stats.numInUse == 14);
+    //! [AsyncBuffersPoolElasticSnippet]
+
+    // Buffers from slabs are valid, distinct and fully writeable
+    for (size_t idx = 0; idx < 14; ++idx)
+    {
+        SC_TEST_EXPECT(pool.getData(ids[idx], data));
+        SC_TEST_EXPECT(data.sizeInBytes() == (idx < 2 ? 128 : 256));
+        memset(data.data(), static_cast<int>(idx), data.sizeInBytes());
+    }
+    for (size_t idx = 0; idx < 14; ++idx)
+    {
+        SC_TEST_EXPECT(pool.getData(ids[idx], data) and data[data.sizeInBytes() - 1] == static_cast<char>(idx));
+    }
+    // A request larger than elasticBufferSize allocates a slab with larger buffers
+    SC_TEST_EXPECT(not pool.releaseSlabs()); // Buffers are still in use
+    for (AsyncBufferView::ID& id : ids)
+    {
+        pool.unrefBuffer(id);
+    }
+    SC_TEST_EXPECT(pool.releaseSlabs());
+    SC_TEST_EXPECT(stats.numSlabs == 0 and stats.numBuffers == 2 and stats.slabsSizeInBytes == 0);
+    SC_TEST_EXPECT(pool.requestNewBuffer(1000, ids[0], data));
+    SC_TEST_EXPECT(data.sizeInBytes() == 1024 and stats.numSlabs == 1);
+    pool.unrefBuffer(ids[0]);
+}
+
+void SC::AsyncStreamsTest::buffersPoolBenchmark()
+{
+    // Acquire and release buffers from a large pool mostly in use, like many concurrent streams would do
+    constexpr size_t numberOfBuffers = 4096;
+    constexpr size_t numInUse        = numberOfBuffers - 16;
+
+    Vector<AsyncBufferView> buffers;
+    Buffer                  memory;
+    SC_TEST_EXPECT(buffers.resize(numberOfBuffers));
+    SC_TEST_EXPECT(memory.resizeWithoutInitializing(numberOfBuffers * 1024));
+    for (size_t idx = 0; idx < numberOfBuffers; ++idx)
+    {
+        SC_TEST_EXPECT(memory.toSpan().sliceStartLength(idx * 1024, 1024, buffers[idx].data));
+    }
+    AsyncBuffersPool pool;
+    pool.buffers = buffers.toSpan();
+
+    AsyncBufferView::ID id;
+    Span<char>          data;
+    for (size_t idx = 0; idx < numInUse; ++idx)
+    {
+        SC_TEST_EXPECT(pool.requestNewBuffer(1024, id, data));
+    }
+    constexpr size_t numIterations = 1000000;
+
+    Time::HighResolutionCounter start;
+    start.snap();
+    bool success = true;
+    for (size_t idx = 0; idx < numIterations; ++idx)
+    {
+        success = success and pool.requestNewBuffer(1024, id, data);
+        pool.unrefBuffer(id);
+    }
+    const int64_t elapsed = Time::HighResolutionCounter().snap().subtractExact(start).toNanoseconds().ns;
+    SC_TEST_EXPECT(success);
+    report.console.print("AsyncBuffersPool: {:.1} ns per acquire + release ({} buffers in use)\n",
+                         static_cast<double>(elapsed) / numIterations, numInUse);
+}
+
 namespace SC
 {
 void runAsyncStreamTest(SC::TestReport& report) { AsyncStreamsTest test(report); }
@@ -0,0 +1,244 @@
+// Copyright (c) Stefano Cristiano
+// SPDX-License-Identifier: MIT
+#include "Libraries/AsyncStreams/HashingTransformStreams.h"
+#include "Libraries/Async/Async.h"
+#include "Libraries/Foundation/Buffer.h"
+#include "Libraries/Strings/String.h"
+#include "Libraries/Strings/StringBuilder.h"
+#include "Libraries/Testing/Testing.h"
+
+namespace SC
+{
+struct HashingTransformStreamsTest;
+}
+
+struct SC::HashingTransformStreamsTest : public SC::TestCase
+{
+    HashingTransformStreamsTest(SC::TestReport& report) : TestCase(report, "HashingTransformStreamsTest")
+    {
+        if (test_section("checksum"))
+        {
+            checksum(false);
+        }
+        if (test_section("checksum thread pool"))
+        {
+            checksum(true);
+        }
+        if (test_section("hashing"))
+        {
+            hashing();
+        }
+        if (test_section("snippet"))
+        {
+            snippet();
+        }
+    }
+
+    static void fillInput(Buffer& input, size_t size)
+    {
+        SC_ASSERT_RELEASE(input.resizeWithoutInitializing(size));
+        for (size_t idx = 0; idx < size; ++idx)
+        {
+            input.data()[idx] = static_cast<char>(idx * 7 + 3);
+        }
+    }
+
+    String toHex(const Hashing::Result& res)
+    {
+        String hex;
+        SC_TEST_EXPECT(StringBuilder(hex).appendHex(res.toBytesSpan(), StringBuilder::AppendHexCase::UpperCase));
+        return hex;
+    }
+
+    // Streams input through an AsyncHashingTransformStream, checking that output is unmodified and returning digest
+    Hashing::Result hashInPipeline(AsyncHashingTransformStream::Algorithm algorithm, Span<const char> input,
+                                   bool useThreadPool);
+
+    void checksum(bool useThreadPool);
+    void hashing();
+    void snippet();
+};
+
+SC::Hashing::Result SC::HashingTransformStreamsTest::hashInPipeline(AsyncHashingTransformStream::Algorithm algorithm,
+                                                                    Span<const char> input, bool useThreadPool)
+{
+    AsyncEventLoop eventLoop;
+    SC_TEST_EXPECT(eventLoop.create());
+    ThreadPool threadPool;
+
+    constexpr size_t numberOfBuffers = 8;
+    constexpr size_t buffersSize     = 1000; // Not a multiple of hashes block sizes
+
+    AsyncBufferView buffers[numberOfBuffers];
+    char            buffersMemory[numberOfBuffers][buffersSize];
+    for (size_t idx = 0; idx < numberOfBuffers; ++idx)
+    {
+        buffers[idx].data = buffersMemory[idx];
+    }
+    AsyncBuffersPool buffersPool;
+    buffersPool.buffers = buffers;
+
+    struct Context
+    {
+        AsyncReadableStream source;
+        AsyncWritableStream sink;
+        Span<const char>    input;
+        size_t              inputOffset = 0;
+        Buffer              output;
+        Hashing::Result     digest;
+        int                 numDigests = 0;
+        bool                finished   = false;
+    } context;
+    context.input = input;
+
+    AsyncReadableStream::Request sourceRequests[numberOfBuffers + 1];
+    SC_TEST_EXPECT(context.source.init(buffersPool, sourceRequests));
+    context.source.asyncRead = [&context]() -> Result
+    {
+        if (context.inputOffset == context.input.sizeInBytes())
+        {
+            context.source.pushEnd();
+            return Result(true);
+        }
+        AsyncBufferView::ID bufferID;
+        Span<char>          data;
+        if (context.source.getBufferOrPause(0, bufferID, data))
+        {
+            size_t toCopy = context.input.sizeInBytes() - context.inputOffset;
+            toCopy        = toCopy < data.sizeInBytes() ? toCopy : data.sizeInBytes();
+            memcpy(data.data(), context.input.data() + context.inputOffset, toCopy);
+            context.inputOffset += toCopy;
+            context.source.push(bufferID, toCopy);
+            context.source.getBuffersPool().unrefBuffer(bufferID);
+            context.source.reactivate(true);
+        }
+        return Result(true);
+    };
+
+    AsyncWritableStream::Request sinkRequests[numberOfBuffers + 1];
+    SC_TEST_EXPECT(context.sink.init(buffersPool, sinkRequests));
+    context.sink.asyncWrite = [&context](AsyncBufferView::ID bufferID, Function<void(AsyncBufferView::ID)> cb)
+    {
+        Span<const char> data;
+        SC_TRY(context.sink.getBuffersPool().getData(bufferID, data));
+        SC_TRY(context.output.append(data));
+        context.sink.finishedWriting(bufferID, move(cb), Result(true));
+        return Result(true);
+    };
+    (void)context.sink.eventFinish.addListener([&context]() { context.finished = true; });
+
+    AsyncHashingTransformStream  hashStream;
+    AsyncReadableStream::Request readRequests[numberOfBuffers + 1];
+    AsyncWritableStream::Request writeRequests[numberOfBuffers + 1];
+    SC_TEST_EXPECT(hashStream.init(buffersPool, readRequests, writeRequests, algorithm));
+    if (useThreadPool)
+    {
+        SC_TEST_EXPECT(threadPool.create(2));
+        SC_TEST_EXPECT(hashStream.asyncWork.setThreadPool(threadPool));
+        hashStream.setEventLoop(eventLoop);
+    }
+    (void)hashStream.eventDigest.addListener(
+        [&context](Hashing::Result digest)
+        {
+            context.digest = digest;
+            context.numDigests++;
+        });
+
+    AsyncDuplexStream*   transforms[1] = {&hashStream};
+    AsyncWritableStream* sinks[1]      = {&context.sink};
+    AsyncPipeline        pipeline;
+    SC_TEST_EXPECT(pipeline.pipe(context.source, transforms, {sinks}));
+    SC_TEST_EXPECT(pipeline.start());
+    SC_TEST_EXPECT(eventLoop.run());
+    SC_TEST_EXPECT(pipeline.unpipe());
+    SC_TEST_EXPECT(eventLoop.close());
+
+    SC_TEST_EXPECT(context.finished);
+    SC_TEST_EXPECT(context.numDigests == 1);
+    SC_TEST_EXPECT(context.output.size() == input.sizeInBytes());
+    SC_TEST_EXPECT(memcmp(context.output.data(), input.data(), input.sizeInBytes()) == 0);
+
+    Hashing::Result digest;
+    SC_TEST_EXPECT(hashStream.getDigest(digest));
+    SC_TEST_EXPECT(digest.size == context.digest.size);
+    return context.digest;
+}
+
+void SC::HashingTransformStreamsTest::checksum(bool useThreadPool)
+{
+    Buffer input;
+    fillInput(input, 100 * 1000 + 17);
+
+    using Stream = AsyncHashingTransformStream;
+    SC_TEST_EXPECT(toHex(hashInPipeline(Stream::AlgorithmCRC32C, {}, useThreadPool)) == "00000000");
+    SC_TEST_EXPECT(toHex(hashInPipeline(Stream::AlgorithmXXHash64, {}, useThreadPool)) == "EF46DB3751D8E999");
+
+    const uint32_t crc = Checksum::crc32c(input.toSpanConst().reinterpret_as_span_of<const uint8_t>());
+    const uint64_t xxh = Checksum::xxHash64(input.toSpanConst().reinterpret_as_span_of<const uint8_t>());
+
+    Hashing::Result res = hashInPipeline(Stream::AlgorithmCRC32C, input.toSpanConst(), useThreadPool);
+    SC_TEST_EXPECT(res.size == 4 and res.hash[0] == static_cast<uint8_t>(crc >> 24));
+    SC_TEST_EXPECT(res.hash[3] == static_cast<uint8_t>(crc));
+
+    res = hashInPipeline(Stream::AlgorithmXXHash64, input.toSpanConst(), useThreadPool);
+    SC_TEST_EXPECT(res.size == 8 and res.hash[0] == static_cast<uint8_t>(xxh >> 56));
+    SC_TEST_EXPECT(res.hash[7] == static_cast<uint8_t>(xxh));
+}
+
+void SC::HashingTransformStreamsTest::hashing()
+{
+    Hashing probe;
+    if (not probe.setType(Hashing::TypeSHA256))
+    {
+        return; // Hashing OS API can be unavailable (for example in containers without AF_ALG sockets)
+    }
+    Buffer input;
+    SC_TEST_EXPECT(input.append("testtest"_a8.toCharSpan()));
+    Hashing::Result res = hashInPipeline(AsyncHashingTransformStream::AlgorithmSHA256, input.toSpanConst(), true);
+    SC_TEST_EXPECT(toHex(res) == "37268335DD6931045BDCDF92623FF819A64244B53D0E746D438797349D4DA578");
+    res = hashInPipeline(AsyncHashingTransformStream::AlgorithmMD5, input.toSpanConst(), false);
+    SC_TEST_EXPECT(toHex(res) == "05A671C66AEFEA124CC08B76EA6D30BB");
+}
+
+void SC::HashingTransformStreamsTest::snippet()
+{
+    AsyncEventLoop eventLoop;
+    SC_TEST_EXPECT(eventLoop.create());
+
+    constexpr size_t numberOfBuffers = 4;
+    AsyncBufferView  buffers[numberOfBuffers];
+    char             buffersMemory[numberOfBuffers][1024];
+    for (size_t idx = 0; idx < numberOfBuffers; ++idx)
+    {
+        buffers[idx].data = buffersMemory[idx];
+    }
+    AsyncBuffersPool buffersPool;
+    buffersPool.buffers = buffers;
+
+    AsyncReadableStream::Request readRequests[numberOfBuffers + 1];
+    AsyncWritableStream::Request writeRequests[numberOfBuffers + 1];
+    //! [AsyncHashingTransformStreamSnippet]
+    // Compute XXH64 on a ThreadPool thread while data flows, for example, from a file to a socket
+    ThreadPool threadPool;
+    SC_TEST_EXPECT(threadPool.create(1));
+
+    AsyncHashingTransformStream hashStream;
+    constexpr auto              algorithm = AsyncHashingTransformStream::AlgorithmXXHash64;
+    SC_TEST_EXPECT(hashStream.init(buffersPool, readRequests, writeRequests, algorithm));
+    SC_TEST_EXPECT(hashStream.asyncWork.setThreadPool(threadPool));
+    hashStream.setEventLoop(eventLoop);
+    (void)hashStream.eventDigest.addListener(
+        [](Hashing::Result digest)
+        {
+            // Compare digest.toBytesSpan() with the expected one
+            (void)digest;
+        });
+    // ...add hashStream to AsyncPipeline transforms between the readable file stream and the writable socket stream
+    //! [AsyncHashingTransformStreamSnippet]
+    SC_TEST_EXPECT(eventLoop.close());
+}
+
+namespace SC
+{
+void runHashingTransformStreamsTest(SC::TestReport& report) { HashingTransformStreamsTest test(report); }
+} // namespace SC
@@ -0,0 +1,507 @@
+// Copyright (c) Stefano Cristiano
+// SPDX-License-Identifier: MIT
+#include "Libraries/AsyncStreams/LZ4TransformStreams.h"
+#include "Libraries/Async/Async.h"
+#include "Libraries/AsyncStreams/Internal/ZLibStream.h"
+#include "Libraries/Foundation/Buffer.h"
+#include "Libraries/Strings/Console.h"
+#include "Libraries/Testing/Testing.h"
+#include "Libraries/Time/Time.h"
+
+namespace SC
+{
+struct LZ4StreamTest;
+}
+
+struct SC::LZ4StreamTest : public SC::TestCase
+{
+    LZ4StreamTest(SC::TestReport& report) : TestCase(report, "LZ4StreamTest")
+    {
+        if (test_section("block"))
+        {
+            blockRoundTrip();
+        }
+        if (test_section("block corrupted"))
+        {
+            blockCorrupted();
+        }
+        if (test_section("frame"))
+        {
+            frameRoundTrip();
+        }
+        if (test_section("frame reference"))
+        {
+            frameReference();
+        }
+        if (test_section("frame corrupted"))
+        {
+            frameCorrupted();
+        }
+        if (test_section("transform sync"))
+        {
+            transformRoundTrip(false);
+        }
+        if (test_section("transform thread pool"))
+        {
+            transformRoundTrip(true);
+        }
+        if (test_section("LZ4 benchmark", Execute::OnlyExplicit))
+        {
+            benchmark();
+        }
+    }
+
+    static void fillInput(Buffer& input, size_t size);
+
+    void compress(Span<const char> input, Buffer& output, size_t outputChunk);
+    bool decompress(Span<const char> input, Buffer& output, size_t inputChunk, size_t outputChunk);
+    void transform(LZ4Stream::Algorithm algorithm, bool useThreadPool, Span<const char> input, Buffer& output);
+
+    void blockRoundTrip();
+    void blockCorrupted();
+    void frameRoundTrip();
+    void frameReference();
+    void frameCorrupted();
+    void transformRoundTrip(bool useThreadPool);
+    void benchmark();
+};
+
+void SC::LZ4StreamTest::fillInput(Buffer& input, size_t size)
+{
+    // Text-like content, compressible but not trivially so
+    static constexpr const char* words[] = {"async ", "stream ", "buffer ", "lz4 ", "frame ", "block ",
+                                            "pool ",  "sane ",   "cpp ",    "fast\n", "data ",  "the "};
+    SC_ASSERT_RELEASE(input.resizeWithoutInitializing(size));
+    uint32_t seed   = 12345;
+    size_t   offset = 0;
+    while (offset < size)
+    {
+        seed               = seed * 1103515245u + 12345u;
+        const char*  word  = words[(seed >> 16) % (sizeof(words) / sizeof(words[0]))];
+        const size_t chars = ::strlen(word);
+        for (size_t idx = 0; idx < chars and offset < size; ++idx)
+        {
+            input.data()[offset++] = word[idx];
+        }
+    }
+}
+
+void SC::LZ4StreamTest::compress(Span<const char> input, Buffer& output, size_t outputChunk)
+{
+    LZ4Stream compressor;
+    SC_TEST_EXPECT(compressor.init(LZ4Stream::Compress));
+    Buffer chunk;
+    SC_TEST_EXPECT(chunk.resizeWithoutInitializing(outputChunk));
+    output.clear();
+    bool processed = true;
+    while (processed and not input.empty())
+    {
+        Span<char> outputSpan = chunk.toSpan();
+        processed             = compressor.process(input, outputSpan);
+        processed = processed and output.append({chunk.data(), chunk.size() - outputSpan.sizeInBytes()});
+    }
+    bool streamEnded = false;
+    while (processed and not streamEnded)
+    {
+        Span<char> outputSpan = chunk.toSpan();
+        processed             = compressor.finalize(outputSpan, streamEnded);
+        processed = processed and output.append({chunk.data(), chunk.size() - outputSpan.sizeInBytes()});
+    }
+    SC_TEST_EXPECT(processed);
+}
+
+bool SC::LZ4StreamTest::decompress(Span<const char> input, Buffer& output, size_t inputChunk, size_t outputChunk)
+{
+    LZ4Stream decompressor;
+    SC_TEST_EXPECT(decompressor.init(LZ4Stream::Decompress));
+    Buffer chunk;
+    SC_TEST_EXPECT(chunk.resizeWithoutInitializing(outputChunk));
+    output.clear();
+    while (not input.empty())
+    {
+        Span<const char> inputSpan;
+        SC_TRY(input.sliceStartLength(0, min(inputChunk, input.sizeInBytes()), inputSpan));
+        const size_t inputSize = inputSpan.sizeInBytes();
+        Span<char>   outputSpan;
+        do
+        {
+            outputSpan = chunk.toSpan();
+            SC_TRY(decompressor.process(inputSpan, outputSpan));
+            SC_TRY(output.append({chunk.data(), chunk.size() - outputSpan.sizeInBytes()}));
+        } while (not inputSpan.empty() or outputSpan.empty());
+        SC_TRY(input.sliceStart(inputSize, input));
+    }
+    bool streamEnded = false;
+    while (not streamEnded)
+    {
+        Span<char> outputSpan = chunk.toSpan();
+        SC_TRY(decompressor.finalize(outputSpan, streamEnded));
+        SC_TRY(output.append({chunk.data(), chunk.size() - outputSpan.sizeInBytes()}));
+        if (not streamEnded and outputSpan.sizeInBytes() == chunk.size())
+        {
+            return false; // Truncated stream
+        }
+    }
+    return true;
+}
+
+void SC::LZ4StreamTest::blockRoundTrip()
+{
+    const size_t sizes[] = {0, 1, 12, 13, 100, 1000, 65536, 300000};
+    for (size_t size : sizes)
+    {
+        Buffer input;
+        fillInput(input, size);
+        Buffer compressed;
+        SC_TEST_EXPECT(compressed.resizeWithoutInitializing(LZ4Stream::getBlockBound(size)));
+        const size_t compressedSize = LZ4Stream::compressBlock(input.toSpanConst(), compressed.toSpan());
+        SC_TEST_EXPECT(compressedSize > 0);
+        if (size > 1000)
+        {
+            SC_TEST_EXPECT(compressedSize < size / 2);
+        }
+
+        Buffer decompressed;
+        SC_TEST_EXPECT(decompressed.resizeWithoutInitializing(size));
+        size_t decompressedSize = 0;
+        SC_TEST_EXPECT(LZ4Stream::decompressBlock({compressed.data(), compressedSize}, decompressed.toSpan(), 0,
+                                                  decompressedSize));
+        SC_TEST_EXPECT(decompressedSize == size);
+        SC_TEST_EXPECT(memcmp(decompressed.data(), input.data(), size) == 0);
+
+        if (size > 0)
+        {
+            // Output too small is detected by both decompressor and compressor
+            SC_TEST_EXPECT(not LZ4Stream::decompressBlock({compressed.data(), compressedSize},
+                                                          {decompressed.data(), size - 1}, 0, decompressedSize));
+            SC_TEST_EXPECT(LZ4Stream::compressBlock(input.toSpanConst(), {compressed.data(), compressedSize - 1}) == 0);
+        }
+    }
+}
+
+void SC::LZ4StreamTest::blockCorrupted()
+{
+    Buffer input;
+    fillInput(input, 10000);
+    Buffer compressed;
+    SC_TEST_EXPECT(compressed.resizeWithoutInitializing(LZ4Stream::getBlockBound(input.size())));
+    const size_t compressedSize = LZ4Stream::compressBlock(input.toSpanConst(), compressed.toSpan());
+    Buffer       decompressed;
+    SC_TEST_EXPECT(decompressed.resizeWithoutInitializing(input.size()));
+
+    // Truncated or altered blocks must fail (or produce wrong data) without reading or writing out of bounds
+    size_t numFailures = 0;
+    for (size_t idx = 0; idx < compressedSize; idx += 7)
+    {
+        size_t     decompressedSize = 0;
+        const bool truncatedFailed  = not LZ4Stream::decompressBlock({compressed.data(), idx}, decompressed.toSpan(),
+                                                                     0, decompressedSize);
+        compressed.data()[idx] = static_cast<char>(compressed.data()[idx] ^ 0x5A);
+        const bool alteredFailed = not LZ4Stream::decompressBlock({compressed.data(), compressedSize},
+                                                                  decompressed.toSpan(), 0, decompressedSize);
+        compressed.data()[idx]   = static_cast<char>(compressed.data()[idx] ^ 0x5A);
+        numFailures += (truncatedFailed ? 1 : 0) + (alteredFailed ? 1 : 0);
+    }
+    SC_TEST_EXPECT(numFailures > 0);
+
+    // Offsets pointing before the output start are rejected, unless there's a large enough prefix
+    // Token with no literals and a 4 bytes match at offset 16, followed by the (empty) last literals token
+    const char match[] = {0x00, 0x10, 0x00, 0x00};
+    size_t     decompressedSize;
+    SC_TEST_EXPECT(not LZ4Stream::decompressBlock({match, 4}, decompressed.toSpan(), 0, decompressedSize));
+    const Span<char> afterPrefix = {decompressed.data() + 16, decompressed.size() - 16};
+    SC_TEST_EXPECT(not LZ4Stream::decompressBlock({match, 4}, afterPrefix, 15, decompressedSize));
+    SC_TEST_EXPECT(LZ4Stream::decompressBlock({match, 4}, afterPrefix, 16, decompressedSize));
+    SC_TEST_EXPECT(decompressedSize == 4 and memcmp(afterPrefix.data(), decompressed.data(), 4) == 0);
+}
+
+void SC::LZ4StreamTest::frameRoundTrip()
+{
+    // Sizes that are empty, smaller than a block, an exact multiple of blocks and a non-exact multiple of blocks
+    const size_t sizes[]  = {0, 1000, 4 * 64 * 1024, 1024 * 1024 + 123};
+    const size_t chunks[] = {7, 1000, 1024 * 1024};
+    for (size_t size : sizes)
+    {
+        Buffer input;
+        fillInput(input, size);
+        for (size_t chunk : chunks)
+        {
+            Buffer compressed;
+            compress(input.toSpanConst(), compressed, chunk);
+            Buffer decompressed;
+            SC_TEST_EXPECT(decompress(compressed.toSpanConst(), decompressed, chunk, chunk));
+            SC_TEST_EXPECT(decompressed.size() == size);
+            SC_TEST_EXPECT(memcmp(decompressed.data(), input.data(), size) == 0);
+        }
+    }
+
+    // Incompressible data is stored in uncompressed blocks
+    Buffer input;
+    SC_TEST_EXPECT(input.resizeWithoutInitializing(200 * 1024));
+    uint32_t seed = 1;
+    for (char& value : input)
+    {
+        seed  = seed * 1664525u + 1013904223u;
+        value = static_cast<char>(seed >> 24);
+    }
+    Buffer compressed, decompressed;
+    compress(input.toSpanConst(), compressed, 4096);
+    SC_TEST_EXPECT(compressed.size() < input.size() + 100);
+    SC_TEST_EXPECT(decompress(compressed.toSpanConst(), decompressed, 4096, 4096));
+    SC_TEST_EXPECT(decompressed.size() == input.size());
+    SC_TEST_EXPECT(memcmp(decompressed.data(), input.data(), input.size()) == 0);
+
+    // Concatenated frames decompress to concatenated contents
+    Buffer twice;
+    SC_TEST_EXPECT(twice.append(compressed.toSpanConst()));
+    SC_TEST_EXPECT(twice.append(compressed.toSpanConst()));
+    SC_TEST_EXPECT(decompress(twice.toSpanConst(), decompressed, 1000, 3000));
+    SC_TEST_EXPECT(decompressed.size() == 2 * input.size());
+    SC_TEST_EXPECT(memcmp(decompressed.data() + input.size(), input.data(), input.size()) == 0);
+}
+
+void SC::LZ4StreamTest::frameReference()
+{
+    // Produced by `lz4 -BD -BX -B4` (linked 64 KB blocks with block and content checksums) on 66536 bytes where
+    // byte[i] = 'a' + ((i % 251) * 7) % 26. The second block contains matches referencing the first block.
+    static constexpr uint8_t part1[] = {
+        0x04, 0x22, 0x4d, 0x18, 0x54, 0x40, 0xae, 0x2f, 0x01, 0x00, 0x00, 0xff, 0x0b, 0x61, 0x68, 0x6f,
+        0x76, 0x63, 0x6a, 0x71, 0x78, 0x65, 0x6c, 0x73, 0x7a, 0x67, 0x6e, 0x75, 0x62, 0x69, 0x70, 0x77,
+        0x64, 0x6b, 0x72, 0x79, 0x66, 0x6d, 0x74, 0x1a, 0x00, 0xce, 0x0f, 0xe1, 0x00, 0xce, 0x0f, 0xcb,
+        0x01, 0x07, 0x0f, 0xfb, 0x00,
+    };
+    static constexpr uint8_t part2[] = {
+        0xf0, 0x50, 0x6b, 0x72, 0x79, 0x66, 0x6d, 0x06, 0xa1, 0x3f, 0xb1, 0x15, 0x00, 0x00, 0x00, 0x1f,
+        0x74, 0x0b, 0xfe, 0xce, 0x0f, 0xe1, 0x00, 0xce, 0x0f, 0xe7, 0xff, 0xff, 0xff, 0x0f, 0x50, 0x69,
+        0x70, 0x77, 0x64, 0x6b, 0x75, 0x12, 0x0b, 0x06, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x97, 0x9b, 0xec,
+    };
+    constexpr size_t size = 65536 + 1000;
+
+    Buffer frame;
+    // Skippable frame with 3 bytes of user data, that must be ignored
+    const char skippable[] = {0x5A, 0x2A, 0x4D, 0x18, 0x03, 0x00, 0x00, 0x00, 'a', 'b', 'c'};
+    SC_TEST_EXPECT(frame.append({skippable, sizeof(skippable)}));
+    SC_TEST_EXPECT(frame.append({reinterpret_cast<const char*>(part1), sizeof(part1)}));
+    SC_TEST_EXPECT(frame.resize(frame.size() + 254, static_cast<char>(0xff))); // Length of the long match
+    SC_TEST_EXPECT(frame.append({reinterpret_cast<const char*>(part2), sizeof(part2)}));
+
+    const size_t chunks[] = {1, 13, 64 * 1024 + 7};
+    for (size_t chunk : chunks)
+    {
+        Buffer decompressed;
+        SC_TEST_EXPECT(decompress(frame.toSpanConst(), decompressed, chunk, chunk));
+        SC_TEST_EXPECT(decompressed.size() == size);
+        bool matches = decompressed.size() == size;
+        for (size_t idx = 0; matches and idx < size; ++idx)
+        {
+            matches = decompressed.data()[idx] == static_cast<char>('a' + ((idx % 251) * 7) % 26);
+        }
+        SC_TEST_EXPECT(matches);
+    }
+}
+
+void SC::LZ4StreamTest::frameCorrupted()
+{
+    Buffer input;
+    fillInput(input, 100000);
+    Buffer compressed, decompressed;
+    compress(input.toSpanConst(), compressed, 1024);
+
+    // Altering any byte is detected by header or content checksums, unless it produces the same output (for example
+    // changing a match offset to a different position holding the same bytes)
+    size_t numUndetected = 0;
+    for (size_t idx = 0; idx < compressed.size(); idx += 97)
+    {
+        compressed.data()[idx] = static_cast<char>(compressed.data()[idx] ^ 0x01);
+        if (decompress(compressed.toSpanConst(), decompressed, 4096, 4096))
+        {
+            const bool same = decompressed.size() == input.size() and
+                              memcmp(decompressed.data(), input.data(), input.size()) == 0;
+            numUndetected += same ? 0 : 1;
+        }
+        compressed.data()[idx] = static_cast<char>(compressed.data()[idx] ^ 0x01);
+    }
+    SC_TEST_EXPECT(numUndetected == 0);
+
+    // Truncated frames never report the end of stream
+    SC_TEST_EXPECT(not decompress({compressed.data(), compressed.size() - 1}, decompressed, 4096, 4096));
+    SC_TEST_EXPECT(not decompress({compressed.data(), 6}, decompressed, 4096, 4096));
+}
+
+void SC::LZ4StreamTest::transform(LZ4Stream::Algorithm algorithm, bool useThreadPool, Span<const char> input,
+                                  Buffer& output)
+{
+    AsyncEventLoop eventLoop;
+    SC_TEST_EXPECT(eventLoop.create());
+    ThreadPool threadPool;
+    SC_TEST_EXPECT(threadPool.create(2));
+
+    constexpr size_t numberOfBuffers = 8;
+    constexpr size_t buffersSize     = 16 * 1024;
+    AsyncBufferView  buffers[numberOfBuffers];
+    Buffer           buffersMemory;
+    SC_TEST_EXPECT(buffersMemory.resizeWithoutInitializing(numberOfBuffers * buffersSize));
+    for (size_t idx = 0; idx < numberOfBuffers; ++idx)
+    {
+        SC_TEST_EXPECT(buffersMemory.toSpan().sliceStartLength(idx * buffersSize, buffersSize, buffers[idx].data));
+    }
+    AsyncBuffersPool buffersPool;
+    buffersPool.buffers = {buffers, numberOfBuffers};
+
+    // Source pushing input synchronously, until running out of buffers
+    struct Context
+    {
+        AsyncReadableStream source;
+        AsyncWritableStream sink;
+        Span<const char>    input;
+        Buffer&             output;
+        size_t              inputOffset = 0;
+        bool                finished    = false;
+
+        Context(Span<const char> input, Buffer& output) : input(input), output(output) {}
+    } context = {input, output};
+
+    AsyncReadableStream::Request sourceRequests[numberOfBuffers + 1];
+    SC_TEST_EXPECT(context.source.init(buffersPool, sourceRequests));
+    context.source.asyncRead = [&context]() -> Result
+    {
+        if (context.inputOffset == context.input.sizeInBytes())
+        {
+            context.source.pushEnd();
+            return Result(true);
+        }
+        AsyncBufferView::ID bufferID;
+        Span<char>          data;
+        if (context.source.getBufferOrPause(0, bufferID, data))
+        {
+            size_t toCopy = context.input.sizeInBytes() - context.inputOffset;
+            toCopy        = toCopy < data.sizeInBytes() ? toCopy : data.sizeInBytes();
+            memcpy(data.data(), context.input.data() + context.inputOffset, toCopy);
+            context.inputOffset += toCopy;
+            context.source.push(bufferID, toCopy);
+            context.source.getBuffersPool().unrefBuffer(bufferID);
+            context.source.reactivate(true);
+        }
+        return Result(true);
+    };
+
+    // Sink appending all received data to output
+    AsyncWritableStream::Request sinkRequests[numberOfBuffers + 1];
+    SC_TEST_EXPECT(context.sink.init(buffersPool, sinkRequests));
+    context.sink.asyncWrite = [&context](AsyncBufferView::ID bufferID, Function<void(AsyncBufferView::ID)> cb)
+    {
+        Span<const char> data;
+        SC_TRY(context.sink.getBuffersPool().getData(bufferID, data));
+        SC_TRY(context.output.append(data));
+        context.sink.finishedWriting(bufferID, move(cb), Result(true));
+        return Result(true);
+    };
+    (void)context.sink.eventFinish.addListener([&context]() { context.finished = true; });
+
+    AsyncLZ4TransformStream lz4;
+    if (useThreadPool)
+    {
+        lz4.setEventLoop(eventLoop);
+        SC_TEST_EXPECT(lz4.asyncWork.setThreadPool(threadPool));
+    }
+    AsyncReadableStream::Request readRequests[numberOfBuffers + 1];
+    AsyncWritableStream::Request writeRequests[numberOfBuffers + 1];
+    SC_TEST_EXPECT(lz4.init(buffersPool, readRequests, writeRequests));
+    SC_TEST_EXPECT(lz4.stream.init(algorithm));
+
+    AsyncDuplexStream*   transforms[1] = {&lz4};
+    AsyncWritableStream* sinks[1]      = {&context.sink};
+    AsyncPipeline        pipeline;
+    (void)pipeline.eventError.addListener([this](Result res) { SC_TEST_EXPECT(res); });
+    SC_TEST_EXPECT(pipeline.pipe(context.source, transforms, {sinks}));
+    SC_TEST_EXPECT(pipeline.start());
+    SC_TEST_EXPECT(eventLoop.run());
+    SC_TEST_EXPECT(context.finished);
+    SC_TEST_EXPECT(pipeline.unpipe());
+    SC_TEST_EXPECT(eventLoop.close());
+}
+
+void SC::LZ4StreamTest::transformRoundTrip(bool useThreadPool)
+{
+    const size_t sizes[] = {0, 1000, 1024 * 1024 + 123};
+    for (size_t size : sizes)
+    {
+        Buffer input;
+        fillInput(input, size);
+        Buffer compressed, decompressed;
+        transform(LZ4Stream::Compress, useThreadPool, input.toSpanConst(), compressed);
+        transform(LZ4Stream::Decompress, useThreadPool, compressed.toSpanConst(), decompressed);
+        SC_TEST_EXPECT(decompressed.size() == size);
+        SC_TEST_EXPECT(memcmp(decompressed.data(), input.data(), size) == 0);
+    }
+    if (not useThreadPool)
+    {
+        //! [AsyncLZ4TransformStreamSnippet]
+        AsyncLZ4TransformStream compressor;
+        // Optionally offload compression to a thread pool:
+        // compressor.setEventLoop(eventLoop);
+        // SC_TEST_EXPECT(compressor.asyncWork.setThreadPool(threadPool));
+        SC_TEST_EXPECT(compressor.stream.init(LZ4Stream::Compress));
+        // ...init it with a buffers pool and use it in an AsyncPipeline like any other transform
+        //! [AsyncLZ4TransformStreamSnippet]
+    }
+}
+
+void SC::LZ4StreamTest::benchmark()
+{
+    constexpr size_t inputSize = 256 * 1024 * 1024;
+
+    Buffer input;
+    fillInput(input, inputSize);
+    Buffer compressed, decompressed;
+    SC_TEST_EXPECT(compressed.resizeWithoutInitializing(inputSize + inputSize / 100 + 1024));
+    SC_TEST_EXPECT(decompressed.resizeWithoutInitializing(inputSize));
+
+    const auto throughput = [](Time::HighResolutionCounter start)
+    {
+        const int64_t nanoseconds = Time::HighResolutionCounter().snap().subtractExact(start).toNanoseconds().ns;
+        return static_cast<double>(inputSize) / (1024.0 * 1024.0) / (static_cast<double>(nanoseconds) / 1e9);
+    };
+
+    LZ4Stream compressor;
+    SC_TEST_EXPECT(compressor.init(LZ4Stream::Compress));
+    Time::HighResolutionCounter start;
+    start.snap();
+    Span<const char> inputSpan   = input.toSpanConst();
+    Span<char>       outputSpan  = compressed.toSpan();
+    bool             streamEnded = false;
+    SC_TEST_EXPECT(compressor.process(inputSpan, outputSpan));
+    SC_TEST_EXPECT(compressor.finalize(outputSpan, streamEnded) and streamEnded);
+    const double compressMBs    = throughput(start);
+    const size_t compressedSize = compressed.size() - outputSpan.sizeInBytes();
+
+    LZ4Stream decompressor;
+    SC_TEST_EXPECT(decompressor.init(LZ4Stream::Decompress));
+    start.snap();
+    inputSpan  = {compressed.data(), compressedSize};
+    outputSpan = decompressed.toSpan();
+    SC_TEST_EXPECT(decompressor.process(inputSpan, outputSpan));
+    SC_TEST_EXPECT(decompressor.finalize(outputSpan, streamEnded) and streamEnded);
+    const double decompressMBs = throughput(start);
+    SC_TEST_EXPECT(memcmp(decompressed.data(), input.data(), inputSize) == 0);
+
+    const double ratio = static_cast<double>(compressedSize) / static_cast<double>(inputSize);
+    report.console.print("LZ4Stream: compress {:.1} MB/s, decompress {:.1} MB/s (ratio {:.3})\n", compressMBs,
+                         decompressMBs, ratio);
+
+    ZLibStream zlib;
+    SC_TEST_EXPECT(zlib.init(ZLibStream::CompressZLib));
+    start.snap();
+    inputSpan  = input.toSpanConst();
+    outputSpan = compressed.toSpan();
+    SC_TEST_EXPECT(zlib.process(inputSpan, outputSpan));
+    SC_TEST_EXPECT(zlib.finalize(outputSpan, streamEnded) and streamEnded);
+    const double zlibMBs   = throughput(start);
+    const double zlibRatio = static_cast<double>(compressed.size() - outputSpan.sizeInBytes()) / inputSize;
+    report.console.print("ZLibStream: compress {:.1} MB/s (ratio {:.3})\n", zlibMBs, zlibRatio);
+}
+
+namespace SC
+{
+void runLZ4StreamTest(SC::TestReport& report) { LZ4StreamTest test(report); }
+} // namespace SC
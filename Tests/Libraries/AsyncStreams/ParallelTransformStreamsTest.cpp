@@ -0,0 +1,377 @@
+// Copyright (c) Stefano Cristiano
+// SPDX-License-Identifier: MIT
+#include "Libraries/AsyncStreams/ParallelTransformStreams.h"
+#include "Libraries/Async/Async.h"
+#include "Libraries/Foundation/Buffer.h"
+#include "Libraries/Strings/Console.h"
+#include "Libraries/Testing/Testing.h"
+#include "Libraries/Time/Time.h"
+
+namespace SC
+{
+struct ParallelTransformStreamsTest;
+}
+
+struct SC::ParallelTransformStreamsTest : public SC::TestCase
+{
+    ParallelTransformStreamsTest(SC::TestReport& report) : TestCase(report, "ParallelTransformStreamsTest")
+    {
+        if (test_section("ordered output"))
+        {
+            orderedOutput();
+        }
+        if (test_section("output size"))
+        {
+            outputSize();
+        }
+        if (test_section("error"))
+        {
+            error();
+        }
+        if (test_section("snippet"))
+        {
+            snippet();
+        }
+        if (test_section("ParallelTransform benchmark", Execute::OnlyExplicit))
+        {
+            benchmark();
+        }
+    }
+
+    struct Params
+    {
+        size_t numThreads      = 4;
+        size_t numJobs         = 8;
+        size_t numberOfBuffers = 24;
+        size_t buffersSize     = 4 * 1024;
+        size_t sourceChunkSize = 0; // Max bytes pushed by source per buffer (0 == buffersSize)
+
+        Function<Result(Span<const char>, Span<char>&)> onProcess;
+
+        size_t minimumOutputSize = 0;
+        bool   expectError       = false;
+    };
+
+    static void fillInput(Buffer& input, size_t size);
+
+    // Per-buffer transform with a variable (pseudo-random) amount of work, so that jobs complete out of order
+    static Result scramble(Span<const char> input, Span<char>& output, uint32_t rounds);
+
+    void transformInMemory(Params& params, Span<const char> input, Buffer& output);
+
+    void orderedOutput();
+    void outputSize();
+    void error();
+    void snippet();
+    void benchmark();
+};
+
+void SC::ParallelTransformStreamsTest::fillInput(Buffer& input, size_t size)
+{
+    SC_ASSERT_RELEASE(input.resizeWithoutInitializing(size));
+    uint32_t seed = 12345;
+    for (size_t idx = 0; idx < size; ++idx)
+    {
+        seed              = seed * 1103515245u + 12345u;
+        input.data()[idx] = static_cast<char>(seed >> 16);
+    }
+}
+
+SC::Result SC::ParallelTransformStreamsTest::scramble(Span<const char> input, Span<char>& output, uint32_t rounds)
+{
+    SC_TRY_MSG(output.sizeInBytes() >= input.sizeInBytes(), "Output is too small");
+    const uint32_t    variable = input.empty() ? 0 : static_cast<uint8_t>(input.data()[0]) % 8;
+    volatile uint32_t busyWork = 0; // Not influencing output, just simulating a CPU heavy transform
+    for (size_t idx = 0; idx < input.sizeInBytes(); ++idx)
+    {
+        uint32_t value = static_cast<uint8_t>(input.data()[idx]);
+        for (uint32_t round = 0; round < rounds * variable; ++round)
+        {
+            value = value * 33 + round;
+        }
+        busyWork           = value;
+        output.data()[idx] = static_cast<char>(input.data()[idx] ^ 0x5a);
+    }
+    output = {output.data(), input.sizeInBytes()};
+    return Result(true);
+}
+
+void SC::ParallelTransformStreamsTest::transformInMemory(Params& params, Span<const char> input, Buffer& output)
+{
+    AsyncEventLoop eventLoop;
+    SC_TEST_EXPECT(eventLoop.create());
+    ThreadPool threadPool;
+    SC_TEST_EXPECT(threadPool.create(params.numThreads));
+
+    Buffer          buffersMemory;
+    AsyncBufferView buffers[64];
+    SC_TEST_EXPECT(params.numberOfBuffers <= 64);
+    SC_TEST_EXPECT(buffersMemory.resizeWithoutInitializing(params.numberOfBuffers * params.buffersSize));
+    for (size_t idx = 0; idx < params.numberOfBuffers; ++idx)
+    {
+        SC_TEST_EXPECT(buffersMemory.toSpan().sliceStartLength(idx * params.buffersSize, params.buffersSize,
+                                                               buffers[idx].data));
+    }
+    AsyncBuffersPool buffersPool;
+    buffersPool.buffers = {buffers, params.numberOfBuffers};
+
+    // Source pushing input synchronously, until running out of buffers
+    struct Context
+    {
+        AsyncReadableStream source;
+        AsyncWritableStream sink;
+        Span<const char>    input;
+        Buffer&             output;
+        size_t              chunkSize   = 0;
+        size_t              inputOffset = 0;
+        size_t              numErrors   = 0;
+        bool                finished    = false;
+
+        Context(Span<const char> input, Buffer& output) : input(input), output(output) {}
+    } context = {input, output};
+    context.chunkSize = params.sourceChunkSize > 0 ? params.sourceChunkSize : params.buffersSize;
+
+    AsyncReadableStream::Request sourceRequests[64 + 1];
+    SC_TEST_EXPECT(context.source.init(buffersPool, {sourceRequests, params.numberOfBuffers + 1}));
+    context.source.asyncRead = [&context]() -> Result
+    {
+        if (context.inputOffset == context.input.sizeInBytes())
+        {
+            context.source.pushEnd();
+            return Result(true);
+        }
+        AsyncBufferView::ID bufferID;
+        Span<char>          data;
+        if (context.source.getBufferOrPause(0, bufferID, data))
+        {
+            size_t toCopy = context.input.sizeInBytes() - context.inputOffset;
+            toCopy        = toCopy < context.chunkSize ? toCopy : context.chunkSize;
+            memcpy(data.data(), context.input.data() + context.inputOffset, toCopy);
+            context.inputOffset += toCopy;
+            context.source.push(bufferID, toCopy);
+            context.source.getBuffersPool().unrefBuffer(bufferID);
+            context.source.reactivate(true);
+        }
+        return Result(true);
+    };
+
+    // Sink appending all received data to output
+    AsyncWritableStream::Request sinkRequests[64 + 1];
+    SC_TEST_EXPECT(context.sink.init(buffersPool, {sinkRequests, params.numberOfBuffers + 1}));
+    context.sink.asyncWrite = [&context](AsyncBufferView::ID bufferID, Function<void(AsyncBufferView::ID)> cb)
+    {
+        Span<const char> data;
+        SC_TRY(context.sink.getBuffersPool().getData(bufferID, data));
+        SC_TRY(context.output.append(data));
+        context.sink.finishedWriting(bufferID, move(cb), Result(true));
+        return Result(true);
+    };
+    (void)context.sink.eventFinish.addListener([&context]() { context.finished = true; });
+
+    AsyncParallelTransformStream::Job jobs[16];
+    SC_TEST_EXPECT(params.numJobs <= 16);
+
+    AsyncParallelTransformStream transform;
+    transform.onProcess         = params.onProcess;
+    transform.minimumOutputSize = params.minimumOutputSize;
+
+    AsyncReadableStream::Request readRequests[64 + 1];
+    AsyncWritableStream::Request writeRequests[64 + 1];
+    SC_TEST_EXPECT(transform.init(buffersPool, {readRequests, params.numberOfBuffers + 1},
+                                  {writeRequests, params.numberOfBuffers + 1}, eventLoop, threadPool,
+                                  {jobs, params.numJobs}));
+
+    AsyncDuplexStream*   transforms[1] = {&transform};
+    AsyncWritableStream* sinks[1]      = {&context.sink};
+    AsyncPipeline        pipeline;
+    (void)pipeline.eventError.addListener([&context](Result) { context.numErrors++; });
+    SC_TEST_EXPECT(pipeline.pipe(context.source, transforms, {sinks}));
+    SC_TEST_EXPECT(pipeline.start());
+    SC_TEST_EXPECT(eventLoop.run());
+    if (params.expectError)
+    {
+        SC_TEST_EXPECT(context.numErrors > 0);
+    }
+    else
+    {
+        SC_TEST_EXPECT(context.numErrors == 0);
+        SC_TEST_EXPECT(context.finished);
+    }
+    SC_TEST_EXPECT(pipeline.unpipe());
+    SC_TEST_EXPECT(eventLoop.close());
+}
+
+void SC::ParallelTransformStreamsTest::orderedOutput()
+{
+    // Sizes that are empty, smaller than a buffer, an exact multiple of buffers and a non-exact multiple of them
+    const size_t sizes[] = {0, 1000, 32 * 4 * 1024, 1024 * 1024 + 123};
+    for (size_t size : sizes)
+    {
+        Buffer input;
+        fillInput(input, size);
+
+        Params params;
+        params.onProcess = [](Span<const char> in, Span<char>& out) { return scramble(in, out, 16); };
+        Buffer output;
+        transformInMemory(params, input.toSpanConst(), output);
+        SC_TEST_EXPECT(output.size() == size);
+
+        bool outputIsOk = true;
+        for (size_t idx = 0; idx < output.size(); ++idx)
+        {
+            outputIsOk &= output.data()[idx] == static_cast<char>(input.data()[idx] ^ 0x5a);
+        }
+        SC_TEST_EXPECT(outputIsOk);
+    }
+
+    // A single job serializes all buffers (and a pool with few buffers applies back-pressure on the source)
+    Buffer input;
+    fillInput(input, 256 * 1024);
+    Params params;
+    params.numThreads      = 1;
+    params.numJobs         = 1;
+    params.numberOfBuffers = 3;
+    params.onProcess       = [](Span<const char> in, Span<char>& out) { return scramble(in, out, 0); };
+    Buffer output;
+    transformInMemory(params, input.toSpanConst(), output);
+    SC_TEST_EXPECT(output.size() == input.size());
+    SC_TEST_EXPECT(output.size() > 0 and output.data()[output.size() - 1] == (input.data()[input.size() - 1] ^ 0x5a));
+}
+
+void SC::ParallelTransformStreamsTest::outputSize()
+{
+    // Output can be smaller than input (keeps only even bytes) or empty (nothing is pushed downstream)
+    Buffer input;
+    fillInput(input, 100 * 1024 + 11);
+
+    Params params;
+    params.onProcess = [](Span<const char> in, Span<char>& out)
+    {
+        size_t numBytes = 0;
+        for (char value : in)
+        {
+            if ((value & 1) == 0)
+                out.data()[numBytes++] = value;
+        }
+        out = {out.data(), numBytes};
+        return Result(true);
+    };
+    Buffer output;
+    transformInMemory(params, input.toSpanConst(), output);
+    size_t numEven = 0;
+    for (char value : input.toSpanConst())
+    {
+        numEven += (value & 1) == 0 ? 1 : 0;
+    }
+    SC_TEST_EXPECT(output.size() == numEven);
+
+    // Output buffers larger than input ones can be requested with minimumOutputSize
+    params.buffersSize       = 2048;
+    params.sourceChunkSize   = 1024;
+    params.numberOfBuffers   = 48;
+    params.minimumOutputSize = 2048;
+    params.onProcess         = [](Span<const char> in, Span<char>& out)
+    {
+        SC_TRY_MSG(out.sizeInBytes() >= in.sizeInBytes() * 2, "Output is too small");
+        for (size_t idx = 0; idx < in.sizeInBytes(); ++idx)
+        {
+            out.data()[idx * 2]     = in.data()[idx];
+            out.data()[idx * 2 + 1] = in.data()[idx];
+        }
+        out = {out.data(), in.sizeInBytes() * 2};
+        return Result(true);
+    };
+    output.clear();
+    transformInMemory(params, input.toSpanConst(), output);
+    SC_TEST_EXPECT(output.size() == input.size() * 2);
+    SC_TEST_EXPECT(output.data()[output.size() - 1] == input.data()[input.size() - 1]);
+}
+
+void SC::ParallelTransformStreamsTest::error()
+{
+    Buffer input;
+    fillInput(input, 64 * 1024);
+
+    Params params;
+    params.expectError = true;
+    params.onProcess   = [](Span<const char>, Span<char>&) { return Result::Error("Transform failed"); };
+    Buffer output;
+    transformInMemory(params, input.toSpanConst(), output);
+    SC_TEST_EXPECT(output.isEmpty());
+}
+
+void SC::ParallelTransformStreamsTest::snippet()
+{
+    AsyncEventLoop eventLoop;
+    SC_TEST_EXPECT(eventLoop.create());
+
+    constexpr size_t numberOfBuffers = 16;
+    AsyncBufferView  buffers[numberOfBuffers];
+    char             buffersMemory[numberOfBuffers][1024];
+    for (size_t idx = 0; idx < numberOfBuffers; ++idx)
+    {
+        buffers[idx].data = buffersMemory[idx];
+    }
+    AsyncBuffersPool buffersPool;
+    buffersPool.buffers = buffers;
+
+    AsyncReadableStream::Request readRequests[numberOfBuffers + 1];
+    AsyncWritableStream::Request writeRequests[numberOfBuffers + 1];
+    //! [AsyncParallelTransformStreamSnippet]
+    // Transform up to 8 buffers at the same time on 4 threads
+    ThreadPool threadPool;
+    SC_TEST_EXPECT(threadPool.create(4));
+
+    AsyncParallelTransformStream::Job jobs[8];
+    AsyncParallelTransformStream      transform;
+    // Called concurrently on thread pool threads, must not touch any shared state
+    transform.onProcess = [](Span<const char> input, Span<char>& output)
+    {
+        for (size_t idx = 0; idx < input.sizeInBytes(); ++idx)
+        {
+            output.data()[idx] = input.data()[idx] ^ 0x5a;
+        }
+        output = {output.data(), input.sizeInBytes()};
+        return Result(true);
+    };
+    SC_TEST_EXPECT(transform.init(buffersPool, readRequests, writeRequests, eventLoop, threadPool, jobs));
+    // ...use it like any other transform in an AsyncPipeline (for example between file streams)
+    //! [AsyncParallelTransformStreamSnippet]
+    SC_TEST_EXPECT(eventLoop.close());
+}
+
+void SC::ParallelTransformStreamsTest::benchmark()
+{
+    constexpr size_t inputSize = 16 * 1024 * 1024;
+
+    Buffer input;
+    fillInput(input, inputSize);
+
+    const size_t numThreads[] = {1, 2, 4, 8};
+    for (size_t threads : numThreads)
+    {
+        Params params;
+        params.numThreads      = threads;
+        params.numJobs         = threads * 2;
+        params.numberOfBuffers = threads * 4 + 8;
+        params.buffersSize     = 64 * 1024;
+        params.onProcess       = [](Span<const char> in, Span<char>& out) { return scramble(in, out, 8); };
+
+        Buffer output;
+        SC_TEST_EXPECT(output.reserve(inputSize));
+
+        Time::HighResolutionCounter start;
+        start.snap();
+        transformInMemory(params, input.toSpanConst(), output);
+        const int64_t nanoseconds = Time::HighResolutionCounter().snap().subtractExact(start).toNanoseconds().ns;
+
+        const double seconds = static_cast<double>(nanoseconds) / 1e9;
+        const double mbs     = static_cast<double>(inputSize) / (1024.0 * 1024.0) / seconds;
+        report.console.print("AsyncParallelTransformStream {} threads: {:.1} MB/s\n", threads, mbs);
+    }
+}
+
+namespace SC
+{
+void runParallelTransformStreamsTest(SC::TestReport& report) { ParallelTransformStreamsTest test(report); }
+} // namespace SC
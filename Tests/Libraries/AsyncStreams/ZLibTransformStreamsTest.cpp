@@ -0,0 +1,329 @@
+// Copyright (c) Stefano Cristiano
+// SPDX-License-Identifier: MIT
+#include "Libraries/AsyncStreams/ZLibTransformStreams.h"
+#include "Libraries/Async/Async.h"
+#include "Libraries/Foundation/Buffer.h"
+#include "Libraries/Strings/Console.h"
+#include "Libraries/Testing/Testing.h"
+#include "Libraries/Time/Time.h"
+
+namespace SC
+{
+struct ZLibTransformStreamsTest;
+}
+
+struct SC::ZLibTransformStreamsTest : public SC::TestCase
+{
+    ZLibTransformStreamsTest(SC::TestReport& report) : TestCase(report, "ZLibTransformStreamsTest")
+    {
+        // Avoid "expression is constant" warning
+        auto host           = HostPlatform;
+        auto instructionSet = HostInstructionSet;
+        if (host == Platform::Windows and instructionSet == InstructionSet::ARM64)
+        {
+            // Can't load the system installed x86_64 zlib dll from ARM64 executable
+            return;
+        }
+        if (test_section("parallel gzip"))
+        {
+            parallelRoundTrip(ZLibStream::CompressGZip, ZLibStream::DecompressGZip);
+        }
+        if (test_section("parallel zlib"))
+        {
+            parallelRoundTrip(ZLibStream::CompressZLib, ZLibStream::DecompressZLib);
+        }
+        if (test_section("parallel deflate"))
+        {
+            parallelRoundTrip(ZLibStream::CompressDeflate, ZLibStream::DecompressDeflate);
+        }
+        if (test_section("parallel snippet"))
+        {
+            parallelSnippet();
+        }
+        if (test_section("ZLib parallel benchmark", Execute::OnlyExplicit))
+        {
+            parallelBenchmark();
+        }
+    }
+
+    struct Params
+    {
+        ZLibStream::Algorithm algorithm  = ZLibStream::CompressGZip;
+        size_t                numThreads = 2;
+        size_t                numJobs    = 4;
+        size_t                blockSize  = 64 * 1024;
+    };
+
+    static void fillInput(Buffer& input, size_t size);
+
+    void compressInMemory(const Params& params, Span<const char> input, Buffer& output);
+    void decompress(ZLibStream::Algorithm algorithm, Span<const char> input, Buffer& output, size_t expectedSize);
+
+    void parallelRoundTrip(ZLibStream::Algorithm compression, ZLibStream::Algorithm decompression);
+    void parallelSnippet();
+    void parallelBenchmark();
+};
+
+void SC::ZLibTransformStreamsTest::fillInput(Buffer& input, size_t size)
+{
+    // Text-like content, compressible but not trivially so, with repetitions spanning multiple blocks
+    static constexpr const char* words[] = {"async ", "stream ", "buffer ", "deflate ", "thread ", "block ",
+                                            "pool ",  "sane ",   "cpp ",    "zlib\n",   "data ",   "the "};
+    SC_ASSERT_RELEASE(input.resizeWithoutInitializing(size));
+    uint32_t seed   = 12345;
+    size_t   offset = 0;
+    while (offset < size)
+    {
+        seed               = seed * 1103515245u + 12345u;
+        const char*  word  = words[(seed >> 16) % (sizeof(words) / sizeof(words[0]))];
+        const size_t chars = ::strlen(word);
+        for (size_t idx = 0; idx < chars and offset < size; ++idx)
+        {
+            input.data()[offset++] = word[idx];
+        }
+    }
+}
+
+void SC::ZLibTransformStreamsTest::compressInMemory(const Params& params, Span<const char> input, Buffer& output)
+{
+    AsyncEventLoop eventLoop;
+    SC_TEST_EXPECT(eventLoop.create());
+    ThreadPool threadPool;
+    SC_TEST_EXPECT(threadPool.create(params.numThreads));
+
+    constexpr size_t numberOfBuffers = 8;
+    constexpr size_t buffersSize     = 16 * 1024;
+    AsyncBufferView  buffers[numberOfBuffers];
+    Buffer           buffersMemory;
+    SC_TEST_EXPECT(buffersMemory.resizeWithoutInitializing(numberOfBuffers * buffersSize));
+    for (size_t idx = 0; idx < numberOfBuffers; ++idx)
+    {
+        SC_TEST_EXPECT(buffersMemory.toSpan().sliceStartLength(idx * buffersSize, buffersSize, buffers[idx].data));
+    }
+    AsyncBuffersPool buffersPool;
+    buffersPool.buffers = {buffers, numberOfBuffers};
+
+    // Source pushing input synchronously, until running out of buffers
+    struct Context
+    {
+        AsyncReadableStream source;
+        AsyncWritableStream sink;
+        Span<const char>    input;
+        Buffer&             output;
+        size_t              inputOffset = 0;
+        bool                finished    = false;
+
+        Context(Span<const char> input, Buffer& output) : input(input), output(output) {}
+    } context = {input, output};
+
+    AsyncReadableStream::Request sourceRequests[numberOfBuffers + 1];
+    SC_TEST_EXPECT(context.source.init(buffersPool, sourceRequests));
+    context.source.asyncRead = [&context]() -> Result
+    {
+        if (context.inputOffset == context.input.sizeInBytes())
+        {
+            context.source.pushEnd();
+            return Result(true);
+        }
+        AsyncBufferView::ID bufferID;
+        Span<char>          data;
+        if (context.source.getBufferOrPause(0, bufferID, data))
+        {
+            size_t toCopy = context.input.sizeInBytes() - context.inputOffset;
+            toCopy        = toCopy < data.sizeInBytes() ? toCopy : data.sizeInBytes();
+            memcpy(data.data(), context.input.data() + context.inputOffset, toCopy);
+            context.inputOffset += toCopy;
+            context.source.push(bufferID, toCopy);
+            context.source.getBuffersPool().unrefBuffer(bufferID);
+            context.source.reactivate(true);
+        }
+        return Result(true);
+    };
+
+    // Sink appending all received data to output
+    AsyncWritableStream::Request sinkRequests[numberOfBuffers + 1];
+    SC_TEST_EXPECT(context.sink.init(buffersPool, sinkRequests));
+    context.sink.asyncWrite = [&context](AsyncBufferView::ID bufferID, Function<void(AsyncBufferView::ID)> cb)
+    {
+        Span<const char> data;
+        SC_TRY(context.sink.getBuffersPool().getData(bufferID, data));
+        SC_TRY(context.output.append(data));
+        context.sink.finishedWriting(bufferID, move(cb), Result(true));
+        return Result(true);
+    };
+    (void)context.sink.eventFinish.addListener([&context]() { context.finished = true; });
+
+    ParallelZLibTransformStream::Job jobs[16];
+    SC_TEST_EXPECT(params.numJobs <= 16);
+
+    ParallelZLibTransformStream compressor;
+    compressor.blockSize = params.blockSize;
+    Buffer memory;
+    SC_TEST_EXPECT(memory.resizeWithoutInitializing(
+        ParallelZLibTransformStream::getMemorySizeFor(params.numJobs, params.blockSize)));
+    AsyncReadableStream::Request readRequests[numberOfBuffers + 1];
+    AsyncWritableStream::Request writeRequests[numberOfBuffers + 1];
+    SC_TEST_EXPECT(compressor.init(buffersPool, readRequests, writeRequests, eventLoop, threadPool,
+                                   {jobs, params.numJobs}, memory.toSpan(), params.algorithm));
+
+    AsyncDuplexStream*   transforms[1] = {&compressor};
+    AsyncWritableStream* sinks[1]      = {&context.sink};
+    AsyncPipeline        pipeline;
+    (void)pipeline.eventError.addListener([this](Result res) { SC_TEST_EXPECT(res); });
+    SC_TEST_EXPECT(pipeline.pipe(context.source, transforms, {sinks}));
+    SC_TEST_EXPECT(pipeline.start());
+    SC_TEST_EXPECT(eventLoop.run());
+    SC_TEST_EXPECT(context.finished);
+    SC_TEST_EXPECT(pipeline.unpipe());
+    SC_TEST_EXPECT(eventLoop.close());
+}
+
+void SC::ZLibTransformStreamsTest::decompress(ZLibStream::Algorithm algorithm, Span<const char> input,
+                                              Buffer& output, size_t expectedSize)
+{
+    ZLibStream decompressor;
+    SC_TEST_EXPECT(decompressor.init(algorithm));
+    SC_TEST_EXPECT(output.resizeWithoutInitializing(expectedSize + 1));
+    Span<char> outputSpan = output.toSpan();
+    SC_TEST_EXPECT(decompressor.process(input, outputSpan));
+    SC_TEST_EXPECT(input.empty());
+    bool streamEnded = false;
+    SC_TEST_EXPECT(decompressor.finalize(outputSpan, streamEnded));
+    SC_TEST_EXPECT(streamEnded);
+    SC_TEST_EXPECT(output.resize(output.size() - outputSpan.sizeInBytes()));
+}
+
+void SC::ZLibTransformStreamsTest::parallelRoundTrip(ZLibStream::Algorithm compression,
+                                                     ZLibStream::Algorithm decompression)
+{
+    // Sizes that are empty, smaller than a block, an exact multiple of blocks and a non-exact multiple of blocks
+    const size_t sizes[] = {0, 1000, 8 * 64 * 1024, 1024 * 1024 + 123};
+    for (size_t size : sizes)
+    {
+        Buffer input;
+        fillInput(input, size);
+
+        Params params;
+        params.algorithm = compression;
+        Buffer compressed;
+        compressInMemory(params, input.toSpanConst(), compressed);
+
+        Buffer decompressed;
+        decompress(decompression, compressed.toSpanConst(), decompressed, size);
+        SC_TEST_EXPECT(decompressed.size() == size);
+        SC_TEST_EXPECT(memcmp(decompressed.data(), input.data(), size) == 0);
+    }
+
+    // Using a single job (serializing all blocks) produces the same output as many jobs on many threads
+    Buffer input;
+    fillInput(input, 1024 * 1024);
+    Buffer compressedSingle, compressedMany;
+    Params params;
+    params.algorithm  = compression;
+    params.numThreads = 1;
+    params.numJobs    = 1;
+    compressInMemory(params, input.toSpanConst(), compressedSingle);
+    params.numThreads = 4;
+    params.numJobs    = 8;
+    compressInMemory(params, input.toSpanConst(), compressedMany);
+    SC_TEST_EXPECT(compressedSingle.size() == compressedMany.size());
+    SC_TEST_EXPECT(memcmp(compressedSingle.data(), compressedMany.data(), compressedSingle.size()) == 0);
+}
+
+void SC::ZLibTransformStreamsTest::parallelSnippet()
+{
+    AsyncEventLoop eventLoop;
+    SC_TEST_EXPECT(eventLoop.create());
+
+    constexpr size_t numberOfBuffers = 4;
+    AsyncBufferView  buffers[numberOfBuffers];
+    char             buffersMemory[numberOfBuffers][1024];
+    for (size_t idx = 0; idx < numberOfBuffers; ++idx)
+    {
+        buffers[idx].data = buffersMemory[idx];
+    }
+    AsyncBuffersPool buffersPool;
+    buffersPool.buffers = buffers;
+
+    AsyncReadableStream::Request readRequests[numberOfBuffers + 1];
+    AsyncWritableStream::Request writeRequests[numberOfBuffers + 1];
+    //! [ParallelZLibTransformStreamSnippet]
+    // Compress using 4 threads, with 8 blocks of 128 KB in flight at the same time
+    ThreadPool threadPool;
+    SC_TEST_EXPECT(threadPool.create(4));
+
+    constexpr size_t numJobs   = 8;
+    constexpr size_t blockSize = 128 * 1024;
+
+    ParallelZLibTransformStream::Job jobs[numJobs];
+    Buffer                           memory;
+    SC_TEST_EXPECT(memory.resizeWithoutInitializing(ParallelZLibTransformStream::getMemorySizeFor(numJobs, blockSize)));
+
+    ParallelZLibTransformStream gzip;
+    gzip.blockSize = blockSize;
+    SC_TEST_EXPECT(gzip.init(buffersPool, readRequests, writeRequests, eventLoop, threadPool, jobs, memory.toSpan(),
+                             ZLibStream::CompressGZip));
+    // ...use it like any other transform in an AsyncPipeline (for example between file streams)
+    //! [ParallelZLibTransformStreamSnippet]
+    SC_TEST_EXPECT(eventLoop.close());
+}
+
+void SC::ZLibTransformStreamsTest::parallelBenchmark()
+{
+    constexpr size_t inputSize = 64 * 1024 * 1024;
+
+    Buffer input;
+    fillInput(input, inputSize);
+
+    {
+        // Single threaded reference
+        ZLibStream compressor;
+        SC_TEST_EXPECT(compressor.init(ZLibStream::CompressGZip));
+        Buffer compressed;
+        SC_TEST_EXPECT(compressed.resizeWithoutInitializing(inputSize));
+
+        Time::HighResolutionCounter start;
+        start.snap();
+        Span<const char> inputSpan  = input.toSpanConst();
+        Span<char>       outputSpan = compressed.toSpan();
+        bool             streamEnded = false;
+        SC_TEST_EXPECT(compressor.process(inputSpan, outputSpan));
+        SC_TEST_EXPECT(compressor.finalize(outputSpan, streamEnded) and streamEnded);
+        const int64_t nanoseconds = Time::HighResolutionCounter().snap().subtractExact(start).toNanoseconds().ns;
+
+        const size_t outputSize = compressed.size() - outputSpan.sizeInBytes();
+
+        const double seconds = static_cast<double>(nanoseconds) / 1e9;
+        const double mbs     = static_cast<double>(inputSize) / (1024.0 * 1024.0) / seconds;
+        const double ratio   = static_cast<double>(outputSize) / static_cast<double>(inputSize);
+        report.console.print("ZLibStream gzip: {:.1} MB/s (ratio {:.3})\n", mbs, ratio);
+    }
+
+    const size_t numThreads[] = {1, 2, 4, 8};
+    for (size_t threads : numThreads)
+    {
+        Params params;
+        params.numThreads = threads;
+        params.numJobs    = threads * 2;
+        params.blockSize  = 128 * 1024;
+
+        Buffer compressed;
+        SC_TEST_EXPECT(compressed.reserve(inputSize / 2));
+
+        Time::HighResolutionCounter start;
+        start.snap();
+        compressInMemory(params, input.toSpanConst(), compressed);
+        const int64_t nanoseconds = Time::HighResolutionCounter().snap().subtractExact(start).toNanoseconds().ns;
+
+        const double seconds = static_cast<double>(nanoseconds) / 1e9;
+        const double mbs     = static_cast<double>(inputSize) / (1024.0 * 1024.0) / seconds;
+        const double ratio   = static_cast<double>(compressed.size()) / static_cast<double>(inputSize);
+        report.console.print("ParallelZLibTransformStream gzip {} threads: {:.1} MB/s (ratio {:.3})\n", threads, mbs,
+                             ratio);
+    }
+}
+
+namespace SC
+{
+void runZLibTransformStreamsTest(SC::TestReport& report) { ZLibTransformStreamsTest test(report); }
+} // namespace SC
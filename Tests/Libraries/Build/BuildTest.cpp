@@ -1,7 +1,9 @@
 // Copyright (c) Stefano Cristiano
 // SPDX-License-Identifier: MIT
 #include "Libraries/Build/Build.h"
+#include "Libraries/FileSystem/FileSystem.h"
 #include "Libraries/FileSystem/Path.h"
+#include "Libraries/Strings/StringBuilder.h"
 #include "Libraries/Testing/Testing.h"
 
 namespace SC
@@ -57,9 +59,149 @@ struct SC::BuildTest : public SC::TestCase
             action.parameters.platform  = Build::Platform::Linux;
             SC_TEST_EXPECT(Build::executeAction(action));
         }
+        if (test_section("Ninja (macOS)"))
+        {
+            action.parameters.generator = Build::Generator::Ninja;
+            action.parameters.platform  = Build::Platform::Apple;
+            SC_TEST_EXPECT(Build::executeAction(action));
+        }
+        if (test_section("Ninja (Linux)"))
+        {
+            action.parameters.generator = Build::Generator::Ninja;
+            action.parameters.platform  = Build::Platform::Linux;
+            SC_TEST_EXPECT(Build::executeAction(action));
+        }
+#if SC_PLATFORM_LINUX || SC_PLATFORM_APPLE
+        if (test_section("Native"))
+        {
+            nativeCompile(action, buildDir.view(), false);
+        }
+        if (test_section("Native (Unity)"))
+        {
+            nativeCompile(action, buildDir.view(), true);
+        }
+#endif
+    }
+
+    void nativeCompile(Build::Action action, StringView buildDir, bool unity);
+
+    template <bool unity>
+    static Result configureNative(Build::Definition& definition, const Build::Parameters& parameters)
+    {
+        const StringView name      = unity ? StringView("UnityTest") : "NativeTest";
+        Build::Workspace workspace = {name};
+        Build::Project   project   = {Build::TargetType::ConsoleExecutable, name};
+        SC_TRY(project.setRootDirectory(parameters.directories.libraryDirectory.view()));
+        Build::Configuration configuration;
+        SC_TRY(configuration.name.assign("Debug"));
+        SC_TRY(configuration.intermediatesPath.assign(name));
+        SC_TRY(configuration.outputPath.assign(name));
+        configuration.compile.optimizationLevel = Build::Optimization::Debug;
+        SC_TRY(project.configurations.push_back(move(configuration)));
+        SC_TRY(project.addFiles("Sources", "*.cpp"));
+        SC_TRY(project.addIncludePaths({"Sources"}));
+        if (unity)
+        {
+            SC_TRY(project.enableUnityBuild(2));
+            Build::SourceFiles specificFiles;
+            SC_TRY(specificFiles.addSelection("Sources", "Special.cpp"));
+            SC_TRY(specificFiles.compile.addDefines({"SPECIAL_VALUE=0"}));
+            SC_TRY(project.addSpecificFileFlags(move(specificFiles)));
+        }
+        SC_TRY(workspace.projects.push_back(move(project)));
+        return Result(definition.workspaces.push_back(move(workspace)));
     }
 };
 
+void SC::BuildTest::nativeCompile(Build::Action action, StringView buildDir, bool unity)
+{
+    const Build::Directories& directories = action.parameters.directories;
+
+    const StringView name = unity ? StringView("UnityTest") : "NativeTest";
+    String           rootDirectoryName;
+    SC_TEST_EXPECT(StringBuilder(rootDirectoryName).format("_{}", name));
+
+    String rootDirectory, cacheDirectory, intermediatesDirectory, outputsDirectory;
+    SC_TEST_EXPECT(Path::join(rootDirectory, {buildDir, rootDirectoryName.view()}));
+    SC_TEST_EXPECT(Path::join(cacheDirectory, {buildDir, "_Cache"}));
+    SC_TEST_EXPECT(Path::join(intermediatesDirectory, {directories.intermediatesDirectory.view(), name}));
+    SC_TEST_EXPECT(Path::join(outputsDirectory, {directories.outputsDirectory.view(), name}));
+
+    // Build directory is created here, so that the section doesn't depend on previous sections
+    FileSystem fs;
+    SC_TEST_EXPECT(fs.init(report.applicationRootDirectory));
+    SC_TEST_EXPECT(fs.makeDirectoryRecursive(buildDir));
+    SC_TEST_EXPECT(fs.init(buildDir));
+    for (StringView directory :
+         {rootDirectory.view(), cacheDirectory.view(), intermediatesDirectory.view(), outputsDirectory.view()})
+    {
+        if (fs.existsAndIsDirectory(directory))
+        {
+            SC_TEST_EXPECT(fs.removeDirectoryRecursive(directory));
+        }
+    }
+    SC_TEST_EXPECT(fs.makeDirectoryRecursive(rootDirectory.view()));
+    SC_TEST_EXPECT(fs.init(rootDirectory.view()));
+    SC_TEST_EXPECT(fs.makeDirectory("Sources"));
+    if (unity)
+    {
+        SC_TEST_EXPECT(fs.writeString("Sources/A.cpp", "int a() { return 1; }\n"));
+        SC_TEST_EXPECT(fs.writeString("Sources/B.cpp", "int b() { return 2; }\n"));
+        SC_TEST_EXPECT(fs.writeString("Sources/Special.cpp", "int special() { return SPECIAL_VALUE; }\n"));
+        SC_TEST_EXPECT(fs.writeString("Sources/main.cpp", "int a();\nint b();\nint special();\n"
+                                                          "int main() { return a() + b() - 3 + special(); }\n"));
+    }
+    else
+    {
+        SC_TEST_EXPECT(fs.writeString("Sources/main.cpp", "#include \"Value.h\"\nint main() { return value(); }\n"));
+        SC_TEST_EXPECT(fs.writeString("Sources/Value.h", "inline int value() { return 0; }\n"));
+    }
+
+    action.action                                  = Build::Action::Run;
+    action.parameters.generator                    = Build::Generator::Native;
+    action.parameters.platform                     = Build::Platform::Linux;
+    action.parameters.directories.libraryDirectory = rootDirectory.view();
+    action.target                                  = name;
+    action.configuration                           = "Debug";
+#if SC_PLATFORM_APPLE
+    action.parameters.platform = Build::Platform::Apple;
+#endif
+    const Build::Action::ConfigureFunction configure = unity ? &configureNative<true> : &configureNative<false>;
+
+    // First build compiles all sources, with the compiler writing a depfile for each of them
+    SC_TEST_EXPECT(Build::Action::execute(action, configure, name));
+
+    if (unity)
+    {
+        // A.cpp and B.cpp are batched in a single unity file, main.cpp is left alone in its batch and Special.cpp
+        // is excluded from unity build because it has specific compile flags
+        SC_TEST_EXPECT(fs.init(intermediatesDirectory.view()));
+        SC_TEST_EXPECT(fs.existsAndIsFile("UnityTest_Unity_0.o"));
+        SC_TEST_EXPECT(fs.existsAndIsFile("main.o"));
+        SC_TEST_EXPECT(fs.existsAndIsFile("Special.o"));
+        SC_TEST_EXPECT(not fs.existsAndIsFile("A.o"));
+        SC_TEST_EXPECT(not fs.existsAndIsFile("B.o"));
+        return;
+    }
+    String objectFile, depFile;
+    SC_TEST_EXPECT(Path::join(objectFile, {intermediatesDirectory.view(), "main.o"}));
+    SC_TEST_EXPECT(Path::join(depFile, {intermediatesDirectory.view(), "main.o.d"}));
+    SC_TEST_EXPECT(fs.existsAndIsFile(depFile.view()));
+
+    // Clean rebuild restores object files from cache without invoking the compiler (no depfile is written)
+    SC_TEST_EXPECT(fs.removeDirectoryRecursive(intermediatesDirectory.view()));
+    SC_TEST_EXPECT(fs.removeDirectoryRecursive(outputsDirectory.view()));
+    SC_TEST_EXPECT(Build::Action::execute(action, configure, name));
+    SC_TEST_EXPECT(fs.existsAndIsFile(objectFile.view()));
+    SC_TEST_EXPECT(not fs.existsAndIsFile(depFile.view()));
+
+    // Modifying an included header invalidates the cached object file
+    SC_TEST_EXPECT(fs.removeFile("Sources/Value.h"));
+    SC_TEST_EXPECT(fs.writeString("Sources/Value.h", "inline int value() { return 1 - 1; }\n"));
+    SC_TEST_EXPECT(Build::Action::execute(action, configure, name));
+    SC_TEST_EXPECT(fs.existsAndIsFile(depFile.view()));
+}
+
 namespace SC
 {
 void runBuildTest(SC::TestReport& report) { BuildTest test(report); }
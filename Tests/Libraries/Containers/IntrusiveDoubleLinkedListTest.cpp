@@ -44,6 +44,26 @@ struct SC::IntrusiveDoubleLinkedListTest : public SC::TestCase
             SC_TEST_EXPECT(second->data == 1);
             SC_TEST_EXPECT(queue.isEmpty());
         }
+        if (test_section("queueFront"))
+        {
+            IntrusiveDoubleLinkedList<Item> queue;
+
+            Item items[3];
+            items[0].data = 0;
+            items[1].data = 1;
+            items[2].data = 2;
+            queue.queueFront(items[1]);
+            queue.queueBack(items[2]);
+            queue.queueFront(items[0]);
+            SC_TEST_EXPECT(queue.front == &items[0] and queue.back == &items[2]);
+            int expected = 0;
+            while (Item* item = queue.dequeueFront())
+            {
+                SC_TEST_EXPECT(item->data == expected);
+                expected++;
+            }
+            SC_TEST_EXPECT(expected == 3);
+        }
         if (test_section("remove"))
         {
             IntrusiveDoubleLinkedList<Item> queue;
@@ -0,0 +1,169 @@
+// Copyright (c) Stefano Cristiano
+// SPDX-License-Identifier: MIT
+#include "Libraries/Containers/VirtualVector.h"
+#include "Libraries/Strings/String.h"
+#include "Libraries/Testing/Testing.h"
+
+namespace SC
+{
+struct VirtualVectorTest;
+}
+
+struct SC::VirtualVectorTest : public SC::TestCase
+{
+    VirtualVectorTest(SC::TestReport& report) : TestCase(report, "VirtualVectorTest")
+    {
+        if (test_section("push_back/pop_back"))
+        {
+            pushBackPopBack();
+        }
+        if (test_section("stable pointers"))
+        {
+            stablePointers();
+        }
+        if (test_section("shrink_to_fit"))
+        {
+            shrinkToFit();
+        }
+        if (test_section("non trivial"))
+        {
+            nonTrivial();
+        }
+        if (test_section("snippet"))
+        {
+            virtualVectorSnippet();
+        }
+    }
+
+    void pushBackPopBack();
+    void stablePointers();
+    void shrinkToFit();
+    void nonTrivial();
+    void virtualVectorSnippet();
+};
+
+void SC::VirtualVectorTest::pushBackPopBack()
+{
+    VirtualVector<int> vector;
+    SC_TEST_EXPECT(not vector.push_back(1)); // Not created yet
+    SC_TEST_EXPECT(vector.create(1024));
+    SC_TEST_EXPECT(not vector.create(1024)); // Already created
+    SC_TEST_EXPECT(vector.maxCapacity() >= 1024);
+    SC_TEST_EXPECT(vector.capacity() == 0); // Nothing committed yet
+    SC_TEST_EXPECT(vector.push_back(1));
+    SC_TEST_EXPECT(vector.push_back(2));
+    const int values[] = {3, 4, 5};
+    SC_TEST_EXPECT(vector.append(values));
+    SC_TEST_EXPECT(vector.size() == 5);
+    SC_TEST_EXPECT(vector.front() == 1 and vector.back() == 5);
+    int removed = 0;
+    SC_TEST_EXPECT(vector.pop_back(&removed));
+    SC_TEST_EXPECT(removed == 5 and vector.size() == 4);
+    int sum = 0;
+    for (int value : vector)
+    {
+        sum += value;
+    }
+    SC_TEST_EXPECT(sum == 1 + 2 + 3 + 4);
+    SC_TEST_EXPECT(vector.resize(10, 7));
+    SC_TEST_EXPECT(vector.size() == 10 and vector[9] == 7);
+    SC_TEST_EXPECT(vector.resize(2));
+    SC_TEST_EXPECT(vector.toSpanConst().sizeInElements() == 2);
+    vector.clear();
+    SC_TEST_EXPECT(vector.isEmpty());
+    SC_TEST_EXPECT(not vector.pop_back());
+
+    // Growing past the reserved address space fails
+    SC_TEST_EXPECT(not vector.resize(vector.maxCapacity() + 1));
+    SC_TEST_EXPECT(vector.resize(vector.maxCapacity()));
+    SC_TEST_EXPECT(not vector.push_back(1));
+}
+
+void SC::VirtualVectorTest::stablePointers()
+{
+    VirtualVector<size_t> vector;
+    SC_TEST_EXPECT(vector.create(16 * 1024 * 1024));
+    SC_TEST_EXPECT(vector.push_back(0));
+    const size_t* first = &vector[0];
+
+    bool allPushed = true;
+    for (size_t idx = 1; idx < 1024 * 1024; ++idx)
+    {
+        allPushed = allPushed and vector.push_back(idx);
+    }
+    SC_TEST_EXPECT(allPushed);
+    // Growth has committed more pages without relocating existing elements
+    SC_TEST_EXPECT(&vector[0] == first);
+    SC_TEST_EXPECT(vector.size() == 1024 * 1024 and vector.back() == 1024 * 1024 - 1);
+    SC_TEST_EXPECT(vector.capacity() < vector.maxCapacity());
+
+    VirtualVector<size_t> moved = move(vector);
+    SC_TEST_EXPECT(vector.isEmpty() and vector.data() == nullptr);
+    SC_TEST_EXPECT(moved.data() == first and moved.size() == 1024 * 1024);
+}
+
+void SC::VirtualVectorTest::shrinkToFit()
+{
+    VirtualVector<char> vector;
+    SC_TEST_EXPECT(vector.create(1024 * 1024));
+    SC_TEST_EXPECT(vector.resize(512 * 1024, 'a'));
+    SC_TEST_EXPECT(vector.capacity() >= 512 * 1024);
+    SC_TEST_EXPECT(vector.resize(1));
+    SC_TEST_EXPECT(vector.shrink_to_fit());
+    // Only the page holding the remaining element stays committed
+    SC_TEST_EXPECT(vector.capacity() == VirtualMemory::getPageSize());
+    SC_TEST_EXPECT(vector[0] == 'a');
+    SC_TEST_EXPECT(vector.resize(512 * 1024, 'b')); // Pages are committed again
+    SC_TEST_EXPECT(vector[0] == 'a' and vector.back() == 'b');
+    vector.clear();
+    SC_TEST_EXPECT(vector.shrink_to_fit());
+    SC_TEST_EXPECT(vector.capacity() == 0);
+}
+
+void SC::VirtualVectorTest::nonTrivial()
+{
+    VirtualVector<String> vector;
+    SC_TEST_EXPECT(vector.create(100));
+    SC_TEST_EXPECT(vector.push_back(String("first")));
+    String second = "second";
+    SC_TEST_EXPECT(vector.push_back(second));
+    SC_TEST_EXPECT(vector.resize(4, "other"));
+    SC_TEST_EXPECT(vector[0] == "first" and vector[1] == "second" and vector[3] == "other");
+    String removed;
+    SC_TEST_EXPECT(vector.pop_back(&removed));
+    SC_TEST_EXPECT(removed == "other");
+    SC_TEST_EXPECT(vector.release()); // Destroys remaining elements
+    SC_TEST_EXPECT(vector.isEmpty() and vector.maxCapacity() == 0);
+}
+
+void SC::VirtualVectorTest::virtualVectorSnippet()
+{
+    //! [VirtualVectorSnippet]
+    struct LogEntry
+    {
+        uint64_t timestamp;
+        uint32_t code;
+    };
+    VirtualVector<LogEntry> log;
+    // Reserves address space for 1 billion entries (16 GB), committing nothing
+    SC_TEST_EXPECT(log.create(1024 * 1024 * 1024));
+    SC_TEST_EXPECT(log.push_back({1, 200}));
+    const LogEntry* firstEntry = &log[0];
+    for (uint32_t idx = 0; idx < 100000; ++idx)
+    {
+        if (not log.push_back({idx, 404})) // Commits pages on demand, without copying
+        {
+            break;
+        }
+    }
+    SC_TEST_EXPECT(log.size() == 100001);
+    SC_TEST_EXPECT(&log[0] == firstEntry); // Pointers to elements never change
+    SC_TEST_EXPECT(log.resize(10));
+    SC_TEST_EXPECT(log.shrink_to_fit()); // Gives back unused pages to the OS
+    //! [VirtualVectorSnippet]
+}
+
+namespace SC
+{
+void runVirtualVectorTest(SC::TestReport& report) { VirtualVectorTest test(report); }
+} // namespace SC
@@ -22,6 +22,65 @@ struct SC::FileSystemWatcherTest : public SC::TestCase
         eventLoopSubdirectory(appDirectory);
         eventLoopWatchClose(appDirectory);
         eventLoopWatchStop(appDirectory);
+#if SC_PLATFORM_LINUX
+        // Fanotify sections assert that fanotify is used, or report themselves as skipped when missing privileges
+        for (FileSystemWatcher::LinuxBackend backend :
+             {FileSystemWatcher::LinuxBackend::Inotify, FileSystemWatcher::LinuxBackend::Fanotify})
+        {
+            threadRunnerBatch(appDirectory, backend);
+            eventLoopBatch(appDirectory, backend);
+            eventLoopOverlappingWatches(appDirectory, backend);
+        }
+        eventLoopOverflow(appDirectory);
+        eventLoopManySubdirectories(appDirectory);
+        eventLoopFanotify(appDirectory);
+#endif
+    }
+
+    static StringView sectionName(StringView inotifyName, StringView fanotifyName,
+                                  FileSystemWatcher::LinuxBackend backend)
+    {
+        return backend == FileSystemWatcher::LinuxBackend::Fanotify ? fanotifyName : inotifyName;
+    }
+
+    /// @brief Checks if the process has CAP_SYS_ADMIN and CAP_DAC_READ_SEARCH, needed by fanotify filesystem marks
+    static bool hasFanotifyCapabilities(const StringView appDirectory)
+    {
+        FileSystem fs;
+        String     status = StringEncoding::Ascii;
+        StringView capEff;
+        if (not fs.init(appDirectory) or not fs.read("/proc/self/status", status, StringEncoding::Ascii) or
+            not status.view().splitAfter("CapEff:", capEff) or not capEff.splitBefore("\n", capEff))
+        {
+            return false;
+        }
+        capEff = capEff.trimAnyOf({' ', '\t'});
+        // Only the lowest 32 bits are needed
+        uint32_t   capabilities = 0;
+        const auto numDigits    = capEff.sizeInBytes() < 8 ? capEff.sizeInBytes() : size_t(8);
+        for (const char digit : capEff.sliceStartBytes(capEff.sizeInBytes() - numDigits).toCharSpan())
+        {
+            const bool isDecimal = digit >= '0' and digit <= '9';
+            capabilities         = capabilities * 16 + uint32_t(isDecimal ? digit - '0' : (digit | 0x20) - 'a' + 10);
+        }
+        constexpr uint32_t CAP_DAC_READ_SEARCH = 1u << 2;
+        constexpr uint32_t CAP_SYS_ADMIN       = 1u << 21;
+        return (capabilities & (CAP_DAC_READ_SEARCH | CAP_SYS_ADMIN)) == (CAP_DAC_READ_SEARCH | CAP_SYS_ADMIN);
+    }
+
+    /// @brief Expects watcher to use the requested backend, returning false (after reporting the skip) when fanotify
+    /// has been requested without the needed privileges, as inotify fallback is used in that case.
+    bool expectLinuxBackend(const StringView appDirectory, FileSystemWatcher::FolderWatcher& watcher,
+                            FileSystemWatcher::LinuxBackend backend)
+    {
+        if (backend == FileSystemWatcher::LinuxBackend::Fanotify and not hasFanotifyCapabilities(appDirectory))
+        {
+            report.console.print("FileSystemWatcherTest: fanotify section skipped (missing CAP_SYS_ADMIN or "
+                                 "CAP_DAC_READ_SEARCH)\n");
+            return false;
+        }
+        SC_TEST_EXPECT(watcher.getLinuxBackend() == backend);
+        return true;
     }
 
     void initClose()
@@ -334,6 +393,371 @@ struct SC::FileSystemWatcherTest : public SC::TestCase
             SC_TEST_EXPECT(fs.removeEmptyDirectory(path2.view()));
         }
     }
+
+    void threadRunnerBatch(const StringView appDirectory, FileSystemWatcher::LinuxBackend backend)
+    {
+        if (test_section(sectionName("ThreadRunner batch", "ThreadRunner batch (fanotify)", backend)))
+        {
+            FileSystemWatcher               fileEventsWatcher;
+            FileSystemWatcher::ThreadRunner runner;
+            fileEventsWatcher.linuxBackend = backend;
+            SC_TEST_EXPECT(fileEventsWatcher.init(runner));
+            StringNative<1024> path;
+            SC_TEST_EXPECT(Path::join(path, {appDirectory, "__testThreadBatch"}));
+            FileSystem fs;
+            SC_TEST_EXPECT(fs.init(appDirectory));
+            if (fs.existsAndIsDirectory(path.view()))
+            {
+                SC_TEST_EXPECT(fs.removeDirectoryRecursive(path.view()));
+            }
+            SC_TEST_EXPECT(fs.makeDirectory(path.view()));
+            struct Params
+            {
+                int         numBatches       = 0;
+                size_t      numNotifications = 0;
+                EventObject eventObject;
+            } params;
+            FileSystemWatcher::FolderWatcher watcher;
+            // Results are saved and checked after the wait, as the callback runs on the watcher thread
+            watcher.notifyBatchCallback = [&](const FileSystemWatcher::ChangeSet& changeSet)
+            {
+                params.numBatches++;
+                params.numNotifications = changeSet.notifications.sizeInElements();
+                params.eventObject.signal();
+            };
+            fileEventsWatcher.batchWindow = Time::Milliseconds(100);
+            SC_TEST_EXPECT(fileEventsWatcher.watch(watcher, path.view()));
+            if (not expectLinuxBackend(appDirectory, watcher, backend))
+            {
+                SC_TEST_EXPECT(fileEventsWatcher.close());
+                SC_TEST_EXPECT(fs.removeDirectoryRecursive(path.view()));
+                return;
+            }
+            for (int idx = 0; idx < 10; ++idx)
+            {
+                SC_TEST_EXPECT(fs.write("__testThreadBatch/test.txt", "content"));
+            }
+            params.eventObject.wait();
+            SC_TEST_EXPECT(fileEventsWatcher.close());
+            SC_TEST_EXPECT(params.numBatches == 1);
+            SC_TEST_EXPECT(params.numNotifications == 1);
+            SC_TEST_EXPECT(fs.removeDirectoryRecursive(path.view()));
+        }
+    }
+
+    void eventLoopBatch(const StringView appDirectory, FileSystemWatcher::LinuxBackend backend)
+    {
+        if (test_section(sectionName("AsyncEventLoop batch", "AsyncEventLoop batch (fanotify)", backend)))
+        {
+            AsyncEventLoop eventLoop;
+            SC_TEST_EXPECT(eventLoop.create());
+
+            FileSystemWatcher                  fileEventsWatcher;
+            FileSystemWatcher::EventLoopRunner runner;
+            fileEventsWatcher.linuxBackend = backend;
+            SC_TEST_EXPECT(fileEventsWatcher.init(runner, eventLoop));
+            StringNative<1024> path;
+            SC_TEST_EXPECT(Path::join(path, {appDirectory, "__testBatch"}));
+            FileSystem fs;
+            SC_TEST_EXPECT(fs.init(appDirectory));
+            if (fs.existsAndIsDirectory(path.view()))
+            {
+                SC_TEST_EXPECT(fs.removeDirectoryRecursive(path.view()));
+            }
+            SC_TEST_EXPECT(fs.makeDirectory(path.view()));
+            SC_TEST_EXPECT(fs.makeDirectory("__testBatch/dir"));
+            struct Params
+            {
+                int  numBatches       = 0;
+                int  numNotifications = 0;
+                int  numTest          = 0;
+                int  numDirTest       = 0;
+                bool overflow         = false;
+            } params;
+            FileSystemWatcher::FolderWatcher watcher;
+            watcher.notifyBatchCallback = [&](const FileSystemWatcher::ChangeSet& changeSet)
+            {
+                params.numBatches++;
+                params.overflow = params.overflow or changeSet.overflow;
+                for (const FileSystemWatcher::Notification& notification : changeSet.notifications)
+                {
+                    params.numNotifications++;
+                    if (notification.relativePath == "test.txt" and
+                        notification.operation == FileSystemWatcher::Operation::AddRemoveRename)
+                    {
+                        params.numTest++;
+                    }
+                    else if (notification.relativePath == "dir/test.txt")
+                    {
+                        params.numDirTest++;
+                    }
+                }
+            };
+            fileEventsWatcher.batchWindow = Time::Milliseconds(100);
+            SC_TEST_EXPECT(fileEventsWatcher.watch(watcher, path.view()));
+            if (not expectLinuxBackend(appDirectory, watcher, backend))
+            {
+                SC_TEST_EXPECT(fileEventsWatcher.close());
+                SC_TEST_EXPECT(fs.removeDirectoryRecursive(path.view()));
+                return;
+            }
+            // Many events on the same paths are coalesced in a single notification for each path
+            for (int idx = 0; idx < 10; ++idx)
+            {
+                SC_TEST_EXPECT(fs.write("__testBatch/test.txt", "content"));
+                SC_TEST_EXPECT(fs.write("__testBatch/dir/test.txt", "content"));
+            }
+            for (int idx = 0; idx < 10 and params.numBatches == 0; ++idx)
+            {
+                SC_TEST_EXPECT(eventLoop.runOnce());
+            }
+            SC_TEST_EXPECT(params.numBatches == 1);
+            SC_TEST_EXPECT(params.numNotifications == 2);
+            SC_TEST_EXPECT(params.numTest == 1);
+            SC_TEST_EXPECT(params.numDirTest == 1);
+            SC_TEST_EXPECT(not params.overflow);
+            SC_TEST_EXPECT(fileEventsWatcher.close());
+            SC_TEST_EXPECT(fs.removeDirectoryRecursive(path.view()));
+        }
+    }
+
+    void eventLoopOverlappingWatches(const StringView appDirectory, FileSystemWatcher::LinuxBackend backend)
+    {
+        if (test_section(sectionName("AsyncEventLoop overlapping watches",
+                                     "AsyncEventLoop overlapping watches (fanotify)", backend)))
+        {
+            AsyncEventLoop eventLoop;
+            SC_TEST_EXPECT(eventLoop.create());
+
+            FileSystemWatcher                  fileEventsWatcher;
+            FileSystemWatcher::EventLoopRunner runner;
+            fileEventsWatcher.linuxBackend = backend;
+            SC_TEST_EXPECT(fileEventsWatcher.init(runner, eventLoop));
+            StringNative<1024> path, subPath;
+            SC_TEST_EXPECT(Path::join(path, {appDirectory, "__testOverlap"}));
+            SC_TEST_EXPECT(Path::join(subPath, {appDirectory, "__testOverlap", "dir"}));
+            FileSystem fs;
+            SC_TEST_EXPECT(fs.init(appDirectory));
+            if (fs.existsAndIsDirectory(path.view()))
+            {
+                SC_TEST_EXPECT(fs.removeDirectoryRecursive(path.view()));
+            }
+            SC_TEST_EXPECT(fs.makeDirectoryRecursive(subPath.view()));
+            struct Params
+            {
+                int changes     = 0;
+                int subChanges  = 0;
+                int sameChanges = 0;
+            } params;
+            // Watching a sub-folder of a recursive watch (or the same folder) re-uses its watches (or filesystem mark)
+            // and all get notified
+            FileSystemWatcher::FolderWatcher watcher, subWatcher, sameWatcher;
+            watcher.notifyCallback = [&](const FileSystemWatcher::Notification& notification)
+            {
+                if (notification.operation == FileSystemWatcher::Operation::AddRemoveRename and
+                    notification.relativePath == "dir/test.txt")
+                {
+                    params.changes++;
+                }
+            };
+            subWatcher.notifyCallback = [&](const FileSystemWatcher::Notification& notification)
+            {
+                if (notification.operation == FileSystemWatcher::Operation::AddRemoveRename and
+                    notification.relativePath == "test.txt")
+                {
+                    params.subChanges++;
+                }
+            };
+            sameWatcher.notifyCallback = [&](const FileSystemWatcher::Notification& notification)
+            {
+                if (notification.operation == FileSystemWatcher::Operation::AddRemoveRename and
+                    notification.relativePath == "dir/test.txt")
+                {
+                    params.sameChanges++;
+                }
+            };
+            SC_TEST_EXPECT(fileEventsWatcher.watch(watcher, path.view()));
+            SC_TEST_EXPECT(fileEventsWatcher.watch(subWatcher, subPath.view()));
+            SC_TEST_EXPECT(fileEventsWatcher.watch(sameWatcher, path.view()));
+            if (not expectLinuxBackend(appDirectory, watcher, backend))
+            {
+                SC_TEST_EXPECT(fileEventsWatcher.close());
+                SC_TEST_EXPECT(fs.removeDirectoryRecursive(path.view()));
+                return;
+            }
+            SC_TEST_EXPECT(fs.write("__testOverlap/dir/test.txt", "content"));
+            SC_TEST_EXPECT(eventLoop.runOnce());
+            SC_TEST_EXPECT(params.changes == 1);
+            SC_TEST_EXPECT(params.subChanges == 1);
+            SC_TEST_EXPECT(params.sameChanges == 1);
+
+            // Stopping the sub-folder watcher must not remove watches (or the mark) still used by the other one
+            SC_TEST_EXPECT(subWatcher.stopWatching());
+            SC_TEST_EXPECT(fs.removeFile("__testOverlap/dir/test.txt"));
+            SC_TEST_EXPECT(eventLoop.runOnce());
+            SC_TEST_EXPECT(params.changes == 2);
+            SC_TEST_EXPECT(params.subChanges == 1);
+            SC_TEST_EXPECT(fileEventsWatcher.close());
+            SC_TEST_EXPECT(fs.removeDirectoryRecursive(path.view()));
+        }
+    }
+
+    void eventLoopOverflow(const StringView appDirectory)
+    {
+        if (test_section("AsyncEventLoop overflow"))
+        {
+            // Overflow the kernel queue generating more events than max_queued_events without reading them
+            String maxQueuedEvents = StringEncoding::Ascii;
+            FileSystem fs;
+            SC_TEST_EXPECT(fs.init(appDirectory));
+            int32_t numEvents = 0;
+            if (not fs.read("/proc/sys/fs/inotify/max_queued_events", maxQueuedEvents, StringEncoding::Ascii) or
+                not maxQueuedEvents.view().trimEndAnyOf({'\n'}).parseInt32(numEvents) or numEvents > 100000)
+            {
+                return; // Too many events would be needed to overflow the queue
+            }
+            AsyncEventLoop eventLoop;
+            SC_TEST_EXPECT(eventLoop.create());
+
+            FileSystemWatcher                  fileEventsWatcher;
+            FileSystemWatcher::EventLoopRunner runner;
+            SC_TEST_EXPECT(fileEventsWatcher.init(runner, eventLoop));
+            StringNative<1024> path;
+            SC_TEST_EXPECT(Path::join(path, {appDirectory, "__testOverflow"}));
+            if (fs.existsAndIsDirectory(path.view()))
+            {
+                SC_TEST_EXPECT(fs.removeDirectoryRecursive(path.view()));
+            }
+            SC_TEST_EXPECT(fs.makeDirectory(path.view()));
+            struct Params
+            {
+                int  numBatches = 0;
+                bool overflow   = false;
+            } params;
+            FileSystemWatcher::FolderWatcher watcher;
+            watcher.notifyBatchCallback = [&](const FileSystemWatcher::ChangeSet& changeSet)
+            {
+                params.numBatches++;
+                params.overflow = params.overflow or changeSet.overflow;
+            };
+            SC_TEST_EXPECT(fileEventsWatcher.watch(watcher, path.view()));
+            // Alternating files, as the kernel merges consecutive identical events
+            bool written = true;
+            for (int32_t idx = 0; idx < numEvents / 2 + 100 and written; ++idx)
+            {
+                written = fs.write("__testOverflow/a.txt", "a") and fs.write("__testOverflow/b.txt", "b");
+            }
+            SC_TEST_EXPECT(written);
+            for (int idx = 0; idx < 100 and not params.overflow; ++idx)
+            {
+                SC_TEST_EXPECT(eventLoop.runOnce());
+            }
+            SC_TEST_EXPECT(params.overflow);
+            SC_TEST_EXPECT(fileEventsWatcher.close());
+            SC_TEST_EXPECT(fs.removeDirectoryRecursive(path.view()));
+        }
+    }
+
+    void eventLoopManySubdirectories(const StringView appDirectory)
+    {
+        if (test_section("AsyncEventLoop many subdirectories"))
+        {
+            // Number of watched sub-folders (one inotify watch each) is not bounded
+            constexpr int numSubdirectories = 300;
+
+            FileSystem fs;
+            SC_TEST_EXPECT(fs.init(appDirectory));
+            StringNative<1024> path;
+            SC_TEST_EXPECT(Path::join(path, {appDirectory, "__testManySubdirs"}));
+            if (fs.existsAndIsDirectory(path.view()))
+            {
+                SC_TEST_EXPECT(fs.removeDirectoryRecursive(path.view()));
+            }
+            SC_TEST_EXPECT(fs.makeDirectory(path.view()));
+            SC_TEST_EXPECT(fs.init(path.view()));
+            SmallString<64> name;
+            for (int idx = 0; idx < numSubdirectories; ++idx)
+            {
+                SC_TEST_EXPECT(StringBuilder(name, StringBuilder::Clear).format("dir{}", idx));
+                SC_TEST_EXPECT(fs.makeDirectory(name.view()));
+            }
+
+            AsyncEventLoop eventLoop;
+            SC_TEST_EXPECT(eventLoop.create());
+            FileSystemWatcher                  fileEventsWatcher;
+            FileSystemWatcher::EventLoopRunner runner;
+            SC_TEST_EXPECT(fileEventsWatcher.init(runner, eventLoop));
+
+            bool found = false;
+
+            FileSystemWatcher::FolderWatcher watcher;
+            watcher.notifyCallback = [&found](const FileSystemWatcher::Notification& notification)
+            { found = found or notification.relativePath == "dir299/test.txt"; };
+            SC_TEST_EXPECT(fileEventsWatcher.watch(watcher, path.view()));
+            SC_TEST_EXPECT(fs.write("dir299/test.txt", "content"));
+            SC_TEST_EXPECT(eventLoop.runOnce());
+            SC_TEST_EXPECT(found);
+            SC_TEST_EXPECT(fileEventsWatcher.close());
+            SC_TEST_EXPECT(fs.init(appDirectory));
+            SC_TEST_EXPECT(fs.removeDirectoryRecursive(path.view()));
+        }
+    }
+
+    void eventLoopFanotify(const StringView appDirectory)
+    {
+        if (test_section("AsyncEventLoop fanotify"))
+        {
+            AsyncEventLoop eventLoop;
+            SC_TEST_EXPECT(eventLoop.create());
+
+            FileSystemWatcher                  fileEventsWatcher;
+            FileSystemWatcher::EventLoopRunner runner;
+            fileEventsWatcher.linuxBackend = FileSystemWatcher::LinuxBackend::Fanotify;
+            SC_TEST_EXPECT(fileEventsWatcher.init(runner, eventLoop));
+            StringNative<1024> path;
+            SC_TEST_EXPECT(Path::join(path, {appDirectory, "__testFanotify"}));
+            FileSystem fs;
+            SC_TEST_EXPECT(fs.init(appDirectory));
+            if (fs.existsAndIsDirectory(path.view()))
+            {
+                SC_TEST_EXPECT(fs.removeDirectoryRecursive(path.view()));
+            }
+            SC_TEST_EXPECT(fs.makeDirectory(path.view()));
+            struct Params
+            {
+                int changes      = 0;
+                int otherChanges = 0;
+            } params;
+            FileSystemWatcher::FolderWatcher watcher;
+            watcher.notifyCallback = [&](const FileSystemWatcher::Notification& notification)
+            {
+                if (notification.operation == FileSystemWatcher::Operation::AddRemoveRename and
+                    notification.relativePath == "dir/nested/test.txt")
+                {
+                    params.changes++;
+                }
+                else if (not notification.relativePath.startsWith("dir"))
+                {
+                    params.otherChanges++;
+                }
+            };
+            SC_TEST_EXPECT(fileEventsWatcher.watch(watcher, path.view()));
+            if (expectLinuxBackend(appDirectory, watcher, FileSystemWatcher::LinuxBackend::Fanotify))
+            {
+                // Sub-folders created after starting the watch are watched too, as the mark is on the filesystem
+                SC_TEST_EXPECT(fs.makeDirectoryRecursive("__testFanotify/dir/nested"));
+                SC_TEST_EXPECT(fs.write("__testFanotify/dir/nested/test.txt", "content"));
+                // Changes outside of the watched folder (but in the same filesystem) must not be reported
+                SC_TEST_EXPECT(fs.write("__testFanotify.txt", "content"));
+                SC_TEST_EXPECT(eventLoop.runOnce());
+                SC_TEST_EXPECT(params.changes == 1);
+                SC_TEST_EXPECT(params.otherChanges == 0);
+                SC_TEST_EXPECT(fs.removeFile("__testFanotify.txt"));
+            }
+            SC_TEST_EXPECT(fileEventsWatcher.close());
+            SC_TEST_EXPECT(fs.removeDirectoryRecursive(path.view()));
+        }
+    }
 };
 
 namespace SC
@@ -388,6 +812,67 @@ Result fileSystemWatcherEventLoopRunnerSnippet(AsyncEventLoop& eventLoop, Consol
     return Result(true);
 }
 
+Result fileSystemWatcherBatchSnippet(AsyncEventLoop& eventLoop, Console& console)
+{
+    //! [fileSystemWatcherBatchSnippet]
+    FileSystemWatcher fileSystemWatcher;
+
+    FileSystemWatcher::EventLoopRunner eventLoopRunner;
+    SC_TRY(fileSystemWatcher.init(eventLoopRunner, eventLoop));
+
+    // Changes happening within 200 ms after the first one are delivered together
+    fileSystemWatcher.batchWindow = Time::Milliseconds(200);
+
+    FileSystemWatcher::FolderWatcher folderWatcher;
+    folderWatcher.notifyBatchCallback = [&](const FileSystemWatcher::ChangeSet& changeSet)
+    {
+        if (changeSet.overflow)
+        {
+            // Some changes have been lost, so the entire directory must be re-scanned
+            console.print("Rescan {}\n", changeSet.basePath);
+        }
+        // Each changed path is listed only once, no matter how many times it has changed in the window
+        for (const FileSystemWatcher::Notification& notification : changeSet.notifications)
+        {
+            console.print("Changed {}\n", notification.relativePath);
+        }
+    };
+    SC_TRY(fileSystemWatcher.watch(folderWatcher, "/path/to/dir"));
+
+    // ...
+    SC_TRY(fileSystemWatcher.close());
+    //! [fileSystemWatcherBatchSnippet]
+    return Result(true);
+}
+
+Result fileSystemWatcherFanotifySnippet(AsyncEventLoop& eventLoop, Console& console)
+{
+    //! [fileSystemWatcherFanotifySnippet]
+    FileSystemWatcher fileSystemWatcher;
+
+    // Must be requested before init (it's ignored on platforms other than Linux)
+    fileSystemWatcher.linuxBackend = FileSystemWatcher::LinuxBackend::Fanotify;
+
+    FileSystemWatcher::EventLoopRunner eventLoopRunner;
+    SC_TRY(fileSystemWatcher.init(eventLoopRunner, eventLoop));
+
+    FileSystemWatcher::FolderWatcher folderWatcher;
+    folderWatcher.notifyCallback = [&](const FileSystemWatcher::Notification& notification)
+    { console.print("Changed {}\n", notification.relativePath); };
+    SC_TRY(fileSystemWatcher.watch(folderWatcher, "/path/to/huge/monorepo"));
+
+    if (folderWatcher.getLinuxBackend() == FileSystemWatcher::LinuxBackend::Inotify)
+    {
+        // Process is missing CAP_SYS_ADMIN or CAP_DAC_READ_SEARCH, so one inotify watch for each sub-folder is used
+        console.print("Falling back to inotify\n");
+    }
+
+    // ...
+    SC_TRY(fileSystemWatcher.close());
+    //! [fileSystemWatcherFanotifySnippet]
+    return Result(true);
+}
+
 Result fileSystemWatcherThreadRunnerSnippet(Console& console)
 {
     //! [fileSystemWatcherThreadRunnerSnippet]
@@ -2,6 +2,8 @@
 // SPDX-License-Identifier: MIT
 #include "Libraries/Foundation/Globals.h"
 #include "Libraries/Foundation/VirtualMemory.h"
+#include "Libraries/Containers/Vector.h"
+#include "Libraries/Foundation/LibC.h" // memcmp
 #include "Libraries/Testing/Testing.h"
 #include "Libraries/Threading/Threading.h"
 namespace SC
@@ -22,6 +24,13 @@ struct SC::GlobalsTest : public SC::TestCase
         {
             fixedThreadLocal();
         }
+
+        if (test_section("arena"))
+        {
+            arenaFixed();
+            arenaVirtual();
+            globalsSnippetArena();
+        }
     }
 
     template <typename BufferT, typename SmallBufferT>
@@ -60,9 +69,12 @@ struct SC::GlobalsTest : public SC::TestCase
     void fixedGlobal();
     void fixedThreadLocal();
     void virtualGlobal();
+    void arenaFixed();
+    void arenaVirtual();
 
     void globalsSnippetFixed();
     void globalsSnippetVirtual();
+    void globalsSnippetArena();
 };
 
 void SC::GlobalsTest::fixedGlobal()
@@ -104,6 +116,62 @@ void SC::GlobalsTest::fixedThreadLocal()
     SC_TEST_EXPECT(res[1]);
 }
 
+void SC::GlobalsTest::arenaFixed()
+{
+    alignas(uint64_t) char stackMemory[64] = {0};
+
+    ArenaAllocator arena = {stackMemory, sizeof(stackMemory)};
+    Globals        globals = {arena};
+    Globals::push(Globals::ThreadLocal, globals);
+    {
+        BufferTL buffer1, buffer2;
+        SC_TEST_EXPECT(buffer1.append({"123"})); // 4 bytes (including null terminator)
+        SC_TEST_EXPECT(buffer2.append({"567"}));
+        // buffer1 is no longer the last allocation, so it gets copied to a new one
+        SC_TEST_EXPECT(buffer1.append({"abc"}));
+        SC_TEST_EXPECT(memcmp(buffer1.data(), "123\0abc", 8) == 0);
+        SC_TEST_EXPECT(memcmp(buffer2.data(), "567", 4) == 0);
+        // buffer2 is not the last allocation anymore too, and there's no space left for its copy
+        SC_TEST_EXPECT(not buffer2.append({"0123456789012345678901234567890123456789"}));
+    }
+    SC_TEST_EXPECT(arena.size() > 0);
+    arena.reset();
+    SC_TEST_EXPECT(arena.size() == 0);
+    Globals::pop(Globals::ThreadLocal);
+}
+
+void SC::GlobalsTest::arenaVirtual()
+{
+    ArenaAllocator arena = {VirtualMemory::getPageSize()};
+    Globals        globals = {arena};
+    Globals::push(Globals::ThreadLocal, globals);
+    {
+        VectorTL<uint32_t> vector;
+        // Growing past the block size chains new VirtualMemory blocks
+        for (uint32_t idx = 0; idx < 4096; ++idx)
+        {
+            SC_TEST_EXPECT(vector.push_back(idx));
+        }
+        bool allEquals = true;
+        for (uint32_t idx = 0; idx < 4096; ++idx)
+        {
+            allEquals = allEquals and vector[idx] == idx;
+        }
+        SC_TEST_EXPECT(allEquals);
+        SC_TEST_EXPECT(arena.size() >= 4096 * sizeof(uint32_t));
+    }
+    arena.reset(); // Keeps the blocks for reuse
+    SC_TEST_EXPECT(arena.size() == 0);
+    {
+        BufferTL buffer;
+        SC_TEST_EXPECT(buffer.append({"ASD"}));
+        SC_TEST_EXPECT(arena.size() == 4);
+    }
+    arena.releaseBlocks();
+    SC_TEST_EXPECT(arena.size() == 0);
+    Globals::pop(Globals::ThreadLocal);
+}
+
 void SC::GlobalsTest::globalsSnippetFixed()
 {
     //! [GlobalsSnippetFixed]
@@ -138,6 +206,27 @@ void SC::GlobalsTest::globalsSnippetVirtual()
     //! [GlobalsSnippetVirtual]
 }
 
+void SC::GlobalsTest::globalsSnippetArena()
+{
+    //! [GlobalsSnippetArena]
+    // Create an arena chaining blocks of 1 MB of virtual memory (committed only when used)
+    ArenaAllocator arena = {1024 * 1024};
+    Globals        arenaGlobals = {arena};
+    for (int idx = 0; idx < 3; ++idx)
+    {
+        Globals::push(Globals::ThreadLocal, arenaGlobals);
+        {
+            // ...
+            BufferTL buffer;
+            (void)buffer.append({"ASDF"}); // Allocates from arena, without any call to malloc
+            // ...
+        }
+        Globals::pop(Globals::ThreadLocal);
+        arena.reset(); // Frees all allocations at once
+    }
+    //! [GlobalsSnippetArena]
+}
+
 namespace SC
 {
 void runGlobalsTest(SC::TestReport& report) { GlobalsTest test(report); }
@@ -0,0 +1,390 @@
+// Copyright (c) Stefano Cristiano
+// SPDX-License-Identifier: MIT
+#include "Libraries/Foundation/VirtualMemory.h"
+#include "Libraries/Containers/Vector.h"
+#include "Libraries/Foundation/Globals.h"
+#include "Libraries/Foundation/LibC.h" // memset
+#include "Libraries/Testing/Testing.h"
+#include "Libraries/Threading/Atomic.h"
+#include "Libraries/Threading/Threading.h"
+#include "Libraries/Time/Time.h"
+
+namespace SC
+{
+struct SlabAllocatorTest;
+}
+
+struct SC::SlabAllocatorTest : public SC::TestCase
+{
+    SlabAllocatorTest(SC::TestReport& report) : TestCase(report, "SlabAllocatorTest")
+    {
+        if (test_section("size classes"))
+        {
+            sizeClasses();
+        }
+        if (test_section("reallocate"))
+        {
+            reallocate();
+        }
+        if (test_section("cross thread release"))
+        {
+            crossThreadRelease();
+        }
+        if (test_section("many threads"))
+        {
+            manyThreads();
+        }
+        if (test_section("alignment"))
+        {
+            alignment();
+        }
+        if (test_section("multiple allocators"))
+        {
+            multipleAllocators();
+        }
+        if (test_section("globals"))
+        {
+            slabAllocatorSnippet();
+        }
+        if (test_section("SlabAllocator benchmark", Execute::OnlyExplicit))
+        {
+            benchmark();
+        }
+    }
+
+    void sizeClasses();
+    void reallocate();
+    void crossThreadRelease();
+    void manyThreads();
+    void alignment();
+    void multipleAllocators();
+    void slabAllocatorSnippet();
+    void benchmark();
+};
+
+void SC::SlabAllocatorTest::sizeClasses()
+{
+    SlabAllocator allocator = {64 * SlabAllocator::SlabBytes};
+
+    void* block16 = allocator.allocate(nullptr, 10, 8);
+    void* other16 = allocator.allocate(nullptr, 16, 8);
+    SC_TEST_EXPECT(block16 != nullptr and other16 != nullptr);
+    // Blocks of the same size class are contiguous in the same slab
+    SC_TEST_EXPECT(static_cast<char*>(other16) - static_cast<char*>(block16) == 16);
+    SC_TEST_EXPECT(allocator.statistics.numBytesUsed == 32);
+    SC_TEST_EXPECT(allocator.statistics.numBytesCommitted == 2 * SlabAllocator::SlabBytes); // caches + one slab
+
+    void* block100 = allocator.allocate(nullptr, 100, 8);
+    SC_TEST_EXPECT((reinterpret_cast<size_t>(block100) & 127) == 0); // 128 bytes size class
+    SC_TEST_EXPECT(allocator.statistics.numBytesUsed == 32 + 128);
+
+    // Released blocks are reused immediately
+    allocator.release(other16);
+    void* reused16 = allocator.allocate(nullptr, 16, 8);
+    SC_TEST_EXPECT(reused16 == other16);
+
+    // Allocations larger than MaxClassBytes get their own virtual memory
+    void* large = allocator.allocate(nullptr, SlabAllocator::MaxClassBytes + 1, 8);
+    SC_TEST_EXPECT(large != nullptr);
+    memset(large, 1, SlabAllocator::MaxClassBytes + 1);
+    SC_TEST_EXPECT(allocator.statistics.numBytesUsed == 32 + 128 + SlabAllocator::MaxClassBytes + 1);
+    allocator.release(large);
+
+    allocator.release(block16);
+    allocator.release(reused16);
+    allocator.release(block100);
+    SC_TEST_EXPECT(allocator.statistics.numBytesUsed == 0);
+    SC_TEST_EXPECT(allocator.statistics.numAllocate == allocator.statistics.numRelease);
+
+    // Exhausting the reservation fails allocations
+    SlabAllocator tiny = {2 * SlabAllocator::SlabBytes}; // Caches + a single slab
+    void*         allocations[3];
+    for (void*& it : allocations)
+    {
+        it = tiny.allocate(nullptr, SlabAllocator::MaxClassBytes, 8);
+    }
+    SC_TEST_EXPECT(allocations[0] != nullptr and allocations[1] != nullptr and allocations[2] != nullptr);
+    SC_TEST_EXPECT(tiny.allocate(nullptr, SlabAllocator::MaxClassBytes, 8) == nullptr);
+    for (void* it : allocations)
+    {
+        tiny.release(it);
+    }
+}
+
+void SC::SlabAllocatorTest::reallocate()
+{
+    SlabAllocator allocator = {64 * SlabAllocator::SlabBytes};
+
+    char* memory = static_cast<char*>(allocator.allocate(nullptr, 20, 8));
+    memset(memory, 'a', 20);
+    // Stays in the same 32 bytes size class
+    SC_TEST_EXPECT(allocator.reallocate(memory, 32) == memory);
+    memory = static_cast<char*>(allocator.reallocate(memory, 1000));
+    SC_TEST_EXPECT(memory != nullptr and memory[0] == 'a' and memory[19] == 'a');
+    memset(memory, 'b', 1000);
+    memory = static_cast<char*>(allocator.reallocate(memory, 100 * 1024)); // Large
+    SC_TEST_EXPECT(memory != nullptr and memory[0] == 'b' and memory[999] == 'b');
+    memset(memory, 'c', 100 * 1024);
+    memory = static_cast<char*>(allocator.reallocate(memory, 200 * 1024)); // Large grows (not in place)
+    SC_TEST_EXPECT(memory != nullptr and memory[100 * 1024 - 1] == 'c');
+    memory = static_cast<char*>(allocator.reallocate(memory, 64)); // Back to a slab
+    SC_TEST_EXPECT(memory != nullptr and memory[63] == 'c');
+    allocator.release(memory);
+    SC_TEST_EXPECT(allocator.statistics.numBytesUsed == 0);
+}
+
+void SC::SlabAllocatorTest::crossThreadRelease()
+{
+    SlabAllocator allocator = {64 * SlabAllocator::SlabBytes};
+
+    constexpr size_t NumBlocks = 8192; // more than what fits a single slab of 16 bytes blocks
+    Vector<void*>    blocks;
+    SC_TEST_EXPECT(blocks.resize(NumBlocks, nullptr));
+    for (void*& it : blocks)
+    {
+        it = allocator.allocate(nullptr, 16, 8);
+    }
+    const size_t committedBytes = allocator.statistics.numBytesCommitted;
+
+    // Release all blocks from another thread
+    Thread thread;
+    SC_TEST_EXPECT(thread.start(
+        [&](Thread&)
+        {
+            for (void* it : blocks)
+            {
+                allocator.release(it);
+            }
+            allocator.releaseThreadCache();
+        }));
+    SC_TEST_EXPECT(thread.join());
+    SC_TEST_EXPECT(allocator.statistics.numBytesUsed == 0);
+
+    // Owner thread reclaims blocks released by the other thread, without committing new slabs
+    for (void*& it : blocks)
+    {
+        it = allocator.allocate(nullptr, 16, 8);
+    }
+    SC_TEST_EXPECT(allocator.statistics.numBytesCommitted == committedBytes);
+    for (void* it : blocks)
+    {
+        allocator.release(it);
+    }
+}
+
+void SC::SlabAllocatorTest::manyThreads()
+{
+    SlabAllocator allocator = {256 * SlabAllocator::SlabBytes}; // Room for a slab for each thread cache
+
+    // More threads than SlabAllocator::MaxThreads allocate at the same time (exiting without releaseThreadCache)
+    constexpr int32_t NumThreads = static_cast<int32_t>(SlabAllocator::MaxThreads) + 8;
+    struct Context
+    {
+        SlabAllocator&  allocator;
+        Atomic<int32_t> numAllocated = 0;
+        Atomic<int32_t> numFailed    = 0;
+        Atomic<bool>    canRelease   = false;
+
+        void run()
+        {
+            void* block = allocator.allocate(nullptr, 64, 8);
+            if (block == nullptr)
+            {
+                (void)numFailed.fetch_add(1);
+            }
+            (void)numAllocated.fetch_add(1);
+            while (not canRelease.load())
+            {
+                Thread::Sleep(1);
+            }
+            allocator.release(block);
+        }
+    } context = {allocator};
+
+    size_t committedBytes = 0;
+    for (int round = 0; round < 2; ++round)
+    {
+        context.numAllocated.store(0, memory_order_seq_cst);
+        (void)context.canRelease.exchange(false);
+        Thread threads[NumThreads];
+        for (Thread& thread : threads)
+        {
+            SC_TEST_EXPECT(thread.start([&context](Thread&) { context.run(); }));
+        }
+        while (context.numAllocated.load() < NumThreads)
+        {
+            Thread::Sleep(1);
+        }
+        (void)context.canRelease.exchange(true);
+        for (Thread& thread : threads)
+        {
+            SC_TEST_EXPECT(thread.join());
+        }
+        SC_TEST_EXPECT(context.numFailed.load() == 0);
+        SC_TEST_EXPECT(allocator.statistics.numBytesUsed == 0);
+        if (round == 0)
+        {
+            committedBytes = allocator.statistics.numBytesCommitted;
+        }
+    }
+    // Caches of exited threads (with their slabs) have been adopted by new threads, without committing new slabs
+    SC_TEST_EXPECT(allocator.statistics.numBytesCommitted == committedBytes);
+
+    // Calling thread gets a cache of its own (released by exited threads) instead of the shared one, so that a released
+    // block goes back to its local free list (instead of the lock-free list) and it's immediately reused
+    void* block = allocator.allocate(nullptr, 64, 8);
+    allocator.release(block);
+    SC_TEST_EXPECT(allocator.allocate(nullptr, 64, 8) == block);
+    allocator.release(block);
+}
+
+void SC::SlabAllocatorTest::alignment()
+{
+    SlabAllocator allocator = {64 * SlabAllocator::SlabBytes};
+
+    const size_t alignments[] = {128, 4096, 64 * 1024};
+    for (size_t alignment : alignments)
+    {
+        char* small = static_cast<char*>(allocator.allocate(nullptr, 24, alignment));
+        char* large = static_cast<char*>(allocator.allocate(nullptr, SlabAllocator::MaxClassBytes * 2, alignment));
+        SC_TEST_EXPECT(small != nullptr and (reinterpret_cast<size_t>(small) & (alignment - 1)) == 0);
+        SC_TEST_EXPECT(large != nullptr and (reinterpret_cast<size_t>(large) & (alignment - 1)) == 0);
+        memset(small, 1, 24);
+        memset(large, 2, SlabAllocator::MaxClassBytes * 2);
+        // Alignment is preserved when an allocation is moved
+        small = static_cast<char*>(allocator.reallocate(small, 100));
+        SC_TEST_EXPECT(small != nullptr and (reinterpret_cast<size_t>(small) & (alignment - 1)) == 0);
+        SC_TEST_EXPECT(small[0] == 1 and small[23] == 1);
+        allocator.release(small);
+        allocator.release(large);
+    }
+    SC_TEST_EXPECT(allocator.allocate(nullptr, 16, 24) == nullptr); // Not a power of two
+    SC_TEST_EXPECT(allocator.statistics.numBytesUsed == 0);
+    SC_TEST_EXPECT(allocator.statistics.numAllocate == allocator.statistics.numRelease + 1);
+}
+
+void SC::SlabAllocatorTest::multipleAllocators()
+{
+    // Interleaving allocations from a few allocators on the same thread keeps using their existing caches
+    SlabAllocator allocators[6] = {{4 * SlabAllocator::SlabBytes}, {4 * SlabAllocator::SlabBytes},
+                                   {4 * SlabAllocator::SlabBytes}, {4 * SlabAllocator::SlabBytes},
+                                   {4 * SlabAllocator::SlabBytes}, {4 * SlabAllocator::SlabBytes}};
+    void*         blocks[6][16];
+    for (size_t idx = 0; idx < 16; ++idx)
+    {
+        for (size_t allocatorIdx = 0; allocatorIdx < 6; ++allocatorIdx)
+        {
+            blocks[allocatorIdx][idx] = allocators[allocatorIdx].allocate(nullptr, 16, 8);
+            SC_TEST_EXPECT(blocks[allocatorIdx][idx] != nullptr);
+        }
+    }
+    for (size_t allocatorIdx = 0; allocatorIdx < 6; ++allocatorIdx)
+    {
+        // All blocks come from the same slab of the same cache
+        SC_TEST_EXPECT(allocators[allocatorIdx].statistics.numBytesCommitted == 2 * SlabAllocator::SlabBytes);
+        for (void* it : blocks[allocatorIdx])
+        {
+            allocators[allocatorIdx].release(it);
+        }
+        SC_TEST_EXPECT(allocators[allocatorIdx].statistics.numBytesUsed == 0);
+    }
+}
+
+void SC::SlabAllocatorTest::slabAllocatorSnippet()
+{
+    //! [SlabAllocatorSnippet]
+    // Reserves (lazily) 64 MB of address space for slabs
+    SlabAllocator slabAllocator = {64 * 1024 * 1024};
+    Globals       slabGlobals   = {slabAllocator};
+    Globals::push(Globals::ThreadLocal, slabGlobals);
+    {
+        VectorTL<int> vector;
+        for (int idx = 0; idx < 100; ++idx)
+        {
+            SC_TEST_EXPECT(vector.push_back(idx)); // Grows through size classes
+        }
+        // Occupancy can be measured through allocator statistics
+        const MemoryAllocator::Statistics& stats = slabAllocator.statistics;
+        SC_TEST_EXPECT(stats.numBytesUsed > 0 and stats.numBytesUsed <= stats.numBytesCommitted);
+    }
+    Globals::pop(Globals::ThreadLocal);
+    //! [SlabAllocatorSnippet]
+    SC_TEST_EXPECT(slabAllocator.statistics.numBytesUsed == 0);
+}
+
+void SC::SlabAllocatorTest::benchmark()
+{
+    constexpr size_t NumBlocks     = 1024;
+    constexpr size_t NumIterations = 1000;
+
+    void* blocks[NumBlocks];
+
+    // Allocates and releases a mix of small sizes in LIFO batches
+    auto run = [&](auto allocateFunc, auto releaseFunc)
+    {
+        Time::HighResolutionCounter start;
+        start.snap();
+        for (size_t iteration = 0; iteration < NumIterations; ++iteration)
+        {
+            for (size_t idx = 0; idx < NumBlocks; ++idx)
+            {
+                blocks[idx] = allocateFunc(16 + ((idx * 7 + iteration) % 32) * 16);
+            }
+            for (size_t idx = 0; idx < NumBlocks; ++idx)
+            {
+                releaseFunc(blocks[idx]);
+            }
+        }
+        const auto elapsed = Time::HighResolutionCounter().snap().subtractExact(start).toNanoseconds();
+        return static_cast<double>(elapsed.ns) / (NumIterations * NumBlocks);
+    };
+
+    const double memoryNs = run([](size_t numBytes) { return Memory::allocate(numBytes, 8); },
+                                [](void* memory) { Memory::release(memory); });
+
+    SlabAllocator slabAllocator;
+    const double  slabNs = run([&](size_t numBytes) { return slabAllocator.allocate(nullptr, numBytes, 8); },
+                               [&](void* memory) { slabAllocator.release(memory); });
+
+    report.console.print("Memory::allocate / release: {:.2} ns per pair\n", memoryNs);
+    report.console.print("SlabAllocator allocate / release: {:.2} ns per pair\n", slabNs);
+
+    // Allocates on this thread and releases on another one
+    constexpr size_t NumCrossBlocks = 256 * 1024;
+
+    Vector<void*> crossBlocks;
+    SC_TEST_EXPECT(crossBlocks.resize(NumCrossBlocks, nullptr));
+    Time::HighResolutionCounter start;
+    start.snap();
+    for (void*& it : crossBlocks)
+    {
+        it = slabAllocator.allocate(nullptr, 64, 8);
+    }
+    Thread thread;
+    SC_TEST_EXPECT(thread.start(
+        [&](Thread&)
+        {
+            for (void* it : crossBlocks)
+            {
+                slabAllocator.release(it);
+            }
+            slabAllocator.releaseThreadCache();
+        }));
+    SC_TEST_EXPECT(thread.join());
+    for (void*& it : crossBlocks)
+    {
+        it = slabAllocator.allocate(nullptr, 64, 8);
+    }
+    for (void* it : crossBlocks)
+    {
+        slabAllocator.release(it);
+    }
+    const auto   elapsed = Time::HighResolutionCounter().snap().subtractExact(start).toNanoseconds();
+    const double crossNs = static_cast<double>(elapsed.ns) / (2 * NumCrossBlocks);
+    report.console.print("SlabAllocator cross thread allocate / release: {:.2} ns per pair\n", crossNs);
+}
+
+namespace SC
+{
+void runSlabAllocatorTest(SC::TestReport& report) { SlabAllocatorTest test(report); }
+} // namespace SC
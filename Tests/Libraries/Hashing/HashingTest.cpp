@@ -1,6 +1,7 @@
 // Copyright (c) Stefano Cristiano
 // SPDX-License-Identifier: MIT
 #include "Libraries/Hashing/Hashing.h"
+#include "Libraries/Hashing/Checksum.h"
 #include "Libraries/Strings/Console.h"
 #include "Libraries/Strings/String.h"
 #include "Libraries/Strings/StringBuilder.h"
@@ -109,6 +110,74 @@ struct SC::HashingTest : public SC::TestCase
             SC_TEST_EXPECT(StringBuilder(test).appendHex(res.toBytesSpan(), StringBuilder::AppendHexCase::UpperCase));
             SC_TEST_EXPECT(test == "37268335DD6931045BDCDF92623FF819A64244B53D0E746D438797349D4DA578"_a8);
         }
+        if (test_section("CRC32C"))
+        {
+            //! [ChecksumSnippet]
+            Checksum checksum;
+            SC_TEST_EXPECT(checksum.setType(Checksum::TypeCRC32C));
+
+            SC_TEST_EXPECT(checksum.add("1234"_a8.toBytesSpan()));
+            SC_TEST_EXPECT(checksum.add("56789"_a8.toBytesSpan()));
+            Hashing::Result res;
+            SC_TEST_EXPECT(checksum.getHash(res));
+
+            String test;
+            SC_TEST_EXPECT(StringBuilder(test).appendHex(res.toBytesSpan(), StringBuilder::AppendHexCase::UpperCase));
+            SC_TEST_EXPECT(test == "E3069283"_a8);
+            SC_TEST_EXPECT(checksum.getValue() == 0xE3069283);
+            //! [ChecksumSnippet]
+            SC_TEST_EXPECT(Checksum::crc32c("test"_a8.toBytesSpan()) == 0x86A072C0);
+            SC_TEST_EXPECT(Checksum::crc32c("test"_a8.toBytesSpan(), Checksum::crc32c("1234"_a8.toBytesSpan())) ==
+                           Checksum::crc32c("1234test"_a8.toBytesSpan()));
+        }
+
+        if (test_section("XXHash64"))
+        {
+            SC_TEST_EXPECT(Checksum::xxHash64({}) == 0xEF46DB3751D8E999ULL);
+            SC_TEST_EXPECT(Checksum::xxHash64("a"_a8.toBytesSpan()) == 0xD24EC4F1A98C6E5BULL);
+            SC_TEST_EXPECT(Checksum::xxHash64("abc"_a8.toBytesSpan()) == 0x44BC2CF5AD770999ULL);
+            SC_TEST_EXPECT(Checksum::xxHash64("test"_a8.toBytesSpan()) == 0x4FDCCA5DDB678139ULL);
+
+            Checksum checksum;
+            SC_TEST_EXPECT(checksum.setType(Checksum::TypeXXHash64));
+            SC_TEST_EXPECT(checksum.add("test"_a8.toBytesSpan()));
+            SC_TEST_EXPECT(checksum.add("test"_a8.toBytesSpan()));
+            Hashing::Result res;
+            SC_TEST_EXPECT(checksum.getHash(res));
+
+            String test;
+            SC_TEST_EXPECT(StringBuilder(test).appendHex(res.toBytesSpan(), StringBuilder::AppendHexCase::UpperCase));
+            SC_TEST_EXPECT(test == "43506E4D9362A1C4"_a8);
+        }
+
+        if (test_section("Checksum Update"))
+        {
+            // Adding data in irregular chunks (crossing internal stripes) must match single shot computation
+            uint8_t data[1000];
+            for (size_t idx = 0; idx < sizeof(data); ++idx)
+            {
+                data[idx] = static_cast<uint8_t>(idx * 7 + 3);
+            }
+            SC_TEST_EXPECT(Checksum::xxHash64(data) == 0x5F235FA033F1A3FBULL);
+            SC_TEST_EXPECT(Checksum::crc32c(data) == 0xDD2EDFF7);
+
+            Checksum crc, xxh;
+            SC_TEST_EXPECT(crc.setType(Checksum::TypeCRC32C));
+            SC_TEST_EXPECT(xxh.setType(Checksum::TypeXXHash64));
+            size_t offset = 0;
+            size_t chunk  = 1;
+            while (offset < sizeof(data))
+            {
+                const size_t        size  = chunk < sizeof(data) - offset ? chunk : sizeof(data) - offset;
+                Span<const uint8_t> slice = {data + offset, size};
+                SC_TEST_EXPECT(crc.add(slice) and xxh.add(slice));
+                offset += size;
+                chunk = (chunk * 3 + 1) % 71;
+            }
+            SC_TEST_EXPECT(crc.getValue() == 0xDD2EDFF7);
+            SC_TEST_EXPECT(xxh.getValue() == 0x5F235FA033F1A3FBULL);
+        }
+
         if (test_section("C Bindings"))
         {
             const char* res = sc_hashing_test();
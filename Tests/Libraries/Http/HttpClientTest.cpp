@@ -14,9 +14,47 @@ struct SC::HttpClientTest : public SC::TestCase
     HttpClientTest(SC::TestReport& report) : TestCase(report, "HttpClientTest")
     {
         if (test_section("sample")) {}
+        if (test_section("timeout"))
+        {
+            timeoutTest();
+        }
     }
+
+    void timeoutTest();
 };
 
+void SC::HttpClientTest::timeoutTest()
+{
+    AsyncEventLoop eventLoop;
+    SC_TEST_EXPECT(eventLoop.create());
+
+    // A server that never accepts connections (and never responds) makes client receive time out
+    SocketDescriptor serverSocket;
+    SocketIPAddress  serverAddress;
+    SC_TEST_EXPECT(serverAddress.fromAddressPort("127.0.0.1", 6154));
+    SC_TEST_EXPECT(serverSocket.create(serverAddress.getAddressFamily()));
+    {
+        SocketServer server(serverSocket);
+        SC_TEST_EXPECT(server.bind(serverAddress));
+        SC_TEST_EXPECT(server.listen(1));
+    }
+
+    int        numCallbacks = 0;
+    HttpClient client;
+    client.timeout  = Time::Milliseconds(100);
+    client.callback = [this, &numCallbacks](HttpClient& result)
+    {
+        numCallbacks++;
+        SC_TEST_EXPECT(result.isTimedOut());
+        SC_TEST_EXPECT(result.getResponse().isEmpty());
+    };
+    SC_TEST_EXPECT(client.get(eventLoop, "http://127.0.0.1:6154/index.html"));
+    SC_TEST_EXPECT(eventLoop.run());
+    SC_TEST_EXPECT(numCallbacks == 1);
+    SC_TEST_EXPECT(serverSocket.close());
+    SC_TEST_EXPECT(eventLoop.close());
+}
+
 namespace SC
 {
 void runHttpClientTest(SC::TestReport& report) { HttpClientTest test(report); }
@@ -1,6 +1,7 @@
 // Copyright (c) Stefano Cristiano
 // SPDX-License-Identifier: MIT
 #include "Libraries/Http/HttpServer.h"
+#include "Libraries/Foundation/VirtualMemory.h"
 #include "Libraries/Http/HttpClient.h"
 #include "Libraries/Strings/String.h"
 #include "Libraries/Strings/StringBuilder.h"
@@ -18,8 +19,13 @@ struct SC::HttpServerTest : public SC::TestCase
         {
             httpServerTest();
         }
+        if (test_section("HttpServer headers timeout"))
+        {
+            httpServerHeadersTimeoutTest();
+        }
     }
     void httpServerTest();
+    void httpServerHeadersTimeoutTest();
 };
 
 void SC::HttpServerTest::httpServerTest()
@@ -31,6 +37,10 @@ void SC::HttpServerTest::httpServerTest()
     HttpServer server;
     SC_TEST_EXPECT(server.start(eventLoop, 10, "127.0.0.1", 6152));
 
+    // Temporaries (BufferTL, VectorTL etc.) inside onRequest will be allocated from this arena
+    ArenaAllocator requestArena(64 * 1024);
+    server.requestArena = &requestArena;
+
     struct ServerContext
     {
         int         numRequests;
@@ -58,6 +68,8 @@ void SC::HttpServerTest::httpServerTest()
         SC_TEST_EXPECT(response.addHeader("Server", "SC"));
         SC_TEST_EXPECT(response.addHeader("Date", "Mon, 27 Aug 2023 16:37:00 GMT"));
         SC_TEST_EXPECT(response.addHeader("Last-Modified", "Wed, 27 Aug 2023 16:37:00 GMT"));
+        VectorTL<StringView> names;
+        SC_TEST_EXPECT(names.push_back("SC") and serverContext.server.requestArena->size() > 0);
         String        str;
         StringBuilder sb(str);
         const char    sampleHtml[] = "<html>\r\n"
@@ -98,10 +110,54 @@ void SC::HttpServerTest::httpServerTest()
     }
     SC_TEST_EXPECT(eventLoop.run());
     SC_TEST_EXPECT(serverContext.numRequests == clientContext.wantedNumRequests);
+    SC_TEST_EXPECT(requestArena.size() == 0); // Arena is reset after every onRequest
     SC_TEST_EXPECT(clientContext.numRequests == clientContext.wantedNumRequests);
     SC_TEST_EXPECT(eventLoop.close());
 }
 
+void SC::HttpServerTest::httpServerHeadersTimeoutTest()
+{
+    AsyncEventLoop eventLoop;
+    SC_TEST_EXPECT(eventLoop.create());
+
+    HttpServer server;
+    server.headersTimeout = Time::Milliseconds(100);
+    server.idleTimeout    = Time::Milliseconds(0);
+
+    int numRequests  = 0;
+    server.onRequest = [&numRequests](HttpRequest&, HttpResponse&) { numRequests++; };
+    SC_TEST_EXPECT(server.start(eventLoop, 2, "127.0.0.1", 6153));
+
+    // A client sending incomplete headers must be disconnected by the server once headersTimeout expires
+    SocketDescriptor client;
+    SC_TEST_EXPECT(client.create(SocketFlags::AddressFamilyIPV4));
+    SC_TEST_EXPECT(SocketClient(client).connect("127.0.0.1", 6153));
+    SC_TEST_EXPECT(SocketClient(client).write(StringView("GET /index.html HTTP/1.1\r\n").toCharSpan()));
+    SC_TEST_EXPECT(client.setBlocking(false));
+    SC_TEST_EXPECT(eventLoop.associateExternallyCreatedSocket(client));
+
+    struct Context
+    {
+        HttpServer& server;
+        bool        disconnected;
+    } context = {server, false};
+
+    char               buffer[16];
+    AsyncSocketReceive asyncReceive;
+    asyncReceive.callback = [this, &context](AsyncSocketReceive::Result& result)
+    {
+        Span<char> data;
+        SC_TEST_EXPECT(result.get(data) and data.empty());
+        context.disconnected = result.completionData.disconnected;
+        SC_TEST_EXPECT(context.server.stopAsync());
+    };
+    SC_TEST_EXPECT(asyncReceive.start(eventLoop, client, {buffer, sizeof(buffer)}));
+    SC_TEST_EXPECT(eventLoop.run());
+    SC_TEST_EXPECT(context.disconnected);
+    SC_TEST_EXPECT(numRequests == 0);
+    SC_TEST_EXPECT(eventLoop.close());
+}
+
 namespace SC
 {
 void runHttpServerTest(SC::TestReport& report) { HttpServerTest test(report); }
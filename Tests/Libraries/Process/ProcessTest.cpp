@@ -4,12 +4,25 @@
 #include "Libraries/Async/Async.h"
 #include "Libraries/File/File.h"
 #include "Libraries/FileSystem/FileSystem.h"
+#include "Libraries/Process/ProcessForkSnapshot.h"
+#include "Libraries/Reflection/ReflectionSC.h"
 #include "Libraries/Testing/Testing.h"
 
 namespace SC
 {
 struct ProcessTest;
-}
+struct ProcessTestSnapshotData;
+} // namespace SC
+
+struct SC::ProcessTestSnapshotData
+{
+    uint32_t        version = 1;
+    Vector<int32_t> values;
+};
+SC_REFLECT_STRUCT_VISIT(SC::ProcessTestSnapshotData)
+SC_REFLECT_STRUCT_FIELD(0, version)
+SC_REFLECT_STRUCT_FIELD(1, values)
+SC_REFLECT_STRUCT_LEAVE()
 
 struct SC::ProcessTest : public SC::TestCase
 {
@@ -62,6 +75,10 @@ struct SC::ProcessTest : public SC::TestCase
             {
                 processFork();
             }
+            if (test_section("Process fork snapshot"))
+            {
+                processForkSnapshot();
+            }
         }
 #if SC_XCTEST
 #else
@@ -94,6 +111,7 @@ struct SC::ProcessTest : public SC::TestCase
     void processEnvironmentRedefineParentVar();
     void processEnvironmentDisableInheritance();
     void processFork();
+    void processForkSnapshot();
 
     Result spawnChildAndPrintEnvironmentVars(Process& process, String& output);
 
@@ -420,6 +438,66 @@ void SC::ProcessTest::processFork()
     //! [ProcessFork]
 }
 
+void SC::ProcessTest::processForkSnapshot()
+{
+    StringView snapshotFile = "ProcessForkSnapshot.bin";
+
+    ProcessTestSnapshotData data;
+    SC_TEST_EXPECT(data.values.resizeWithoutInitializing(100000));
+    for (int32_t idx = 0; idx < 100000; ++idx)
+    {
+        data.values[static_cast<size_t>(idx)] = idx;
+    }
+
+    //! [ProcessForkSnapshotSnippet]
+    AsyncEventLoop eventLoop;
+    SC_TEST_EXPECT(eventLoop.create());
+
+    ProcessForkSnapshot snapshot;
+    snapshot.chunkSize = 64 * 1024; // Child writes to disk (and reports progress) every 64 KB
+
+    int      numProgress  = 0;
+    uint64_t bytesWritten = 0;
+    Result   completed    = Result::Error("Not completed");
+
+    snapshot.onProgress = [&](uint64_t numBytes)
+    {
+        numProgress++;
+        bytesWritten = numBytes;
+    };
+    snapshot.onComplete = [&](Result result) { completed = result; };
+    SC_TEST_EXPECT(snapshot.start(eventLoop, data, report.applicationRootDirectory, snapshotFile));
+    SC_TEST_EXPECT(snapshot.isRunning());
+
+    // Parent side can keep modifying data while the child is persisting its Copy-On-Write snapshot
+    data.version = 2;
+    data.values.clear();
+
+    SC_TEST_EXPECT(eventLoop.run());
+    SC_TEST_EXPECT(completed);
+    //! [ProcessForkSnapshotSnippet]
+    SC_TEST_EXPECT(not snapshot.isRunning());
+    SC_TEST_EXPECT(eventLoop.close());
+
+    // Snapshot must contain data as it was at the time of the fork
+    FileSystem fs;
+    SC_TEST_EXPECT(fs.init(report.applicationRootDirectory));
+    Buffer fileData;
+    SC_TEST_EXPECT(fs.read(snapshotFile, fileData));
+    ProcessTestSnapshotData loaded;
+    SC_TEST_EXPECT(SerializationBinary::loadVersionedWithSchema(loaded, fileData.toSpanConst()));
+    SC_TEST_EXPECT(loaded.version == 1);
+    SC_TEST_EXPECT(loaded.values.size() == 100000);
+    SC_TEST_EXPECT(loaded.values[99999] == 99999);
+    if (HostPlatform != Platform::Windows)
+    {
+        SC_TEST_EXPECT(numProgress > 0);
+        SC_TEST_EXPECT(bytesWritten == fileData.size());
+    }
+    SC_TEST_EXPECT(not fs.existsAndIsFile("ProcessForkSnapshot.bin.tmp"));
+    SC_TEST_EXPECT(fs.removeFile(snapshotFile));
+}
+
 SC::Result SC::ProcessTest::quickSheet()
 {
     // clang-format off
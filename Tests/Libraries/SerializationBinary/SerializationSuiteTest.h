@@ -29,6 +29,9 @@ struct ConversionStruct1;
 struct ConversionStruct2;
 struct PackedStruct1;
 struct PackedStruct2;
+struct VersionedRecord;
+struct VersionedRecords1;
+struct VersionedRecords2;
 struct SerializationTest;
 
 } // namespace SerializationSuiteTest
@@ -284,6 +287,46 @@ SC_REFLECT_STRUCT_FIELD(0, field0)
 SC_REFLECT_STRUCT_FIELD(2, field2)
 SC_REFLECT_STRUCT_LEAVE()
 
+struct SC::SerializationSuiteTest::VersionedRecord
+{
+    int32_t id    = 0;
+    float   value = 0;
+    uint8_t flags = 0;
+};
+SC_REFLECT_STRUCT_VISIT(SC::SerializationSuiteTest::VersionedRecord)
+SC_REFLECT_STRUCT_FIELD(0, id)
+SC_REFLECT_STRUCT_FIELD(1, value)
+SC_REFLECT_STRUCT_FIELD(2, flags)
+SC_REFLECT_STRUCT_LEAVE()
+
+struct SC::SerializationSuiteTest::VersionedRecords1
+{
+    uint32_t                 version = 1;
+    Vector<VersionedRecord>  records;
+    Vector<VersionedPoint2D> points;
+    double                   fieldToRemove = 1.0;
+};
+SC_REFLECT_STRUCT_VISIT(SC::SerializationSuiteTest::VersionedRecords1)
+SC_REFLECT_STRUCT_FIELD(0, version)
+SC_REFLECT_STRUCT_FIELD(1, records)
+SC_REFLECT_STRUCT_FIELD(2, points)
+SC_REFLECT_STRUCT_FIELD(3, fieldToRemove)
+SC_REFLECT_STRUCT_LEAVE()
+
+struct SC::SerializationSuiteTest::VersionedRecords2
+{
+    Vector<VersionedPoint2D> points;
+    Vector<VersionedRecord>  records;
+    uint64_t                 version    = 0;
+    int32_t                  fieldToAdd = 7;
+};
+SC_REFLECT_STRUCT_VISIT(SC::SerializationSuiteTest::VersionedRecords2)
+SC_REFLECT_STRUCT_FIELD(2, points)
+SC_REFLECT_STRUCT_FIELD(1, records)
+SC_REFLECT_STRUCT_FIELD(0, version)
+SC_REFLECT_STRUCT_FIELD(4, fieldToAdd)
+SC_REFLECT_STRUCT_LEAVE()
+
 struct SC::SerializationSuiteTest::SerializationTest : public SC::TestCase
 {
     // Used only for the test
@@ -497,5 +540,45 @@ struct SC::SerializationSuiteTest::SerializationTest : public SC::TestCase
             SC_TEST_EXPECT(deserializedObject.field0 == 0);
             SC_TEST_EXPECT(deserializedObject.field2 == 2);
         }
+        if (test_section("VersionedRecords1/2"))
+        {
+            // Records and points have the same layout in both versions, even if their parent struct has changed
+            constexpr auto    schema = SerializerSchemaCompiler::template compile<VersionedRecords1>();
+            VersionedRecords1 objectToSerialize;
+            VersionedRecords2 deserializedObject;
+            for (int32_t idx = 0; idx < 100; ++idx)
+            {
+                VersionedRecord record;
+                record.id    = idx;
+                record.value = static_cast<float>(idx) * 0.5f;
+                record.flags = static_cast<uint8_t>(idx % 3);
+                SC_TRUST_RESULT(objectToSerialize.records.push_back(record));
+                SC_TRUST_RESULT(objectToSerialize.points.push_back({static_cast<float>(idx), -1.0f}));
+            }
+
+            // Serialization
+            Buffer buffer;
+            SC_TEST_EXPECT(SerializerWriter::write(objectToSerialize, buffer, &numWriteOperations));
+
+            // Deserialization
+            SC_TEST_EXPECT(SerializerReader::loadVersioned(deserializedObject, buffer.toSpanConst(), schema.typeInfos,
+                                                           SerializationBinaryOptions(), &numReadOperations));
+
+            // Verification
+            SC_TEST_EXPECT(deserializedObject.version == 1);
+            SC_TEST_EXPECT(deserializedObject.fieldToAdd == 7);
+            SC_TEST_EXPECT(deserializedObject.records.size() == 100);
+            SC_TEST_EXPECT(deserializedObject.points.size() == 100);
+            for (size_t idx = 0; idx < 100; ++idx)
+            {
+                const VersionedRecord& source = objectToSerialize.records[idx];
+                const VersionedRecord& record = deserializedObject.records[idx];
+                SC_TEST_EXPECT(record.id == source.id and record.value == source.value);
+                SC_TEST_EXPECT(record.flags == source.flags);
+                SC_TEST_EXPECT(deserializedObject.points[idx].x == static_cast<float>(idx));
+            }
+            // Packed points are read with a single operation
+            SC_TEST_EXPECT(numReadOperations < 100 * 3 + 100);
+        }
     }
 };
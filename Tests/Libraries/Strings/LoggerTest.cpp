@@ -0,0 +1,280 @@
+// Copyright (c) Stefano Cristiano
+// SPDX-License-Identifier: MIT
+#include "Libraries/Strings/Logger.h"
+#include "Libraries/Testing/Testing.h"
+#include "Libraries/Time/Time.h"
+
+namespace SC
+{
+struct LoggerTest;
+}
+
+struct SC::LoggerTest : public SC::TestCase
+{
+    inline void logAndFlush();
+    inline void ringBufferWrapping();
+    inline void dropPolicy();
+    inline void multipleThreads();
+    inline void benchmark();
+
+    LoggerTest(SC::TestReport& report) : TestCase(report, "LoggerTest")
+    {
+        if (test_section("log and flush"))
+        {
+            logAndFlush();
+        }
+        if (test_section("ring buffer wrapping"))
+        {
+            ringBufferWrapping();
+        }
+        if (test_section("drop policy"))
+        {
+            dropPolicy();
+        }
+        if (test_section("multiple threads"))
+        {
+            multipleThreads();
+        }
+        if (test_section("Logger benchmark", Execute::OnlyExplicit))
+        {
+            benchmark();
+        }
+    }
+};
+
+void SC::LoggerTest::logAndFlush()
+{
+    //! [loggerSnippet]
+    Buffer output; // Collects everything written by the logger
+    Logger logger;
+    SC_TEST_EXPECT(logger.create([&output](StringView text) { (void)output.append(text.toCharSpan()); }));
+
+    // Each thread logging needs its own producer, with its own ring buffer memory
+    char           memory[4096];
+    LoggerProducer producer;
+    SC_TEST_EXPECT(logger.addProducer(producer, memory));
+
+    // Arguments are copied to the ring buffer and formatted later on the writer thread
+    SC_TEST_EXPECT(producer.log(SC_STRING_FORMAT("{} from {}:{}\n"), "connection", StringView("127.0.0.1"), 8080));
+    SC_TEST_EXPECT(producer.log(SC_STRING_FORMAT("{1} bytes in {0:.2} ms\n"), 1.2345, uint64_t(1024)));
+
+    SC_TEST_EXPECT(logger.flush()); // Writes all records logged so far
+    SC_TEST_EXPECT(logger.removeProducer(producer));
+    SC_TEST_EXPECT(logger.destroy());
+    //! [loggerSnippet]
+    const StringView expected = "connection from 127.0.0.1:8080\n1024 bytes in 1.23 ms\n";
+    SC_TEST_EXPECT(StringView(output.toSpanConst(), false, StringEncoding::Utf8) == expected);
+    SC_TEST_EXPECT(producer.getNumDroppedRecords() == 0);
+    SC_TEST_EXPECT(not producer.log(SC_STRING_FORMAT("Not registered")));
+}
+
+void SC::LoggerTest::ringBufferWrapping()
+{
+    Buffer output;
+    Logger logger;
+    SC_TEST_EXPECT(logger.create([&output](StringView text) { (void)output.append(text.toCharSpan()); }));
+
+    char           memory[300]; // Rounded down to 256 bytes
+    LoggerProducer producer;
+    SC_TEST_EXPECT(logger.addProducer(producer, memory, LoggerProducer::OverflowPolicy::Block));
+
+    // Records of different sizes, continuing from the start of the ring buffer at different offsets
+    String        expected;
+    StringBuilder builder(expected);
+    const char    text[] = "abcdefghijklmnopqrstuvwxyz0123456789";
+    for (size_t idx = 0; idx < 200; ++idx)
+    {
+        const StringView name({text, idx % sizeof(text)}, false, StringEncoding::Ascii);
+        SC_TEST_EXPECT(producer.log(SC_STRING_FORMAT("{}_{}_{}\n"), idx, name, String(name)));
+        SC_TEST_EXPECT(builder.append(SC_STRING_FORMAT("{}_{}_{}\n"), idx, name, name));
+    }
+    SC_TEST_EXPECT(logger.flush());
+    SC_TEST_EXPECT(StringView(output.toSpanConst(), false, StringEncoding::Utf8) == expected.view());
+    SC_TEST_EXPECT(producer.getNumDroppedRecords() == 0);
+
+    // Records bigger than half of the ring buffer are always dropped
+    char big[200] = {0};
+    memset(big, 'x', sizeof(big) - 1);
+    SC_TEST_EXPECT(not producer.log(SC_STRING_FORMAT("{}"), big));
+    SC_TEST_EXPECT(producer.getNumDroppedRecords() == 1);
+    SC_TEST_EXPECT(logger.destroy());
+}
+
+void SC::LoggerTest::dropPolicy()
+{
+    // Simulates a slow destination, blocking the writer thread until allowed to continue
+    struct SlowDestination
+    {
+        Buffer      output;
+        EventObject writerBlocked;
+        EventObject writerCanContinue;
+        bool        firstWrite = true;
+
+        void write(StringView text)
+        {
+            (void)output.append(text.toCharSpan());
+            if (firstWrite)
+            {
+                firstWrite = false;
+                writerBlocked.signal();
+                writerCanContinue.wait();
+            }
+        }
+    } destination;
+
+    Logger logger;
+    SC_TEST_EXPECT(logger.create([&destination](StringView text) { destination.write(text); }));
+    char           memory[256];
+    LoggerProducer producer;
+    SC_TEST_EXPECT(logger.addProducer(producer, memory, LoggerProducer::OverflowPolicy::Drop));
+    SC_TEST_EXPECT(producer.log(SC_STRING_FORMAT("first\n")));
+    destination.writerBlocked.wait();
+
+    // The write function is called without holding locks, so producers can be added while it's blocked
+    char           otherMemory[256];
+    LoggerProducer otherProducer;
+    SC_TEST_EXPECT(logger.addProducer(otherProducer, otherMemory));
+
+    // Logging doesn't wait for the blocked writer thread, records are dropped when ring buffer is full
+    int32_t numLogged = 0;
+    for (int32_t idx = 0; idx < 100; ++idx)
+    {
+        if (producer.log(SC_STRING_FORMAT("{}\n"), idx))
+        {
+            SC_TEST_EXPECT(idx == numLogged); // After first drop, all records are dropped
+            numLogged++;
+        }
+    }
+    SC_TEST_EXPECT(numLogged > 0 and numLogged < 100);
+    SC_TEST_EXPECT(producer.getNumDroppedRecords() == 100 - numLogged);
+    SC_TEST_EXPECT(producer.getNumBlockedRecords() == 0);
+    destination.writerCanContinue.signal();
+    SC_TEST_EXPECT(logger.removeProducer(otherProducer));
+    SC_TEST_EXPECT(logger.flush());
+
+    String        expected;
+    StringBuilder builder(expected);
+    SC_TEST_EXPECT(builder.append("first\n"));
+    for (int32_t idx = 0; idx < numLogged; ++idx)
+    {
+        SC_TEST_EXPECT(builder.append("{}\n", idx));
+    }
+    SC_TEST_EXPECT(StringView(destination.output.toSpanConst(), false, StringEncoding::Utf8) == expected.view());
+    SC_TEST_EXPECT(logger.destroy());
+}
+
+void SC::LoggerTest::multipleThreads()
+{
+    constexpr int32_t NumThreads = 4;
+    constexpr int32_t NumRecords = 2000;
+
+    Buffer output;
+    Logger logger;
+    SC_TEST_EXPECT(logger.create([&output](StringView text) { (void)output.append(text.toCharSpan()); }));
+
+    // Small ring buffers with the block policy, so that all records are written
+    struct ThreadLogger
+    {
+        int32_t        index     = 0;
+        int32_t        numLogged = 0; // Expectations can't be recorded concurrently from multiple threads
+        char           memory[512];
+        LoggerProducer producer;
+        Thread         thread;
+    } threadLoggers[NumThreads];
+
+    for (int32_t idx = 0; idx < NumThreads; ++idx)
+    {
+        ThreadLogger& threadLogger = threadLoggers[idx];
+        threadLogger.index         = idx;
+        SC_TEST_EXPECT(logger.addProducer(threadLogger.producer, threadLogger.memory,
+                                          LoggerProducer::OverflowPolicy::Block));
+        auto logRecords = [&threadLogger](Thread&)
+        {
+            for (int32_t record = 0; record < NumRecords; ++record)
+            {
+                if (threadLogger.producer.log(SC_STRING_FORMAT("{} {}\n"), threadLogger.index, record))
+                {
+                    threadLogger.numLogged++;
+                }
+            }
+        };
+        SC_TEST_EXPECT(threadLogger.thread.start(logRecords));
+    }
+    for (int32_t idx = 0; idx < NumThreads; ++idx)
+    {
+        SC_TEST_EXPECT(threadLoggers[idx].thread.join());
+        SC_TEST_EXPECT(threadLoggers[idx].numLogged == NumRecords);
+    }
+    SC_TEST_EXPECT(logger.flush());
+
+    // Records of each thread must be written in order
+    int32_t nextRecord[NumThreads] = {0};
+
+    StringViewTokenizer lines(StringView(output.toSpanConst(), false, StringEncoding::Utf8));
+    while (lines.tokenizeNextLine())
+    {
+        int32_t thread = 0, record = 0;
+        SC_TEST_EXPECT(lines.component.sliceStartLength(0, 1).parseInt32(thread));
+        SC_TEST_EXPECT(lines.component.sliceStart(2).parseInt32(record));
+        SC_TEST_EXPECT(thread >= 0 and thread < NumThreads);
+        SC_TEST_EXPECT(nextRecord[thread] == record);
+        nextRecord[thread]++;
+    }
+    for (int32_t idx = 0; idx < NumThreads; ++idx)
+    {
+        SC_TEST_EXPECT(nextRecord[idx] == NumRecords);
+        SC_TEST_EXPECT(threadLoggers[idx].producer.getNumDroppedRecords() == 0);
+    }
+    SC_TEST_EXPECT(logger.destroy());
+}
+
+void SC::LoggerTest::benchmark()
+{
+    constexpr size_t NumRecords = 1000000;
+
+    // Measures logging (with a ring buffer big enough for all records and a writer thread that doesn't wake up
+    // during the measurement), formatting on writer side and formatting the same records on the calling thread
+    size_t numBytes = 0;
+    Logger logger;
+    SC_TEST_EXPECT(logger.create([&numBytes](StringView text) { numBytes += text.sizeInBytes(); }, 2000));
+
+    Buffer memory;
+    SC_TEST_EXPECT(memory.resize(128 * 1024 * 1024, 0)); // Touches all pages before measuring
+    LoggerProducer producer;
+    SC_TEST_EXPECT(logger.addProducer(producer, memory.toSpan(), LoggerProducer::OverflowPolicy::Drop));
+
+    const StringView path = "/api/v1/items?id=1234";
+
+    Time::HighResolutionCounter start;
+    start.snap();
+    for (size_t idx = 0; idx < NumRecords; ++idx)
+    {
+        (void)producer.log(SC_STRING_FORMAT("[{}] GET {} completed in {} us\n"), idx, path, 42);
+    }
+    const auto logging = Time::HighResolutionCounter().snap().subtractExact(start).toNanoseconds();
+    start.snap();
+    SC_TEST_EXPECT(logger.flush());
+    const auto writing = Time::HighResolutionCounter().snap().subtractExact(start).toNanoseconds();
+    SC_TEST_EXPECT(producer.getNumDroppedRecords() == 0);
+
+    String        buffer;
+    StringBuilder builder(buffer);
+    start.snap();
+    for (size_t idx = 0; idx < NumRecords; ++idx)
+    {
+        (void)builder.format(SC_STRING_FORMAT("[{}] GET {} completed in {} us\n"), idx, path, 42);
+    }
+    const auto formatting = Time::HighResolutionCounter().snap().subtractExact(start).toNanoseconds();
+    SC_TEST_EXPECT(logger.destroy());
+
+    const double records = static_cast<double>(NumRecords);
+    report.console.print("LoggerProducer::log: {:.1} ns / record\n", static_cast<double>(logging.ns) / records);
+    report.console.print("Logger::flush: {:.1} ns / record ({} bytes)\n", static_cast<double>(writing.ns) / records,
+                         numBytes);
+    report.console.print("StringBuilder::format: {:.1} ns / record\n", static_cast<double>(formatting.ns) / records);
+}
+
+namespace SC
+{
+void runLoggerTest(SC::TestReport& report) { LoggerTest test(report); }
+} // namespace SC
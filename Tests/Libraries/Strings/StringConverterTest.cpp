@@ -3,6 +3,7 @@
 #include "Libraries/Strings/StringConverter.h"
 #include "Libraries/Containers/Vector.h"
 #include "Libraries/Testing/Testing.h"
+#include "Libraries/Time/Time.h"
 
 namespace SC
 {
@@ -12,6 +13,9 @@ struct StringConverterTest;
 struct SC::StringConverterTest : public SC::TestCase
 {
     inline void convertUtf8Utf16();
+    inline void convertLongMixed();
+    inline void convertMalformed();
+    inline void benchmark();
     StringConverterTest(SC::TestReport& report) : TestCase(report, "StringConverterTest")
     {
         using namespace SC;
@@ -19,6 +23,41 @@ struct SC::StringConverterTest : public SC::TestCase
         {
             convertUtf8Utf16();
         }
+        if (test_section("UTF8<->UTF16 long mixed"))
+        {
+            convertLongMixed();
+        }
+        if (test_section("UTF8<->UTF16 malformed"))
+        {
+            convertMalformed();
+        }
+        if (test_section("StringConverter benchmark", Execute::OnlyExplicit))
+        {
+            benchmark();
+        }
+    }
+
+    // Builds text repeating the UTF8 sequences in pieces, starting from a given piece
+    static bool buildText(Buffer& text, size_t numBytes, size_t firstPiece)
+    {
+        const StringView pieces[] = {
+            "abcdefghijklmnopqrstuvwxyz0123456789"_a8,    // ASCII run longer than 32 bytes
+            "\xC3\xA0"_u8,                                 // U+00E0 (2 bytes)
+            "\xE6\x97\xA5\xE6\x9C\xAC\xE8\xAA\x9E"_u8, // U+65E5 U+672C U+8A9E (3 bytes each)
+            "path/to/file.txt"_a8,                        // 16 ASCII bytes
+            "\xF0\x9F\x98\x80"_u8,                         // U+1F600 (4 bytes, surrogate pair in UTF16)
+            "x"_a8,
+            // Runs of 11 sequences of 2 bytes and 12 sequences of 3 bytes (converted in blocks)
+            "\xD0\xBF\xD1\x80\xD0\xB8\xD0\xB2\xD0\xB5\xD1\x82\xD0\xBC\xD0\xB8\xD1\x80\xD0\xB4\xD1\x80"_u8,
+            "\xE6\x97\xA5\xE6\x9C\xAC\xE8\xAA\x9E\xE3\x81\xAE\xE6\x96\x87\xE7\xAB\xA0"
+            "\xE6\x97\xA5\xE6\x9C\xAC\xE8\xAA\x9E\xE3\x81\xAE\xE6\x96\x87\xE7\xAB\xA0"_u8,
+        };
+        text.clear();
+        for (size_t idx = firstPiece; text.size() < numBytes; ++idx)
+        {
+            SC_TRY(text.append(pieces[idx % (sizeof(pieces) / sizeof(pieces[0]))].toCharSpan()));
+        }
+        return true;
     }
 };
 
@@ -46,6 +85,157 @@ void SC::StringConverterTest::convertUtf8Utf16()
     SC_TEST_EXPECT(output == expected);
     //! [stringConverterTestSnippet]
 }
+
+void SC::StringConverterTest::convertLongMixed()
+{
+    Buffer source, utf16, utf8;
+    for (size_t firstPiece = 0; firstPiece < 8; ++firstPiece)
+    {
+        for (size_t numBytes = 1; numBytes < 300; numBytes += 3)
+        {
+            SC_TEST_EXPECT(buildText(source, numBytes, firstPiece));
+            const StringView input(source.toSpanConst(), false, StringEncoding::Utf8);
+
+            // Appending to existing content, to check that destination offset is respected
+            utf16.clear();
+            SC_TEST_EXPECT(utf16.append({"\x61\x00", 2}));
+            SC_TEST_EXPECT(StringConverter::convertEncodingToUTF16(input, utf16, nullptr,
+                                                                   StringConverter::DoNotAddZeroTerminator));
+            const StringView converted16({utf16.data() + 2, utf16.size() - 2}, false, StringEncoding::Utf16);
+            SC_TEST_EXPECT(converted16.compare(input) == StringView::Comparison::Equals);
+
+            utf8.clear();
+            SC_TEST_EXPECT(utf8.append({"b", 1}));
+            StringView output;
+            SC_TEST_EXPECT(
+                StringConverter::convertEncodingToUTF8(converted16, utf8, &output, StringConverter::AddZeroTerminator));
+            SC_TEST_EXPECT(output.sizeInBytes() == input.sizeInBytes() + 1);
+            SC_TEST_EXPECT(output.sliceStartEndBytes(1, output.sizeInBytes()) == input);
+        }
+    }
+}
+
+void SC::StringConverterTest::convertMalformed()
+{
+    SmallBuffer<255> buffer;
+
+    const StringView invalidUtf8[] = {
+        "abc\xC0\xAF"_u8,         // Overlong '/'
+        "abc\xED\xA0\x80"_u8,     // U+D800 surrogate
+        "abc\xF4\x90\x80\x80"_u8, // Above U+10FFFF
+        "abc\xE6\x97"_u8,         // Truncated
+        "abc\x97"_u8,             // Lone continuation byte
+    };
+    for (const StringView& input : invalidUtf8)
+    {
+        buffer.clear();
+        SC_TEST_EXPECT(not StringConverter::convertEncodingToUTF16(input, buffer));
+    }
+    const StringView invalidUtf16[] = {
+        "a\x00\x3D\xD8"_u16,         // Truncated surrogate pair
+        "a\x00\x3D\xD8\x61\x00"_u16, // Unpaired high surrogate
+        "a\x00\x00\xDE"_u16,         // Unpaired low surrogate
+    };
+    for (const StringView& input : invalidUtf16)
+    {
+        buffer.clear();
+        SC_TEST_EXPECT(not StringConverter::convertEncodingToUTF8(input, buffer));
+    }
+
+    // Malformed sequences in the middle of long runs of sequences of the same length (converted in blocks)
+    Buffer text;
+    for (size_t position = 0; position < 20; ++position)
+    {
+        const StringView runs[][2] = {
+            {"\xD0\xBF"_u8, "\xC1\xBF"_u8},         // Overlong in 2 bytes run
+            {"\xE6\x97\xA5"_u8, "\xE0\x80\xAF"_u8}, // Overlong in 3 bytes run
+            {"\xE6\x97\xA5"_u8, "\xED\xA0\x80"_u8}, // Surrogate in 3 bytes run
+            {"\xE6\x97\xA5"_u8, "\xE6\x97\xC5"_u8}, // Bad continuation byte in 3 bytes run
+        };
+        for (const auto& run : runs)
+        {
+            text.clear();
+            for (size_t idx = 0; idx < 20; ++idx)
+            {
+                SC_TEST_EXPECT(text.append(run[idx == position ? 1 : 0].toCharSpan()));
+            }
+            buffer.clear();
+            SC_TEST_EXPECT(not StringConverter::convertEncodingToUTF16(
+                StringView(text.toSpanConst(), false, StringEncoding::Utf8), buffer));
+        }
+        const StringView runs16[][2] = {
+            {"\x3F\x04"_u16, "\x00\xDC"_u16}, // Unpaired low surrogate in 2 bytes run
+            {"\xE5\x65"_u16, "\x00\xDC"_u16}, // Unpaired low surrogate in 3 bytes run
+            {"\xE5\x65"_u16, "\x00\xD8"_u16}, // Unpaired high surrogate in 3 bytes run
+        };
+        for (const auto& run : runs16)
+        {
+            text.clear();
+            for (size_t idx = 0; idx < 20; ++idx)
+            {
+                SC_TEST_EXPECT(text.append(run[idx == position ? 1 : 0].toCharSpan()));
+            }
+            buffer.clear();
+            SC_TEST_EXPECT(not StringConverter::convertEncodingToUTF8(
+                StringView(text.toSpanConst(), false, StringEncoding::Utf16), buffer));
+        }
+    }
+}
+
+void SC::StringConverterTest::benchmark()
+{
+    constexpr size_t NumBytes      = 1024 * 1024;
+    constexpr size_t NumIterations = 100;
+
+    // Mostly ASCII (paths and identifiers), mostly CJK (sentences with CJK punctuation) and CJK in short runs
+    Buffer mostlyASCII, mostlyCJK, shortRunsCJK, utf16, utf8;
+    SC_TEST_EXPECT(buildText(mostlyASCII, NumBytes, 0));
+    const StringView sentence =
+        "\xE6\x97\xA5\xE6\x9C\xAC\xE8\xAA\x9E\xE3\x81\xAE\xE6\x96\x87\xE7\xAB\xA0"
+        "\xE3\x82\x92\xE5\xA4\x89\xE6\x8F\x9B\xE3\x81\x97\xE3\x81\xBE\xE3\x81\x99\xE3\x80\x82"
+        "\xE6\x97\xA5\xE6\x9C\xAC\xE8\xAA\x9E\xE3\x81\xAE\xE6\x96\x87\xE7\xAB\xA0"
+        "\xE3\x82\x92\xE5\xA4\x89\xE6\x8F\x9B\xE3\x81\x97\xE3\x81\xBE\xE3\x81\x99\xE3\x80\x82 (UTF-8) "_u8;
+    const StringView shortRun = "\xE6\x97\xA5\xE6\x9C\xAC\xE8\xAA\x9E\xE3\x81\xAE\xE6\x96\x87\xE7\xAB\xA0 "_u8;
+    while (mostlyCJK.size() < NumBytes)
+    {
+        SC_TEST_EXPECT(mostlyCJK.append(sentence.toCharSpan()));
+    }
+    while (shortRunsCJK.size() < NumBytes)
+    {
+        SC_TEST_EXPECT(shortRunsCJK.append(shortRun.toCharSpan()));
+    }
+
+    auto measure = [&](StringView name, const Buffer& source)
+    {
+        const StringView input(source.toSpanConst(), false, StringEncoding::Utf8);
+        StringView       converted16;
+        StringView       converted8;
+
+        Time::HighResolutionCounter start;
+        start.snap();
+        for (size_t iteration = 0; iteration < NumIterations; ++iteration)
+        {
+            utf16.clear();
+            SC_TEST_EXPECT(StringConverter::convertEncodingToUTF16(input, utf16, &converted16));
+        }
+        const auto toUTF16 = Time::HighResolutionCounter().snap().subtractExact(start).toNanoseconds();
+        start.snap();
+        for (size_t iteration = 0; iteration < NumIterations; ++iteration)
+        {
+            utf8.clear();
+            SC_TEST_EXPECT(StringConverter::convertEncodingToUTF8(converted16, utf8, &converted8));
+        }
+        const auto toUTF8 = Time::HighResolutionCounter().snap().subtractExact(start).toNanoseconds();
+        SC_TEST_EXPECT(converted8 == input);
+
+        const double numBytes = static_cast<double>(source.size() * NumIterations);
+        report.console.print("{} UTF8 -> UTF16: {:.2} GB/s\n", name, numBytes / static_cast<double>(toUTF16.ns));
+        report.console.print("{} UTF16 -> UTF8: {:.2} GB/s\n", name, numBytes / static_cast<double>(toUTF8.ns));
+    };
+    measure("Mostly ASCII", mostlyASCII);
+    measure("Mostly CJK", mostlyCJK);
+    measure("Short CJK runs", shortRunsCJK);
+}
 namespace SC
 {
 void runStringConverterTest(SC::TestReport& report) { StringConverterTest test(report); }
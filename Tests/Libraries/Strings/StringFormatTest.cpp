@@ -4,6 +4,7 @@
 #include "Libraries/Strings/String.h"
 #include "Libraries/Strings/StringBuilder.h"
 #include "Libraries/Testing/Testing.h"
+#include "Libraries/Time/Time.h"
 
 namespace SC
 {
@@ -122,9 +123,136 @@ struct SC::StringFormatTest : public SC::TestCase
             SC_TEST_EXPECT(builder.format("{0:.2}_{1}_{0:.4}", 1.2222, "salve"));
             SC_TEST_EXPECT(buffer == "1.22_salve_1.2222");
         }
+        if (test_section("compiled format string"))
+        {
+            compiledFormatString();
+        }
+        if (test_section("compiled format string reserve"))
+        {
+            compiledFormatStringReserve();
+        }
+        if (test_section("StringFormat benchmark", Execute::OnlyExplicit))
+        {
+            benchmark();
+        }
     }
+
+    void compiledFormatString();
+    void compiledFormatStringReserve();
+    void benchmark();
 };
 
+// Invalid format strings (and wrong number of arguments) are detected at compile time
+static_assert(SC::StringFormatParser::countSegments("{") == -1, "");
+static_assert(SC::StringFormatParser::countSegments("}") == -1, "");
+static_assert(SC::StringFormatParser::countSegments("{}}}}") == -1, "");
+static_assert(SC::StringFormatParser::countSegments("{a}") == -1, "");
+static_assert(SC::StringFormatParser::countSegments("") == 0, "");
+static_assert(SC::StringFormatParser::countSegments("{{{}}}-{{{}}}") == 6, "");
+static_assert(SC::StringFormatParser::countArguments("{{{}}}-{{{}}}") == 2, "");
+static_assert(SC::StringFormatParser::countArguments("{1}_{0}_{1}") == 2, "");
+static_assert(SC::StringFormatParser::countArguments("{3:.2}") == 4, "");
+
+void SC::StringFormatTest::compiledFormatString()
+{
+    String        buffer(StringEncoding::Ascii);
+    StringBuilder builder(buffer);
+    SC_TEST_EXPECT(builder.format(SC_STRING_FORMAT("")));
+    SC_TEST_EXPECT(buffer.isEmpty());
+    SC_TEST_EXPECT(builder.format(SC_STRING_FORMAT("asd")));
+    SC_TEST_EXPECT(buffer == "asd");
+    SC_TEST_EXPECT(builder.format(SC_STRING_FORMAT("{}{{{{"), 1));
+    SC_TEST_EXPECT(buffer == "1{{");
+    SC_TEST_EXPECT(builder.format(SC_STRING_FORMAT("{}}}}}"), 1));
+    SC_TEST_EXPECT(buffer == "1}}");
+    SC_TEST_EXPECT(builder.format(SC_STRING_FORMAT("{{{}}}-{{{}}}"), 1, 2));
+    SC_TEST_EXPECT(buffer == "{1}-{2}");
+    SC_TEST_EXPECT(builder.format(SC_STRING_FORMAT("_{}_TEXT_{}"), 123, 12.4));
+    SC_TEST_EXPECT(buffer == "_123_TEXT_12.400000");
+    SC_TEST_EXPECT(builder.format(SC_STRING_FORMAT("{1}_{0}_{1}"), 1, 0));
+    SC_TEST_EXPECT(buffer == "0_1_0");
+    SC_TEST_EXPECT(builder.format(SC_STRING_FORMAT("{0:.2}_{1}_{0:.4}"), 1.2222, "salve"));
+    SC_TEST_EXPECT(buffer == "1.22_salve_1.2222");
+    SC_TEST_EXPECT(builder.append(SC_STRING_FORMAT("_{}_{}_{}"), String("asd"), StringView("sv"), 'c'));
+    SC_TEST_EXPECT(buffer == "1.22_salve_1.2222_asd_sv_c");
+    SC_TEST_EXPECT(builder.format(SC_STRING_FORMAT("__{}__{}__"), static_cast<uint64_t>(MaxValue()), true));
+    SC_TEST_EXPECT(buffer == "__18446744073709551615__true__");
+
+    // A failing argument leaves destination as it was
+    SC_TEST_EXPECT(not builder.append(SC_STRING_FORMAT("{:200}"), 1));
+    SC_TEST_EXPECT(buffer == "__18446744073709551615__true__");
+
+    // Literal chunks are UTF8 and they're converted when formatting to a UTF16 destination
+    String        buffer16(StringEncoding::Utf16);
+    StringBuilder builder16(buffer16);
+    SC_TEST_EXPECT(builder16.format(SC_STRING_FORMAT("\xE6\x97\xA5 {} {}"), 1, "\xE6\x9C\xAC"_u8));
+    SC_TEST_EXPECT(buffer16 == "\xE6\x97\xA5 1 \xE6\x9C\xAC"_u8);
+}
+
+void SC::StringFormatTest::compiledFormatStringReserve()
+{
+    // Destination is reserved once with an upper bound of the formatted length
+    Buffer        data;
+    StringBuilder builder(data, StringEncoding::Utf8, StringBuilder::Clear);
+    const auto&   fmt = SC_STRING_FORMAT("[{}] {} {:.3} {}"); // 5 bytes of literal chunks
+
+    const size_t maxLength = StringFormat<StringIteratorASCII>::maxLength(fmt, int32_t(-1), "file.txt", 1.5, false);
+    SC_TEST_EXPECT(maxLength == 5 + 11 + 8 + 98 + 5);
+    SC_TEST_EXPECT(builder.format(fmt, int32_t(-1), "file.txt", 1.5, false));
+    SC_TEST_EXPECT(StringView(data.toSpanConst(), true, StringEncoding::Utf8) == "[-1] file.txt 1.500 false\0");
+    SC_TEST_EXPECT(data.capacity() >= maxLength + 1);
+
+    // Integers without a specifier get their maximum number of digits
+    const size_t maxNumbers = StringFormat<StringIteratorASCII>::maxLength(fmt, int8_t(-1), uint64_t(1), 1.5f, 'c');
+    SC_TEST_EXPECT(maxNumbers == 5 + 4 + 20 + 98 + 1);
+    SC_TEST_EXPECT(builder.format(fmt, int8_t(-128), uint64_t(MaxValue()), -1.5f, 'c'));
+    SC_TEST_EXPECT(data.size() - 1 <= maxNumbers);
+
+    // Inline buffers are not moved to the heap when the upper bound exceeds their capacity but the result fits
+    SmallBuffer<64> small;
+    StringBuilder   smallBuilder(small, StringEncoding::Ascii, StringBuilder::Clear);
+    SC_TEST_EXPECT(StringFormat<StringIteratorASCII>::maxLength(fmt, 1, "a", 1.5, 2.5) > 64);
+    SC_TEST_EXPECT(smallBuilder.format(fmt, 1, "a", 1.5, 2.5));
+    SC_TEST_EXPECT(StringView(small.toSpanConst(), true, StringEncoding::Ascii) == "[1] a 1.500 2.500000\0");
+    SC_TEST_EXPECT(small.isInline());
+}
+
+void SC::StringFormatTest::benchmark()
+{
+    constexpr size_t NumIterations = 1000000;
+
+    // Formats a log line (replacing the previous one) with the runtime parsed and the compile time parsed format
+    String        buffer(StringEncoding::Utf8);
+    StringBuilder builder(buffer);
+    const auto&   compiled = SC_STRING_FORMAT("[{}] {}:{} request \"{}\" completed in {:.2} ms (status {})");
+
+    const StringView file = "Libraries/Http/HttpServer.cpp";
+    const StringView path = "/api/v1/items?id=1234";
+
+    Time::HighResolutionCounter start;
+    start.snap();
+    for (size_t idx = 0; idx < NumIterations; ++idx)
+    {
+        SC_TEST_EXPECT(builder.format("[{}] {}:{} request \"{}\" completed in {:.2} ms (status {})", idx, file, 123,
+                                      path, 12.5, 200));
+    }
+    const auto runtime = Time::HighResolutionCounter().snap().subtractExact(start).toNanoseconds();
+    String     expected;
+    SC_TEST_EXPECT(expected.assign(buffer.view()));
+    start.snap();
+    for (size_t idx = 0; idx < NumIterations; ++idx)
+    {
+        SC_TEST_EXPECT(builder.format(compiled, idx, file, 123, path, 12.5, 200));
+    }
+    const auto compileTime = Time::HighResolutionCounter().snap().subtractExact(start).toNanoseconds();
+    SC_TEST_EXPECT(buffer == expected.view());
+
+    const double iterations = static_cast<double>(NumIterations);
+    report.console.print("Runtime format string: {:.1} ns / line\n", static_cast<double>(runtime.ns) / iterations);
+    report.console.print(SC_STRING_FORMAT("Compile time format string: {:.1} ns / line\n"),
+                         static_cast<double>(compileTime.ns) / iterations);
+}
+
 namespace SC
 {
 void runStringFormatTest(SC::TestReport& report) { StringFormatTest test(report); }
@@ -2,7 +2,10 @@
 // SPDX-License-Identifier: MIT
 #include "Libraries/Strings/StringView.h"
 #include "Libraries/Algorithms/AlgorithmBubbleSort.h"
+#include "Libraries/Containers/Vector.h"
+#include "Libraries/Foundation/LibC.h" // memcpy, memchr, memset
 #include "Libraries/Testing/Testing.h"
+#include "Libraries/Time/Time.h"
 
 namespace SC
 {
@@ -338,9 +341,362 @@ struct SC::StringViewTest : public SC::TestCase
             SC_TEST_EXPECT(s3 == "");
             SC_TEST_EXPECT(s3.isEmpty());
         }
+        if (test_section("search long strings"))
+        {
+            searchLongStrings();
+        }
+        if (test_section("isValidEncoding"))
+        {
+            validEncoding();
+        }
+        if (test_section("StringView benchmark", Execute::OnlyExplicit))
+        {
+            benchmark();
+        }
+    }
+
+    void searchLongStrings();
+    void validEncoding();
+    void benchmark();
+
+    // Reference implementations used to check the vectorized search paths
+    static ssize_t naiveFind(const char* text, size_t textLength, const char* pattern, size_t patternLength)
+    {
+        for (size_t idx = 0; idx + patternLength <= textLength; ++idx)
+        {
+            if (memcmp(text + idx, pattern, patternLength) == 0)
+                return static_cast<ssize_t>(idx);
+        }
+        return -1;
+    }
+
+    static ssize_t naiveFindAny(const char* text, size_t textLength, const char* set, size_t setLength)
+    {
+        for (size_t idx = 0; idx < textLength; ++idx)
+        {
+            if (memchr(set, text[idx], setLength) != nullptr)
+                return static_cast<ssize_t>(idx);
+        }
+        return -1;
+    }
+
+    static ssize_t naiveReverseFindAny(const char* text, size_t textLength, const char* set, size_t setLength)
+    {
+        for (size_t idx = textLength; idx > 0; --idx)
+        {
+            if (memchr(set, text[idx - 1], setLength) != nullptr)
+                return static_cast<ssize_t>(idx - 1);
+        }
+        return -1;
     }
 };
 
+void SC::StringViewTest::searchLongStrings()
+{
+    // Lengths and offsets cross the 16 and 32 bytes boundaries of the vector loops and their scalar tails
+    constexpr size_t BufferSize = 160;
+
+    char buffer[BufferSize];
+    for (size_t idx = 0; idx < BufferSize; ++idx)
+    {
+        buffer[idx] = static_cast<char>('a' + (idx * 7 + idx / 5) % 4); // Only 'a', 'b', 'c' and 'd'
+    }
+
+    // containsString / splitAfter / splitBefore
+    const char* patterns[] = {"x", "dcb", "xyz", "ab", "abca", "dabcdaab"};
+    for (size_t offset = 0; offset < 40; ++offset)
+    {
+        for (size_t length = 0; length + offset <= BufferSize; ++length)
+        {
+            char text[BufferSize];
+            memcpy(text, buffer, BufferSize);
+            // Place a needle at a few positions that depend on length
+            if (length > 3)
+            {
+                memcpy(text + offset + (length * 5) % (length - 2), "xyz", 3);
+            }
+            const StringView textView({text + offset, length}, false, StringEncoding::Ascii);
+            for (const char* pattern : patterns)
+            {
+                const StringView patternView = StringView::fromNullTerminated(pattern, StringEncoding::Ascii);
+
+                const ssize_t expected = naiveFind(text + offset, length, pattern, patternView.sizeInBytes());
+                SC_TEST_EXPECT(textView.containsString(patternView) == (expected >= 0));
+
+                StringView before, after;
+                if (textView.splitBefore(patternView, before) and textView.splitAfter(patternView, after))
+                {
+                    SC_TEST_EXPECT(expected >= 0);
+                    SC_TEST_EXPECT(before.sizeInBytes() == static_cast<size_t>(expected));
+                    const size_t afterSize = length - static_cast<size_t>(expected) - patternView.sizeInBytes();
+                    SC_TEST_EXPECT(after.sizeInBytes() == afterSize);
+                }
+                else
+                {
+                    SC_TEST_EXPECT(expected < 0);
+                }
+            }
+        }
+    }
+
+    // advanceUntilMatchesAny / reverseAdvanceUntilMatchesAny with a growing number of separators
+    const StringCodePoint separators[]      = {'x', 'y', 'z', ',', ';', ':', '|', '/'};
+    const char            separatorsChars[] = {'x', 'y', 'z', ',', ';', ':', '|', '/'};
+    for (size_t numSeparators = 1; numSeparators <= sizeof(separators) / sizeof(separators[0]); ++numSeparators)
+    {
+        for (size_t length = 0; length <= BufferSize; ++length)
+        {
+            char text[BufferSize];
+            memcpy(text, buffer, BufferSize);
+            if (length > 0)
+            {
+                text[(length * 7) / 11] = separatorsChars[length % numSeparators];
+                text[(length * 5) / 6]  = separatorsChars[(length + 1) % numSeparators];
+            }
+            const StringView textView({text, length}, false, StringEncoding::Ascii);
+            const ssize_t    expected        = naiveFindAny(text, length, separatorsChars, numSeparators);
+            const ssize_t    expectedReverse = naiveReverseFindAny(text, length, separatorsChars, numSeparators);
+
+            StringIteratorASCII it = textView.getIterator<StringIteratorASCII>();
+            StringCodePoint     matched;
+            SC_TEST_EXPECT(it.advanceUntilMatchesAny({separators, numSeparators}, matched) == (expected >= 0));
+            if (expected >= 0)
+            {
+                SC_TEST_EXPECT(it.bytesDistanceFrom(textView.getIterator<StringIteratorASCII>()) == expected);
+                SC_TEST_EXPECT(matched == static_cast<StringCodePoint>(text[expected]));
+            }
+            else
+            {
+                SC_TEST_EXPECT(it.isAtEnd());
+            }
+
+            it.setToEnd();
+            SC_TEST_EXPECT(it.reverseAdvanceUntilMatchesAny({separators, numSeparators}, matched) ==
+                           (expectedReverse >= 0));
+            if (expectedReverse >= 0)
+            {
+                SC_TEST_EXPECT(it.bytesDistanceFrom(textView.getIterator<StringIteratorASCII>()) == expectedReverse);
+                SC_TEST_EXPECT(matched == static_cast<StringCodePoint>(text[expectedReverse]));
+            }
+            else
+            {
+                SC_TEST_EXPECT(it.isAtStart());
+            }
+
+            // Tokenizer must produce the same components of a naive split
+            size_t              numComponents = 0;
+            size_t              numBytes      = 0;
+            StringViewTokenizer tokenizer(textView);
+            while (tokenizer.tokenizeNext({separators, numSeparators}, StringViewTokenizer::IncludeEmpty))
+            {
+                SC_TEST_EXPECT(naiveFindAny(tokenizer.component.bytesWithoutTerminator(),
+                                            tokenizer.component.sizeInBytes(), separatorsChars, numSeparators) < 0);
+                numBytes += tokenizer.component.sizeInBytes();
+                numComponents++;
+            }
+            size_t expectedSeparators = 0;
+            for (size_t idx = 0; idx < length; ++idx)
+            {
+                expectedSeparators += memchr(separatorsChars, text[idx], numSeparators) != nullptr ? 1 : 0;
+            }
+            SC_TEST_EXPECT(numBytes + expectedSeparators == length);
+        }
+    }
+
+    // UTF8 multi-byte code points are matched as whole sequences and never in the middle of another sequence
+    StringView utf8 = "\xc3\xa0\xc3\xa8 \xe6\x97\xa5\xe6\x9c\xac \xc3\xa0\xc3\xa8 \xe6\x97\xa5\xe6\x9c\xac "
+                      "\xc3\xa0\xc3\xa8 \xe6\x97\xa5\xe6\x9c\xac"_u8;
+    StringView split;
+    SC_TEST_EXPECT(utf8.containsString("\xe6\x9c\xac \xc3\xa0"_u8));
+    SC_TEST_EXPECT(not utf8.containsString("\xe6\x9c\xac\xc3\xa0"_u8));
+    SC_TEST_EXPECT(utf8.splitAfter("\xe6\x97\xa5\xe6\x9c\xac \xc3\xa0"_u8, split));
+    SC_TEST_EXPECT(split.sizeInBytes() == utf8.sizeInBytes() - 14);
+
+    StringViewTokenizer tokenizer(utf8);
+    size_t              numTokens = 0;
+    while (tokenizer.tokenizeNext({' ', 0x65E5}, StringViewTokenizer::SkipEmpty)) // Non ASCII separator
+    {
+        numTokens++;
+    }
+    SC_TEST_EXPECT(numTokens == 6);
+
+    auto it = utf8.getIterator<StringIteratorUTF8>();
+    it.setToEnd();
+    SC_TEST_EXPECT(it.reverseAdvanceUntilMatches(' '));
+    SC_TEST_EXPECT(it.bytesDistanceFrom(utf8.getIterator<StringIteratorUTF8>()) ==
+                   static_cast<ssize_t>(utf8.sizeInBytes()) - 7);
+}
+
+void SC::StringViewTest::validEncoding()
+{
+    SC_TEST_EXPECT(StringView("\xc3\xa0"_u8).isValidEncoding());
+    SC_TEST_EXPECT(not StringView("\xc0\xaf"_u8).isValidEncoding()); // Overlong '/'
+    SC_TEST_EXPECT(StringView(""_u8).isValidEncoding());
+    SC_TEST_EXPECT(StringView("plain ascii"_a8).isValidEncoding());
+    SC_TEST_EXPECT(not StringView("\xc3\xa0"_a8).isValidEncoding());
+    SC_TEST_EXPECT(StringView("\xe6\x97\xa5\xf0\x9f\x98\x80\x7f"_u8).isValidEncoding()); // U+65E5, U+1F600
+    SC_TEST_EXPECT(StringView("\xf4\x8f\xbf\xbf"_u8).isValidEncoding());                   // U+10FFFF
+    SC_TEST_EXPECT(not StringView("\xf4\x90\x80\x80"_u8).isValidEncoding());               // U+110000
+    SC_TEST_EXPECT(not StringView("\xe0\x80\xaf"_u8).isValidEncoding());                    // Overlong 3 bytes
+    SC_TEST_EXPECT(not StringView("\xf0\x80\x80\xaf"_u8).isValidEncoding());               // Overlong 4 bytes
+    SC_TEST_EXPECT(not StringView("\xed\xa0\x80"_u8).isValidEncoding());                    // U+D800 surrogate
+    SC_TEST_EXPECT(not StringView("\xe6\x97"_u8).isValidEncoding());                         // Truncated
+    SC_TEST_EXPECT(not StringView("\x97\xa5"_u8).isValidEncoding());                         // Lone continuation
+    SC_TEST_EXPECT(not StringView("\xf8\x88\x80\x80\x80"_u8).isValidEncoding());          // 5 bytes form
+    SC_TEST_EXPECT(not StringView("\xff"_u8).isValidEncoding());
+
+    // Invalid sequences are found after long ASCII runs skipped by the vector loop
+    char text[100];
+    memset(text, 'a', sizeof(text));
+    for (size_t position = 0; position + 2 <= sizeof(text); ++position)
+    {
+        memcpy(text + position, "\xc3\xa0", 2);
+        SC_TEST_EXPECT(StringView({text, sizeof(text)}, false, StringEncoding::Utf8).isValidEncoding());
+        SC_TEST_EXPECT(not StringView({text, position + 1}, false, StringEncoding::Utf8).isValidEncoding());
+        text[position + 1] = 'a';
+        SC_TEST_EXPECT(not StringView({text, sizeof(text)}, false, StringEncoding::Utf8).isValidEncoding());
+        text[position] = 'a';
+    }
+
+    SC_TEST_EXPECT(StringView("a\0"_u16).isValidEncoding());
+    SC_TEST_EXPECT(StringView("\x3d\xd8\x00\xde"_u16).isValidEncoding());   // U+1F600 surrogate pair
+    SC_TEST_EXPECT(not StringView("\x3d\xd8\x61\x00"_u16).isValidEncoding()); // Unpaired high surrogate
+    SC_TEST_EXPECT(not StringView("\x00\xde\x61\x00"_u16).isValidEncoding()); // Unpaired low surrogate
+    SC_TEST_EXPECT(not StringView("\x3d\xd8"_u16).isValidEncoding());         // Truncated pair
+    SC_TEST_EXPECT(not StringView({"abc", 3}, false, StringEncoding::Utf16).isValidEncoding());
+}
+
+void SC::StringViewTest::benchmark()
+{
+    constexpr size_t NumIterations = 200;
+
+    // Log-line workload: lines with a timestamp, a level and a message
+    const StringView logLines[] = {
+        "2024-03-11T10:12:54.123Z INFO  [http] GET /api/v1/items?page=3 200 12ms remote=10.0.0.12\n",
+        "2024-03-11T10:12:54.131Z WARN  [db] slow query: SELECT * FROM items WHERE owner_id = 44 took 230ms\n",
+        "2024-03-11T10:12:54.164Z ERROR [http] POST /api/v1/upload 500 1043ms remote=10.0.0.31 reason=timeout\n",
+        "2024-03-11T10:12:54.201Z DEBUG [cache] evicted 128 entries from region 'sessions' (capacity 4096)\n",
+    };
+    // Header-parsing workload: a typical HTTP request head
+    const StringView headers = "Host: example.com\r\n"
+                               "User-Agent: Mozilla/5.0 (X11; Linux x86_64; rv:123.0) Gecko/20100101 Firefox/123.0\r\n"
+                               "Accept: text/html,application/xhtml+xml,application/xml;q=0.9,*/*;q=0.8\r\n"
+                               "Accept-Language: en-US,en;q=0.5\r\n"
+                               "Accept-Encoding: gzip, deflate, br\r\n"
+                               "Connection: keep-alive\r\n"
+                               "Cookie: session=4f2a9c0e7d1b42f5a3c9e8d7b6a5f4e3; theme=dark; consent=accepted\r\n"
+                               "Upgrade-Insecure-Requests: 1\r\n"
+                               "Cache-Control: max-age=0\r\n\r\n";
+
+    constexpr size_t MaxTextSize = 1024 * 1024;
+
+    Vector<char> logText;
+    Vector<char> headersText;
+    Vector<char> utf8Text;
+    for (size_t idx = 0; logText.size() + 128 < MaxTextSize; ++idx)
+    {
+        SC_TEST_EXPECT(logText.append(logLines[idx % 4].toCharSpan()));
+    }
+    while (headersText.size() + headers.sizeInBytes() < MaxTextSize)
+    {
+        SC_TEST_EXPECT(headersText.append(headers.toCharSpan()));
+    }
+    const StringView mixed = "Gr\xc3\xbc\xc3\x9f"
+                             "e, \xe6\x97\xa5\xe6\x9c\xac\xe8\xaa\x9e text with mostly ASCII content and "
+                             "a few multibyte sequences. "_u8;
+    while (utf8Text.size() + mixed.sizeInBytes() < MaxTextSize)
+    {
+        SC_TEST_EXPECT(utf8Text.append(mixed.toCharSpan()));
+    }
+    const StringView logView({logText.data(), logText.size()}, false, StringEncoding::Ascii);
+    const StringView headersView({headersText.data(), headersText.size()}, false, StringEncoding::Ascii);
+    const StringView utf8View({utf8Text.data(), utf8Text.size()}, false, StringEncoding::Utf8);
+
+    auto measure = [&](StringView name, size_t numBytes, auto func)
+    {
+        size_t                      checksum = 0;
+        Time::HighResolutionCounter start;
+        start.snap();
+        for (size_t iteration = 0; iteration < NumIterations; ++iteration)
+        {
+            checksum += func();
+        }
+        const auto   elapsed = Time::HighResolutionCounter().snap().subtractExact(start).toNanoseconds();
+        const double gbPerSecond =
+            static_cast<double>(numBytes * NumIterations) / static_cast<double>(elapsed.ns > 0 ? elapsed.ns : 1);
+        report.console.print("{}: {:.2} GB/s (checksum {})\n", name, gbPerSecond, checksum);
+    };
+
+    measure("Log lines tokenizeNextLine + containsString", logView.sizeInBytes(),
+            [&]()
+            {
+                size_t              numErrors = 0;
+                StringViewTokenizer lines(logView);
+                while (lines.tokenizeNextLine())
+                {
+                    numErrors += lines.component.containsString(" ERROR ") ? 1 : 0;
+                }
+                return numErrors;
+            });
+    measure("Log lines splitAfter + tokenizeNext", logView.sizeInBytes(),
+            [&]()
+            {
+                size_t              numFields = 0;
+                StringViewTokenizer lines(logView);
+                while (lines.tokenizeNextLine())
+                {
+                    StringView message;
+                    if (lines.component.splitAfter("] ", message))
+                    {
+                        StringViewTokenizer fields(message);
+                        while (fields.tokenizeNext({' ', '=', ','}))
+                        {
+                            numFields++;
+                        }
+                    }
+                }
+                return numFields;
+            });
+    measure("Log lines containsString (not found)", logView.sizeInBytes(),
+            [&]() { return logView.containsString("FATAL") ? size_t(1) : size_t(0); });
+    measure("HTTP headers tokenize + splitBefore / splitAfter", headersView.sizeInBytes(),
+            [&]()
+            {
+                size_t              valuesLength = 0;
+                StringViewTokenizer lines(headersView);
+                while (lines.tokenizeNext({'\r', '\n'}))
+                {
+                    StringView name, value;
+                    if (lines.component.splitBefore(": ", name) and lines.component.splitAfter(": ", value))
+                    {
+                        valuesLength += value.sizeInBytes() + name.sizeInBytes();
+                    }
+                }
+                return valuesLength;
+            });
+    measure("Reverse find last separator per header", headersView.sizeInBytes(),
+            [&]()
+            {
+                size_t              total = 0;
+                StringViewTokenizer lines(headersView);
+                while (lines.tokenizeNext({'\r', '\n'}))
+                {
+                    const auto start = lines.component.getIterator<StringIteratorASCII>();
+
+                    auto it = start;
+                    it.setToEnd();
+                    StringCodePoint matched;
+                    if (it.reverseAdvanceUntilMatchesAny({';', ','}, matched))
+                    {
+                        total += static_cast<size_t>(it.bytesDistanceFrom(start));
+                    }
+                }
+                return total;
+            });
+    measure("UTF-8 isValidEncoding", utf8View.sizeInBytes(),
+            [&]() { return utf8View.isValidEncoding() ? size_t(1) : size_t(0); });
+}
+
 namespace SC
 {
 void runStringViewTest(SC::TestReport& report) { StringViewTest test(report); }
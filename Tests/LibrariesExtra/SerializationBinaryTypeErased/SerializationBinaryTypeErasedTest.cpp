@@ -16,9 +16,49 @@ struct SC::SerializationBinaryTypeErasedTest : public SC::SerializationSuiteTest
     {
         runSameVersionTests<SerializationBinaryTypeErased, SerializationBinaryTypeErased>();
         runVersionedTests<SerializationBinaryTypeErased, SerializationBinaryTypeErased, Reflection::SchemaTypeErased>();
+        if (test_section("Conversion plan cache"))
+        {
+            conversionPlanCache();
+        }
     }
+
+    void conversionPlanCache();
 };
 
+void SC::SerializationBinaryTypeErasedTest::conversionPlanCache()
+{
+    using namespace SerializationSuiteTest;
+    VersionedRecords1 objectToSerialize;
+    SC_TEST_EXPECT(objectToSerialize.records.push_back({1, 1.5f, 2}));
+    SC_TEST_EXPECT(objectToSerialize.records.push_back({2, 2.5f, 3}));
+    Buffer buffer;
+    SC_TEST_EXPECT(SerializationBinaryTypeErased::write(objectToSerialize, buffer));
+    //! [typeErasedPlanSnippet]
+    constexpr auto schema = Reflection::SchemaTypeErased::compile<VersionedRecords1>();
+
+    // Conversion plan is compiled by the first load and reused by all loads from buffers with the same schema
+    SerializationBinaryTypeErasedPlanCache plans;
+    for (int idx = 0; idx < 3; ++idx)
+    {
+        VersionedRecords2 deserializedObject;
+        SC_TEST_EXPECT(SerializationBinaryTypeErased::loadVersioned(deserializedObject, buffer.toSpanConst(),
+                                                                    schema.typeInfos, plans));
+        SC_TEST_EXPECT(deserializedObject.records.size() == 2 and deserializedObject.records[1].flags == 3);
+    }
+    SC_TEST_EXPECT(plans.getNumberOfPlans() == 1);
+    //! [typeErasedPlanSnippet]
+
+    // Different options produce a different plan
+    VersionedRecords2          deserializedObject;
+    SerializationBinaryOptions options;
+    options.allowDropExcessStructMembers = false;
+    SC_TEST_EXPECT(not SerializationBinaryTypeErased::loadVersioned(deserializedObject, buffer.toSpanConst(),
+                                                                    schema.typeInfos, plans, options));
+    SC_TEST_EXPECT(plans.getNumberOfPlans() == 1); // fieldToRemove cannot be dropped so no plan is compiled
+    plans.clear();
+    SC_TEST_EXPECT(plans.getNumberOfPlans() == 0);
+}
+
 namespace SC
 {
 void runSerializationBinaryTypeErasedTest(SC::TestReport& report) { SerializationBinaryTypeErasedTest test(report); }
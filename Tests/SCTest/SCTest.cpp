@@ -15,6 +15,7 @@ void runVirtualMemoryTest(TestReport& report);
 void runFunctionTest(TestReport& report);
 void runUniqueHandleTest(TestReport& report);
 void runGlobalsTest(TestReport& report);
+void runSlabAllocatorTest(TestReport& report);
 
 // Foundation Extra
 void runTaggedUnionTest(TestReport& report);
@@ -27,6 +28,7 @@ void runSmallVectorTest(TestReport& report);
 void runVectorMapTest(TestReport& report);
 void runVectorSetTest(TestReport& report);
 void runVectorTest(TestReport& report);
+void runVirtualVectorTest(TestReport& report);
 void runGlobalsContainerTest(TestReport& report);
 
 // File
@@ -73,6 +75,7 @@ void runSocketTest(TestReport& report);
 
 // Strings
 void runConsoleTest(TestReport& report);
+void runLoggerTest(TestReport& report);
 void runStringTest(TestReport& report);
 void runStringConverterTest(TestReport& report);
 void runStringBuilderTest(TestReport& report);
@@ -93,6 +96,10 @@ void runAsyncTest(SC::TestReport& report);
 void runAsyncStreamTest(SC::TestReport& report);
 void runAsyncRequestStreamTest(SC::TestReport& report);
 void runZLibStreamTest(TestReport& report);
+void runZLibTransformStreamsTest(TestReport& report);
+void runLZ4StreamTest(TestReport& report);
+void runParallelTransformStreamsTest(TestReport& report);
+void runHashingTransformStreamsTest(TestReport& report);
 
 // Support
 void runDebugVisualizersTest(TestReport& report);
@@ -149,6 +156,7 @@ int main(int argc, const char* argv[])
     runVirtualMemoryTest(report);
     runUniqueHandleTest(report);
     runGlobalsTest(report);
+    runSlabAllocatorTest(report);
 
     // Containers tests
     runArenaMapTest(report);
@@ -158,6 +166,7 @@ int main(int argc, const char* argv[])
     runVectorTest(report);
     runVectorMapTest(report);
     runVectorSetTest(report);
+    runVirtualVectorTest(report);
     runGlobalsContainerTest(report);
 
     // Foundation extra tests
@@ -213,6 +222,7 @@ int main(int argc, const char* argv[])
     runStringFormatTest(report);
     runStringTest(report);
     runStringViewTest(report);
+    runLoggerTest(report);
 
     // Time tests
     runTimeTest(report);
@@ -228,6 +238,10 @@ int main(int argc, const char* argv[])
     runAsyncStreamTest(report);
     runAsyncRequestStreamTest(report);
     runZLibStreamTest(report);
+    runZLibTransformStreamsTest(report);
+    runLZ4StreamTest(report);
+    runParallelTransformStreamsTest(report);
+    runHashingTransformStreamsTest(report);
 
     // DebugVisualizers tests
     runDebugVisualizersTest(report);
@@ -72,6 +72,12 @@ constexpr StringView INTERMEDIATES_SUBDIR = "_Intermediates";
     action.parameters.generator = Build::Generator::Make;
     action.parameters.platform  = Build::Platform::Apple;
     SC_TRY_MSG(Build::executeAction(action), "Build error Makefile (Apple)");
+    action.parameters.generator = Build::Generator::Ninja;
+    action.parameters.platform  = Build::Platform::Linux;
+    SC_TRY_MSG(Build::executeAction(action), "Build error Ninja (Linux)");
+    action.parameters.generator = Build::Generator::Ninja;
+    action.parameters.platform  = Build::Platform::Apple;
+    SC_TRY_MSG(Build::executeAction(action), "Build error Ninja (Apple)");
     return Result(true);
 }
 
@@ -119,6 +125,14 @@ constexpr StringView INTERMEDIATES_SUBDIR = "_Intermediates";
         {
             action.parameters.generator = Build::Generator::Make;
         }
+        else if (arguments.arguments[2] == "ninja")
+        {
+            action.parameters.generator = Build::Generator::Ninja;
+        }
+        else if (arguments.arguments[2] == "native")
+        {
+            action.parameters.generator = Build::Generator::Native;
+        }
         else if (arguments.arguments[2] == "vs2022")
         {
             action.parameters.generator = Build::Generator::VisualStudio2022;
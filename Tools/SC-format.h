@@ -64,10 +64,7 @@ struct ProcessLimiter
         {
             availableProcessMonitors.queueBack(processMonitors[idx]);
         }
-        // TODO: Investigate why ProcessLimiter fails on uring backend
-        AsyncEventLoop::Options options;
-        options.apiType = AsyncEventLoop::Options::ApiType::ForceUseEpoll;
-        return eventLoop.create(options);
+        return eventLoop.create();
     }
 
     /// @brief Waits for any process still running and free the resources created by event loop